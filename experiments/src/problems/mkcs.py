@@ -17,6 +17,9 @@ class MkcsInstance:
 class MkcsModel:
     """Maximum k-colored subgraph problem"""
 
+    # Attributes that hold the variables of the model, see `snapshot.PresolvedSnapshot`
+    VARIABLE_MAPS = ('x',)
+
     def __init__(self, instance: MkcsInstance):
         self.graph = instance.graph
         self.k = instance.k
@@ -102,6 +102,9 @@ class MucpInstance:
 class MucpBasicModel:
     """Basic IP model for min-up/min-down unit commitment problem."""
 
+    # Attributes that hold the variables of the model, see `snapshot.PresolvedSnapshot`
+    VARIABLE_MAPS = ('x', 'u', 'p')
+
     def __init__(self, instance: MucpInstance):
         """Initializes the model.
         """
@@ -320,14 +323,12 @@ class MucpBasicModel:
         if (s := self.scip.getStatus()) != 'optimal':
             raise ValueError(f'Problem status is not "optimal" (status is {s})')
 
-        sol = self.scip.getBestSol()
         p = self.p
+        vals = self.scip.getVals([p[t, j] for j, _ in self.units for t in self.time_horizon])
+        vals = vals.reshape(-1, len(self.time_horizon))
 
         print(tabulate(
-            [
-                [None if self.scip.isZero(v := sol[p[t, j]]) else v for t in self.time_horizon]
-                for j, _ in self.units
-            ],
+            [[None if self.scip.isZero(v) else v for v in row] for row in vals],
             headers=self.time_horizon,
             showindex=(j for j, _ in self.units),
         ))
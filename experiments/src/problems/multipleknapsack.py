@@ -47,6 +47,9 @@ class MultipleKnapsackInstance:
 
 
 class MultipleKnapsackModel:
+    # Attributes that hold the variables of the model, see `snapshot.PresolvedSnapshot`
+    VARIABLE_MAPS = ('x',)
+
     def __init__(self, instance: MultipleKnapsackInstance):
         self.instance = instance
 
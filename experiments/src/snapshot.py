@@ -0,0 +1,136 @@
+"""
+Presolved model snapshots that can be shared between the variants of one instance.
+
+The base model of an instance is built and presolved once, and the transformed problem is written to a CIP file,
+together with a small index that records which variable of the model is stored under which name. Every variant then
+reads these files instead of rebuilding and re-presolving the model, and maps the variables of the model back by name,
+such that the variant's orbitopes and activation handlers can be added as usual.
+
+Note that the snapshot is presolved with different settings than a model that is solved directly: symmetry handling
+and all dual reductions (misc/allowstrongdualreds and misc/allowweakdualreds) are switched off, see
+`PresolvedSnapshot.write`. Presolving is therefore weaker than with the default settings, and runs with snapshots are
+not directly comparable to runs without them. The variants solve the snapshot with default settings again.
+"""
+import json
+import os
+import tempfile
+from collections.abc import Mapping
+
+from pyscipopt import Model
+from pyscipopt.scip import Variable
+
+# Prefix that SCIP gives to the names of transformed variables
+TRANSFORMED_PREFIX = 't_'
+
+
+def _write_atomic(path: str, write) -> None:
+    """Writes a file through `write(tmppath)`, such that runs started in parallel never read a partial file."""
+    directory = os.path.dirname(os.path.abspath(path))
+    os.makedirs(directory, exist_ok=True)
+    fd, tmppath = tempfile.mkstemp(suffix=os.path.splitext(path)[1], dir=directory)
+    os.close(fd)
+    try:
+        write(tmppath)
+        os.replace(tmppath, path)
+    finally:
+        if os.path.exists(tmppath):
+            os.remove(tmppath)
+
+
+class PresolvedSnapshot:
+    """Presolved base model of an instance, stored as CIP file on disk.
+
+    Model classes that support snapshots list the attributes that hold their variables in `VARIABLE_MAPS`. These
+    attributes are mappings from a tuple index to a variable.
+    """
+
+    def __init__(self, path: str):
+        self.path = path
+        self.index_path = f'{os.path.splitext(path)[0]}.vars.json'
+
+    def exists(self) -> bool:
+        return os.path.isfile(self.path) and os.path.isfile(self.index_path)
+
+    def write(self, model) -> None:
+        """Presolves the base model and writes the transformed problem to the snapshot file.
+
+        Symmetry handling and dual reductions are disabled while presolving: the variants add their own symmetry
+        constraints to the presolved problem, which is only valid if presolving did not remove any symmetric
+        (optimal) solutions.
+        """
+        scip = model.scip
+        # Deviations from the default settings; they only apply to the presolve of the snapshot, since the variants
+        # read the snapshot into a new model. Dual reductions may fix or aggregate variables such that only some of the
+        # symmetric optimal solutions remain, which contradicts the symmetry constraints of the variants.
+        scip.setIntParam('misc/usesymmetry', 0)
+        scip.setBoolParam('misc/allowstrongdualreds', False)
+        scip.setBoolParam('misc/allowweakdualreds', False)
+        scip.setBoolParam('reading/cipreader/writefixedvars', True)
+        scip.hideOutput()
+        scip.presolve()
+
+        index = {
+            attribute: [[list(key), var.name] for key, var in getattr(model, attribute).items()]
+            for attribute in model.VARIABLE_MAPS
+        }
+
+        # The index is written last, since its existence marks the snapshot as complete
+        _write_atomic(self.path, lambda tmppath: scip.writeProblem(tmppath, trans=True))
+        _write_atomic(self.index_path, lambda tmppath: _dump_json(index, tmppath))
+
+    def load(self, model) -> None:
+        """Sets the SCIP model of `model` to the snapshot and remaps its variables by name.
+
+        The base model does not have to be built for this.
+        """
+        scip = Model(os.path.splitext(os.path.basename(self.path))[0])
+        scip.hideOutput()
+        scip.readProblem(self.path)
+        scip.hideOutput(False)
+
+        with open(self.index_path, 'r') as f:
+            index = json.load(f)
+
+        variables: Mapping[str, Variable] = {var.name: var for var in scip.getVars()}
+
+        for attribute in model.VARIABLE_MAPS:
+            setattr(model, attribute, {tuple(key): _lookup(variables, name) for key, name in index[attribute]})
+
+        model.scip = scip
+
+
+def _dump_json(data, path: str) -> None:
+    with open(path, 'w') as f:
+        json.dump(data, f)
+
+
+def _lookup(variables: Mapping[str, Variable], name: str) -> Variable:
+    try:
+        return variables[TRANSFORMED_PREFIX + name]
+    except KeyError:
+        raise KeyError(f'Variable <{name}> does not occur in the presolved snapshot.') from None
+
+
+def build_base_model(model, name: str, snapshot_dir: str | None = None, memory_limit=None) -> bool:
+    """Builds the base model of `model`, going through a presolved snapshot if `snapshot_dir` is given.
+
+    The snapshot is created if it does not exist yet. Returns whether the model was loaded from an existing snapshot.
+    """
+    if snapshot_dir is None:
+        model.build(memory_limit=memory_limit)
+        return False
+
+    snapshot = PresolvedSnapshot(os.path.join(snapshot_dir, f'{name}.cip'))
+    reused = snapshot.exists()
+
+    if not reused:
+        model.build(memory_limit=memory_limit)
+        snapshot.write(model)
+
+    # Also the run that created the snapshot solves the loaded problem, such that all variants start from the same model
+    snapshot.load(model)
+
+    if memory_limit is not None:
+        model.scip.setRealParam('limits/memory', memory_limit)
+
+    return reused
@@ -6,10 +6,11 @@ from collections.abc import Callable
 from graph.edgelist import GraphEdgeListNeighbors
 from index.mkcs import SELECTED_INSTANCES
 from problems.mkcs import MkcsModel, MkcsInstance
+from snapshot import build_base_model
 
 COLOR02_INSTANCE_DIR = 'data/Color02'
 
-def test_color02_instance(graph_file: str, k: int, subsym_handler: Callable[[MkcsModel], None], model_name: str):
+def test_color02_instance(graph_file: str, k: int, subsym_handler: Callable[[MkcsModel], None], model_name: str, snapshot_dir: str | None = None):
     print(f'{graph_file}__{k}__{model_name}')
 
     graph = GraphEdgeListNeighbors.read_from_col_file(os.path.join(COLOR02_INSTANCE_DIR, graph_file))
@@ -18,7 +19,7 @@ def test_color02_instance(graph_file: str, k: int, subsym_handler: Callable[[Mkc
     start_time = time.time()
     model = MkcsModel(instance)
 
-    model.build(memory_limit=10_000)  # 10 GB
+    build_base_model(model, f'{graph_file}__{k}', snapshot_dir, memory_limit=10_000)  # 10 GB
     print(f'Initializing model took: {time.time()-start_time} seconds.')
 
     start_time = time.time()
@@ -36,4 +37,4 @@ def test_color02_instance(graph_file: str, k: int, subsym_handler: Callable[[Mkc
 
 if __name__ == '__main__':
     instance, k, model = SELECTED_INSTANCES[int(sys.argv[1])]
-    test_color02_instance(instance, k, *model)
+    test_color02_instance(instance, k, *model, snapshot_dir=sys.argv[2] if len(sys.argv) > 2 else None)
@@ -4,9 +4,10 @@ from collections.abc import Callable
 
 from index.mkp import SELECTED_INSTANCES, MkpBenchmarkSpec
 from problems.multipleknapsack import MultipleKnapsackModel, MultipleKnapsackInstance
+from snapshot import build_base_model
 
 
-def test_instance(spec: MkpBenchmarkSpec, subsym_handler: Callable[[MultipleKnapsackModel], None], model_name: str):
+def test_instance(spec: MkpBenchmarkSpec, subsym_handler: Callable[[MultipleKnapsackModel], None], model_name: str, snapshot_dir: str | None = None):
     name = f'{spec.item_class.name}__K{spec.nknapsacks}__I{spec.nitems}__F{spec.symmetry_factor}__E{spec.equal_profit}__{spec.index}'
     print(f'{name}__{model_name}')
     with open(f'data/mkp/{name}.json', 'r') as f:
@@ -15,7 +16,7 @@ def test_instance(spec: MkpBenchmarkSpec, subsym_handler: Callable[[MultipleKnap
     start_time = time.time()
     model = MultipleKnapsackModel(mkpi)
 
-    model.build(memory_limit=10_000)  # 10 GB
+    build_base_model(model, name, snapshot_dir, memory_limit=10_000)  # 10 GB
     if model_name != 'No-Int-Sym':
         model.add_item_orbitopes()
     print(f'Initializing basic model took: {time.time()-start_time} seconds.')
@@ -35,4 +36,4 @@ def test_instance(spec: MkpBenchmarkSpec, subsym_handler: Callable[[MultipleKnap
 
 if __name__ == '__main__':
     instance, model = SELECTED_INSTANCES[int(sys.argv[1])]
-    test_instance(instance, *model)
+    test_instance(instance, *model, snapshot_dir=sys.argv[2] if len(sys.argv) > 2 else None)
@@ -0,0 +1,43 @@
+import sys
+import time
+
+from pyscipopt import VariantSession
+
+from index.mkp import TEST_SET, MODELS, MkpBenchmarkSpec
+from problems.multipleknapsack import MultipleKnapsackModel, MultipleKnapsackInstance
+
+
+def sweep_instance(spec: MkpBenchmarkSpec):
+    """Solves all models of one instance in a single process, building the base model only once."""
+    name = f'{spec.item_class.name}__K{spec.nknapsacks}__I{spec.nitems}__F{spec.symmetry_factor}__E{spec.equal_profit}__{spec.index}'
+    with open(f'data/mkp/{name}.json', 'r') as f:
+        mkpi = MultipleKnapsackInstance.from_json(f.read())
+
+    start_time = time.time()
+    model = MultipleKnapsackModel(mkpi)
+    model.build(memory_limit=10_000)  # 10 GB
+    print(f'Initializing basic model took: {time.time()-start_time} seconds.')
+
+    session = VariantSession(model.scip, params={
+        'limits/memory': 10_000,
+        'limits/time': 3600,
+        'display/verblevel': 0,
+    })
+
+    for subsym_handler, model_name in MODELS:
+        print(f'{name}__{model_name}')
+
+        def variant(_):
+            if model_name != 'No-Int-Sym':
+                model.add_item_orbitopes()
+            subsym_handler(model)
+
+        def collect(scip):
+            print(f'Solving took: {scip.getSolvingTime()} seconds.')
+            scip.writeStatistics(f'out/mkp/results/{name}__{model_name}.stats')
+
+        session.solve(variant, collect)
+
+
+if __name__ == '__main__':
+    sweep_instance(TEST_SET[int(sys.argv[1])])
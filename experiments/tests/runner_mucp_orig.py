@@ -4,9 +4,10 @@ from collections.abc import Callable
 
 from index.mucp import ORIGINAL_INSTANCES
 from problems.mucp import MucpBasicModel, MucpInstance
+from snapshot import build_base_model
 
 
-def test_mucp_instance(file_name: str, sym_handler: Callable[[MucpBasicModel], None], model_name: str):
+def test_mucp_instance(file_name: str, sym_handler: Callable[[MucpBasicModel], None], model_name: str, snapshot_dir: str | None = None):
     print(f'{file_name}__{model_name}')
 
     with open(f'data/mucp/{file_name}', 'r') as f:
@@ -14,7 +15,7 @@ def test_mucp_instance(file_name: str, sym_handler: Callable[[MucpBasicModel], N
 
     start_time = time.time()
     model = MucpBasicModel(instance)
-    model.build(memory_limit=10_000)
+    build_base_model(model, file_name, snapshot_dir, memory_limit=10_000)
     print(f'Initializing basic model took: {time.time()-start_time} seconds.')
 
     start_time = time.time()
@@ -35,4 +36,4 @@ def test_mucp_instance(file_name: str, sym_handler: Callable[[MucpBasicModel], N
 
 if __name__ == '__main__':
     number, model = ORIGINAL_INSTANCES[int(sys.argv[1])]
-    test_mucp_instance(number, *model)
+    test_mucp_instance(number, *model, snapshot_dir=sys.argv[2] if len(sys.argv) > 2 else None)
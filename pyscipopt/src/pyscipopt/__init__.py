@@ -9,6 +9,7 @@ if hasattr(os, 'add_dll_directory'):
 # export user-relevant objects:
 from pyscipopt.Multidict import multidict
 from pyscipopt.symmetry  import OrbitopeType
+from pyscipopt.variants  import VariantSession
 from pyscipopt.scip      import Model
 from pyscipopt.scip      import Benders
 from pyscipopt.scip      import Benderscut
@@ -20,6 +21,7 @@ from pyscipopt.scip      import Heur
 from pyscipopt.scip      import Presol
 from pyscipopt.scip      import Pricer
 from pyscipopt.scip      import Prop
+from pyscipopt.scip      import Activationhdlr
 from pyscipopt.scip      import Sepa
 from pyscipopt.scip      import LP
 from pyscipopt.scip      import Expr
@@ -0,0 +1,104 @@
+##@file activation.pxi
+#@brief Base class of the Activation Handler Plugin
+cdef class Activationhdlr:
+    cdef public Model model
+    cdef public str name
+
+    def activationfree(self):
+        '''calls destructor and frees memory of activation handler'''
+        pass
+
+    def activationinit(self):
+        '''initializes activation handler'''
+        pass
+
+    def activationexit(self):
+        '''calls exit method of activation handler'''
+        pass
+
+    def activationisactive(self, constraint):
+        '''returns whether the constraint is active at the current node'''
+        print("python error in activationisactive: this method needs to be implemented")
+        return True
+
+    def activationfinddata(self, constraint, forparentnode):
+        '''returns the submatrices of the (orbitope) constraint that are active at the current node (or its parent
+        node, if forparentnode is True) as a list of (rows, cols) or (rows, cols, orbitopetype) tuples; rows and cols
+        may be lists or NumPy arrays of row and column indices'''
+        return []
+
+
+cdef const int[::1] _activationIndexArray(indices):
+    '''returns the indices as a contiguous buffer of C ints; NumPy arrays of dtype intc are used without copying'''
+    cdef const int[::1] view
+    try:
+        view = indices
+    except (TypeError, ValueError, BufferError):
+        view = array.array('i', indices)
+    return view
+
+cdef SCIP_RETCODE _createActivationSubmatrix(SCIP* scip, SCIP_ACTIVATIONSUBMATRIX** submatrix, rows, cols,
+                                             orbitopetype, SCIP_ACTIVATIONSUBMATRIX* next):
+    cdef const int[::1] _rows = _activationIndexArray(rows)
+    cdef const int[::1] _cols = _activationIndexArray(cols)
+    cdef int _orbitopetype = getattr(orbitopetype, "value", orbitopetype)
+
+    assert _rows.shape[0] > 0 and _cols.shape[0] > 0
+    return SCIPcreateActivationSubmatrix(scip, submatrix, &_rows[0], <int>_rows.shape[0], &_cols[0],
+                                         <int>_cols.shape[0], <SCIP_ORBITOPETYPE>_orbitopetype, next)
+
+
+cdef SCIP_RETCODE PyActivationFree (SCIP* scip, SCIP_ACTIVATIONHDLR* activationhdlr) with gil:
+    cdef SCIP_ACTIVATIONHDLRDATA* activationhdlrdata
+    activationhdlrdata = SCIPactivationhdlrGetData(activationhdlr)
+    PyActivationhdlr = <Activationhdlr>activationhdlrdata
+    PyActivationhdlr.activationfree()
+    Py_DECREF(PyActivationhdlr)
+    return SCIP_OKAY
+
+cdef SCIP_RETCODE PyActivationInit (SCIP* scip, SCIP_ACTIVATIONHDLR* activationhdlr) with gil:
+    cdef SCIP_ACTIVATIONHDLRDATA* activationhdlrdata
+    activationhdlrdata = SCIPactivationhdlrGetData(activationhdlr)
+    PyActivationhdlr = <Activationhdlr>activationhdlrdata
+    PyActivationhdlr.activationinit()
+    return SCIP_OKAY
+
+cdef SCIP_RETCODE PyActivationExit (SCIP* scip, SCIP_ACTIVATIONHDLR* activationhdlr) with gil:
+    cdef SCIP_ACTIVATIONHDLRDATA* activationhdlrdata
+    activationhdlrdata = SCIPactivationhdlrGetData(activationhdlr)
+    PyActivationhdlr = <Activationhdlr>activationhdlrdata
+    PyActivationhdlr.activationexit()
+    return SCIP_OKAY
+
+cdef SCIP_RETCODE PyActivationIsActive (SCIP* scip, SCIP_ACTIVATIONHDLR* activationhdlr, SCIP_CONS* cons, SCIP_Bool* result) with gil:
+    cdef SCIP_ACTIVATIONHDLRDATA* activationhdlrdata
+    activationhdlrdata = SCIPactivationhdlrGetData(activationhdlr)
+    PyActivationhdlr = <Activationhdlr>activationhdlrdata
+    PyCons = Constraint.create(cons)
+    result[0] = PyActivationhdlr.activationisactive(PyCons)
+    return SCIP_OKAY
+
+cdef SCIP_RETCODE PyActivationFindData (SCIP* scip, SCIP_ACTIVATIONHDLR* activationhdlr, SCIP_CONS* cons, SCIP_Bool forparentnode, void** activationdata) with gil:
+    cdef SCIP_ACTIVATIONHDLRDATA* activationhdlrdata
+    cdef SCIP_ACTIVATIONSUBMATRIX* submatrix = NULL
+    cdef SCIP_ACTIVATIONSUBMATRIX* newsubmatrix
+    cdef SCIP_RETCODE retcode
+    activationhdlrdata = SCIPactivationhdlrGetData(activationhdlr)
+    PyActivationhdlr = <Activationhdlr>activationhdlrdata
+    PyCons = Constraint.create(cons)
+    submatrices = PyActivationhdlr.activationfinddata(PyCons, forparentnode)
+    try:
+        for data in submatrices:
+            orbitopetype = data[2] if len(data) > 2 else SCIP_ORBITOPETYPE_FULL
+            newsubmatrix = NULL
+            retcode = _createActivationSubmatrix(scip, &newsubmatrix, data[0], data[1], orbitopetype, submatrix)
+            if retcode != SCIP_OKAY:
+                # the submatrices created for the previous entries are not handed over to the orbitope constraint
+                SCIPfreeActivationSubmatrices(scip, &submatrix)
+                return retcode
+            submatrix = newsubmatrix
+    except:
+        SCIPfreeActivationSubmatrices(scip, &submatrix)
+        raise
+    activationdata[0] = <void*>submatrix
+    return SCIP_OKAY
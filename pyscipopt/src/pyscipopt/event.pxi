@@ -84,5 +84,6 @@ cdef SCIP_RETCODE PyEventExec (SCIP* scip, SCIP_EVENTHDLR* eventhdlr, SCIP_EVENT
     PyEventhdlr = getPyEventhdlr(eventhdlr)
     PyEvent = Event()
     PyEvent.event = event
+    PyEvent.scip = scip
     PyEventhdlr.eventexec(PyEvent)
     return SCIP_OKAY
@@ -443,6 +443,12 @@ cdef extern from "scip/scip.h":
     ctypedef struct SCIP_ACTIVATIONHDLR:
         pass
 
+    ctypedef struct SCIP_ACTIVATIONHDLRDATA:
+        pass
+
+    ctypedef struct SCIP_ACTIVATIONSUBMATRIX:
+        pass
+
     ctypedef void (*messagecallback) (SCIP_MESSAGEHDLR *messagehdlr, FILE *file, const char *msg)
     ctypedef void (*errormessagecallback) (void *data, FILE *file, const char *msg)
     ctypedef SCIP_RETCODE (*messagehdlrfree) (SCIP_MESSAGEHDLR *messagehdlr)
@@ -632,6 +638,7 @@ cdef extern from "scip/scip.h":
     void SCIPnodeGetNDomchg(SCIP_NODE* node, int* nbranchings, int* nconsprop,
                             int* nprop)
     SCIP_DOMCHG* SCIPnodeGetDomchg(SCIP_NODE* node)
+    SCIP_RETCODE SCIPexpandNodeDomchg(SCIP* scip, SCIP_NODE* node)
 
     # Domain change methods
     int SCIPdomchgGetNBoundchgs(SCIP_DOMCHG* domchg)
@@ -767,6 +774,7 @@ cdef extern from "scip/scip.h":
     int SCIPgetNBestSolsFound(SCIP* scip)
     SCIP_SOL* SCIPgetBestSol(SCIP* scip)
     SCIP_Real SCIPgetSolVal(SCIP* scip, SCIP_SOL* sol, SCIP_VAR* var)
+    SCIP_RETCODE SCIPgetSolVals(SCIP* scip, SCIP_SOL* sol, int nvars, SCIP_VAR** vars, SCIP_Real* vals)
     SCIP_RETCODE SCIPwriteVarName(SCIP* scip, FILE* outfile, SCIP_VAR* var, SCIP_Bool vartype)
     SCIP_Real SCIPgetSolOrigObj(SCIP* scip, SCIP_SOL* sol)
     SCIP_Real SCIPgetSolTransObj(SCIP* scip, SCIP_SOL* sol)
@@ -1546,6 +1554,29 @@ cdef extern from "scip/scip_tree.h":
 cdef extern from "scip/scip_var.h":
     SCIP_RETCODE SCIPchgVarBranchPriority(SCIP* scip, SCIP_VAR* var, int branchpriority)
 
+cdef extern from "scip/scip_activation.h":
+    SCIP_RETCODE SCIPincludeActivationhdlr(SCIP* scip,
+                                           const char* name,
+                                           const char* desc,
+                                           SCIP_RETCODE (*activationcopy) (SCIP* scip, SCIP_ACTIVATIONHDLR* activationhdlr),
+                                           SCIP_RETCODE (*activationfree) (SCIP* scip, SCIP_ACTIVATIONHDLR* activationhdlr),
+                                           SCIP_RETCODE (*activationinit) (SCIP* scip, SCIP_ACTIVATIONHDLR* activationhdlr),
+                                           SCIP_RETCODE (*activationexit) (SCIP* scip, SCIP_ACTIVATIONHDLR* activationhdlr),
+                                           SCIP_RETCODE (*activationisactive) (SCIP* scip, SCIP_ACTIVATIONHDLR* activationhdlr, SCIP_CONS* cons, SCIP_Bool* result),
+                                           SCIP_RETCODE (*activationfindactivationdata) (SCIP* scip, SCIP_ACTIVATIONHDLR* activationhdlr, SCIP_CONS* cons, SCIP_Bool forparentnode, void** activationdata),
+                                           SCIP_ACTIVATIONHDLRDATA* activationhdlrdata)
+    SCIP_ACTIVATIONHDLR* SCIPfindActivationhdlr(SCIP* scip, const char* name)
+
+cdef extern from "scip/pub_activation.h":
+    SCIP_ACTIVATIONHDLRDATA* SCIPactivationhdlrGetData(SCIP_ACTIVATIONHDLR* activationhdlr)
+
+cdef extern from "scip/scip_cons.h":
+    SCIP_RETCODE SCIPsetConsActivationhdlr(SCIP* scip, SCIP_CONS* cons, SCIP_ACTIVATIONHDLR* activationhdlr)
+
+cdef extern from "scip/activation_varfix.h":
+    SCIP_RETCODE SCIPincludeActivationVarFix(SCIP* scip)
+    SCIP_RETCODE SCIPregisterConsActivationVarFix(SCIP* scip, SCIP_CONS* cons, SCIP_VAR** vars, SCIP_Real* vals, int nvars, int* rows, int nrows, int* cols, int ncols, SCIP_ORBITOPETYPE orbitopetype)
+
 cdef extern from "scip/activation_suborbitope.h":
     SCIP_RETCODE SCIPincludeActivationSuborbitope(SCIP* scip)
     SCIP_RETCODE SCIPregisterConsActivationSuborbitope(SCIP* scip, SCIP_CONS* cons, SCIP_VAR*** matrix, int m, int n, int zeroheight, int oneheight)
@@ -1580,6 +1611,15 @@ cdef extern from "scip/cons_orbisack.h":
                                         SCIP_Bool stickingatnode)
 
 cdef extern from "scip/cons_orbitope.h":
+    SCIP_RETCODE SCIPcreateActivationSubmatrix(SCIP* scip,
+                                               SCIP_ACTIVATIONSUBMATRIX** submatrix,
+                                               const int* rows,
+                                               int nrows,
+                                               const int* cols,
+                                               int ncols,
+                                               SCIP_ORBITOPETYPE orbitopetype,
+                                               SCIP_ACTIVATIONSUBMATRIX* next)
+    void SCIPfreeActivationSubmatrices(SCIP* scip, SCIP_ACTIVATIONSUBMATRIX** submatrix)
     SCIP_RETCODE SCIPcreateConsOrbitope(SCIP* scip,
                                         SCIP_CONS** cons,
                                         const char* name,
@@ -1621,6 +1661,7 @@ cdef class Expr:
 
 cdef class Event:
     cdef SCIP_EVENT* event
+    cdef SCIP* scip
     # can be used to store problem data
     cdef public object data
     @staticmethod
@@ -1673,11 +1714,12 @@ cdef class BoundChange:
 
 cdef class Node:
     cdef SCIP_NODE* scip_node
+    cdef SCIP* scip
     # can be used to store problem data
     cdef public object data
 
     @staticmethod
-    cdef create(SCIP_NODE* scipnode)
+    cdef create(SCIP* scip, SCIP_NODE* scipnode)
 
 cdef class Variable(Expr):
     cdef SCIP_VAR* scip_var
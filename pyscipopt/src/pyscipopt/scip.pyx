@@ -1,5 +1,6 @@
 ##@file scip.pyx
 #@brief holding functions in python that reference the SCIP public functions included in scip.pxd
+import array
 import weakref
 from os.path import abspath
 from os.path import splitext
@@ -29,6 +30,7 @@ include "propagator.pxi"
 include "sepa.pxi"
 include "relax.pxi"
 include "nodesel.pxi"
+include "activation.pxi"
 
 # recommended SCIP version; major version is required
 MAJOR = 7
@@ -300,7 +302,7 @@ cdef class Event:
     def getNode(self):
         """gets node for a node or LP event"""
         cdef SCIP_NODE* node = SCIPeventGetNode(self.event)
-        return Node.create(node)
+        return Node.create(self.scip, node)
 
     def getRow(self):
         """gets row for a row event"""
@@ -613,16 +615,17 @@ cdef class Node:
     """Base class holding a pointer to corresponding SCIP_NODE"""
 
     @staticmethod
-    cdef create(SCIP_NODE* scipnode):
+    cdef create(SCIP* scip, SCIP_NODE* scipnode):
         if scipnode == NULL:
             return None
         node = Node()
         node.scip_node = scipnode
+        node.scip = scip
         return node
 
     def getParent(self):
         """Retrieve parent node (or None if the node has no parent node)."""
-        return Node.create(SCIPnodeGetParent(self.scip_node))
+        return Node.create(self.scip, SCIPnodeGetParent(self.scip_node))
 
     def getNumber(self):
         """Retrieve number of node."""
@@ -715,7 +718,11 @@ cdef class Node:
 
     def getDomchg(self):
         """Retrieve domain changes for this node."""
-        cdef SCIP_DOMCHG* domchg = SCIPnodeGetDomchg(self.scip_node)
+        cdef SCIP_DOMCHG* domchg
+        # the branching decisions of leaves may be stored compactly if the memory limit is approached
+        if SCIPgetStage(self.scip) == SCIP_STAGE_SOLVING:
+            PY_SCIP_CALL(SCIPexpandNodeDomchg(self.scip, self.scip_node))
+        domchg = SCIPnodeGetDomchg(self.scip_node)
         if domchg == NULL:
             return None
         return DomainChanges.create(domchg)
@@ -894,6 +901,23 @@ cdef class Constraint:
                 and self.scip_cons == (<Constraint>other).scip_cons)
 
 
+cdef _emptyArray(int n):
+    """returns an uninitialized NumPy array of n doubles; NumPy is only required by the bulk getters"""
+    import numpy
+    return numpy.empty(n, dtype=numpy.float64)
+
+cdef SCIP_VAR** _allocScipVars(vars, int nvars):
+    """returns a newly allocated array with the SCIP variables of the given variables; has to be freed by the caller"""
+    cdef SCIP_VAR** _vars = <SCIP_VAR**> malloc(nvars * sizeof(SCIP_VAR*))
+    try:
+        for i, var in enumerate(vars):
+            _vars[i] = (<Variable?>var).scip_var
+    except:
+        free(_vars)
+        raise
+    return _vars
+
+
 cdef void relayMessage(SCIP_MESSAGEHDLR *messagehdlr, FILE *file, const char *msg):
     sys.stdout.write(msg.decode('UTF-8'))
 
@@ -1098,7 +1122,7 @@ cdef class Model:
 
     def getCurrentNode(self):
         """Retrieve current node."""
-        return Node.create(SCIPgetCurrentNode(self._scip))
+        return Node.create(self._scip, SCIPgetCurrentNode(self._scip))
 
     def getGap(self):
         """Retrieve the gap, i.e. |(primalbound - dualbound)/min(|primalbound|,|dualbound|)|."""
@@ -1701,23 +1725,23 @@ cdef class Model:
     # Node methods
     def getBestChild(self):
         """gets the best child of the focus node w.r.t. the node selection strategy."""
-        return Node.create(SCIPgetBestChild(self._scip))
+        return Node.create(self._scip, SCIPgetBestChild(self._scip))
 
     def getBestSibling(self):
         """gets the best sibling of the focus node w.r.t. the node selection strategy."""
-        return Node.create(SCIPgetBestSibling(self._scip))
+        return Node.create(self._scip, SCIPgetBestSibling(self._scip))
 
     def getBestLeaf(self):
         """gets the best leaf from the node queue w.r.t. the node selection strategy."""
-        return Node.create(SCIPgetBestLeaf(self._scip))
+        return Node.create(self._scip, SCIPgetBestLeaf(self._scip))
 
     def getBestNode(self):
         """gets the best node from the tree (child, sibling, or leaf) w.r.t. the node selection strategy."""
-        return Node.create(SCIPgetBestNode(self._scip))
+        return Node.create(self._scip, SCIPgetBestNode(self._scip))
 
     def getBestboundNode(self):
         """gets the node with smallest lower bound from the tree (child, sibling, or leaf)."""
-        return Node.create(SCIPgetBestboundNode(self._scip))
+        return Node.create(self._scip, SCIPgetBestboundNode(self._scip))
 
     def getOpenNodes(self):
         """access to all data of open nodes (leaves, children, and siblings)
@@ -1733,9 +1757,9 @@ cdef class Model:
 
         PY_SCIP_CALL(SCIPgetOpenNodesData(self._scip, &_leaves, &_children, &_siblings, &_nleaves, &_nchildren, &_nsiblings))
 
-        leaves   = [Node.create(_leaves[i]) for i in range(_nleaves)]
-        children = [Node.create(_children[i]) for i in range(_nchildren)]
-        siblings = [Node.create(_siblings[i]) for i in range(_nsiblings)]
+        leaves   = [Node.create(self._scip, _leaves[i]) for i in range(_nleaves)]
+        children = [Node.create(self._scip, _children[i]) for i in range(_nchildren)]
+        siblings = [Node.create(self._scip, _siblings[i]) for i in range(_nsiblings)]
 
         return leaves, children, siblings
 
@@ -1761,6 +1785,39 @@ cdef class Model:
         PY_SCIP_CALL(SCIPconstructLP(self._scip, &cutoff))
         return cutoff
 
+    def getVarRedcosts(self, vars=None):
+        """Retrieve the reduced costs of the given variables in the current LP as NumPy array.
+
+        :param vars: list or array of variables, or None for all original variables in the order of getVars() (Default value = None)
+
+        """
+        cdef SCIP_VAR** _vars
+        cdef double[::1] _redcosts
+        cdef int nvars
+        cdef int i
+
+        if not SCIPgetStage(self._scip) == SCIP_STAGE_SOLVING:
+            raise Warning("reduced costs are only available in stage SOLVING")
+
+        nvars = SCIPgetNOrigVars(self._scip) if vars is None else len(vars)
+        redcosts = _emptyArray(nvars)
+        _redcosts = redcosts
+
+        if vars is None:
+            _vars = SCIPgetOrigVars(self._scip)
+        else:
+            _vars = _allocScipVars(vars, nvars)
+
+        for i in range(nvars):
+            _redcosts[i] = SCIPgetVarRedcost(self._scip, _vars[i])
+
+        if vars is not None:
+            free(_vars)
+
+        if self.getObjectiveSense() == "maximize":
+            redcosts *= -1
+        return redcosts
+
     def getLPObjVal(self):
         """gets objective value of current LP (which is the sum of column and loose objective value)"""
 
@@ -1872,6 +1929,32 @@ cdef class Model:
         """returns the activity of a row in the last LP solution"""
         return SCIPgetRowLPActivity(self._scip, row.scip_row)
 
+    def getRowLPActivities(self, rows=None):
+        """returns the activities of the given rows in the last LP solution as NumPy array
+
+        :param rows: list of rows, or None for all rows of the current LP in the order of getLPRowsData() (Default value = None)
+
+        """
+        cdef SCIP_ROW** _rows
+        cdef double[::1] _activities
+        cdef int nrows
+        cdef int i
+
+        if rows is None:
+            PY_SCIP_CALL(SCIPgetLPRowsData(self._scip, &_rows, &nrows))
+            activities = _emptyArray(nrows)
+            _activities = activities
+            for i in range(nrows):
+                _activities[i] = SCIPgetRowLPActivity(self._scip, _rows[i])
+            return activities
+
+        nrows = len(rows)
+        activities = _emptyArray(nrows)
+        _activities = activities
+        for i, row in enumerate(rows):
+            _activities[i] = SCIPgetRowLPActivity(self._scip, (<Row?>row).scip_row)
+        return activities
+
     # TODO: do we need this? (also do we need release var??)
     def releaseRow(self, Row row not None):
         """decreases usage counter of LP row, and frees memory if necessary"""
@@ -3592,7 +3675,7 @@ cdef class Model:
         cdef SCIP_NODE* upchild
 
         PY_SCIP_CALL(SCIPbranchVar(self._scip, (<Variable>variable).scip_var, &downchild, &eqchild, &upchild))
-        return Node.create(downchild), Node.create(eqchild), Node.create(upchild)
+        return Node.create(self._scip, downchild), Node.create(self._scip, eqchild), Node.create(self._scip, upchild)
 
 
     def branchVarVal(self, variable, value):
@@ -3610,7 +3693,7 @@ cdef class Model:
 
         PY_SCIP_CALL(SCIPbranchVarVal(self._scip, (<Variable>variable).scip_var, value, &downchild, &eqchild, &upchild))
 
-        return Node.create(downchild), Node.create(eqchild), Node.create(upchild)
+        return Node.create(self._scip, downchild), Node.create(self._scip, eqchild), Node.create(self._scip, upchild)
 
     def calcNodeselPriority(self, Variable variable, branchdir, targetvalue):
         """calculates the node selection priority for moving the given variable's LP value
@@ -3647,7 +3730,7 @@ cdef class Model:
         """
         cdef SCIP_NODE* child
         PY_SCIP_CALL(SCIPcreateChild(self._scip, &child, nodeselprio, estimate))
-        return Node.create(child)
+        return Node.create(self._scip, child)
 
     # Diving methods (Diving is LP related)
     def startDive(self):
@@ -4114,6 +4197,56 @@ cdef class Model:
             raise Warning("method cannot be called before problem is solved")
         return self.getSolVal(self._bestSol, expr)
 
+    def getSolVals(self, Solution sol, vars=None):
+        """Retrieve the values of the given variables in the given solution or in the LP/pseudo solution if sol == None,
+        as NumPy array. In contrast to getSolVal, the values are retrieved at once with SCIPgetSolVals.
+
+        :param Solution sol: solution
+        :param vars: list or array of variables, or None for all original variables in the order of getVars() (Default value = None)
+
+        """
+        cdef SCIP_SOL* _sol = NULL
+        cdef SCIP_VAR** _vars
+        cdef double[::1] _vals
+        cdef int nvars
+        cdef SCIP_RETCODE retcode
+
+        if sol is not None:
+            _sol = sol.sol
+        if _sol == NULL and not SCIPgetStage(self._scip) == SCIP_STAGE_SOLVING:
+            raise Warning("getSolVals cannot only be called in stage SOLVING without a valid solution (current stage: %d)" % SCIPgetStage(self._scip))
+
+        if vars is None:
+            nvars = SCIPgetNOrigVars(self._scip)
+            vals = _emptyArray(nvars)
+            _vals = vals
+            if nvars > 0:
+                PY_SCIP_CALL(SCIPgetSolVals(self._scip, _sol, nvars, SCIPgetOrigVars(self._scip), &_vals[0]))
+            return vals
+
+        nvars = len(vars)
+        vals = _emptyArray(nvars)
+        _vals = vals
+        if nvars == 0:
+            return vals
+
+        _vars = _allocScipVars(vars, nvars)
+        retcode = SCIPgetSolVals(self._scip, _sol, nvars, _vars, &_vals[0])
+        free(_vars)
+        PY_SCIP_CALL(retcode)
+        return vals
+
+    def getVals(self, vars=None):
+        """Retrieve the values of the given variables in the best known solution as NumPy array.
+        Can only be called after solving is completed.
+
+        :param vars: list or array of variables, or None for all original variables in the order of getVars() (Default value = None)
+
+        """
+        if not self.getStage() >= SCIP_STAGE_SOLVING:
+            raise Warning("method cannot be called before problem is solved")
+        return self.getSolVals(self._bestSol, vars)
+
     def getPrimalbound(self):
         """Retrieve the best primal bound."""
         return SCIPgetPrimalbound(self._scip)
@@ -4578,7 +4711,9 @@ cdef class Model:
         PY_SCIP_CALL(SCIPchgVarBranchPriority(self._scip, var.scip_var, priority))
 
     def includeActivationSuborbitope(self):
-        """Creates the suborbitope activation handler and includes it in SCIP"""
+        """Creates the suborbitope activation handler and includes it in SCIP, unless it is already included"""
+        if SCIPfindActivationhdlr(self._scip, b"suborbitope") != NULL:
+            return
         PY_SCIP_CALL(SCIPincludeActivationSuborbitope(self._scip))
 
     def registerConsActivationSuborbitope(self, Constraint cons, matrix, zeroheight, oneheight):
@@ -4603,7 +4738,9 @@ cdef class Model:
         free(_matrix)
 
     def includeActivationMakespan(self):
-        """Creates the suborbitope activation handler and includes it in SCIP"""
+        """Creates the makespan activation handler and includes it in SCIP, unless it is already included"""
+        if SCIPfindActivationhdlr(self._scip, b"makespan") != NULL:
+            return
         PY_SCIP_CALL(SCIPincludeActivationMakespan(self._scip))
 
     def registerConsActivationMakespan(self, Constraint cons, matrix, jobtimes):
@@ -4634,7 +4771,9 @@ cdef class Model:
         free(_matrix)
 
     def includeActivationColorComp(self):
-        """Creates the color components activation handler and includes it in SCIP"""
+        """Creates the color components activation handler and includes it in SCIP, unless it is already included"""
+        if SCIPfindActivationhdlr(self._scip, b"colorcomp") != NULL:
+            return
         PY_SCIP_CALL(SCIPincludeActivationColorComp(self._scip))
 
     def registerConsActivationColorComp(self, Constraint cons, matrix, adjacencies, allcolorpairs, strategy):
@@ -4674,6 +4813,90 @@ cdef class Model:
 
         free(_matrix)
 
+    def includeActivationhdlr(self, Activationhdlr activationhdlr, name, desc):
+        """Include an activation handler.
+
+        :param Activationhdlr activationhdlr: activation handler
+        :param name: name of activation handler
+        :param desc: description of activation handler
+
+        """
+        n = str_conversion(name)
+        d = str_conversion(desc)
+        PY_SCIP_CALL(SCIPincludeActivationhdlr(self._scip, n, d, NULL, PyActivationFree, PyActivationInit,
+                                               PyActivationExit, PyActivationIsActive, PyActivationFindData,
+                                               <SCIP_ACTIVATIONHDLRDATA*> activationhdlr))
+        activationhdlr.model = <Model>weakref.proxy(self)
+        activationhdlr.name = name
+        Py_INCREF(activationhdlr)
+
+    def setConsActivationhdlr(self, Constraint cons, activationhdlr):
+        """Sets the activation handler of the constraint.
+
+        :param Constraint cons: constraint
+        :param activationhdlr: activation handler, or the name of an included activation handler
+
+        """
+        cdef SCIP_ACTIVATIONHDLR* _activationhdlr
+        name = activationhdlr.name if isinstance(activationhdlr, Activationhdlr) else activationhdlr
+        _activationhdlr = SCIPfindActivationhdlr(self._scip, str_conversion(name))
+        if _activationhdlr == NULL:
+            raise LookupError("activation handler <%s> not found" % name)
+        PY_SCIP_CALL(SCIPsetConsActivationhdlr(self._scip, cons.scip_cons, _activationhdlr))
+
+    def includeActivationVarFix(self):
+        """Creates the variable fixings activation handler and includes it in SCIP, unless it is already included"""
+        if SCIPfindActivationhdlr(self._scip, b"varfix") != NULL:
+            return
+        PY_SCIP_CALL(SCIPincludeActivationVarFix(self._scip))
+
+    def registerConsActivationVarFix(self, Constraint cons, fixings, rows=None, cols=None,
+                                     orbitopetype=SCIP_ORBITOPETYPE_FULL):
+        """Adds a trigger for the constraint to the variable fixings activation handler.
+
+        The trigger is evaluated in C: it matches at a node if all variables are fixed to the given values. The
+        constraint is active if at least one of its triggers matches. If rows and cols are given, the trigger activates
+        the given submatrix of the (orbitope) constraint instead.
+
+        :param Constraint cons: constraint
+        :param fixings: list of (variable, value) pairs
+        :param rows: row indices (list or NumPy array) of the submatrix that is activated (Default value = None)
+        :param cols: column indices (list or NumPy array) of the submatrix that is activated (Default value = None)
+        :param orbitopetype: type of orbitope for the submatrix that is activated (Default value = SCIP_ORBITOPETYPE_FULL)
+
+        """
+        cdef int nvars = len(fixings)
+        cdef const int[::1] _rows
+        cdef const int[::1] _cols
+        cdef int* rowsptr = NULL
+        cdef int* colsptr = NULL
+        cdef int nrows = 0
+        cdef int ncols = 0
+        cdef int _orbitopetype = getattr(orbitopetype, "value", orbitopetype)
+        assert nvars > 0
+        assert (rows is None) == (cols is None)
+
+        if rows is not None:
+            _rows = _activationIndexArray(rows)
+            _cols = _activationIndexArray(cols)
+            nrows = _rows.shape[0]
+            ncols = _cols.shape[0]
+            assert nrows > 0 and ncols > 0
+            rowsptr = <int*>&_rows[0]
+            colsptr = <int*>&_cols[0]
+
+        _vars = <SCIP_VAR**> malloc(nvars * sizeof(SCIP_VAR*))
+        _vals = <SCIP_Real*> malloc(nvars * sizeof(SCIP_Real))
+        for i, (var, val) in enumerate(fixings):
+            _vars[i] = (<Variable>var).scip_var
+            _vals[i] = val
+
+        PY_SCIP_CALL(SCIPregisterConsActivationVarFix(self._scip, cons.scip_cons, _vars, _vals, nvars, rowsptr, nrows,
+                                                      colsptr, ncols, <SCIP_ORBITOPETYPE>_orbitopetype))
+
+        free(_vals)
+        free(_vars)
+
 
 # debugging memory management
 def is_memory_freed():
@@ -0,0 +1,56 @@
+class VariantSession:
+    """Solves many variants of one base model in a single process.
+
+    The base model is built once. Every variant adds its own constraints, variables and parameter settings on top of
+    it, is solved, and is rolled back afterwards: the transformed problem is freed, and all constraints and variables
+    that the variant added to the original problem are deleted again. Constraints that are registered to an
+    activation handler release their registration when they are deleted, so every variant may register its own.
+    The parameter settings that the base model had before a variant was applied are restored as well.
+    """
+
+    def __init__(self, model, params=None):
+        """
+        :param model: the base model, in problem stage
+        :param params: parameter settings that apply to every variant (Default value = None)
+        """
+        self.model = model
+        self.params = dict(params) if params is not None else {}
+
+    def solve(self, variant, collect=None):
+        """Adds a variant to the base model, solves it and restores the base model.
+
+        :param variant: callable that receives the model and adds the variant's constraints and settings
+        :param collect: callable that receives the solved model and returns the statistics of interest (Default value = None)
+        :return: the result of `collect`, or None if no `collect` is given
+        """
+        model = self.model
+        baseconss = set(model.getConss())
+        basevars = {var.ptr() for var in model.getVars()}
+        baseparams = model.getParams()
+
+        model.setParams(self.params)
+        try:
+            variant(model)
+            model.optimize()
+            result = collect(model) if collect is not None else None
+        finally:
+            self._rollback(baseconss, basevars, baseparams)
+
+        return result
+
+    def _rollback(self, baseconss, basevars, baseparams):
+        """Restores the base model: frees the transformed problem, deletes everything the variant added, and resets
+        the parameters that were changed since the given snapshot of the base model's parameters was taken."""
+        model = self.model
+        model.freeTransform()
+
+        for cons in model.getConss():
+            if cons not in baseconss:
+                model.delCons(cons)
+
+        for var in model.getVars():
+            if var.ptr() not in basevars:
+                model.delVar(var)
+
+        params = model.getParams()
+        model.setParams({name: value for name, value in baseparams.items() if params[name] != value})
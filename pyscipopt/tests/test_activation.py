@@ -0,0 +1,81 @@
+import array
+
+from pyscipopt import Model, Activationhdlr, OrbitopeType, quicksum
+
+def build_multiple_knapsack():
+    s = Model("MultipleKnapsack")
+    s.hideOutput()
+    s.setMaximize()
+
+    weights = [4, 2, 6, 3, 7, 5, 4, 2]
+    nknapsacks = 3
+    capacity = 9
+
+    x = [[s.addVar("x_%d_%d" % (i, j), vtype='B', obj=weights[i]) for j in range(nknapsacks)] for i in range(len(weights))]
+
+    for i in range(len(weights)):
+        s.addCons(quicksum(x[i]) <= 1)
+
+    for j in range(nknapsacks):
+        s.addCons(quicksum(weights[i] * x[i][j] for i in range(len(weights))) <= capacity)
+
+    return s, x, weights
+
+class FullSubmatrixActivation(Activationhdlr):
+    '''activates the full orbitope, with the rows given as list and the columns as buffer of C ints'''
+
+    def __init__(self, nrows, ncols):
+        self.nrows = nrows
+        self.ncols = ncols
+        self.ncalls = 0
+
+    def activationisactive(self, constraint):
+        return True
+
+    def activationfinddata(self, constraint, forparentnode):
+        self.ncalls += 1
+        return [(list(range(self.nrows)), array.array('i', range(self.ncols)), OrbitopeType.PACKING)]
+
+def optimize(s):
+    s.optimize()
+    assert s.getStatus() == 'optimal'
+    return s.getObjVal()
+
+def test_activationhdlr():
+    s, x, _ = build_multiple_knapsack()
+    optimum = optimize(s)
+
+    s, x, _ = build_multiple_knapsack()
+    activationhdlr = FullSubmatrixActivation(len(x), len(x[0]))
+    s.includeActivationhdlr(activationhdlr, "fullsubmatrix", "activates the full orbitope")
+    cons = s.addConsOrbitope(x, OrbitopeType.PACKING.value, usedynamicprop=False, resolveprop=False,
+                             ismodelcons=False, mayinteract=False, enforce=False)
+    s.setConsActivationhdlr(cons, activationhdlr)
+
+    assert optimize(s) == optimum
+    assert activationhdlr.ncalls > 0
+
+def test_activation_varfix():
+    s, x, _ = build_multiple_knapsack()
+    optimum = optimize(s)
+
+    s, x, _ = build_multiple_knapsack()
+    s.includeActivationVarFix()
+    s.includeActivationVarFix()
+
+    # orbisack on the first two knapsacks, active once the first item is in neither of them
+    cons = s.addConsOrbisack([x[i][0] for i in range(len(x))], [x[i][1] for i in range(len(x))],
+                             ispporbisack=False, isparttype=False, ismodelcons=False, initial=False)
+    s.registerConsActivationVarFix(cons, [(x[0][0], 0), (x[0][1], 0)])
+
+    # orbitope on all knapsacks, whose last two columns are active once the first item is in the first knapsack
+    cons = s.addConsOrbitope(x, OrbitopeType.PACKING.value, usedynamicprop=False, resolveprop=False,
+                             ismodelcons=False, mayinteract=False, enforce=False)
+    s.registerConsActivationVarFix(cons, [(x[0][0], 1)], rows=range(1, len(x)), cols=[1, 2],
+                                   orbitopetype=OrbitopeType.PACKING)
+
+    assert optimize(s) == optimum
+
+if __name__ == "__main__":
+    test_activationhdlr()
+    test_activation_varfix()
@@ -1,4 +1,6 @@
-from pyscipopt import Model
+import pytest
+
+from pyscipopt import Model, Eventhdlr, SCIP_EVENTTYPE, SCIP_PARAMSETTING
 
 
 def test_solution_getbest():
@@ -63,6 +65,63 @@ def test_solution_evaluation():
     assert sol[expr2] == m.getVal(expr2)
 
 
+
+def test_solution_bulk_values():
+    pytest.importorskip("numpy")
+    m = Model()
+    m.hideOutput()
+
+    x = [m.addVar("x_%d" % i, vtype='B', obj=-(i + 1)) for i in range(10)]
+    m.addCons(sum(x) <= 4)
+
+    m.optimize()
+
+    # Check consistency with Models's getVal method
+    vals = m.getVals(x)
+    assert list(vals) == [m.getVal(v) for v in x]
+    assert list(m.getVals()) == [m.getVal(v) for v in m.getVars()]
+    assert list(m.getSolVals(m.getBestSol(), x[::-1])) == list(vals[::-1])
+    assert len(m.getVals([])) == 0
+
+
+class LPBulkEvent(Eventhdlr):
+
+    def eventinit(self):
+        self.model.catchEvent(SCIP_EVENTTYPE.FIRSTLPSOLVED, self)
+
+    def eventexit(self):
+        self.model.dropEvent(SCIP_EVENTTYPE.FIRSTLPSOLVED, self)
+
+    def eventexec(self, event):
+        x = self.model.getVars(transformed=True)
+        assert list(self.model.getVarRedcosts(x)) == [self.model.getVarRedcost(v) for v in x]
+
+        rows = self.model.getLPRowsData()
+        activities = [self.model.getRowLPActivity(row) for row in rows]
+        assert list(self.model.getRowLPActivities()) == activities
+        assert list(self.model.getRowLPActivities(rows)) == activities
+        self.checked = True
+
+
+def test_lp_bulk_values():
+    pytest.importorskip("numpy")
+    m = Model()
+    m.hideOutput()
+    m.setPresolve(SCIP_PARAMSETTING.OFF)
+    eventhdlr = LPBulkEvent()
+    eventhdlr.checked = False
+    m.includeEventhdlr(eventhdlr, "LPBulkEvent", "python event handler to check the bulk LP getters")
+
+    x = m.addVar("x", obj=1.0)
+    y = m.addVar("y", obj=2.0)
+    m.addCons(x + 2*y >= 5)
+    m.addCons(x - y <= 3)
+
+    m.optimize()
+    assert eventhdlr.checked
+
 if __name__ == "__main__":
     test_solution_getbest()
     test_solution_create()
+    test_solution_bulk_values()
+    test_lp_bulk_values()
@@ -33,6 +33,32 @@ class NodeEventHandler(Eventhdlr):
         assert len(bound_changes) == 1
 
 
+class LeafEventHandler(Eventhdlr):
+
+    def __init__(self):
+        self.nleaves = 0
+
+    def eventinit(self):
+        self.model.catchEvent(SCIP_EVENTTYPE.NODEFOCUSED, self)
+
+    def eventexit(self):
+        self.model.dropEvent(SCIP_EVENTTYPE.NODEFOCUSED, self)
+
+    def eventexec(self, event):
+        leaves, children, siblings = self.model.getOpenNodes()
+
+        for leaf in leaves:
+            variables, branchbounds, boundtypes = leaf.getParentBranchings()
+            bound_changes = leaf.getDomchg().getBoundchgs()
+            assert len(bound_changes) == len(variables)
+
+            for bound_change, variable, branchbound in zip(bound_changes, variables, branchbounds):
+                assert bound_change.getVar().name == variable.name
+                assert bound_change.getNewBound() == branchbound
+
+            self.nleaves += 1
+
+
 def test_tree():
     # create solver instance
     s = Model()
@@ -62,5 +88,30 @@ def test_tree():
 
     assert len(node_eventhdlr.calls) > 3
 
+
+def test_compact_leaves():
+    s = Model()
+    s.setMaximize()
+    s.hideOutput()
+    s.setPresolve(SCIP_PARAMSETTING.OFF)
+    s.setHeuristics(SCIP_PARAMSETTING.OFF)
+    s.setSeparating(SCIP_PARAMSETTING.OFF)
+
+    # store the branching decisions of all leaves compactly
+    s.setRealParam("memory/compactfac", 0.0)
+    leaf_eventhdlr = LeafEventHandler()
+    s.includeEventhdlr(leaf_eventhdlr, "LeafEventHandler", "python event handler to read the bound changes of leaves")
+
+    n = 12
+    x = [s.addVar("x{}".format(i), obj=i + 3, vtype="BINARY") for i in range(n)]
+    s.addCons(sum((2 * i + 5) * x[i] for i in range(n)) <= 57)
+    s.optimize()
+
+    assert s.getStatus() == "optimal"
+    assert leaf_eventhdlr.nleaves > 0
+
+    del s
+
+
 if __name__ == "__main__":
     test_tree()
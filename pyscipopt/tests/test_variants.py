@@ -0,0 +1,65 @@
+from pyscipopt import Model, VariantSession, OrbitopeType, quicksum
+
+def build_multiple_knapsack():
+    s = Model("MultipleKnapsack")
+    s.hideOutput()
+    s.setMaximize()
+
+    weights = [4, 2, 6, 3, 7, 5, 4, 2]
+    nknapsacks = 3
+    capacity = 9
+
+    x = [[s.addVar("x_%d_%d" % (i, j), vtype='B', obj=weights[i]) for j in range(nknapsacks)] for i in range(len(weights))]
+
+    for i in range(len(weights)):
+        s.addCons(quicksum(x[i]) <= 1)
+
+    for j in range(nknapsacks):
+        s.addCons(quicksum(weights[i] * x[i][j] for i in range(len(weights))) <= capacity)
+
+    return s, x, weights
+
+def test_variants():
+    s, x, weights = build_multiple_knapsack()
+    nconss = s.getNConss()
+    nvars = len(s.getVars())
+
+    # parameters of the caller's base model must survive the variants
+    s.setParam('randomization/randomseedshift', 7)
+    s.setParam('display/freq', 50)
+
+    session = VariantSession(s, params={'limits/time': 60})
+
+    def add_makespan_orbitope(model):
+        cons = model.addConsOrbitope(x, OrbitopeType.PACKING.value, usedynamicprop=False, resolveprop=False,
+                                     ismodelcons=False, mayinteract=False, enforce=False)
+        model.includeActivationMakespan()
+        model.registerConsActivationMakespan(cons, x, weights)
+
+    def add_cutoff_variable(model):
+        model.setParam('randomization/randomseedshift', 3)
+        model.setParam('propagating/maxrounds', 5)
+        y = model.addVar("y", vtype='B', obj=-1.0)
+        model.addCons(y >= x[0][0])
+
+    def collect(model):
+        return model.getStatus(), model.getObjVal()
+
+    results = [session.solve(variant, collect) for variant in [lambda model: None, add_makespan_orbitope,
+                                                               add_makespan_orbitope, add_cutoff_variable]]
+
+    # all variants are rolled back to the base model
+    assert s.getNConss() == nconss
+    assert len(s.getVars()) == nvars
+    assert s.getParam('randomization/randomseedshift') == 7
+    assert s.getParam('display/freq') == 50
+    assert s.getParam('propagating/maxrounds') == 100
+    assert s.getParam('limits/time') == 1e+20
+
+    # symmetry handling does not change the optimal value
+    assert all(status == 'optimal' for status, _ in results)
+    assert results[0][1] == results[1][1] == results[2][1]
+    assert results[3][1] <= results[0][1]
+
+if __name__ == "__main__":
+    test_variants()
@@ -782,11 +782,18 @@ struct SCIP_LPi
    SCIP_MESSAGEHDLR*     messagehdlr;        /**< messagehdlr handler to printing messages, or NULL */
 };
 
-/** LPi state stores basis information */
+/** LPi state stores basis information
+ *
+ *  The basis status is packed with two bits per entry. If it is shorter, the packed array is stored run-length encoded
+ *  as pairs (packet, number of repetitions); this is detected by the number of stored packets being smaller than the
+ *  number of packets of the plain packed array.
+ */
 struct SCIP_LPiState
 {
    int                   ncols;              /**< number of LP columns */
    int                   nrows;              /**< number of LP rows */
+   int                   ncolpackets;        /**< number of stored column packets */
+   int                   nrowpackets;        /**< number of stored row packets */
    COLPACKET*            packcstat;          /**< column basis status in compressed form */
    ROWPACKET*            packrstat;          /**< row basis status in compressed form */
 };
@@ -874,20 +881,137 @@ int rowpacketNum(
    return (nrows+(int)ROWS_PER_PACKET-1)/(int)ROWS_PER_PACKET;
 }
 
+/** stores an array of packets in block memory, run-length encoded if this needs less memory */
+static
+SCIP_RETCODE dualpacketsStore(
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   const SCIP_DUALPACKET* packets,           /**< plain packed array */
+   int                   npackets,           /**< number of packets in plain packed array */
+   SCIP_DUALPACKET**     storedpackets,      /**< pointer to store the (possibly run-length encoded) array */
+   int*                  nstoredpackets      /**< pointer to store the number of stored packets */
+   )
+{
+   int nruns;
+   int i;
+
+   assert(packets != NULL || npackets == 0);
+   assert(storedpackets != NULL);
+   assert(nstoredpackets != NULL);
+
+   /* count the runs of equal packets; bases have long runs of columns at their lower bound and of basic rows */
+   nruns = 0;
+   for( i = 0; i < npackets; ++i )
+   {
+      if( i == 0 || packets[i] != packets[i-1] )
+         ++nruns;
+   }
+
+   if( 2 * nruns < npackets )
+   {
+      int r;
+
+      *nstoredpackets = 2 * nruns;
+      SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, storedpackets, *nstoredpackets) );
+
+      r = -2;
+      for( i = 0; i < npackets; ++i )
+      {
+         if( i == 0 || packets[i] != packets[i-1] )
+         {
+            r += 2;
+            (*storedpackets)[r] = packets[i];
+            (*storedpackets)[r+1] = 1;
+         }
+         else
+            ++(*storedpackets)[r+1];
+      }
+      assert(r == *nstoredpackets - 2);
+   }
+   else
+   {
+      *nstoredpackets = npackets;
+      SCIP_ALLOC( BMSduplicateBlockMemoryArray(blkmem, storedpackets, packets, npackets) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** unpacks an array of packets stored with dualpacketsStore() */
+static
+void dualpacketsLoad(
+   const SCIP_DUALPACKET* storedpackets,     /**< stored (possibly run-length encoded) array */
+   int                   nstoredpackets,     /**< number of stored packets */
+   int*                  stat,               /**< buffer for storing basis status in unpacked format */
+   int                   count               /**< number of basis status entries */
+   )
+{
+   const int packetsize = (int)SCIP_DUALPACKETSIZE;
+   int pos;
+   int r;
+
+   assert(storedpackets != NULL || nstoredpackets == 0);
+   assert(stat != NULL || count == 0);
+
+   /* plain packed array */
+   if( nstoredpackets == (count + packetsize - 1) / packetsize )
+   {
+      SCIPdecodeDualBit(storedpackets, stat, count);
+      return;
+   }
+
+   /* run-length encoded array */
+   assert(nstoredpackets % 2 == 0);
+   pos = 0;
+   for( r = 0; r < nstoredpackets; r += 2 )
+   {
+      SCIP_DUALPACKET k;
+
+      for( k = 0; k < storedpackets[r+1]; ++k )
+      {
+         assert(pos < count);
+         SCIPdecodeDualBit(&storedpackets[r], &stat[pos], MIN(packetsize, count - pos));
+         pos += packetsize;
+      }
+   }
+   assert(pos >= count && pos < count + packetsize);
+}
+
 /** store row and column basis status in a packed LPi state object */
 static
-void lpistatePack(
+SCIP_RETCODE lpistatePack(
    SCIP_LPISTATE*       lpistate,            /**< pointer to LPi state data */
+   BMS_BLKMEM*          blkmem,              /**< block memory */
    const int*           cstat,               /**< basis status of columns in unpacked format */
    const int*           rstat                /**< basis status of rows in unpacked format */
    )
 {
+   SCIP_DUALPACKET* packets;
+   int nColPackets;
+   int nRowPackets;
+   SCIP_RETCODE retcode;
+
    assert(lpistate != NULL);
-   assert(lpistate->packcstat != NULL);
-   assert(lpistate->packrstat != NULL);
+   assert(lpistate->packcstat == NULL);
+   assert(lpistate->packrstat == NULL);
+
+   nColPackets = colpacketNum(lpistate->ncols);
+   nRowPackets = rowpacketNum(lpistate->nrows);
+
+   /* pack into a temporary array, which is then stored in its shortest form */
+   SCIP_ALLOC( BMSallocMemoryArray(&packets, MAX(MAX(nColPackets, nRowPackets), 1)) );
+
+   SCIPencodeDualBit(cstat, packets, lpistate->ncols);
+   retcode = dualpacketsStore(blkmem, packets, nColPackets, &lpistate->packcstat, &lpistate->ncolpackets);
+
+   if( retcode == SCIP_OKAY )
+   {
+      SCIPencodeDualBit(rstat, packets, lpistate->nrows);
+      retcode = dualpacketsStore(blkmem, packets, nRowPackets, &lpistate->packrstat, &lpistate->nrowpackets);
+   }
 
-   SCIPencodeDualBit(cstat, lpistate->packcstat, lpistate->ncols);
-   SCIPencodeDualBit(rstat, lpistate->packrstat, lpistate->nrows);
+   BMSfreeMemoryArray(&packets);
+
+   return retcode;
 }
 
 /** unpacks row and column basis status from a packed LPi state object */
@@ -902,11 +1026,11 @@ void lpistateUnpack(
    assert(lpistate->packcstat != NULL);
    assert(lpistate->packrstat != NULL);
 
-   SCIPdecodeDualBit(lpistate->packcstat, cstat, lpistate->ncols);
-   SCIPdecodeDualBit(lpistate->packrstat, rstat, lpistate->nrows);
+   dualpacketsLoad(lpistate->packcstat, lpistate->ncolpackets, cstat, lpistate->ncols);
+   dualpacketsLoad(lpistate->packrstat, lpistate->nrowpackets, rstat, lpistate->nrows);
 }
 
-/** creates LPi state information object */
+/** creates LPi state information object; the basis status is stored by lpistatePack() */
 static
 SCIP_RETCODE lpistateCreate(
    SCIP_LPISTATE**       lpistate,           /**< pointer to LPi state */
@@ -920,12 +1044,13 @@ SCIP_RETCODE lpistateCreate(
    assert(ncols >= 0);
    assert(nrows >= 0);
 
-   int nColPackets = colpacketNum(ncols);
-   int nRowPackets = rowpacketNum(nrows);
-
    SCIP_ALLOC( BMSallocBlockMemory(blkmem, lpistate) );
-   SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &(*lpistate)->packcstat, nColPackets) );
-   SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &(*lpistate)->packrstat, nRowPackets) );
+   (*lpistate)->ncols = ncols;
+   (*lpistate)->nrows = nrows;
+   (*lpistate)->ncolpackets = 0;
+   (*lpistate)->nrowpackets = 0;
+   (*lpistate)->packcstat = NULL;
+   (*lpistate)->packrstat = NULL;
 
    return SCIP_OKAY;
 }
@@ -941,11 +1066,8 @@ void lpistateFree(
    assert(lpistate != NULL);
    assert(*lpistate != NULL);
 
-   int nColPackets = colpacketNum((*lpistate)->ncols);
-   int nRowPackets = rowpacketNum((*lpistate)->nrows);
-
-   BMSfreeBlockMemoryArray(blkmem, &(*lpistate)->packcstat, nColPackets);
-   BMSfreeBlockMemoryArray(blkmem, &(*lpistate)->packrstat, nRowPackets);
+   BMSfreeBlockMemoryArrayNull(blkmem, &(*lpistate)->packcstat, (*lpistate)->ncolpackets);
+   BMSfreeBlockMemoryArrayNull(blkmem, &(*lpistate)->packrstat, (*lpistate)->nrowpackets);
    BMSfreeBlockMemory(blkmem, lpistate);
 }
 
@@ -3922,9 +4044,7 @@ SCIP_RETCODE SCIPlpiGetState(
    SCIP_CALL( SCIPlpiGetBase(lpi, lpi->cstat, lpi->rstat) );
 
    /* pack LPi state data */
-   (*lpistate)->ncols = ncols;
-   (*lpistate)->nrows = nrows;
-   lpistatePack(*lpistate, lpi->cstat, lpi->rstat);
+   SCIP_CALL( lpistatePack(*lpistate, blkmem, lpi->cstat, lpi->rstat) );
 
    return SCIP_OKAY;
 }
@@ -217,6 +217,55 @@ SCIP_RETCODE SCIPactivationhdlrFindActivationData(
    return SCIP_OKAY;
 }
 
+/** calls constraint deletion method of activation handler */
+SCIP_RETCODE SCIPactivationhdlrConsDelete(
+   SCIP_ACTIVATIONHDLR*  activationhdlr,     /**< activation handler */
+   SCIP_CONS*            cons,               /**< original constraint that is freed */
+   SCIP_SET*             set                 /**< global SCIP settings */
+   )
+{
+   assert(activationhdlr != NULL);
+   assert(cons != NULL);
+   assert(set != NULL);
+
+   if( activationhdlr->activationconsdelete != NULL )
+   {
+      SCIP_CALL( activationhdlr->activationconsdelete(set->scip, activationhdlr, cons) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** calls constraint copying method of activation handler */
+SCIP_RETCODE SCIPactivationhdlrConsCopy(
+   SCIP_ACTIVATIONHDLR*  activationhdlr,     /**< activation handler of the target SCIP */
+   SCIP_SET*             set,                /**< global SCIP settings of the target SCIP */
+   SCIP*                 sourcescip,         /**< source SCIP data structure */
+   SCIP_ACTIVATIONHDLR*  sourceactivationhdlr, /**< activation handler of the source SCIP */
+   SCIP_CONS*            sourcecons,         /**< constraint of the source SCIP */
+   SCIP_CONS*            targetcons,         /**< copied constraint of the target SCIP */
+   SCIP_HASHMAP*         varmap,             /**< hashmap mapping source variables to target variables */
+   SCIP_Bool*            valid               /**< pointer to store whether the registration could be copied */
+   )
+{
+   assert(activationhdlr != NULL);
+   assert(set != NULL);
+   assert(sourceactivationhdlr != NULL);
+   assert(sourcecons != NULL);
+   assert(targetcons != NULL);
+   assert(valid != NULL);
+
+   *valid = FALSE;
+
+   if( activationhdlr->activationconscopy != NULL )
+   {
+      SCIP_CALL( activationhdlr->activationconscopy(set->scip, activationhdlr, sourcescip, sourceactivationhdlr,
+            sourcecons, targetcons, varmap, valid) );
+   }
+
+   return SCIP_OKAY;
+}
+
 /** gets user data of activation handler */
 SCIP_ACTIVATIONHDLRDATA* SCIPactivationhdlrGetData(
    SCIP_ACTIVATIONHDLR*  activationhdlr      /**< activation handler */
@@ -304,6 +353,28 @@ void SCIPactivationhdlrSetFindActivationData(
    activationhdlr->activationfindactivationdata = activationfindactivationdata;
 }
 
+/** sets constraint deletion method of activation handler */
+void SCIPactivationhdlrSetConsDelete(
+   SCIP_ACTIVATIONHDLR*  activationhdlr,        /**< activation handler */
+   SCIP_DECL_ACTIVATIONCONSDELETE((*activationconsdelete))     /**< constraint deletion method of activation handler */
+   )
+{
+   assert(activationhdlr != NULL);
+
+   activationhdlr->activationconsdelete = activationconsdelete;
+}
+
+/** sets constraint copying method of activation handler */
+void SCIPactivationhdlrSetConsCopy(
+   SCIP_ACTIVATIONHDLR*  activationhdlr,        /**< activation handler */
+   SCIP_DECL_ACTIVATIONCONSCOPY((*activationconscopy))     /**< constraint copying method of activation handler */
+   )
+{
+   assert(activationhdlr != NULL);
+
+   activationhdlr->activationconscopy = activationconscopy;
+}
+
 /** gets name of activation handler */
 const char* SCIPactivationhdlrGetName(
       SCIP_ACTIVATIONHDLR*  activationhdlr      /**< activation handler */
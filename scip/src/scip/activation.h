@@ -92,6 +92,25 @@ SCIP_RETCODE SCIPactivationhdlrFindActivationData(
    void*                 activationdata      /**< pointer to store the result to */
 );
 
+/** calls constraint deletion method of activation handler */
+SCIP_RETCODE SCIPactivationhdlrConsDelete(
+   SCIP_ACTIVATIONHDLR*  activationhdlr,     /**< activation handler */
+   SCIP_CONS*            cons,               /**< original constraint that is freed */
+   SCIP_SET*             set                 /**< global SCIP settings */
+   );
+
+/** calls constraint copying method of activation handler */
+SCIP_RETCODE SCIPactivationhdlrConsCopy(
+   SCIP_ACTIVATIONHDLR*  activationhdlr,     /**< activation handler of the target SCIP */
+   SCIP_SET*             set,                /**< global SCIP settings of the target SCIP */
+   SCIP*                 sourcescip,         /**< source SCIP data structure */
+   SCIP_ACTIVATIONHDLR*  sourceactivationhdlr, /**< activation handler of the source SCIP */
+   SCIP_CONS*            sourcecons,         /**< constraint of the source SCIP */
+   SCIP_CONS*            targetcons,         /**< copied constraint of the target SCIP */
+   SCIP_HASHMAP*         varmap,             /**< hashmap mapping source variables to target variables */
+   SCIP_Bool*            valid               /**< pointer to store whether the registration could be copied */
+   );
+
 /** sets copy method of activation handler */
 void SCIPactivationhdlrSetCopy(
    SCIP_ACTIVATIONHDLR*  activationhdlr,        /**< activation handler */
@@ -128,6 +147,18 @@ void SCIPactivationhdlrSetFindActivationData(
    SCIP_DECL_ACTIVATIONFINDDATA((*activationfindactivationdata))     /**< TODO */
    );
 
+/** sets constraint deletion method of activation handler */
+void SCIPactivationhdlrSetConsDelete(
+   SCIP_ACTIVATIONHDLR*  activationhdlr,        /**< activation handler */
+   SCIP_DECL_ACTIVATIONCONSDELETE((*activationconsdelete))     /**< constraint deletion method of activation handler */
+   );
+
+/** sets constraint copying method of activation handler */
+void SCIPactivationhdlrSetConsCopy(
+   SCIP_ACTIVATIONHDLR*  activationhdlr,        /**< activation handler */
+   SCIP_DECL_ACTIVATIONCONSCOPY((*activationconscopy))     /**< constraint copying method of activation handler */
+   );
+
 #ifdef __cplusplus
 }
 #endif
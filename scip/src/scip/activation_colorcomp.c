@@ -29,7 +29,6 @@
 #include "scip/pub_activation.h"
 #include "scip/type_activation.h"
 #include "scip/struct_activation.h"
-#include "scip/struct_cons.h"
 #include "scip/struct_misc.h"
 #include "scip/activation_colorcomp.h"
 
@@ -182,7 +181,7 @@ SCIP_RETCODE storeConsGraphData(
    graphdata->allcolorpairs = allcolorpairs;
    graphdata->strategy = strategy;
 
-   SCIP_CALL( SCIPhashmapInsert(activationhdlrdata->consmap, cons, (void*)graphdata) );
+   SCIP_CALL( SCIPhashmapSetImage(activationhdlrdata->consmap, cons, (void*)graphdata) );
 
    SCIP_CALL( SCIPsetConsActivationhdlr(scip, cons, activationhdlr) );
 
@@ -589,11 +588,9 @@ SCIP_DECL_ACTIVATIONCOPY(activationCopyColorComp)
    assert(activationhdlr != NULL);
    assert(strcmp(SCIPactivationhdlrGetName(activationhdlr), ACTIVATION_NAME) == 0);
 
-   /* call inclusion method of activation handler */
+   /* call inclusion method of activation handler; the data of the constraints is copied with the constraints */
    SCIP_CALL( SCIPincludeActivationColorComp(scip) );
 
-   // TODO: copy data! (?)
-
    return SCIP_OKAY;
 }
 
@@ -624,6 +621,103 @@ SCIP_DECL_ACTIVATIONFREE(activationFreeColorComp)
    return SCIP_OKAY;
 }
 
+/** constraint deletion method of activation handler */
+static
+SCIP_DECL_ACTIVATIONCONSDELETE(activationConsDeleteColorComp)
+{
+   SCIP_ACTIVATIONHDLRDATA* activationhdlrdata;
+   GRAPHDATA* graphdata;
+
+   assert(scip != NULL);
+   assert(activationhdlr != NULL);
+   assert(cons != NULL);
+   assert(strcmp(SCIPactivationhdlrGetName(activationhdlr), ACTIVATION_NAME) == 0);
+
+   activationhdlrdata = SCIPactivationhdlrGetData(activationhdlr);
+   assert(activationhdlrdata != NULL);
+
+   graphdata = (GRAPHDATA*)SCIPhashmapGetImage(activationhdlrdata->consmap, cons);
+
+   if( graphdata != NULL )
+   {
+      SCIP_CALL( removeGraphData(scip, &graphdata) );
+      SCIP_CALL( SCIPhashmapRemove(activationhdlrdata->consmap, cons) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** constraint copying method of activation handler */
+static
+SCIP_DECL_ACTIVATIONCONSCOPY(activationConsCopyColorComp)
+{
+   SCIP_ACTIVATIONHDLRDATA* sourceactivationhdlrdata;
+   GRAPHDATA* graphdata;
+   SCIP_CONS* origcons;
+   SCIP_VAR*** matrix;
+   int i;
+   int c;
+
+   assert(scip != NULL);
+   assert(activationhdlr != NULL);
+   assert(sourceactivationhdlr != NULL);
+   assert(sourcecons != NULL);
+   assert(targetcons != NULL);
+   assert(valid != NULL);
+   assert(strcmp(SCIPactivationhdlrGetName(activationhdlr), ACTIVATION_NAME) == 0);
+
+   *valid = FALSE;
+
+   if( varmap == NULL )
+      return SCIP_OKAY;
+
+   /* the data of the source constraint is stored with the same key as in activationFindActivationDataColorComp() */
+   origcons = SCIPconsGetOriginal(sourcecons);
+
+   if( origcons == NULL )
+      origcons = sourcecons;
+
+   sourceactivationhdlrdata = SCIPactivationhdlrGetData(sourceactivationhdlr);
+   assert(sourceactivationhdlrdata != NULL);
+
+   graphdata = (GRAPHDATA*)SCIPhashmapGetImage(sourceactivationhdlrdata->consmap, origcons);
+
+   if( graphdata == NULL )
+      return SCIP_OKAY;
+
+   /* map the coloring variables to the target SCIP; variables that were removed by presolving are copied as well */
+   SCIP_CALL( SCIPallocBufferArray(scip, &matrix, graphdata->nvertices) );
+
+   for( i = 0; i < graphdata->nvertices; ++i )
+   {
+      SCIP_CALL( SCIPallocBufferArray(scip, &matrix[i], graphdata->ncolors) );
+   }
+
+   *valid = TRUE;
+
+   for( i = 0; i < graphdata->nvertices && *valid; ++i )
+   {
+      for( c = 0; c < graphdata->ncolors && *valid; ++c )
+      {
+         SCIP_CALL( SCIPgetVarCopy(sourcescip, scip, graphdata->matrix[i][c], &matrix[i][c], varmap, NULL, TRUE, valid) );
+      }
+   }
+
+   if( *valid )
+   {
+      SCIP_CALL( storeConsGraphData(scip, activationhdlr, targetcons, matrix, graphdata->nvertices, graphdata->ncolors,
+            graphdata->adjacencies, graphdata->nadjacencies, graphdata->allcolorpairs, graphdata->strategy) );
+   }
+
+   for( i = graphdata->nvertices - 1; i >= 0; --i )
+   {
+      SCIPfreeBufferArray(scip, &matrix[i]);
+   }
+   SCIPfreeBufferArray(scip, &matrix);
+
+   return SCIP_OKAY;
+}
+
 /** is active method of activation handler */
 static
 SCIP_DECL_ACTIVATIONFINDDATA(activationFindActivationDataColorComp)
@@ -637,14 +731,11 @@ SCIP_DECL_ACTIVATIONFINDDATA(activationFindActivationDataColorComp)
    assert(cons != NULL);
    assert(strcmp(SCIPactivationhdlrGetName(activationhdlr), ACTIVATION_NAME) == 0);
 
-   /* get original constraint */
-   origcons = cons;
+   /* get original constraint; constraints that were created in the transformed problem are their own key */
+   origcons = SCIPconsGetOriginal(cons);
 
-   if( !SCIPconsIsOriginal(origcons) )
-   {
-      // TODO: there is no API for this?
-      origcons = origcons->transorigcons;
-   }
+   if( origcons == NULL )
+      origcons = cons;
 
    /* get activation handler data */
    activationhdlrdata = SCIPactivationhdlrGetData(activationhdlr);
@@ -722,6 +813,60 @@ SCIP_DECL_ACTIVATIONINIT(activationInitColorComp)
 }
 
 
+/** deinitializes the activation handler by replacing the transformed variables by their original counterparts again */
+static
+SCIP_DECL_ACTIVATIONEXIT(activationExitColorComp)
+{
+   SCIP_ACTIVATIONHDLRDATA* activationhdlrdata;
+   GRAPHDATA* graphdata;
+   SCIP_HASHMAPENTRY* entry;
+   SCIP_Real scalar;
+   SCIP_Real constant;
+   int nentries;
+   int i;
+   int j;
+   int m;
+
+   /* get activation handler data */
+   activationhdlrdata = SCIPactivationhdlrGetData(activationhdlr);
+   assert(activationhdlrdata != NULL);
+
+   nentries = SCIPhashmapGetNEntries(activationhdlrdata->consmap);
+
+   for( i = 0; i < nentries; ++i )
+   {
+      entry = SCIPhashmapGetEntry(activationhdlrdata->consmap, i);
+
+      /* constraints that only exist in the transformed problem keep their transformed variables until they are freed */
+      if( entry != NULL && SCIPconsIsOriginal((SCIP_CONS*)SCIPhashmapEntryGetOrigin(entry)) )
+      {
+         graphdata = (GRAPHDATA*)SCIPhashmapEntryGetImage(entry);
+
+         for( j = 0; j < graphdata->nvertices; ++j )
+         {
+            for( m = 0; m < graphdata->ncolors; ++m )
+            {
+               if( SCIPvarIsOriginal(graphdata->matrix[j][m]) )
+                  continue;
+
+               scalar = 1.0;
+               constant = 0.0;
+               SCIP_CALL( SCIPvarGetOrigvarSum(&(graphdata->matrix[j][m]), &scalar, &constant) );
+
+               if( graphdata->matrix[j][m] == NULL || !SCIPisEQ(scip, scalar, 1.0) || !SCIPisZero(scip, constant) )
+               {
+                  SCIPerrorMessage("Variable of constraint <%s> cannot be retransformed to an original variable.\n",
+                     SCIPconsGetName((SCIP_CONS*)SCIPhashmapEntryGetOrigin(entry)));
+                  return SCIP_INVALIDDATA;
+               }
+            }
+         }
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
 
 /*
  * Activation handler specific interface methods
@@ -768,11 +913,18 @@ SCIP_RETCODE SCIPincludeActivationColorComp(
 {
    SCIP_ACTIVATIONHDLRDATA* activationhdlrdata = NULL;
 
+   /* the handler is already included, e.g., by SCIPincludeDefaultPlugins() */
+   if( SCIPfindActivationhdlr(scip, ACTIVATION_NAME) != NULL )
+      return SCIP_OKAY;
+
    /* create activation handler data */
    SCIP_CALL( createActivationhdlrData(scip, &activationhdlrdata) );
 
-   SCIP_CALL( SCIPincludeActivationhdlr(scip, ACTIVATION_NAME, ACTIVATION_DESC, NULL,
-         activationFreeColorComp, activationInitColorComp, NULL, NULL, activationFindActivationDataColorComp, activationhdlrdata) );
+   SCIP_CALL( SCIPincludeActivationhdlr(scip, ACTIVATION_NAME, ACTIVATION_DESC, activationCopyColorComp,
+         activationFreeColorComp, activationInitColorComp, activationExitColorComp, NULL, activationFindActivationDataColorComp, activationhdlrdata) );
+
+   SCIP_CALL( SCIPsetActivationhdlrConsDelete(scip, SCIPfindActivationhdlr(scip, ACTIVATION_NAME), activationConsDeleteColorComp) );
+   SCIP_CALL( SCIPsetActivationhdlrConsCopy(scip, SCIPfindActivationhdlr(scip, ACTIVATION_NAME), activationConsCopyColorComp) );
 
    return SCIP_OKAY;
 }
@@ -53,7 +53,9 @@ SCIP_RETCODE SCIPregisterConsActivationColorComp(
 
 /** @} */
 
-/** creates the sub-orbitope activation handler and includes it in SCIP
+/** creates the color components activation handler and includes it in SCIP, unless it is already included
+ *
+ * The handlers are included by SCIPincludeDefaultPlugins(), so calling this afterwards does nothing.
  *
  * @ingroup ActivationhdlrIncludes
  */
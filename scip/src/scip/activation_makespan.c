@@ -47,6 +47,8 @@
 struct ActivationData
 {
     SCIP_VAR***           matrix;             /**< matrix of variables on which the symmetry acts (managed by the constraint): rows are jobs, columns are machines */
+    int*                  varindices;         /**< row-wise indices of the transformed matrix variables for reading their bounds from the bound mirror, or NULL if the bounds are not mirrored */
+    int                   varindicesrun;      /**< run in which the variable indices have been collected, or -1 if not collected yet */
     int*                  jobtimes;           /**< array that defines the processing time of each job */
     int                   nmachines;          /**< number of machines (number of columns in matrix) */
     int                   njobs;              /**< number of jobs (number of rows in matrix, size of jobtimes array) */
@@ -96,6 +98,8 @@ SCIP_RETCODE removeActivationData(
    SCIPhashmapFree(&(*activationdata)->newsymmakespans);
    SCIPhashmapFree(&(*activationdata)->makespans);
 
+   SCIPfreeBlockMemoryArrayNull(scip, &(*activationdata)->varindices, (*activationdata)->njobs * (*activationdata)->nmachines);
+
    SCIPfreeBlockMemoryArray(scip, &(*activationdata)->jobtimes, (*activationdata)->njobs);
 
    for( i = 0; i < (*activationdata)->njobs; ++i )
@@ -151,6 +155,8 @@ SCIP_RETCODE storeConsActivationData(
 
    activationdata->nmachines = nmachines;
    activationdata->njobs = njobs;
+   activationdata->varindices = NULL;
+   activationdata->varindicesrun = -1;
 
    SCIP_CALL( SCIPallocBlockMemoryArray(scip, &activationdata->matrix, njobs) );
    for( i = 0; i < njobs; ++i )
@@ -167,7 +173,7 @@ SCIP_RETCODE storeConsActivationData(
    SCIP_CALL( SCIPhashmapCreate(&activationdata->newsymmakespans, SCIPblkmem(scip), activationdata->nmachines / 2) );
 
 
-   SCIP_CALL( SCIPhashmapInsert(activationhdlrdata->consmap, cons, (void*)activationdata) );
+   SCIP_CALL( SCIPhashmapSetImage(activationhdlrdata->consmap, cons, (void*)activationdata) );
 
    SCIP_CALL( SCIPsetConsActivationhdlr(scip, cons, activationhdlr) );
 
@@ -205,6 +211,67 @@ SCIP_RETCODE removeAllActivationData(
    return SCIP_OKAY;
 }
 
+/** collects the indices of the matrix variables and enables the bound mirror, such that the bounds of a whole row of
+ *  the matrix can be read at once
+ *
+ *  Presolving may aggregate variables, so the indices are collected once per run. If the bounds of a matrix variable
+ *  are not mirrored, e.g., because it is aggregated, no indices are collected and the bounds have to be read from the
+ *  variables.
+ */
+static
+SCIP_RETCODE collectVarIndices(
+   SCIP*                 scip,               /**< SCIP data structure */
+   ACTIVATIONDATA*       activationdata,     /**< activation data structure */
+   SCIP_Bool*            mirrored            /**< pointer to store whether the bounds can be read from the bound mirror */
+   )
+{
+   int j;
+   int m;
+
+   assert(scip != NULL);
+   assert(activationdata != NULL);
+   assert(mirrored != NULL);
+
+   if( !SCIPisVarBoundMirrorEnabled(scip) )
+   {
+      SCIP_CALL( SCIPenableVarBoundMirror(scip) );
+   }
+
+   if( activationdata->varindicesrun == SCIPgetNRuns(scip) )
+   {
+      *mirrored = (activationdata->varindices != NULL);
+      return SCIP_OKAY;
+   }
+
+   activationdata->varindicesrun = SCIPgetNRuns(scip);
+   *mirrored = FALSE;
+
+   if( activationdata->varindices == NULL )
+   {
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &activationdata->varindices, activationdata->njobs * activationdata->nmachines) );
+   }
+
+   for( j = 0; j < activationdata->njobs; ++j )
+   {
+      for( m = 0; m < activationdata->nmachines; ++m )
+      {
+         assert(SCIPvarIsTransformed(activationdata->matrix[j][m]));
+
+         if( !SCIPisVarBoundMirrored(scip, activationdata->matrix[j][m]) )
+         {
+            SCIPfreeBlockMemoryArray(scip, &activationdata->varindices, activationdata->njobs * activationdata->nmachines);
+            return SCIP_OKAY;
+         }
+
+         activationdata->varindices[j * activationdata->nmachines + m] = SCIPvarGetIndex(activationdata->matrix[j][m]);
+      }
+   }
+
+   *mirrored = TRUE;
+
+   return SCIP_OKAY;
+}
+
 /*
  * Find the sub-symmetries corresponding to machines that have equal fixed makespan over jobs 1..k, for every k.
  *
@@ -242,7 +309,9 @@ SCIP_RETCODE findSubSymmetries(
    int e;
    int k;
    int i;
-   SCIP_VAR* var;
+   SCIP_Real* rowlbs;
+   SCIP_Real* rowubs;
+   SCIP_Bool mirrored;
    int count;
    SCIP_ACTIVATIONSUBMATRIX* subm;
    SCIP_HASHMAPENTRY* entry;
@@ -268,6 +337,15 @@ SCIP_RETCODE findSubSymmetries(
    submatrixcount = 0;
 #endif
 
+   /* during the solving process, the bounds of every row are read at once from the bound mirror */
+   mirrored = FALSE;
+   if( SCIPgetStage(scip) == SCIP_STAGE_SOLVING )
+   {
+      SCIP_CALL( collectVarIndices(scip, activationdata, &mirrored) );
+   }
+   SCIP_CALL( SCIPallocBufferArray(scip, &rowlbs, activationdata->nmachines) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &rowubs, activationdata->nmachines) );
+
    /* Record for every machine the makespan that is fixed at this node
     * For a given job k, fixedmakespan[m] is equal to the makespan of this machine up to job k
     * fixedmakespan[m] is -1 when x_{j,m} is not fixed to either 0 or 1 for some j=1, ... k (indeterminate) */
@@ -286,6 +364,20 @@ SCIP_RETCODE findSubSymmetries(
    /* Iterate over the rows of the matrix */
    for( j = 0; j < activationdata->njobs; ++j )
    {
+      if( mirrored )
+      {
+         SCIPgetMirroredVarBoundsLocal(scip, &activationdata->varindices[j * activationdata->nmachines],
+            activationdata->nmachines, rowlbs, rowubs);
+      }
+      else
+      {
+         for( m = 0; m < activationdata->nmachines; ++m )
+         {
+            rowlbs[m] = SCIPvarGetLbLocal(activationdata->matrix[j][m]);
+            rowubs[m] = SCIPvarGetUbLocal(activationdata->matrix[j][m]);
+         }
+      }
+
       /* Check if we found sub-symmetries in the previous row, and process them */
       if( !SCIPhashmapIsEmpty(activationdata->newsymmakespans) )
       {
@@ -321,7 +413,7 @@ SCIP_RETCODE findSubSymmetries(
             allfixedzero = TRUE;
             for( i = 0; i < subm->ncols; ++i )
             {
-               if( SCIPvarGetUbLocal(activationdata->matrix[j][subm->cols[i]]) > 0.5 )
+               if( rowubs[subm->cols[i]] > 0.5 )
                {
                   allfixedzero = FALSE;
                   break;
@@ -391,9 +483,7 @@ SCIP_RETCODE findSubSymmetries(
 
          allundetermined = FALSE;
 
-         var = activationdata->matrix[j][m];
-
-         if( SCIPvarGetLbLocal(var) > 0.5 )
+         if( rowlbs[m] > 0.5 )
          {
             /* Fixed to 1, fixed makespan of this machine increases with the size of this job
              * Decrease the makespan counter for the current value */
@@ -419,7 +509,7 @@ SCIP_RETCODE findSubSymmetries(
                   SCIPhashmapInsertInt(activationdata->newsymmakespans, (void*)(size_t)fixedmakespan[m], 0);
             }
          }
-         else if( !(SCIPvarGetUbLocal(var) < 0.5) )
+         else if( !(rowubs[m] < 0.5) )
          {
             /* Not fixed (to either 0 or 1), then its fixed makespan becomes indeterminate from now on */
 
@@ -443,6 +533,8 @@ SCIP_RETCODE findSubSymmetries(
 
    SCIPfreeBufferArray(scip, &reinsertmakespans);
    SCIPfreeBufferArray(scip, &fixedmakespan);
+   SCIPfreeBufferArray(scip, &rowubs);
+   SCIPfreeBufferArray(scip, &rowlbs);
 
 #ifdef SCIP_DEBUG
    if( submatrixcount > 0 )
@@ -503,6 +595,65 @@ SCIP_DECL_ACTIVATIONINIT(activationInitMakespan)
    return SCIP_OKAY;
 }
 
+/* Deinitializes the activation handler by replacing the transformed variables by their original counterparts again,
+ * such that the transformed problem can be freed and the problem can be solved again */
+static
+SCIP_DECL_ACTIVATIONEXIT(activationExitMakespan)
+{
+   SCIP_ACTIVATIONHDLRDATA* activationhdlrdata;
+   ACTIVATIONDATA* activationdata;
+   SCIP_HASHMAPENTRY* entry;
+   SCIP_Real scalar;
+   SCIP_Real constant;
+   int nentries;
+   int i;
+   int j;
+   int m;
+
+   /* get activation handler data */
+   activationhdlrdata = SCIPactivationhdlrGetData(activationhdlr);
+   assert(activationhdlrdata != NULL);
+
+   nentries = SCIPhashmapGetNEntries(activationhdlrdata->consmap);
+
+   for( i = 0; i < nentries; ++i )
+   {
+      entry = SCIPhashmapGetEntry(activationhdlrdata->consmap, i);
+
+      /* constraints that only exist in the transformed problem keep their transformed variables until they are freed */
+      if( entry != NULL && SCIPconsIsOriginal((SCIP_CONS*)SCIPhashmapEntryGetOrigin(entry)) )
+      {
+         activationdata = (ACTIVATIONDATA*)SCIPhashmapEntryGetImage(entry);
+
+         /* the variable indices refer to the transformed variables */
+         SCIPfreeBlockMemoryArrayNull(scip, &activationdata->varindices, activationdata->njobs * activationdata->nmachines);
+         activationdata->varindicesrun = -1;
+
+         for( j = 0; j < activationdata->njobs; ++j )
+         {
+            for( m = 0; m < activationdata->nmachines; m++ )
+            {
+               if( SCIPvarIsOriginal(activationdata->matrix[j][m]) )
+                  continue;
+
+               scalar = 1.0;
+               constant = 0.0;
+               SCIP_CALL( SCIPvarGetOrigvarSum(&(activationdata->matrix[j][m]), &scalar, &constant) );
+
+               if( activationdata->matrix[j][m] == NULL || !SCIPisEQ(scip, scalar, 1.0) || !SCIPisZero(scip, constant) )
+               {
+                  SCIPerrorMessage("Variable of constraint <%s> cannot be retransformed to an original variable.\n",
+                     SCIPconsGetName((SCIP_CONS*)SCIPhashmapEntryGetOrigin(entry)));
+                  return SCIP_INVALIDDATA;
+               }
+            }
+         }
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
 /** copy method for activation handler plugins (called when SCIP copies plugins) */
 static
 SCIP_DECL_ACTIVATIONCOPY(activationCopyMakespan)
@@ -511,11 +662,9 @@ SCIP_DECL_ACTIVATIONCOPY(activationCopyMakespan)
    assert(activationhdlr != NULL);
    assert(strcmp(SCIPactivationhdlrGetName(activationhdlr), ACTIVATION_NAME) == 0);
 
-   /* call inclusion method of activation handler */
+   /* call inclusion method of activation handler; the data of the constraints is copied with the constraints */
    SCIP_CALL( SCIPincludeActivationMakespan(scip) );
 
-   // TODO: copy data! (?)
-
    return SCIP_OKAY;
 }
 
@@ -546,6 +695,103 @@ SCIP_DECL_ACTIVATIONFREE(activationFreeMakespan)
    return SCIP_OKAY;
 }
 
+/** constraint deletion method of activation handler */
+static
+SCIP_DECL_ACTIVATIONCONSDELETE(activationConsDeleteMakespan)
+{
+   SCIP_ACTIVATIONHDLRDATA* activationhdlrdata;
+   ACTIVATIONDATA* adata;
+
+   assert(scip != NULL);
+   assert(activationhdlr != NULL);
+   assert(cons != NULL);
+   assert(strcmp(SCIPactivationhdlrGetName(activationhdlr), ACTIVATION_NAME) == 0);
+
+   activationhdlrdata = SCIPactivationhdlrGetData(activationhdlr);
+   assert(activationhdlrdata != NULL);
+
+   adata = (ACTIVATIONDATA*)SCIPhashmapGetImage(activationhdlrdata->consmap, cons);
+
+   if( adata != NULL )
+   {
+      SCIP_CALL( removeActivationData(scip, &adata) );
+      SCIP_CALL( SCIPhashmapRemove(activationhdlrdata->consmap, cons) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** constraint copying method of activation handler */
+static
+SCIP_DECL_ACTIVATIONCONSCOPY(activationConsCopyMakespan)
+{
+   SCIP_ACTIVATIONHDLRDATA* sourceactivationhdlrdata;
+   ACTIVATIONDATA* adata;
+   SCIP_CONS* origcons;
+   SCIP_VAR*** matrix;
+   int j;
+   int m;
+
+   assert(scip != NULL);
+   assert(activationhdlr != NULL);
+   assert(sourceactivationhdlr != NULL);
+   assert(sourcecons != NULL);
+   assert(targetcons != NULL);
+   assert(valid != NULL);
+   assert(strcmp(SCIPactivationhdlrGetName(activationhdlr), ACTIVATION_NAME) == 0);
+
+   *valid = FALSE;
+
+   if( varmap == NULL )
+      return SCIP_OKAY;
+
+   /* the data of the source constraint is stored with the same key as in activationFindActivationDataMakespan() */
+   origcons = SCIPconsGetOriginal(sourcecons);
+
+   if( origcons == NULL )
+      origcons = sourcecons;
+
+   sourceactivationhdlrdata = SCIPactivationhdlrGetData(sourceactivationhdlr);
+   assert(sourceactivationhdlrdata != NULL);
+
+   adata = (ACTIVATIONDATA*)SCIPhashmapGetImage(sourceactivationhdlrdata->consmap, origcons);
+
+   if( adata == NULL )
+      return SCIP_OKAY;
+
+   /* map the scheduling variables to the target SCIP; variables that were removed by presolving are copied as well */
+   SCIP_CALL( SCIPallocBufferArray(scip, &matrix, adata->njobs) );
+
+   for( j = 0; j < adata->njobs; ++j )
+   {
+      SCIP_CALL( SCIPallocBufferArray(scip, &matrix[j], adata->nmachines) );
+   }
+
+   *valid = TRUE;
+
+   for( j = 0; j < adata->njobs && *valid; ++j )
+   {
+      for( m = 0; m < adata->nmachines && *valid; ++m )
+      {
+         SCIP_CALL( SCIPgetVarCopy(sourcescip, scip, adata->matrix[j][m], &matrix[j][m], varmap, NULL, TRUE, valid) );
+      }
+   }
+
+   if( *valid )
+   {
+      SCIP_CALL( storeConsActivationData(scip, activationhdlr, targetcons, matrix, adata->jobtimes, adata->nmachines,
+            adata->njobs) );
+   }
+
+   for( j = adata->njobs - 1; j >= 0; --j )
+   {
+      SCIPfreeBufferArray(scip, &matrix[j]);
+   }
+   SCIPfreeBufferArray(scip, &matrix);
+
+   return SCIP_OKAY;
+}
+
 /* finds the sub-symmetries and return the found sub-symmetric submatrices */
 static
 SCIP_DECL_ACTIVATIONFINDDATA(activationFindActivationDataMakespan)
@@ -560,11 +806,13 @@ SCIP_DECL_ACTIVATIONFINDDATA(activationFindActivationDataMakespan)
    assert(cons != NULL);
    assert(strcmp(SCIPactivationhdlrGetName(activationhdlr), ACTIVATION_NAME) == 0);
 
-   /* get original constraint */
-   origcons = cons;
+   /* get original constraint; constraints that were created in the transformed problem (e.g., by symmetry detection)
+    * are their own key
+    */
+   origcons = SCIPconsGetOriginal(cons);
 
-   if( !SCIPconsIsOriginal(origcons) )
-      origcons = origcons->transorigcons;
+   if( origcons == NULL )
+      origcons = cons;
 
    /* get activation handler data */
    activationhdlrdata = SCIPactivationhdlrGetData(activationhdlr);
@@ -624,11 +872,18 @@ SCIP_RETCODE SCIPincludeActivationMakespan(
 {
    SCIP_ACTIVATIONHDLRDATA* activationhdlrdata = NULL;
 
+   /* the handler is already included, e.g., by SCIPincludeDefaultPlugins() */
+   if( SCIPfindActivationhdlr(scip, ACTIVATION_NAME) != NULL )
+      return SCIP_OKAY;
+
    /* create variable fixings activation handler data */
    SCIP_CALL( createActivationhdlrData(scip, &activationhdlrdata) );
 
-   SCIP_CALL( SCIPincludeActivationhdlr(scip, ACTIVATION_NAME, ACTIVATION_DESC, NULL,
-         activationFreeMakespan, activationInitMakespan, NULL, NULL, activationFindActivationDataMakespan, activationhdlrdata) );
+   SCIP_CALL( SCIPincludeActivationhdlr(scip, ACTIVATION_NAME, ACTIVATION_DESC, activationCopyMakespan,
+         activationFreeMakespan, activationInitMakespan, activationExitMakespan, NULL, activationFindActivationDataMakespan, activationhdlrdata) );
+
+   SCIP_CALL( SCIPsetActivationhdlrConsDelete(scip, SCIPfindActivationhdlr(scip, ACTIVATION_NAME), activationConsDeleteMakespan) );
+   SCIP_CALL( SCIPsetActivationhdlrConsCopy(scip, SCIPfindActivationhdlr(scip, ACTIVATION_NAME), activationConsCopyMakespan) );
 
    return SCIP_OKAY;
 }
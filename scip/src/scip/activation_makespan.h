@@ -49,7 +49,9 @@ SCIP_RETCODE SCIPregisterConsActivationMakespan(
 
 /** @} */
 
-/** creates the makespan activation handler and includes it in SCIP
+/** creates the makespan activation handler and includes it in SCIP, unless it is already included
+ *
+ * The handlers are included by SCIPincludeDefaultPlugins(), so calling this afterwards does nothing.
  *
  * @ingroup ActivationhdlrIncludes
  */
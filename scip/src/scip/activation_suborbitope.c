@@ -29,7 +29,6 @@
 #include "scip/pub_activation.h"
 #include "scip/type_activation.h"
 #include "scip/struct_activation.h"
-#include "scip/struct_cons.h"
 #include "scip/struct_misc.h"
 #include "scip/activation_suborbitope.h"
 
@@ -43,6 +42,8 @@
 struct Patterns
 {
    SCIP_VAR***           matrix;             /**< matrix of variables on which the symmetry acts (managed by the constraint) */
+   int*                  varindices;         /**< row-wise indices of the transformed matrix variables for reading their bounds from the bound mirror, or NULL if the bounds are not mirrored */
+   int                   varindicesrun;      /**< run in which the variable indices have been collected, or -1 if not collected yet */
    int                   m;                  /**< number of rows in the matrix */
    int                   n;                  /**< number of columns in the matrix */
    int                   zeroheight;         /**< height of zeros column that activates a submatrix */
@@ -88,6 +89,8 @@ SCIP_RETCODE removePatterns(
    assert(patterns != NULL);
    assert(*patterns != NULL);
 
+   SCIPfreeBlockMemoryArrayNull(scip, &(*patterns)->varindices, (*patterns)->m * (*patterns)->n);
+
    for( i = 0; i < (*patterns)->m; ++i )
    {
       SCIPfreeBlockMemoryArray(scip, &(*patterns)->matrix[i], (*patterns)->n);
@@ -147,7 +150,9 @@ SCIP_RETCODE storeConsPatterns(
 
    patterns->m = m;
    patterns->n = n;
-   SCIP_CALL( SCIPhashmapInsert(activationhdlrdata->consmap, cons, (void*)patterns) );
+   patterns->varindices = NULL;
+   patterns->varindicesrun = -1;
+   SCIP_CALL( SCIPhashmapSetImage(activationhdlrdata->consmap, cons, (void*)patterns) );
 
    SCIP_CALL( SCIPsetConsActivationhdlr(scip, cons, activationhdlr) );
 
@@ -184,6 +189,69 @@ SCIP_RETCODE removeAllPatterns(
    return SCIP_OKAY;
 }
 
+/** collects the indices of the transformed matrix variables and enables the bound mirror, such that the bounds of a
+ *  whole row of the matrix can be read at once
+ *
+ *  Presolving may aggregate variables, so the indices are collected once per run. If the bounds of a matrix variable
+ *  are not mirrored, e.g., because it is aggregated, no indices are collected and the bounds have to be read from the
+ *  variables.
+ */
+static
+SCIP_RETCODE collectVarIndices(
+   SCIP*                 scip,               /**< SCIP data structure */
+   PATTERNS*             patterns,           /**< patterns data structure */
+   SCIP_Bool*            mirrored            /**< pointer to store whether the bounds can be read from the bound mirror */
+   )
+{
+   SCIP_VAR* var;
+   int i;
+   int j;
+
+   assert(scip != NULL);
+   assert(patterns != NULL);
+   assert(mirrored != NULL);
+
+   if( !SCIPisVarBoundMirrorEnabled(scip) )
+   {
+      SCIP_CALL( SCIPenableVarBoundMirror(scip) );
+   }
+
+   if( patterns->varindicesrun == SCIPgetNRuns(scip) )
+   {
+      *mirrored = (patterns->varindices != NULL);
+      return SCIP_OKAY;
+   }
+
+   patterns->varindicesrun = SCIPgetNRuns(scip);
+   *mirrored = FALSE;
+
+   if( patterns->varindices == NULL )
+   {
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &patterns->varindices, patterns->m * patterns->n) );
+   }
+
+   for( i = 0; i < patterns->m; ++i )
+   {
+      for( j = 0; j < patterns->n; ++j )
+      {
+         SCIP_CALL( SCIPgetTransformedVar(scip, patterns->matrix[i][j], &var) );
+         assert(var != NULL);
+
+         if( !SCIPisVarBoundMirrored(scip, var) )
+         {
+            SCIPfreeBlockMemoryArray(scip, &patterns->varindices, patterns->m * patterns->n);
+            return SCIP_OKAY;
+         }
+
+         patterns->varindices[i * patterns->n + j] = SCIPvarGetIndex(var);
+      }
+   }
+
+   *mirrored = TRUE;
+
+   return SCIP_OKAY;
+}
+
 static
 SCIP_RETCODE findPatternMatches(
       SCIP*                 scip,               /**< SCIP data structure */
@@ -205,7 +273,9 @@ SCIP_RETCODE findPatternMatches(
    int nzerousedcols;
    int noneusedcols;
    SCIP_Bool transformed;
-   SCIP_VAR* var;
+   SCIP_Bool mirrored;
+   SCIP_Real* rowlbs;
+   SCIP_Real* rowubs;
 
    assert(scip != NULL);
    assert(patterns != NULL);
@@ -218,6 +288,16 @@ SCIP_RETCODE findPatternMatches(
    *submatrix = NULL;
 
    transformed = SCIPisTransformed(scip);
+   mirrored = FALSE;
+
+   /* during the solving process, the bounds of every row are read at once from the bound mirror */
+   if( SCIPgetStage(scip) == SCIP_STAGE_SOLVING )
+   {
+      SCIP_CALL( collectVarIndices(scip, patterns, &mirrored) );
+   }
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &rowlbs, n) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &rowubs, n) );
 
    SCIP_CALL( SCIPallocBufferArray(scip, &zerotowerheight, n) );
    SCIP_CALL( SCIPallocBufferArray(scip, &onetowerheight, n) );
@@ -236,6 +316,30 @@ SCIP_RETCODE findPatternMatches(
       nzerousedcols = 0;
       noneusedcols = 0;
 
+      if( mirrored )
+      {
+         SCIPgetMirroredVarBoundsLocal(scip, &patterns->varindices[i * n], n, rowlbs, rowubs);
+      }
+      else
+      {
+         for( j = 0; j < n; ++j )
+         {
+            SCIP_VAR* var;
+
+            if( transformed )
+            {
+               SCIP_CALL( SCIPgetTransformedVar(scip, matrix[i][j], &var) );
+            }
+            else
+            {
+               var = matrix[i][j];
+            }
+
+            rowlbs[j] = SCIPvarGetLbLocal(var);
+            rowubs[j] = SCIPvarGetUbLocal(var);
+         }
+      }
+
       for( j = 0; j < n; ++j )
       {
          if( zerotowerheight[j] >= zeroheight )
@@ -247,21 +351,12 @@ SCIP_RETCODE findPatternMatches(
             oneusedcols[noneusedcols++] = j;
          }
 
-         if( transformed )
-         {
-            SCIPgetTransformedVar(scip, matrix[i][j], &var);
-         }
-         else
-         {
-            var = matrix[i][j];
-         }
-
-         if( SCIPvarGetUbLocal(var) < 0.5 )
+         if( rowubs[j] < 0.5 )
          {
             zerotowerheight[j] += 1;
             onetowerheight[j] = 0;
          }
-         else if( SCIPvarGetLbLocal(var) > 0.5 )
+         else if( rowlbs[j] > 0.5 )
          {
             onetowerheight[j] += 1;
             zerotowerheight[j] = 0;
@@ -334,6 +429,8 @@ SCIP_RETCODE findPatternMatches(
    SCIPfreeBufferArray(scip, &onetowerheight);
    SCIPfreeBufferArray(scip, &zerousedcols);
    SCIPfreeBufferArray(scip, &oneusedcols);
+   SCIPfreeBufferArray(scip, &rowubs);
+   SCIPfreeBufferArray(scip, &rowlbs);
 
    return SCIP_OKAY;
 }
@@ -351,11 +448,9 @@ SCIP_DECL_ACTIVATIONCOPY(activationCopySuborbitope)
    assert(activationhdlr != NULL);
    assert(strcmp(SCIPactivationhdlrGetName(activationhdlr), ACTIVATION_NAME) == 0);
 
-   /* call inclusion method of activation handler */
+   /* call inclusion method of activation handler; the patterns of the constraints are copied with the constraints */
    SCIP_CALL( SCIPincludeActivationSuborbitope(scip) );
 
-   // TODO: copy data! (?)
-
    return SCIP_OKAY;
 }
 
@@ -386,6 +481,153 @@ SCIP_DECL_ACTIVATIONFREE(activationFreeSuborbitope)
    return SCIP_OKAY;
 }
 
+/** deinitialization method of activation handler (called before transformed problem is freed) */
+static
+SCIP_DECL_ACTIVATIONEXIT(activationExitSuborbitope)
+{
+   SCIP_ACTIVATIONHDLRDATA* activationhdlrdata;
+   SCIP_HASHMAPENTRY* entry;
+   PATTERNS* patterns;
+   int nentries;
+   int i;
+
+   assert(scip != NULL);
+   assert(activationhdlr != NULL);
+   assert(strcmp(SCIPactivationhdlrGetName(activationhdlr), ACTIVATION_NAME) == 0);
+
+   activationhdlrdata = SCIPactivationhdlrGetData(activationhdlr);
+   assert(activationhdlrdata != NULL);
+
+   /* the variable indices refer to the transformed variables */
+   nentries = SCIPhashmapGetNEntries(activationhdlrdata->consmap);
+
+   for( i = 0; i < nentries; ++i )
+   {
+      entry = SCIPhashmapGetEntry(activationhdlrdata->consmap, i);
+
+      if( entry != NULL )
+      {
+         patterns = (PATTERNS*)SCIPhashmapEntryGetImage(entry);
+         SCIPfreeBlockMemoryArrayNull(scip, &patterns->varindices, patterns->m * patterns->n);
+         patterns->varindicesrun = -1;
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+/** constraint deletion method of activation handler */
+static
+SCIP_DECL_ACTIVATIONCONSDELETE(activationConsDeleteSuborbitope)
+{
+   SCIP_ACTIVATIONHDLRDATA* activationhdlrdata;
+   PATTERNS* patterns;
+
+   assert(scip != NULL);
+   assert(activationhdlr != NULL);
+   assert(cons != NULL);
+   assert(strcmp(SCIPactivationhdlrGetName(activationhdlr), ACTIVATION_NAME) == 0);
+
+   activationhdlrdata = SCIPactivationhdlrGetData(activationhdlr);
+   assert(activationhdlrdata != NULL);
+
+   patterns = (PATTERNS*)SCIPhashmapGetImage(activationhdlrdata->consmap, cons);
+
+   if( patterns != NULL )
+   {
+      SCIP_CALL( removePatterns(scip, &patterns) );
+      SCIP_CALL( SCIPhashmapRemove(activationhdlrdata->consmap, cons) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** constraint copying method of activation handler */
+static
+SCIP_DECL_ACTIVATIONCONSCOPY(activationConsCopySuborbitope)
+{
+   SCIP_ACTIVATIONHDLRDATA* sourceactivationhdlrdata;
+   PATTERNS* patterns;
+   SCIP_CONS* origcons;
+   SCIP_VAR*** matrix;
+   SCIP_VAR* var;
+   int i;
+   int j;
+
+   assert(scip != NULL);
+   assert(activationhdlr != NULL);
+   assert(sourceactivationhdlr != NULL);
+   assert(sourcecons != NULL);
+   assert(targetcons != NULL);
+   assert(valid != NULL);
+   assert(strcmp(SCIPactivationhdlrGetName(activationhdlr), ACTIVATION_NAME) == 0);
+
+   *valid = FALSE;
+
+   if( varmap == NULL )
+      return SCIP_OKAY;
+
+   /* the patterns of the source constraint are stored with the same key as in activationFindActivationDataSuborbitope() */
+   origcons = SCIPconsGetOriginal(sourcecons);
+
+   if( origcons == NULL )
+      origcons = sourcecons;
+
+   sourceactivationhdlrdata = SCIPactivationhdlrGetData(sourceactivationhdlr);
+   assert(sourceactivationhdlrdata != NULL);
+
+   patterns = (PATTERNS*)SCIPhashmapGetImage(sourceactivationhdlrdata->consmap, origcons);
+
+   if( patterns == NULL )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &matrix, patterns->m) );
+
+   for( i = 0; i < patterns->m; ++i )
+   {
+      SCIP_CALL( SCIPallocBufferArray(scip, &matrix[i], patterns->n) );
+   }
+
+   *valid = TRUE;
+
+   for( i = 0; i < patterns->m && *valid; ++i )
+   {
+      for( j = 0; j < patterns->n && *valid; ++j )
+      {
+         /* the matrix may hold the original variables, while the variable map of a transformed copy maps the
+          * transformed variables
+          */
+         var = patterns->matrix[i][j];
+
+         if( !SCIPconsIsOriginal(sourcecons) && SCIPvarIsOriginal(var) )
+         {
+            SCIP_CALL( SCIPgetTransformedVar(sourcescip, var, &var) );
+         }
+
+         if( var == NULL )
+            *valid = FALSE;
+         else
+         {
+            SCIP_CALL( SCIPgetVarCopy(sourcescip, scip, var, &matrix[i][j], varmap, NULL, TRUE, valid) );
+         }
+      }
+   }
+
+   if( *valid )
+   {
+      SCIP_CALL( storeConsPatterns(scip, activationhdlr, targetcons, matrix, patterns->m, patterns->n,
+            patterns->zeroheight, patterns->oneheight) );
+   }
+
+   for( i = patterns->m - 1; i >= 0; --i )
+   {
+      SCIPfreeBufferArray(scip, &matrix[i]);
+   }
+   SCIPfreeBufferArray(scip, &matrix);
+
+   return SCIP_OKAY;
+}
+
 /** is active method of activation handler */
 static
 SCIP_DECL_ACTIVATIONFINDDATA(activationFindActivationDataSuborbitope)
@@ -399,14 +641,11 @@ SCIP_DECL_ACTIVATIONFINDDATA(activationFindActivationDataSuborbitope)
    assert(cons != NULL);
    assert(strcmp(SCIPactivationhdlrGetName(activationhdlr), ACTIVATION_NAME) == 0);
 
-   /* get original constraint */
-   origcons = cons;
+   /* get original constraint; constraints that were created in the transformed problem are their own key */
+   origcons = SCIPconsGetOriginal(cons);
 
-   if( !SCIPconsIsOriginal(origcons) )
-   {
-      // TODO: there is no API for this?
-      origcons = origcons->transorigcons;
-   }
+   if( origcons == NULL )
+      origcons = cons;
 
    /* get activation handler data */
    activationhdlrdata = SCIPactivationhdlrGetData(activationhdlr);
@@ -473,11 +712,18 @@ SCIP_RETCODE SCIPincludeActivationSuborbitope(
 {
    SCIP_ACTIVATIONHDLRDATA* activationhdlrdata = NULL;
 
+   /* the handler is already included, e.g., by SCIPincludeDefaultPlugins() */
+   if( SCIPfindActivationhdlr(scip, ACTIVATION_NAME) != NULL )
+      return SCIP_OKAY;
+
    /* create activation handler data */
    SCIP_CALL( createActivationhdlrData(scip, &activationhdlrdata) );
 
-   SCIP_CALL( SCIPincludeActivationhdlr(scip, ACTIVATION_NAME, ACTIVATION_DESC, NULL,
-         activationFreeSuborbitope, NULL, NULL, NULL, activationFindActivationDataSuborbitope, activationhdlrdata) );
+   SCIP_CALL( SCIPincludeActivationhdlr(scip, ACTIVATION_NAME, ACTIVATION_DESC, activationCopySuborbitope,
+         activationFreeSuborbitope, NULL, activationExitSuborbitope, NULL, activationFindActivationDataSuborbitope, activationhdlrdata) );
+
+   SCIP_CALL( SCIPsetActivationhdlrConsDelete(scip, SCIPfindActivationhdlr(scip, ACTIVATION_NAME), activationConsDeleteSuborbitope) );
+   SCIP_CALL( SCIPsetActivationhdlrConsCopy(scip, SCIPfindActivationhdlr(scip, ACTIVATION_NAME), activationConsCopySuborbitope) );
 
    return SCIP_OKAY;
 }
@@ -51,7 +51,9 @@ SCIP_RETCODE SCIPregisterConsActivationSuborbitope(
 
 /** @} */
 
-/** creates the sub-orbitope activation handler and includes it in SCIP
+/** creates the sub-orbitope activation handler and includes it in SCIP, unless it is already included
+ *
+ * The handlers are included by SCIPincludeDefaultPlugins(), so calling this afterwards does nothing.
  *
  * @ingroup ActivationhdlrIncludes
  */
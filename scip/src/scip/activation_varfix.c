@@ -0,0 +1,620 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2021 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   activation_varfix.c
+ * @ingroup DEFPLUGINS_ACTIVATION
+ * @brief  variable fixings activation handler
+ * @author Sten Wessel
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "blockmemshell/memory.h"
+#include "scip/type_misc.h"
+#include "scip/pub_activation.h"
+#include "scip/type_activation.h"
+#include "scip/struct_activation.h"
+#include "scip/struct_cons.h"
+#include "scip/cons_orbitope.h"
+#include "scip/activation_varfix.h"
+
+/* fundamental activation handler properties */
+#define ACTIVATION_NAME        "varfix"
+#define ACTIVATION_DESC        "variable fixings activation handler"
+
+#define INITIAL_CONSMAP_SIZE   10            /**< initial size of the hashmap storing the constraints that use this activation handler */
+
+/*
+ * Data structures
+ */
+
+/*
+ * Pattern of variable fixings that activates a constraint, or a submatrix of it.
+ */
+struct Trigger
+{
+   SCIP_VAR**            vars;               /**< variables of the pattern (transformed while the problem is transformed) */
+   SCIP_Real*            vals;               /**< values the variables need to be fixed to */
+   int                   nvars;              /**< number of variables in the pattern */
+   int*                  rows;               /**< rows of the activated submatrix, or NULL if the whole constraint is activated */
+   int*                  cols;               /**< columns of the activated submatrix, or NULL if the whole constraint is activated */
+   int                   nrows;              /**< number of rows of the activated submatrix */
+   int                   ncols;              /**< number of columns of the activated submatrix */
+   SCIP_ORBITOPETYPE     orbitopetype;       /**< type of orbitope for the activated submatrix */
+   struct Trigger*       next;               /**< next trigger of the same constraint */
+};
+typedef struct Trigger TRIGGER;
+
+struct SCIP_ActivationhdlrData
+{
+   SCIP_HASHMAP*         consmap;            /**< map of constraints to the list of triggers that activate the constraint */
+};
+
+/*
+ * Local methods
+ */
+
+/** initializes the activation handler data structure */
+static
+SCIP_RETCODE createActivationhdlrData(
+   SCIP*                     scip,                 /**< SCIP data structure */
+   SCIP_ACTIVATIONHDLRDATA** activationhdlrdata    /**< pointer to store activation handler data structure */
+   )
+{
+   assert(scip != NULL);
+   assert(activationhdlrdata != NULL);
+
+   SCIP_CALL( SCIPallocMemory(scip, activationhdlrdata) );
+   SCIP_CALL( SCIPhashmapCreate(&(*activationhdlrdata)->consmap, SCIPblkmem(scip), INITIAL_CONSMAP_SIZE) );
+
+   return SCIP_OKAY;
+}
+
+/** frees a list of triggers */
+static
+SCIP_RETCODE removeTriggers(
+   SCIP*                 scip,               /**< SCIP data structure */
+   TRIGGER**             triggers            /**< pointer to the first trigger of the list */
+   )
+{
+   TRIGGER* trigger;
+
+   assert(scip != NULL);
+   assert(triggers != NULL);
+
+   while( *triggers != NULL )
+   {
+      trigger = *triggers;
+      *triggers = trigger->next;
+
+      SCIPfreeBlockMemoryArrayNull(scip, &trigger->cols, trigger->ncols);
+      SCIPfreeBlockMemoryArrayNull(scip, &trigger->rows, trigger->nrows);
+      SCIPfreeBlockMemoryArray(scip, &trigger->vals, trigger->nvars);
+      SCIPfreeBlockMemoryArray(scip, &trigger->vars, trigger->nvars);
+      SCIPfreeBlockMemory(scip, &trigger);
+   }
+
+   return SCIP_OKAY;
+}
+
+/** adds a trigger to the list of triggers of the provided constraint */
+static
+SCIP_RETCODE storeConsTrigger(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_ACTIVATIONHDLR*  activationhdlr,     /**< activation handler */
+   SCIP_CONS*            cons,               /**< constraint */
+   SCIP_VAR**            vars,               /**< variables of the pattern */
+   SCIP_Real*            vals,               /**< values the variables need to be fixed to */
+   int                   nvars,              /**< number of variables in the pattern */
+   int*                  rows,               /**< rows of the submatrix that is activated, or NULL */
+   int                   nrows,              /**< number of rows of the submatrix that is activated */
+   int*                  cols,               /**< columns of the submatrix that is activated, or NULL */
+   int                   ncols,              /**< number of columns of the submatrix that is activated */
+   SCIP_ORBITOPETYPE     orbitopetype        /**< type of orbitope for the submatrix that is activated */
+   )
+{
+   SCIP_ACTIVATIONHDLRDATA* activationhdlrdata;
+   TRIGGER* trigger;
+
+   assert(scip != NULL);
+   assert(activationhdlr != NULL);
+   assert(cons != NULL);
+   assert(vars != NULL);
+   assert(vals != NULL);
+   assert(nvars > 0);
+   assert((rows == NULL) == (cols == NULL));
+
+   /* get activation handler data */
+   activationhdlrdata = SCIPactivationhdlrGetData(activationhdlr);
+   assert(activationhdlrdata != NULL);
+
+   /* create a new trigger */
+   SCIP_CALL( SCIPallocBlockMemory(scip, &trigger) );
+
+   SCIP_CALL( SCIPduplicateBlockMemoryArray(scip, &trigger->vars, vars, nvars) );
+   SCIP_CALL( SCIPduplicateBlockMemoryArray(scip, &trigger->vals, vals, nvars) );
+   trigger->nvars = nvars;
+
+   if( rows != NULL )
+   {
+      assert(nrows > 0);
+      assert(ncols > 0);
+
+      SCIP_CALL( SCIPduplicateBlockMemoryArray(scip, &trigger->rows, rows, nrows) );
+      SCIP_CALL( SCIPduplicateBlockMemoryArray(scip, &trigger->cols, cols, ncols) );
+      trigger->nrows = nrows;
+      trigger->ncols = ncols;
+   }
+   else
+   {
+      trigger->rows = NULL;
+      trigger->cols = NULL;
+      trigger->nrows = 0;
+      trigger->ncols = 0;
+   }
+   trigger->orbitopetype = orbitopetype;
+
+   /* prepend the trigger to the triggers of the constraint */
+   trigger->next = (TRIGGER*)SCIPhashmapGetImage(activationhdlrdata->consmap, cons);
+
+   SCIP_CALL( SCIPhashmapSetImage(activationhdlrdata->consmap, cons, (void*)trigger) );
+
+   SCIP_CALL( SCIPsetConsActivationhdlr(scip, cons, activationhdlr) );
+
+   return SCIP_OKAY;
+}
+
+/** removes the triggers for all constraints using this activation handler */
+static
+SCIP_RETCODE removeAllTriggers(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_HASHMAP*         hashmap             /**< hashmap containing the triggers */
+   )
+{
+   int nentries;
+   int i;
+   SCIP_HASHMAPENTRY* entry;
+   TRIGGER* triggers;
+
+   assert(scip != NULL);
+   assert(hashmap != NULL);
+
+   nentries = SCIPhashmapGetNEntries(hashmap);
+
+   for( i = 0; i < nentries; ++i )
+   {
+      entry = SCIPhashmapGetEntry(hashmap, i);
+
+      if( entry != NULL )
+      {
+         triggers = (TRIGGER*)SCIPhashmapEntryGetImage(entry);
+         SCIP_CALL( removeTriggers(scip, &triggers) );
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+/** returns the triggers of the original constraint of the given constraint, or NULL if it is not registered */
+static
+TRIGGER* getConsTriggers(
+   SCIP_ACTIVATIONHDLR*  activationhdlr,     /**< activation handler */
+   SCIP_CONS*            cons                /**< (original or transformed) constraint */
+   )
+{
+   SCIP_ACTIVATIONHDLRDATA* activationhdlrdata;
+   SCIP_CONS* origcons;
+
+   /* get original constraint */
+   origcons = cons;
+
+   if( !SCIPconsIsOriginal(origcons) && origcons->transorigcons != NULL )
+      origcons = origcons->transorigcons;
+
+   /* get activation handler data */
+   activationhdlrdata = SCIPactivationhdlrGetData(activationhdlr);
+   assert(activationhdlrdata != NULL);
+
+   return (TRIGGER*)SCIPhashmapGetImage(activationhdlrdata->consmap, origcons);
+}
+
+/** checks whether all variables of the trigger are fixed to their values at the current node */
+static
+SCIP_Bool isTriggerMatched(
+   SCIP*                 scip,               /**< SCIP data structure */
+   TRIGGER*              trigger             /**< trigger */
+   )
+{
+   int i;
+
+   assert(scip != NULL);
+   assert(trigger != NULL);
+
+   for( i = 0; i < trigger->nvars; ++i )
+   {
+      if( !SCIPisFeasEQ(scip, SCIPvarGetLbLocal(trigger->vars[i]), trigger->vals[i])
+         || !SCIPisFeasEQ(scip, SCIPvarGetUbLocal(trigger->vars[i]), trigger->vals[i]) )
+         return FALSE;
+   }
+
+   return TRUE;
+}
+
+
+/*
+ * Callback methods of activation handler
+ */
+
+/** copy method for activation handler plugins (called when SCIP copies plugins) */
+static
+SCIP_DECL_ACTIVATIONCOPY(activationCopyVarFix)
+{
+   assert(scip != NULL);
+   assert(activationhdlr != NULL);
+   assert(strcmp(SCIPactivationhdlrGetName(activationhdlr), ACTIVATION_NAME) == 0);
+
+   /* call inclusion method of activation handler; the triggers of the constraints are copied with the constraints */
+   SCIP_CALL( SCIPincludeActivationVarFix(scip) );
+
+   return SCIP_OKAY;
+}
+
+/* Initializes the activation handler by replacing the provided original variables by their transformations */
+static
+SCIP_DECL_ACTIVATIONINIT(activationInitVarFix)
+{
+   SCIP_ACTIVATIONHDLRDATA* activationhdlrdata;
+   SCIP_HASHMAPENTRY* entry;
+   TRIGGER* trigger;
+   int nentries;
+   int i;
+   int j;
+
+   if( !SCIPisTransformed(scip) )
+      return SCIP_OKAY;
+
+   /* get activation handler data */
+   activationhdlrdata = SCIPactivationhdlrGetData(activationhdlr);
+   assert(activationhdlrdata != NULL);
+
+   nentries = SCIPhashmapGetNEntries(activationhdlrdata->consmap);
+
+   for( i = 0; i < nentries; ++i )
+   {
+      entry = SCIPhashmapGetEntry(activationhdlrdata->consmap, i);
+
+      if( entry != NULL )
+      {
+         for( trigger = (TRIGGER*)SCIPhashmapEntryGetImage(entry); trigger != NULL; trigger = trigger->next )
+         {
+            for( j = 0; j < trigger->nvars; ++j )
+            {
+               SCIP_CALL( SCIPgetTransformedVar(scip, trigger->vars[j], &(trigger->vars[j])) );
+            }
+         }
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+/* Deinitializes the activation handler by replacing the transformed variables by their original counterparts again */
+static
+SCIP_DECL_ACTIVATIONEXIT(activationExitVarFix)
+{
+   SCIP_ACTIVATIONHDLRDATA* activationhdlrdata;
+   SCIP_HASHMAPENTRY* entry;
+   TRIGGER* trigger;
+   SCIP_Real scalar;
+   SCIP_Real constant;
+   int nentries;
+   int i;
+   int j;
+
+   /* get activation handler data */
+   activationhdlrdata = SCIPactivationhdlrGetData(activationhdlr);
+   assert(activationhdlrdata != NULL);
+
+   nentries = SCIPhashmapGetNEntries(activationhdlrdata->consmap);
+
+   for( i = 0; i < nentries; ++i )
+   {
+      entry = SCIPhashmapGetEntry(activationhdlrdata->consmap, i);
+
+      /* constraints that only exist in the transformed problem keep their transformed variables until they are freed */
+      if( entry != NULL && SCIPconsIsOriginal((SCIP_CONS*)SCIPhashmapEntryGetOrigin(entry)) )
+      {
+         for( trigger = (TRIGGER*)SCIPhashmapEntryGetImage(entry); trigger != NULL; trigger = trigger->next )
+         {
+            for( j = 0; j < trigger->nvars; ++j )
+            {
+               if( SCIPvarIsOriginal(trigger->vars[j]) )
+                  continue;
+
+               scalar = 1.0;
+               constant = 0.0;
+               SCIP_CALL( SCIPvarGetOrigvarSum(&(trigger->vars[j]), &scalar, &constant) );
+
+               if( trigger->vars[j] == NULL || !SCIPisEQ(scip, scalar, 1.0) || !SCIPisZero(scip, constant) )
+               {
+                  SCIPerrorMessage("Variable of constraint <%s> cannot be retransformed to an original variable.\n",
+                     SCIPconsGetName((SCIP_CONS*)SCIPhashmapEntryGetOrigin(entry)));
+                  return SCIP_INVALIDDATA;
+               }
+            }
+         }
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+/** sets destructor method of activation handler */
+static
+SCIP_DECL_ACTIVATIONFREE(activationFreeVarFix)
+{
+   SCIP_ACTIVATIONHDLRDATA* activationhdlrdata;
+
+   assert(scip != NULL);
+   assert(activationhdlr != NULL);
+   assert(strcmp(SCIPactivationhdlrGetName(activationhdlr), ACTIVATION_NAME) == 0);
+
+   /* free activation handler data */
+   activationhdlrdata = SCIPactivationhdlrGetData(activationhdlr);
+   assert(activationhdlrdata != NULL);
+
+   /* free triggers in consmap */
+   SCIP_CALL( removeAllTriggers(scip, activationhdlrdata->consmap) );
+   SCIP_CALL( SCIPhashmapRemoveAll(activationhdlrdata->consmap) );
+
+   SCIPhashmapFree(&activationhdlrdata->consmap);
+
+   SCIPfreeMemory(scip, &activationhdlrdata);
+
+   SCIPactivationhdlrSetData(activationhdlr, NULL);
+
+   return SCIP_OKAY;
+}
+
+/** constraint deletion method of activation handler */
+static
+SCIP_DECL_ACTIVATIONCONSDELETE(activationConsDeleteVarFix)
+{
+   SCIP_ACTIVATIONHDLRDATA* activationhdlrdata;
+   TRIGGER* triggers;
+
+   assert(scip != NULL);
+   assert(activationhdlr != NULL);
+   assert(cons != NULL);
+   assert(strcmp(SCIPactivationhdlrGetName(activationhdlr), ACTIVATION_NAME) == 0);
+
+   activationhdlrdata = SCIPactivationhdlrGetData(activationhdlr);
+   assert(activationhdlrdata != NULL);
+
+   triggers = (TRIGGER*)SCIPhashmapGetImage(activationhdlrdata->consmap, cons);
+
+   if( triggers != NULL )
+   {
+      SCIP_CALL( removeTriggers(scip, &triggers) );
+      SCIP_CALL( SCIPhashmapRemove(activationhdlrdata->consmap, cons) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** constraint copying method of activation handler */
+static
+SCIP_DECL_ACTIVATIONCONSCOPY(activationConsCopyVarFix)
+{
+   TRIGGER** triggers;
+   TRIGGER* trigger;
+   SCIP_VAR** vars;
+   SCIP_VAR* var;
+   int ntriggers;
+   int maxnvars;
+   int t;
+   int j;
+
+   assert(scip != NULL);
+   assert(activationhdlr != NULL);
+   assert(sourceactivationhdlr != NULL);
+   assert(sourcecons != NULL);
+   assert(targetcons != NULL);
+   assert(valid != NULL);
+   assert(strcmp(SCIPactivationhdlrGetName(activationhdlr), ACTIVATION_NAME) == 0);
+
+   *valid = FALSE;
+
+   if( varmap == NULL )
+      return SCIP_OKAY;
+
+   ntriggers = 0;
+   maxnvars = 0;
+   for( trigger = getConsTriggers(sourceactivationhdlr, sourcecons); trigger != NULL; trigger = trigger->next )
+   {
+      ++ntriggers;
+      maxnvars = MAX(maxnvars, trigger->nvars);
+   }
+
+   if( ntriggers == 0 )
+      return SCIP_OKAY;
+
+   /* the triggers are prepended when they are stored, so they are copied from the last to the first to keep their order */
+   SCIP_CALL( SCIPallocBufferArray(scip, &triggers, ntriggers) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &vars, maxnvars) );
+
+   t = 0;
+   for( trigger = getConsTriggers(sourceactivationhdlr, sourcecons); trigger != NULL; trigger = trigger->next )
+      triggers[t++] = trigger;
+
+   *valid = TRUE;
+
+   for( t = ntriggers - 1; t >= 0 && *valid; --t )
+   {
+      trigger = triggers[t];
+
+      for( j = 0; j < trigger->nvars && *valid; ++j )
+      {
+         /* the trigger holds the original variables before the problem is transformed, while the variable map of a
+          * transformed copy maps the transformed variables
+          */
+         var = trigger->vars[j];
+
+         if( !SCIPconsIsOriginal(sourcecons) && SCIPvarIsOriginal(var) )
+         {
+            SCIP_CALL( SCIPgetTransformedVar(sourcescip, var, &var) );
+         }
+
+         if( var == NULL )
+            *valid = FALSE;
+         else
+         {
+            SCIP_CALL( SCIPgetVarCopy(sourcescip, scip, var, &vars[j], varmap, NULL, TRUE, valid) );
+         }
+      }
+
+      if( *valid )
+      {
+         SCIP_CALL( storeConsTrigger(scip, activationhdlr, targetcons, vars, trigger->vals, trigger->nvars,
+               trigger->rows, trigger->nrows, trigger->cols, trigger->ncols, trigger->orbitopetype) );
+      }
+   }
+
+   SCIPfreeBufferArray(scip, &vars);
+   SCIPfreeBufferArray(scip, &triggers);
+
+   return SCIP_OKAY;
+}
+
+/** is active method of activation handler: the constraint is active if at least one of its triggers matches */
+static
+SCIP_DECL_ACTIVATIONISACTIVE(activationIsActiveVarFix)
+{
+   TRIGGER* trigger;
+
+   assert(scip != NULL);
+   assert(activationhdlr != NULL);
+   assert(cons != NULL);
+   assert(result != NULL);
+   assert(strcmp(SCIPactivationhdlrGetName(activationhdlr), ACTIVATION_NAME) == 0);
+
+   *result = FALSE;
+
+   for( trigger = getConsTriggers(activationhdlr, cons); trigger != NULL && !*result; trigger = trigger->next )
+      *result = isTriggerMatched(scip, trigger);
+
+   return SCIP_OKAY;
+}
+
+/** returns the submatrices of all triggers of the constraint that match */
+static
+SCIP_DECL_ACTIVATIONFINDDATA(activationFindActivationDataVarFix)
+{
+   SCIP_ACTIVATIONSUBMATRIX* submatrix = NULL;
+   TRIGGER* trigger;
+
+   assert(scip != NULL);
+   assert(activationhdlr != NULL);
+   assert(cons != NULL);
+   assert(strcmp(SCIPactivationhdlrGetName(activationhdlr), ACTIVATION_NAME) == 0);
+
+   for( trigger = getConsTriggers(activationhdlr, cons); trigger != NULL; trigger = trigger->next )
+   {
+      if( trigger->rows == NULL || !isTriggerMatched(scip, trigger) )
+         continue;
+
+      SCIP_CALL( SCIPcreateActivationSubmatrix(scip, &submatrix, trigger->rows, trigger->nrows, trigger->cols,
+            trigger->ncols, trigger->orbitopetype, submatrix) );
+   }
+
+   *activationdata = (void*)submatrix;
+
+   return SCIP_OKAY;
+}
+
+
+/*
+ * Activation handler specific interface methods
+ */
+
+/** adds a trigger for the constraint to the variable fixings activation handler
+ *
+ *  Every call adds a trigger; the constraint is active at a node if at least one of its triggers matches. If @p rows
+ *  and @p cols are given, the trigger activates the given submatrix of the (orbitope) constraint when it matches.
+ */
+SCIP_RETCODE SCIPregisterConsActivationVarFix(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONS*            cons,               /**< constraint */
+   SCIP_VAR**            vars,               /**< variables of the pattern */
+   SCIP_Real*            vals,               /**< values the variables need to be fixed to */
+   int                   nvars,              /**< number of variables in the pattern */
+   int*                  rows,               /**< rows of the submatrix that is activated, or NULL */
+   int                   nrows,              /**< number of rows of the submatrix that is activated */
+   int*                  cols,               /**< columns of the submatrix that is activated, or NULL */
+   int                   ncols,              /**< number of columns of the submatrix that is activated */
+   SCIP_ORBITOPETYPE     orbitopetype        /**< type of orbitope for the submatrix that is activated */
+   )
+{
+   SCIP_ACTIVATIONHDLR* activationhdlr;
+
+   assert(scip != NULL);
+   assert(cons != NULL);
+
+   /* find activation handler */
+   activationhdlr = SCIPfindActivationhdlr(scip, ACTIVATION_NAME);
+   if( activationhdlr == NULL )
+   {
+      SCIPerrorMessage("Could not find activation handler <%s>.\n", ACTIVATION_NAME);
+      return SCIP_PLUGINNOTFOUND;
+   }
+   assert(strcmp(SCIPactivationhdlrGetName(activationhdlr), ACTIVATION_NAME) == 0);
+
+   if( nvars <= 0 || (rows == NULL) != (cols == NULL) || (rows != NULL && (nrows <= 0 || ncols <= 0)) )
+   {
+      SCIPerrorMessage("Invalid trigger for constraint <%s>.\n", SCIPconsGetName(cons));
+      return SCIP_INVALIDDATA;
+   }
+
+   SCIP_CALL( storeConsTrigger(scip, activationhdlr, cons, vars, vals, nvars, rows, nrows, cols, ncols, orbitopetype) );
+
+   return SCIP_OKAY;
+}
+
+/** creates the variable fixings activation handler and includes it in SCIP */
+SCIP_RETCODE SCIPincludeActivationVarFix(
+   SCIP*                 scip                /**< SCIP data structure */
+   )
+{
+   SCIP_ACTIVATIONHDLRDATA* activationhdlrdata = NULL;
+
+   /* the handler is already included, e.g., by SCIPincludeDefaultPlugins() */
+   if( SCIPfindActivationhdlr(scip, ACTIVATION_NAME) != NULL )
+      return SCIP_OKAY;
+
+   /* create variable fixings activation handler data */
+   SCIP_CALL( createActivationhdlrData(scip, &activationhdlrdata) );
+
+   SCIP_CALL( SCIPincludeActivationhdlr(scip, ACTIVATION_NAME, ACTIVATION_DESC, activationCopyVarFix,
+         activationFreeVarFix, activationInitVarFix, activationExitVarFix, activationIsActiveVarFix,
+         activationFindActivationDataVarFix, activationhdlrdata) );
+
+   SCIP_CALL( SCIPsetActivationhdlrConsDelete(scip, SCIPfindActivationhdlr(scip, ACTIVATION_NAME), activationConsDeleteVarFix) );
+   SCIP_CALL( SCIPsetActivationhdlrConsCopy(scip, SCIPfindActivationhdlr(scip, ACTIVATION_NAME), activationConsCopyVarFix) );
+
+   return SCIP_OKAY;
+}
@@ -0,0 +1,79 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2021 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   activation_varfix.h
+ * @ingroup ACTIVATIONHDLR
+ * @brief  variable fixings activation handler
+ * @author Sten Wessel
+ *
+ * This activation handler activates (parts of) constraints by declarative triggers: a trigger is a pattern of
+ * variables and values, and it matches at a node if all of its variables are fixed to the given values. A trigger
+ * either activates a submatrix of an orbitope constraint, or the whole constraint (e.g., an orbisack constraint).
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#ifndef __SCIP_ACTIVATION_VARFIX_H__
+#define __SCIP_ACTIVATION_VARFIX_H__
+
+
+#include "scip/scip.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@addtogroup ACTIVATIONHDLR
+ *
+ * @{
+ */
+
+/** adds a trigger for the constraint to the variable fixings activation handler
+ *
+ *  Every call adds a trigger; the constraint is active at a node if at least one of its triggers matches. If @p rows
+ *  and @p cols are given, the trigger activates the given submatrix of the (orbitope) constraint when it matches.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPregisterConsActivationVarFix(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONS*            cons,               /**< constraint */
+   SCIP_VAR**            vars,               /**< variables of the pattern */
+   SCIP_Real*            vals,               /**< values the variables need to be fixed to */
+   int                   nvars,              /**< number of variables in the pattern */
+   int*                  rows,               /**< rows of the submatrix that is activated, or NULL */
+   int                   nrows,              /**< number of rows of the submatrix that is activated */
+   int*                  cols,               /**< columns of the submatrix that is activated, or NULL */
+   int                   ncols,              /**< number of columns of the submatrix that is activated */
+   SCIP_ORBITOPETYPE     orbitopetype        /**< type of orbitope for the submatrix that is activated */
+   );
+
+/** @} */
+
+/** creates the variable fixings activation handler and includes it in SCIP, unless it is already included
+ *
+ * The handlers are included by SCIPincludeDefaultPlugins(), so calling this afterwards does nothing.
+ *
+ * @ingroup ActivationhdlrIncludes
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPincludeActivationVarFix(
+   SCIP*                 scip                /**< SCIP data structure */
+   );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
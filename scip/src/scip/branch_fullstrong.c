@@ -208,6 +208,19 @@ SCIP_RETCODE SCIPselectVarStrongBranching(
    SCIP_Bool upconflict;
    SCIP_Bool bothgains;
    SCIP_Bool propagate;
+   SCIP_VAR** sbvars = NULL;
+   SCIP_Real* sbdown = NULL;
+   SCIP_Real* sbup = NULL;
+   SCIP_Bool* sbdownvalid = NULL;
+   SCIP_Bool* sbupvalid = NULL;
+   SCIP_Bool* sbdowninf = NULL;
+   SCIP_Bool* sbupinf = NULL;
+   SCIP_Bool* sbdownconflict = NULL;
+   SCIP_Bool* sbupconflict = NULL;
+   SCIP_Bool sblperror;
+   int* sbpos = NULL;
+   int nsbvars = 0;
+   int sbthreads;
    int nvars = 0;
    int nsbcalls;
    int i;
@@ -291,6 +304,70 @@ SCIP_RETCODE SCIPselectVarStrongBranching(
     /* initialize strong branching */
    SCIP_CALL( SCIPstartStrongbranch(scip, propagate) );
 
+   /* if strong branching is performed in parallel, evaluate the candidates that are always visited in one call, such
+    * that they are distributed over the threads; the results are processed in the loop below in the usual order
+    */
+   SCIP_CALL( SCIPgetIntParam(scip, "lp/sbthreads", &sbthreads) );
+   if( sbthreads > 1 && !propagate && MIN(ncomplete, nlpcands) > 1 )
+   {
+      int nbatch;
+
+      nbatch = MIN(ncomplete, nlpcands);
+
+      SCIP_CALL( SCIPallocBufferArray(scip, &sbpos, nlpcands) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &sbvars, nbatch) );
+
+      for( c = 0; c < nlpcands; ++c )
+         sbpos[c] = -1;
+
+      for( i = 0, c = *start; i < nbatch; ++i, ++c )
+      {
+         c = c % nlpcands;
+
+         /* candidates with a skipped direction are evaluated in the loop */
+         if( skipdown[i] || skipup[i] )
+            continue;
+
+         if( SCIPgetVarStrongbranchNode(scip, lpcands[c]) == nodenum
+            && SCIPgetVarStrongbranchLPAge(scip, lpcands[c]) < reevalage )
+            continue;
+
+         sbpos[c] = nsbvars;
+         sbvars[nsbvars++] = lpcands[c];
+      }
+
+      if( nsbvars > 1 )
+      {
+         SCIP_CALL( SCIPallocBufferArray(scip, &sbdown, nsbvars) );
+         SCIP_CALL( SCIPallocBufferArray(scip, &sbup, nsbvars) );
+         SCIP_CALL( SCIPallocBufferArray(scip, &sbdownvalid, nsbvars) );
+         SCIP_CALL( SCIPallocBufferArray(scip, &sbupvalid, nsbvars) );
+         SCIP_CALL( SCIPallocBufferArray(scip, &sbdowninf, nsbvars) );
+         SCIP_CALL( SCIPallocBufferArray(scip, &sbupinf, nsbvars) );
+         SCIP_CALL( SCIPallocBufferArray(scip, &sbdownconflict, nsbvars) );
+         SCIP_CALL( SCIPallocBufferArray(scip, &sbupconflict, nsbvars) );
+
+         SCIP_CALL( SCIPgetVarsStrongbranchesFrac(scip, sbvars, nsbvars, INT_MAX, sbdown, sbup, sbdownvalid, sbupvalid,
+               sbdowninf, sbupinf, sbdownconflict, sbupconflict, &sblperror) );
+
+         /* the LP error of the batched call is not attributed to a single candidate, so the candidates are evaluated
+          * one by one in the loop, where each strong branching call reports its own LP error
+          */
+         if( sblperror )
+         {
+            for( c = 0; c < nlpcands; ++c )
+               sbpos[c] = -1;
+         }
+      }
+      else
+      {
+         /* a single candidate is evaluated in the loop */
+         SCIPfreeBufferArray(scip, &sbvars);
+         SCIPfreeBufferArray(scip, &sbpos);
+         nsbvars = 0;
+      }
+   }
+
    /* search the full strong candidate
     * cycle through the candidates, starting with the position evaluated in the last run
     */
@@ -302,9 +379,9 @@ SCIP_RETCODE SCIPselectVarStrongBranching(
       assert(lpcands[c] != NULL);
 
       /* don't use strong branching on variables that have already been initialized at the current node,
-       * and that were evaluated not too long ago
+       * and that were evaluated not too long ago, unless they were evaluated in the parallel call above
        */
-      if( SCIPgetVarStrongbranchNode(scip, lpcands[c]) == nodenum
+      if( (sbpos == NULL || sbpos[c] == -1) && SCIPgetVarStrongbranchNode(scip, lpcands[c]) == nodenum
          && SCIPgetVarStrongbranchLPAge(scip, lpcands[c]) < reevalage )
       {
          SCIP_Real lastlpobjval;
@@ -333,7 +410,20 @@ SCIP_RETCODE SCIPselectVarStrongBranching(
          up = -SCIPinfinity(scip);
          down = -SCIPinfinity(scip);
 
-         if( propagate )
+         if( sbpos != NULL && sbpos[c] >= 0 )
+         {
+            /* take the result of the parallel call above */
+            down = sbdown[sbpos[c]];
+            up = sbup[sbpos[c]];
+            downvalid = sbdownvalid[sbpos[c]];
+            upvalid = sbupvalid[sbpos[c]];
+            downinf = sbdowninf[sbpos[c]];
+            upinf = sbupinf[sbpos[c]];
+            downconflict = sbdownconflict[sbpos[c]];
+            upconflict = sbupconflict[sbpos[c]];
+            lperror = FALSE;
+         }
+         else if( propagate )
          {
             SCIP_CALL( SCIPgetVarStrongbranchWithPropagation(scip, lpcands[c], lpcandssol[c], lpobjval, INT_MAX,
                   maxproprounds, skipdown[i] ? NULL : &down, skipup[i] ? NULL : &up, &downvalid,
@@ -512,6 +602,20 @@ SCIP_RETCODE SCIPselectVarStrongBranching(
          SCIPvarGetName(lpcands[*bestcand]), *bestscore);
    }
 
+   if( nsbvars > 0 )
+   {
+      SCIPfreeBufferArray(scip, &sbupconflict);
+      SCIPfreeBufferArray(scip, &sbdownconflict);
+      SCIPfreeBufferArray(scip, &sbupinf);
+      SCIPfreeBufferArray(scip, &sbdowninf);
+      SCIPfreeBufferArray(scip, &sbupvalid);
+      SCIPfreeBufferArray(scip, &sbdownvalid);
+      SCIPfreeBufferArray(scip, &sbup);
+      SCIPfreeBufferArray(scip, &sbdown);
+      SCIPfreeBufferArray(scip, &sbvars);
+      SCIPfreeBufferArray(scip, &sbpos);
+   }
+
    /* end strong branching */
    SCIP_CALL( SCIPendStrongbranch(scip) );
 
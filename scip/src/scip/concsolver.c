@@ -407,6 +407,13 @@ SCIP_RETCODE SCIPconcsolverSync(
    {
       SCIP_CALL( SCIPconcsolverStop(concsolver) );
    }
+   else if( set->concurrent_nsubtrees > 0 )
+   {
+      /* if the tree is split among the solvers, solvers that processed all their subtrees stop synchronizing and there
+       * is no well-defined last solver to adapt the frequency, so every solver keeps its current frequency
+       */
+      SCIPsyncdataSetSyncFreq(syncstore, syncdata, concsolver->syncfreq);
+   }
    else if( SCIPsyncdataGetNSynced(syncdata) == SCIPsyncstoreGetNSolvers(syncstore) - 1 )
    {
       /* if this is the last concurrent solver that is synchronizing for this synchronization data
@@ -47,6 +47,7 @@
 #include "scip/scip_solve.h"
 #include "scip/scip_solvingstats.h"
 #include "scip/scip_timing.h"
+#include "scip/scip_var.h"
 #include "scip/syncstore.h"
 #include <string.h>
 
@@ -188,6 +189,9 @@ struct SCIP_ConcSolverData
    SCIP*                 solverscip;         /**< the concurrent solvers private SCIP datastructure */
    SCIP_VAR**            vars;               /**< array of variables in the order of the main SCIP's variable array */
    int                   nvars;              /**< number of variables in the above arrays */
+   SCIP_Bool             splittree;          /**< is the search tree split among the concurrent solvers? */
+   SCIP_Real*            subtreesolvals;     /**< values of the best solution found in the subtrees, or NULL if none was found */
+   SCIP_Real             upperbound;         /**< best upper bound received from the other solvers */
 };
 
 /** Disable dual reductions that might cut off optimal solutions. Although they keep at least
@@ -242,6 +246,7 @@ SCIP_RETCODE initConcsolver(
    SCIP_HASHMAP*       varmapfw;
    SCIP_CONCSOLVERDATA* data;
    int* varperm;
+   int symvariant;
 
    assert(scip != NULL);
    assert(concsolver != NULL);
@@ -257,7 +262,20 @@ SCIP_RETCODE initConcsolver(
    SCIP_CALL( SCIPhashmapCreate(&varmapfw, SCIPblkmem(data->solverscip), data->nvars) );
    SCIP_CALL( SCIPcopy(scip, data->solverscip, varmapfw, NULL, SCIPconcsolverGetName(concsolver), TRUE, FALSE, FALSE,
          FALSE, &valid) );
-   assert(valid);
+
+   /* if some constraint could not be copied, the solver would solve a relaxation, whose status and dual bound are not
+    * valid for the problem of the main SCIP
+    */
+   if( !valid )
+   {
+      SCIPerrorMessage("problem could not be copied completely to concurrent solver <%s>\n",
+         SCIPconcsolverGetName(concsolver));
+
+      SCIPhashmapFree(&varmapfw);
+      SCIP_CALL( SCIPfree(&data->solverscip) );
+
+      return SCIP_INVALIDDATA;
+   }
 
    /* allocate memory for the arrays to store the variable mapping */
    SCIP_CALL( SCIPallocBlockMemoryArray(data->solverscip, &data->vars, data->nvars) );
@@ -293,6 +311,17 @@ SCIP_RETCODE initConcsolver(
       assert(stored);
    }
 
+   /* if the symmetry handling methods raced against each other, every solver uses the winner; the solvers may keep
+    * different symmetric solutions, so global bound changes derived by symmetry handling must not be communicated
+    */
+   symvariant = SCIPsyncstoreGetSymmetryVariant(SCIPgetSyncstore(scip));
+
+   if( symvariant >= 0 )
+   {
+      SCIP_CALL( SCIPconcurrentSetSymmetryVariant(data->solverscip, symvariant) );
+      SCIP_CALL( SCIPsetBoolParam(data->solverscip, "concurrent/commvarbnds", FALSE) );
+   }
+
    /* create the concurrent data structure for the concurrent solver's SCIP */
    /* this assert fails on check/instances/Symmetry/packorb_1-FullIns_3.cip
     * assert(SCIPgetNOrigVars(data->solverscip) == data->nvars);
@@ -317,6 +346,7 @@ SCIP_DECL_CONCSOLVERCREATEINST(concsolverScipCreateInstance)
    char*                    prefix;
    char                     filename[SCIP_MAXSTRLEN];
    SCIP_Bool                changechildsel;
+   int                      nsubtrees;
 
    assert(scip != NULL);
    assert(concsolvertype != NULL);
@@ -329,6 +359,19 @@ SCIP_DECL_CONCSOLVERCREATEINST(concsolverScipCreateInstance)
 
    SCIP_CALL( initConcsolver(scip, concsolver) );
 
+   SCIP_CALL( SCIPgetIntParam(scip, "concurrent/nsubtrees", &nsubtrees) );
+   data->splittree = nsubtrees > 0;
+   data->subtreesolvals = NULL;
+   data->upperbound = SCIPinfinity(data->solverscip);
+
+   /* symmetry handling constraints of the main SCIP are copied, but handling the symmetries of a subtree could cut off
+    * solutions whose symmetric counterparts lie in subtrees of other solvers
+    */
+   if( data->splittree )
+   {
+      SCIP_CALL( SCIPsetIntParam(data->solverscip, "misc/usesymmetry", 0) );
+   }
+
    /* check if emphasis setting should be loaded */
    if( typedata->loademphasis )
    {
@@ -429,6 +472,7 @@ SCIP_DECL_CONCSOLVERDESTROYINST(concsolverScipDestroyInstance)
 
    /* free the array with the variable mapping */
    SCIPfreeBlockMemoryArray(data->solverscip, &data->vars, data->nvars);
+   BMSfreeMemoryArrayNull(&data->subtreesolvals);
 
    /* free subscip */
    SCIP_CALL( SCIPfree(&data->solverscip) );
@@ -524,12 +568,189 @@ SCIP_DECL_CONCSOLVERCOPYSOLVINGDATA(concsolverGetSolvingData)
    /* free the buffer array */
    SCIPfreeBufferArray(scip, &solvals);
 
+   /* add the best solution found in the subtrees processed by this solver */
+   if( data->subtreesolvals != NULL )
+   {
+      SCIP_SOL* sol;
+      SCIP_Bool stored;
+
+      SCIP_CALL( SCIPcreateSol(scip, &sol, NULL) );
+      SCIP_CALL( SCIPsetSolVals(scip, sol, nvars, vars, data->subtreesolvals) );
+      SCIP_CALL( SCIPaddSolFree(scip, &sol, &stored) );
+   }
+
+   /* a solver that did not get any subtree to process has no statistics */
+   if( SCIPgetStage(data->solverscip) == SCIP_STAGE_PROBLEM )
+      return SCIP_OKAY;
+
    /* copy solving statistics and status from the solver SCIP to the given SCIP */
    SCIP_CALL( SCIPcopyConcurrentSolvingStats(data->solverscip, scip) );
 
    return SCIP_OKAY;
 }
 
+/** solves the subtrees of the syncstore's subtree pool that are assigned to this concurrent solver one after another
+ *  by restricting the bounds of the solver's problem to the branching decisions of the subtree
+ */
+static
+SCIP_RETCODE solveSubtrees(
+   SCIP_CONCSOLVER*      concsolver,         /**< the concurrent solver */
+   SCIP_Real*            solvingtime,        /**< pointer to store the total solving time */
+   SCIP_Longint*         nlpiterations,      /**< pointer to store the total number of LP iterations */
+   SCIP_Longint*         nnodes              /**< pointer to store the total number of nodes */
+   )
+{
+   SCIP_CONCSOLVERDATA* data;
+   SCIP_SYNCSTORE*      syncstore;
+   SCIP_Real*           origlbs;
+   SCIP_Real*           origubs;
+   SCIP_Real            timelimit;
+   SCIP_Real            bestobj;
+   int                  concsolverid;
+   int                  nprocessed;
+   int                  idx;
+   int                  i;
+
+   data = SCIPconcsolverGetData(concsolver);
+   assert(data != NULL);
+
+   syncstore = SCIPgetSyncstore(data->solverscip);
+   assert(syncstore != NULL);
+
+   concsolverid = SCIPconcsolverGetIdx(concsolver);
+
+   *solvingtime = 0.0;
+   *nlpiterations = 0;
+   *nnodes = 0;
+
+   SCIP_ALLOC( BMSallocMemoryArray(&origlbs, data->nvars) );
+   SCIP_ALLOC( BMSallocMemoryArray(&origubs, data->nvars) );
+
+   for( i = 0; i < data->nvars; ++i )
+   {
+      origlbs[i] = SCIPvarGetLbOriginal(data->vars[i]);
+      origubs[i] = SCIPvarGetUbOriginal(data->vars[i]);
+   }
+
+   SCIP_CALL( SCIPgetRealParam(data->solverscip, "limits/time", &timelimit) );
+
+   /* the best solution found in the ramp-up phase was copied into the solver when it was created; all objective values
+    * and bounds exchanged with the other solvers are in the transformed space of the main SCIP
+    */
+   bestobj = SCIPgetNSols(data->solverscip) > 0
+      ? SCIPconcurrentGetCopyObjval(data->solverscip, SCIPgetSolOrigObj(data->solverscip, SCIPgetBestSol(data->solverscip)))
+      : SCIPinfinity(data->solverscip);
+
+   nprocessed = 0;
+
+   while( !SCIPsyncstoreSolveIsStopped(syncstore) && (idx = SCIPsyncstoreNextSubtree(syncstore, concsolverid, nprocessed)) >= 0 )
+   {
+      SCIP_BOUNDSTORE* subtree;
+      SCIP_STATUS status;
+      SCIP_Real cutoff;
+      SCIP_Real objlimit;
+
+      ++nprocessed;
+
+      /* restore the original bounds of the previous subtree */
+      if( SCIPgetStage(data->solverscip) > SCIP_STAGE_PROBLEM )
+      {
+         SCIP_CALL( SCIPfreeTransform(data->solverscip) );
+
+         for( i = 0; i < data->nvars; ++i )
+         {
+            SCIP_CALL( SCIPchgVarLb(data->solverscip, data->vars[i], origlbs[i]) );
+            SCIP_CALL( SCIPchgVarUb(data->solverscip, data->vars[i], origubs[i]) );
+         }
+      }
+
+      subtree = SCIPsyncstoreGetSubtree(syncstore, idx);
+
+      for( i = 0; i < SCIPboundstoreGetNChgs(subtree); ++i )
+      {
+         int varidx;
+         SCIP_Real newbound;
+
+         varidx = SCIPboundstoreGetChgVaridx(subtree, i);
+         newbound = SCIPboundstoreGetChgVal(subtree, i);
+
+         if( SCIPboundstoreGetChgType(subtree, i) == SCIP_BOUNDTYPE_LOWER )
+         {
+            SCIP_CALL( SCIPchgVarLb(data->solverscip, data->vars[varidx], MAX(newbound, origlbs[varidx])) );
+         }
+         else
+         {
+            SCIP_CALL( SCIPchgVarUb(data->solverscip, data->vars[varidx], MIN(newbound, origubs[varidx])) );
+         }
+      }
+
+      /* prune the subtree with the best solution known to this solver and the best upper bound of the other solvers */
+      cutoff = MIN(bestobj, data->upperbound);
+      objlimit = SCIPconcurrentGetCopyObjval(data->solverscip, SCIPgetObjlimit(data->solverscip));
+
+      if( cutoff < objlimit )
+      {
+         /* the conversion is its own inverse */
+         SCIP_CALL( SCIPsetObjlimit(data->solverscip, SCIPconcurrentGetCopyObjval(data->solverscip, cutoff)) );
+      }
+
+      /* the solving time limit is shared by all subtrees of this solver */
+      SCIP_CALL( SCIPsetRealParam(data->solverscip, "limits/time", MAX(timelimit - *solvingtime, 0.0)) );
+
+      SCIPdebugMessage("concurrent solver %s solves subtree %d with %d bound changes\n", SCIPconcsolverGetName(concsolver),
+         idx, SCIPboundstoreGetNChgs(subtree));
+
+      SCIP_CALL( SCIPsolve(data->solverscip) );
+
+      *solvingtime += SCIPgetSolvingTime(data->solverscip);
+      *nlpiterations += SCIPgetNLPIterations(data->solverscip);
+      *nnodes += SCIPgetNNodes(data->solverscip);
+
+      /* keep the best solution, since solutions violating the bounds of the next subtree are discarded */
+      if( SCIPgetNSols(data->solverscip) > 0 )
+      {
+         SCIP_SOL* bestsol;
+         SCIP_Real obj;
+
+         bestsol = SCIPgetBestSol(data->solverscip);
+         obj = SCIPconcurrentGetCopyObjval(data->solverscip, SCIPgetSolOrigObj(data->solverscip, bestsol));
+
+         if( obj < bestobj )
+         {
+            if( data->subtreesolvals == NULL )
+            {
+               SCIP_ALLOC( BMSallocMemoryArray(&data->subtreesolvals, data->nvars) );
+            }
+
+            SCIP_CALL( SCIPgetSolVals(data->solverscip, bestsol, data->nvars, data->vars, data->subtreesolvals) );
+            bestobj = obj;
+         }
+      }
+
+      status = SCIPgetStatus(data->solverscip);
+
+      if( status == SCIP_STATUS_OPTIMAL || status == SCIP_STATUS_INFEASIBLE )
+      {
+         SCIPsyncstoreSetSubtreeLowerbound(syncstore, idx, SCIPinfinity(data->solverscip));
+      }
+      else
+      {
+         /* the subtree could not be solved due to a limit or an interruption */
+         SCIPsyncstoreSetSubtreeLowerbound(syncstore, idx,
+            SCIPconcurrentGetCopyObjval(data->solverscip, SCIPgetDualbound(data->solverscip)));
+         break;
+      }
+   }
+
+   /* the remaining solvers must not wait for this solver at the next synchronizations */
+   SCIP_CALL( SCIPsyncstoreFinishSolver(syncstore) );
+
+   BMSfreeMemoryArray(&origubs);
+   BMSfreeMemoryArray(&origlbs);
+
+   return SCIP_OKAY;
+}
+
 /** start solving the problem until the solving reaches a limit, gets interrupted, or
  *  just finished successfully
  */
@@ -546,6 +767,15 @@ SCIP_DECL_CONCSOLVEREXEC(concsolverScipExec)
    /* print info message that solving has started */
    SCIPinfoMessage(data->solverscip, NULL, "starting solve in concurrent solver '%s'\n", SCIPconcsolverGetName(concsolver));
 
+   if( data->splittree )
+   {
+      SCIP_CALL( solveSubtrees(concsolver, solvingtime, nlpiterations, nnodes) );
+
+      SCIPinfoMessage(data->solverscip, NULL, "concurrent solver '%s' finished its subtrees\n", SCIPconcsolverGetName(concsolver));
+
+      return SCIP_OKAY;
+   }
+
    /* solve */
    SCIP_CALL( SCIPsolve(data->solverscip) );
 
@@ -594,12 +824,31 @@ SCIP_DECL_CONCSOLVERSYNCWRITE(concsolverScipSyncWrite)
    concsolverid = SCIPconcsolverGetIdx(concsolver);
    solverstatus = SCIPgetStatus(data->solverscip);
 
+   *nsolsshared = 0;
+
+   /* if the tree is split, solving a subtree to optimality does not finish the solve and the dual bound is only valid
+    * for the subtree, so only limits are communicated together with the best upper bound
+    */
+   if( data->splittree )
+   {
+      if( solverstatus != SCIP_STATUS_OPTIMAL && solverstatus != SCIP_STATUS_INFEASIBLE )
+         SCIPsyncdataSetStatus(syncdata, solverstatus, concsolverid);
+
+      if( SCIPgetNSols(data->solverscip) > 0 )
+      {
+         SCIPsyncdataSetUpperbound(syncdata, SCIPconcurrentGetCopyObjval(data->solverscip,
+               SCIPgetSolOrigObj(data->solverscip, SCIPgetBestSol(data->solverscip))));
+      }
+
+      SCIPsyncdataAddMemTotal(syncdata, SCIPgetMemTotal(data->solverscip));
+
+      return SCIP_OKAY;
+   }
+
    SCIPsyncdataSetStatus(syncdata, solverstatus, concsolverid);
    SCIPsyncdataSetLowerbound(syncdata, SCIPgetDualbound(data->solverscip));
    SCIPsyncdataSetUpperbound(syncdata, SCIPgetPrimalbound(data->solverscip));
 
-   *nsolsshared = 0;
-
    if( SCIPsyncdataGetStatus(syncdata) != SCIP_STATUS_UNKNOWN )
       return SCIP_OKAY;
 
@@ -667,6 +916,20 @@ SCIP_DECL_CONCSOLVERSYNCREAD(concsolverScipSyncRead)
 
    concsolverid = SCIPconcsolverGetIdx(concsolver);
 
+   *nsolsrecvd = 0;
+   *ntighterbnds = 0;
+   *ntighterintbnds = 0;
+
+   /* bound changes of other solvers are not valid for the subtrees of this solver; the best upper bound is used to
+    * prune the next subtree, since the cutoff bound cannot be changed safely during the solve
+    */
+   if( data->splittree )
+   {
+      data->upperbound = MIN(data->upperbound, SCIPsyncdataGetUpperbound(syncdata));
+
+      return SCIP_OKAY;
+   }
+
    /* get solutions from synchronization data */
    SCIPsyncdataGetSolutions(syncdata, &solvals, &concsolverids, &nsols);
    *nsolsrecvd = 0;
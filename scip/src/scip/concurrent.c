@@ -23,6 +23,7 @@
 
 #include "scip/concurrent.h"
 #include "scip/struct_concurrent.h"
+#include "scip/boundstore.h"
 #include "scip/concsolver.h"
 #include "scip/event.h"
 #include "scip/struct_scip.h"
@@ -44,6 +45,21 @@
 #include "scip/set.h"
 #include "tpi/tpi.h"
 
+/* the ramp-up phase stops at the latest after this many nodes per requested subtree */
+#define RAMPUP_MAXNODESFACTOR 100
+
+/* the racing ramp-up phase of the symmetry handling methods is split into this many rounds, after each of which the
+ * racers exchange their best solution
+ */
+#define SYMRACING_NROUNDS     10
+
+/* symmetry handling methods that race against each other in the racing ramp-up phase */
+#define SYMRACING_NVARIANTS   4
+
+static const char* symracingnames[SYMRACING_NVARIANTS] = { "orbitopes", "sub-symmetries", "orbital fixing", "SST cuts" };
+static const int symracingusesymmetry[SYMRACING_NVARIANTS] = { 1, 1, 2, 4 };
+static const SCIP_Bool symracingdetectsubsym[SYMRACING_NVARIANTS] = { FALSE, TRUE, FALSE, FALSE };
+
 /** create concurrent data */
 SCIP_RETCODE SCIPcreateConcurrent(
    SCIP*                 scip,               /**< SCIP datastructure */
@@ -465,7 +481,152 @@ SCIP_RETCODE execConcsolver(
    scip = (SCIP*) args;
 
    SCIP_CALL( SCIPconcsolverExec(scip->set->concsolvers[SCIPtpiGetThreadNum()]) );
-   SCIP_CALL( SCIPconcsolverSync(scip->set->concsolvers[SCIPtpiGetThreadNum()], scip->set) );
+
+   /* if the tree is split, the solver already left the synchronization when it finished its subtrees */
+   if( scip->set->concurrent_nsubtrees == 0 )
+   {
+      SCIP_CALL( SCIPconcsolverSync(scip->set->concsolvers[SCIPtpiGetThreadNum()], scip->set) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** adds the counters of the given statistics, which were overwritten by the statistics of a solver that processed
+ *  subtrees of the split search tree, to the counters of this solver
+ */
+static
+void addSubtreesSolvingStats(
+   SCIP_STAT*            stat,               /**< statistics of a solver that processed subtrees */
+   SCIP_STAT*            prevstat            /**< statistics before the ones of the solver were installed */
+   )
+{
+   stat->nlpiterations += prevstat->nlpiterations;
+   stat->nprimallpiterations += prevstat->nprimallpiterations;
+   stat->nduallpiterations += prevstat->nduallpiterations;
+   stat->nlexduallpiterations += prevstat->nlexduallpiterations;
+   stat->nbarrierlpiterations += prevstat->nbarrierlpiterations;
+   stat->nprimalresolvelpiterations += prevstat->nprimalresolvelpiterations;
+   stat->ndualresolvelpiterations += prevstat->ndualresolvelpiterations;
+   stat->nlexdualresolvelpiterations += prevstat->nlexdualresolvelpiterations;
+   stat->nnodelpiterations += prevstat->nnodelpiterations;
+   stat->ninitlpiterations += prevstat->ninitlpiterations;
+   stat->ndivinglpiterations += prevstat->ndivinglpiterations;
+   stat->ndivesetlpiterations += prevstat->ndivesetlpiterations;
+   stat->nsbdivinglpiterations += prevstat->nsbdivinglpiterations;
+   stat->nsblpiterations += prevstat->nsblpiterations;
+   stat->nconflictlpiterations += prevstat->nconflictlpiterations;
+   stat->nnodes += prevstat->nnodes;
+   stat->ninternalnodes += prevstat->ninternalnodes;
+   stat->nobjleaves += prevstat->nobjleaves;
+   stat->nfeasleaves += prevstat->nfeasleaves;
+   stat->ninfeasleaves += prevstat->ninfeasleaves;
+   stat->ntotalnodes += prevstat->ntotalnodes;
+   stat->ntotalinternalnodes += prevstat->ntotalinternalnodes;
+   stat->ncreatednodes += prevstat->ncreatednodes;
+   stat->ncreatednodesrun += prevstat->ncreatednodesrun;
+   stat->nactivatednodes += prevstat->nactivatednodes;
+   stat->ndeactivatednodes += prevstat->ndeactivatednodes;
+   stat->nearlybacktracks += prevstat->nearlybacktracks;
+   stat->nnodesaboverefbound += prevstat->nnodesaboverefbound;
+   stat->nbacktracks += prevstat->nbacktracks;
+   stat->ndelayedcutoffs += prevstat->ndelayedcutoffs;
+   stat->nreprops += prevstat->nreprops;
+   stat->nrepropboundchgs += prevstat->nrepropboundchgs;
+   stat->nrepropcutoffs += prevstat->nrepropcutoffs;
+   stat->nlpsolsfound += prevstat->nlpsolsfound;
+   stat->npssolsfound += prevstat->npssolsfound;
+   stat->nsbsolsfound += prevstat->nsbsolsfound;
+   stat->nboundchgs += prevstat->nboundchgs;
+   stat->nholechgs += prevstat->nholechgs;
+   stat->nprobboundchgs += prevstat->nprobboundchgs;
+   stat->nprobholechgs += prevstat->nprobholechgs;
+   stat->nsbdowndomchgs += prevstat->nsbdowndomchgs;
+   stat->nsbupdomchgs += prevstat->nsbupdomchgs;
+   stat->nsbtimesiterlimhit += prevstat->nsbtimesiterlimhit;
+}
+
+/** installs the solving data of all concurrent solvers that processed subtrees of the split search tree into the given
+ *  SCIP instance and sets the status and dual bound according to the subtrees that are left open
+ *
+ *  The counters of the statistics, e.g., of nodes and LP iterations, are summed over all solvers, since the solvers
+ *  searched disjoint parts of the tree.
+ */
+static
+SCIP_RETCODE concurrentGetSubtreesSolvingData(
+   SCIP*                 scip,               /**< SCIP datastructure */
+   SCIP_SYNCSTORE*       syncstore           /**< the synchronization store */
+   )
+{
+   SCIP_CONCSOLVER** concsolvers;
+   SCIP_STATUS       status;
+   SCIP_STAGE        stage;
+   SCIP_NODE*        root;
+   SCIP_STAT         prevstat;
+   SCIP_Real         lowerbound;
+   int               nconcsolvers;
+   int               winner;
+   int               i;
+
+   concsolvers = scip->set->concsolvers;
+   nconcsolvers = scip->set->nconcsolvers;
+   winner = SCIPsyncstoreGetWinner(syncstore);
+   status = SCIP_STATUS_UNKNOWN;
+   stage = scip->set->stage;
+
+   /* the solver that stopped the solve, if any, is installed last so that its status is kept */
+   for( i = 0; i <= nconcsolvers; ++i )
+   {
+      int idx;
+
+      idx = i < nconcsolvers ? i : winner;
+
+      if( idx < 0 || (i < nconcsolvers && idx == winner) )
+         continue;
+
+      prevstat = *scip->stat;
+
+      SCIP_CALL( SCIPconcsolverGetSolvingData(concsolvers[idx], scip) );
+
+      /* copying the statistics also copies the stage of the solver, but the solutions of the remaining solvers still
+       * need to be added
+       */
+      scip->set->stage = stage;
+
+      /* the counters are overwritten by each solver, but the solvers searched disjoint parts of the tree */
+      addSubtreesSolvingStats(scip->stat, &prevstat);
+
+      if( scip->stat->status != SCIP_STATUS_OPTIMAL && scip->stat->status != SCIP_STATUS_INFEASIBLE
+         && scip->stat->status != SCIP_STATUS_UNKNOWN )
+         status = scip->stat->status;
+   }
+
+   lowerbound = SCIPinfinity(scip);
+
+   for( i = 0; i < SCIPsyncstoreGetNSubtrees(syncstore); ++i )
+      lowerbound = MIN(lowerbound, SCIPsyncstoreGetSubtreeLowerbound(syncstore, i));
+
+   if( SCIPisInfinity(scip, lowerbound) )
+   {
+      /* all subtrees were solved */
+      scip->stat->status = SCIPgetNSols(scip) > 0 ? SCIP_STATUS_OPTIMAL : SCIP_STATUS_INFEASIBLE;
+      lowerbound = SCIPgetUpperbound(scip);
+   }
+   else
+   {
+      /* some subtree was left open, so the solve was stopped by a limit or an interruption */
+      scip->stat->status = status;
+   }
+
+   root = SCIPgetRootNode(scip);
+
+   /* the dual bounds of the subtrees have been converted into the transformed space of the given SCIP by the solvers */
+   if( root != NULL && !SCIPisInfinity(scip, REALABS(lowerbound)) )
+   {
+      SCIP_CALL( SCIPupdateNodeLowerbound(scip, root, lowerbound) );
+   }
+
+   if( scip->stat->status == SCIP_STATUS_OPTIMAL || scip->stat->status == SCIP_STATUS_INFEASIBLE )
+      scip->set->stage = SCIP_STAGE_SOLVED;
 
    return SCIP_OKAY;
 }
@@ -514,6 +675,14 @@ SCIP_RETCODE SCIPconcurrentSolve(
    }
 
    retcode = SCIPtpiCollectJobs(jobid);
+
+   if( scip->set->concurrent_nsubtrees > 0 )
+   {
+      SCIP_CALL( concurrentGetSubtreesSolvingData(scip, syncstore) );
+
+      return retcode;
+   }
+
    idx = SCIPsyncstoreGetWinner(syncstore);
    assert(idx >= 0 && idx < nconcsolvers);
 
@@ -522,6 +691,634 @@ SCIP_RETCODE SCIPconcurrentSolve(
    return retcode;
 }
 
+/** converts an objective value of a copy of the transformed problem of a SCIP into the transformed space of that SCIP
+ *
+ *  The original problem of such a copy has the transformed objective of the copied SCIP, including its scaling but without
+ *  its offset, so original objective values of the copy are values in the transformed space of the copied SCIP. They are
+ *  normalized by the objective sense of the copy, such that dual bounds are lower bounds and primal bounds are upper
+ *  bounds, as in the transformed space.
+ */
+SCIP_Real SCIPconcurrentGetCopyObjval(
+   SCIP*                 copy,               /**< copy of the transformed problem */
+   SCIP_Real             objval              /**< objective value in the original space of the copy */
+   )
+{
+   assert(copy != NULL);
+
+   return (SCIP_Real) SCIPgetObjsense(copy) * objval;
+}
+
+/** adds the solutions of a ramp-up copy of the given SCIP to the given SCIP */
+static
+SCIP_RETCODE transferRampupSols(
+   SCIP*                 scip,               /**< SCIP datastructure in stage SCIP_STAGE_PRESOLVED */
+   SCIP*                 rampscip,           /**< copy of the presolved problem of the given SCIP */
+   SCIP_VAR**            rampvars            /**< variables of the copy, indexed like the variables of the given SCIP */
+   )
+{
+   SCIP_VAR**  vars;
+   SCIP_SOL**  sols;
+   SCIP_Real*  solvals;
+   int         nvars;
+   int         nsols;
+   int         i;
+
+   vars = SCIPgetVars(scip);
+   nvars = SCIPgetNVars(scip);
+   nsols = SCIPgetNSols(rampscip);
+   sols = SCIPgetSols(rampscip);
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &solvals, nvars) );
+
+   for( i = 0; i < nsols; ++i )
+   {
+      SCIP_SOL* sol;
+      SCIP_Bool stored;
+
+      SCIP_CALL( SCIPgetSolVals(rampscip, sols[i], nvars, rampvars, solvals) );
+      SCIP_CALL( SCIPcreateSol(scip, &sol, NULL) );
+      SCIP_CALL( SCIPsetSolVals(scip, sol, nvars, vars, solvals) );
+      SCIP_CALL( SCIPaddSolFree(scip, &sol, &stored) );
+   }
+
+   SCIPfreeBufferArray(scip, &solvals);
+
+   return SCIP_OKAY;
+}
+
+/** splits the search tree of the given SCIP into subtrees for the concurrent solvers
+ *
+ *  A copy of the problem is solved by branch-and-bound until it has enough open nodes or a node limit is reached.
+ *  The branching decisions of the open nodes are added to the subtree pool of the synchronization store, sorted by
+ *  lower bound, and the solutions found are added to the given SCIP. If the copy is solved during this ramp-up phase,
+ *  no subtrees are created.
+ */
+SCIP_RETCODE SCIPconcurrentCreateSubtrees(
+   SCIP*                 scip,               /**< SCIP datastructure in stage SCIP_STAGE_PRESOLVED */
+   int                   nsubtrees           /**< number of subtrees that should be created */
+   )
+{
+   SCIP*             rampscip;
+   SCIP_SYNCSTORE*   syncstore;
+   SCIP_HASHMAP*     varmapfw;
+   SCIP_HASHMAP*     varidxmap;
+   SCIP_VAR**        vars;
+   SCIP_VAR**        rampvars;
+   SCIP_Longint      nodelimit;
+   SCIP_Real         timelimit;
+   SCIP_Bool         valid;
+   int               nvars;
+   int               i;
+
+   assert(scip != NULL);
+   assert(SCIPgetStage(scip) == SCIP_STAGE_PRESOLVED);
+   assert(nsubtrees > 0);
+
+   syncstore = SCIPgetSyncstore(scip);
+   assert(syncstore != NULL);
+
+   vars = SCIPgetVars(scip);
+   nvars = SCIPgetNVars(scip);
+
+   /* create a copy of the presolved problem for the ramp-up phase */
+   SCIP_CALL( SCIPcreate(&rampscip) );
+   SCIP_CALL( SCIPhashmapCreate(&varmapfw, SCIPblkmem(rampscip), nvars) );
+   SCIP_CALL( SCIPcopy(scip, rampscip, varmapfw, NULL, "rampup", TRUE, FALSE, FALSE, FALSE, &valid) );
+
+   /* if some constraint could not be copied, the copy is a relaxation, whose open nodes, solutions, and solving
+    * status do not carry over; then, the whole tree is the only subtree
+    */
+   if( !valid )
+   {
+      SCIP_BOUNDSTORE* subtree;
+
+      SCIPdebugMsg(scip, "copy for ramp-up phase is not valid, the search tree is not split\n");
+
+      SCIPhashmapFree(&varmapfw);
+      SCIP_CALL( SCIPfree(&rampscip) );
+
+      SCIP_CALL( SCIPboundstoreCreate(scip, &subtree, nvars) );
+      SCIP_CALL( SCIPsyncstoreAddSubtree(syncstore, subtree, -SCIPinfinity(scip)) );
+
+      return SCIP_OKAY;
+   }
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &rampvars, nvars) );
+
+   for( i = 0; i < nvars; ++i )
+   {
+      rampvars[i] = (SCIP_VAR*) SCIPhashmapGetImage(varmapfw, vars[i]);
+      assert(rampvars[i] != NULL);
+   }
+
+   SCIPhashmapFree(&varmapfw);
+
+   /* the problem is already presolved and the open nodes must not be invalidated by a restart; the subtrees are
+    * solved without symmetry handling, so it must not restrict the tree they are taken from either
+    */
+   SCIP_CALL( SCIPsetPresolving(rampscip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetIntParam(rampscip, "presolving/maxrestarts", 0) );
+   SCIP_CALL( SCIPsetIntParam(rampscip, "misc/usesymmetry", 0) );
+   SCIP_CALL( SCIPsetIntParam(rampscip, "display/verblevel", 0) );
+   SCIP_CALL( SCIPsetBoolParam(rampscip, "misc/catchctrlc", FALSE) );
+
+   SCIP_CALL( SCIPgetRealParam(scip, "limits/time", &timelimit) );
+   if( !SCIPisInfinity(scip, timelimit) )
+   {
+      SCIP_CALL( SCIPsetRealParam(rampscip, "limits/time", MAX(timelimit - SCIPgetTotalTime(scip), 0.0)) );
+   }
+
+   /* branch until there are enough open nodes */
+   nodelimit = 0;
+
+   do
+   {
+      nodelimit += nsubtrees;
+      SCIP_CALL( SCIPsetLongintParam(rampscip, "limits/nodes", nodelimit) );
+      SCIP_CALL( SCIPsolve(rampscip) );
+   }
+   while( SCIPgetStatus(rampscip) == SCIP_STATUS_NODELIMIT && SCIPgetNNodesLeft(rampscip) < nsubtrees
+      && nodelimit < RAMPUP_MAXNODESFACTOR * (SCIP_Longint) nsubtrees );
+
+   if( SCIPgetStage(rampscip) == SCIP_STAGE_SOLVING )
+   {
+      SCIP_NODE**  leaves;
+      SCIP_NODE**  children;
+      SCIP_NODE**  siblings;
+      SCIP_NODE**  opennodes;
+      SCIP_NODE*   focusnode;
+      SCIP_Real*   lowerbounds;
+      SCIP_VAR**   branchvars;
+      SCIP_Real*   branchbounds;
+      SCIP_BOUNDTYPE* boundtypes;
+      int          branchvarssize;
+      int          nleaves;
+      int          nchildren;
+      int          nsiblings;
+      int          nopennodes;
+      int          j;
+
+      SCIP_CALL( SCIPgetOpenNodesData(rampscip, &leaves, &children, &siblings, &nleaves, &nchildren, &nsiblings) );
+      nopennodes = nleaves + nchildren + nsiblings;
+
+      SCIP_CALL( SCIPallocBufferArray(scip, &opennodes, nopennodes + 1) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &lowerbounds, nopennodes + 1) );
+
+      for( i = 0; i < nleaves; ++i )
+         opennodes[i] = leaves[i];
+      for( i = 0; i < nchildren; ++i )
+         opennodes[nleaves + i] = children[i];
+      for( i = 0; i < nsiblings; ++i )
+         opennodes[nleaves + nchildren + i] = siblings[i];
+
+      /* if a limit stopped the ramp-up phase while a node was processed, the focus node has not been branched on and
+       * its subtree is not covered by the open nodes; cut off focus nodes have an infinite lower bound
+       */
+      focusnode = SCIPgetFocusNode(rampscip);
+      if( focusnode != NULL && nchildren == 0
+         && SCIPisLT(rampscip, SCIPnodeGetLowerbound(focusnode), SCIPgetCutoffbound(rampscip)) )
+         opennodes[nopennodes++] = focusnode;
+
+      for( i = 0; i < nopennodes; ++i )
+         lowerbounds[i] = SCIPnodeGetLowerbound(opennodes[i]);
+
+      /* process the subtrees with the best lower bound first */
+      SCIPsortRealPtr(lowerbounds, (void**) opennodes, nopennodes);
+
+      /* map the branching variables of the ramp-up copy to the variable indices of the given SCIP */
+      SCIP_CALL( SCIPhashmapCreate(&varidxmap, SCIPblkmem(scip), nvars) );
+
+      for( i = 0; i < nvars; ++i )
+      {
+         SCIP_VAR* transvar;
+
+         transvar = SCIPvarGetTransVar(rampvars[i]);
+
+         if( transvar != NULL )
+         {
+            SCIP_CALL( SCIPhashmapInsertInt(varidxmap, transvar, i) );
+         }
+      }
+
+      branchvarssize = MAX(SCIPgetMaxDepth(rampscip), 0) + 1;
+      SCIP_CALL( SCIPallocBufferArray(scip, &branchvars, branchvarssize) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &branchbounds, branchvarssize) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &boundtypes, branchvarssize) );
+
+      for( i = 0; i < nopennodes; ++i )
+      {
+         SCIP_BOUNDSTORE* subtree;
+         int nbranchvars;
+
+         SCIPnodeGetAncestorBranchings(opennodes[i], branchvars, branchbounds, boundtypes, &nbranchvars, branchvarssize);
+
+         if( nbranchvars > branchvarssize )
+         {
+            branchvarssize = nbranchvars;
+            SCIP_CALL( SCIPreallocBufferArray(scip, &branchvars, branchvarssize) );
+            SCIP_CALL( SCIPreallocBufferArray(scip, &branchbounds, branchvarssize) );
+            SCIP_CALL( SCIPreallocBufferArray(scip, &boundtypes, branchvarssize) );
+
+            SCIPnodeGetAncestorBranchings(opennodes[i], branchvars, branchbounds, boundtypes, &nbranchvars, branchvarssize);
+         }
+
+         SCIP_CALL( SCIPboundstoreCreate(scip, &subtree, nvars) );
+
+         /* branchings on variables that only exist in the ramp-up copy are dropped, which relaxes the subtree */
+         for( j = 0; j < nbranchvars; ++j )
+         {
+            if( SCIPhashmapExists(varidxmap, branchvars[j]) )
+            {
+               SCIP_CALL( SCIPboundstoreAdd(scip, subtree, SCIPhashmapGetImageInt(varidxmap, branchvars[j]),
+                     branchbounds[j], boundtypes[j]) );
+            }
+         }
+
+         /* the lower bound of the node is in the transformed space of the copy */
+         SCIP_CALL( SCIPsyncstoreAddSubtree(syncstore, subtree,
+               SCIPconcurrentGetCopyObjval(rampscip, SCIPretransformObj(rampscip, lowerbounds[i]))) );
+      }
+
+      SCIPfreeBufferArray(scip, &boundtypes);
+      SCIPfreeBufferArray(scip, &branchbounds);
+      SCIPfreeBufferArray(scip, &branchvars);
+      SCIPhashmapFree(&varidxmap);
+      SCIPfreeBufferArray(scip, &lowerbounds);
+      SCIPfreeBufferArray(scip, &opennodes);
+   }
+
+   /* if the ramp-up phase stopped before branching, the whole tree is the only subtree */
+   if( SCIPsyncstoreGetNSubtrees(syncstore) == 0 && SCIPgetStatus(rampscip) != SCIP_STATUS_OPTIMAL
+      && SCIPgetStatus(rampscip) != SCIP_STATUS_INFEASIBLE )
+   {
+      SCIP_BOUNDSTORE* subtree;
+
+      SCIP_CALL( SCIPboundstoreCreate(scip, &subtree, nvars) );
+      SCIP_CALL( SCIPsyncstoreAddSubtree(syncstore, subtree, -SCIPinfinity(scip)) );
+   }
+
+   /* pass the solutions of the ramp-up phase to the given SCIP */
+   SCIP_CALL( transferRampupSols(scip, rampscip, rampvars) );
+
+   SCIPfreeBufferArray(scip, &rampvars);
+
+   SCIP_CALL( SCIPfree(&rampscip) );
+
+   return SCIP_OKAY;
+}
+
+/** solves the copy of a symmetry handling method in the racing ramp-up phase until its node limit is reached */
+static
+SCIP_RETCODE execSymmetryRacer(
+   void*                 args                /**< SCIP data structure of the copy passed in as a void pointer */
+   )
+{
+   assert(args != NULL);
+
+   SCIP_CALL( SCIPsolve((SCIP*) args) );
+
+   return SCIP_OKAY;
+}
+
+/** gets the number of open nodes of a racer, which is zero if it stopped before or after the tree search */
+static
+int getRacerNNodesLeft(
+   SCIP*                 racescip            /**< copy of a racing symmetry handling method */
+   )
+{
+   return SCIPgetStage(racescip) == SCIP_STAGE_SOLVING ? SCIPgetNNodesLeft(racescip) : 0;
+}
+
+/** gets the dual bound of a racer in the transformed space of the given SCIP, which is a lower bound */
+static
+SCIP_Real getRacerDualbound(
+   SCIP*                 racescip            /**< copy of a racing symmetry handling method */
+   )
+{
+   return SCIPconcurrentGetCopyObjval(racescip, SCIPgetDualbound(racescip));
+}
+
+/** gets the primal bound of a racer in the transformed space of the given SCIP, which is an upper bound */
+static
+SCIP_Real getRacerPrimalbound(
+   SCIP*                 racescip            /**< copy of a racing symmetry handling method */
+   )
+{
+   return SCIPconcurrentGetCopyObjval(racescip, SCIPgetPrimalbound(racescip));
+}
+
+/** passes the best solution of all racers to the racers that have not found it */
+static
+SCIP_RETCODE shareRacingSolution(
+   SCIP*                 scip,               /**< SCIP datastructure */
+   SCIP**                racescips,          /**< copies of the racing symmetry handling methods */
+   SCIP_VAR***           racevars,           /**< variables of the copies, indexed like the variables of given SCIP */
+   int                   nracers             /**< number of racers */
+   )
+{
+   SCIP_Real* solvals;
+   int        nvars;
+   int        best;
+   int        r;
+
+   best = -1;
+
+   for( r = 0; r < nracers; ++r )
+   {
+      if( SCIPgetNSols(racescips[r]) > 0
+         && (best == -1 || SCIPisLT(scip, getRacerPrimalbound(racescips[r]), getRacerPrimalbound(racescips[best]))) )
+         best = r;
+   }
+
+   if( best == -1 )
+      return SCIP_OKAY;
+
+   nvars = SCIPgetNVars(scip);
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &solvals, nvars) );
+   SCIP_CALL( SCIPgetSolVals(racescips[best], SCIPgetBestSol(racescips[best]), nvars, racevars[best], solvals) );
+
+   for( r = 0; r < nracers; ++r )
+   {
+      SCIP_SOL* sol;
+      SCIP_Bool stored;
+
+      if( SCIPgetStage(racescips[r]) != SCIP_STAGE_SOLVING
+         || !SCIPisLT(scip, getRacerPrimalbound(racescips[best]), getRacerPrimalbound(racescips[r])) )
+         continue;
+
+      SCIP_CALL( SCIPcreateOrigSol(racescips[r], &sol, NULL) );
+      SCIP_CALL( SCIPsetSolVals(racescips[r], sol, nvars, racevars[r], solvals) );
+      SCIP_CALL( SCIPtrySolFree(racescips[r], &sol, FALSE, FALSE, TRUE, TRUE, TRUE, &stored) );
+   }
+
+   SCIPfreeBufferArray(scip, &solvals);
+
+   return SCIP_OKAY;
+}
+
+/** sets the parameters of the given SCIP such that it uses the given symmetry handling method of the racing ramp-up
+ *  phase
+ */
+SCIP_RETCODE SCIPconcurrentSetSymmetryVariant(
+   SCIP*                 scip,               /**< SCIP datastructure in stage SCIP_STAGE_PROBLEM */
+   int                   symvariant          /**< index of the symmetry handling method */
+   )
+{
+   assert(scip != NULL);
+   assert(symvariant >= 0 && symvariant < SYMRACING_NVARIANTS);
+
+   SCIP_CALL( SCIPsetIntParam(scip, "misc/usesymmetry", symracingusesymmetry[symvariant]) );
+
+   /* the orbitope variants only differ in whether sub-symmetries are handled by activation handlers */
+   if( (symracingusesymmetry[symvariant] & 1) != 0 && SCIPgetParam(scip, "propagating/symmetry/detectorbitopes") != NULL )
+   {
+      SCIP_CALL( SCIPsetBoolParam(scip, "propagating/symmetry/detectorbitopes", TRUE) );
+   }
+
+   if( SCIPgetParam(scip, "propagating/symmetry/detectsubsym") != NULL )
+   {
+      SCIP_CALL( SCIPsetBoolParam(scip, "propagating/symmetry/detectsubsym", symracingdetectsubsym[symvariant]) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** lets the symmetry handling methods race against each other on copies of the given SCIP
+ *
+ *  Every racer solves a copy of the presolved problem with a different symmetry handling method until it has processed
+ *  the number of nodes given by concurrent/symracingnodes. All symmetry handling methods race; if there are fewer
+ *  threads than methods, the racers share the threads round-robin in every round. After each of the SYMRACING_NROUNDS
+ *  rounds of the race, the best solution is passed to the other racers and the race is stopped early if a racer solved
+ *  the problem or the best dual bound of all racers closes the gap. The racer with the best dual bound wins, ties are
+ *  broken by the number of open nodes. All bounds are compared in the transformed space of the given SCIP. The winner
+ *  is stored in the synchronization store, such that the concurrent solvers use its symmetry handling method, and the
+ *  solutions of all racers are added to the given SCIP. If a racer solved the problem, its status is returned, such
+ *  that its result can be used instead of solving the problem concurrently.
+ *
+ *  If the problem cannot be copied completely, the copies are relaxations whose results do not carry over, so no race
+ *  takes place.
+ */
+SCIP_RETCODE SCIPconcurrentRaceSymmetry(
+   SCIP*                 scip,               /**< SCIP datastructure in stage SCIP_STAGE_PRESOLVED */
+   int                   nthreads,           /**< number of threads that can be used for the race */
+   SCIP_STATUS*          status              /**< pointer to store the status of the racer that solved the problem, or
+                                              *   SCIP_STATUS_UNKNOWN */
+   )
+{
+   SCIP**            racescips;
+   SCIP_VAR***       racevars;
+   SCIP_VAR**        vars;
+   SCIP_RETCODE      retcode;
+   SCIP_Real         timelimit;
+   SCIP_Real         dualbound;
+   SCIP_Real         primalbound;
+   SCIP_Bool         stopped;
+   int               nracers;
+   int               nvars;
+   int               winner;
+   int               round;
+   int               r;
+   int               i;
+
+   assert(scip != NULL);
+   assert(SCIPgetStage(scip) == SCIP_STAGE_PRESOLVED);
+   assert(status != NULL);
+
+   *status = SCIP_STATUS_UNKNOWN;
+
+   if( nthreads < 2 )
+      return SCIP_OKAY;
+
+   nracers = SYMRACING_NVARIANTS;
+
+   vars = SCIPgetVars(scip);
+   nvars = SCIPgetNVars(scip);
+
+   SCIP_CALL( SCIPgetRealParam(scip, "limits/time", &timelimit) );
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &racescips, nracers) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &racevars, nracers) );
+
+   /* create a copy of the presolved problem for every racer */
+   for( r = 0; r < nracers; ++r )
+   {
+      SCIP_HASHMAP* varmapfw;
+      SCIP_Bool valid;
+
+      SCIP_CALL( SCIPcreate(&racescips[r]) );
+      SCIP_CALL( SCIPhashmapCreate(&varmapfw, SCIPblkmem(racescips[r]), nvars) );
+      SCIP_CALL( SCIPcopy(scip, racescips[r], varmapfw, NULL, symracingnames[r], TRUE, FALSE, FALSE, FALSE, &valid) );
+
+      if( !valid )
+      {
+         SCIPdebugMsg(scip, "copy for racing ramp-up phase is not valid, the symmetry handling methods do not race\n");
+
+         SCIPhashmapFree(&varmapfw);
+         SCIP_CALL( SCIPfree(&racescips[r]) );
+
+         for( --r; r >= 0; --r )
+         {
+            SCIPfreeBufferArray(scip, &racevars[r]);
+            SCIP_CALL( SCIPfree(&racescips[r]) );
+         }
+
+         SCIPfreeBufferArray(scip, &racevars);
+         SCIPfreeBufferArray(scip, &racescips);
+
+         return SCIP_OKAY;
+      }
+
+      SCIP_CALL( SCIPallocBufferArray(scip, &racevars[r], nvars) );
+
+      for( i = 0; i < nvars; ++i )
+      {
+         racevars[r][i] = (SCIP_VAR*) SCIPhashmapGetImage(varmapfw, vars[i]);
+         assert(racevars[r][i] != NULL);
+      }
+
+      SCIPhashmapFree(&varmapfw);
+
+      SCIP_CALL( SCIPconcurrentSetSymmetryVariant(racescips[r], r) );
+      SCIP_CALL( SCIPsetIntParam(racescips[r], "display/verblevel", 0) );
+      SCIP_CALL( SCIPsetBoolParam(racescips[r], "misc/catchctrlc", FALSE) );
+
+      if( !SCIPisInfinity(scip, timelimit) )
+      {
+         SCIP_CALL( SCIPsetRealParam(racescips[r], "limits/time", MAX(timelimit - SCIPgetTotalTime(scip), 0.0)) );
+      }
+   }
+
+   /* the jobs of the racers are queued, so that every racer runs in every round even if there are fewer threads */
+   SCIP_CALL( SCIPtpiInit(MIN(nthreads, nracers), INT_MAX, FALSE) );
+
+   retcode = SCIP_OKAY;
+   stopped = FALSE;
+   winner = -1;
+
+   for( round = 1; round <= SYMRACING_NROUNDS && !stopped && retcode == SCIP_OKAY; ++round )
+   {
+      SCIP_Longint nodelimit;
+      int          jobid;
+
+      nodelimit = (round * scip->set->concurrent_symracingnodes + SYMRACING_NROUNDS - 1) / SYMRACING_NROUNDS;
+
+      for( r = 0; r < nracers; ++r )
+      {
+         SCIP_CALL( SCIPsetLongintParam(racescips[r], "limits/nodes", nodelimit) );
+      }
+
+      jobid = SCIPtpiGetNewJobID();
+
+      TPI_PARA
+      {
+         TPI_SINGLE
+         {
+            for( r = 0; r < nracers; ++r )
+            {
+               /* cppcheck-suppress unassignedVariable */
+               SCIP_JOB*         job;
+               SCIP_SUBMITSTATUS status;
+
+               SCIP_CALL_ABORT( SCIPtpiCreateJob(&job, jobid, execSymmetryRacer, racescips[r]) );
+               SCIP_CALL_ABORT( SCIPtpiSumbitJob(job, &status) );
+
+               assert(status == SCIP_SUBMIT_SUCCESS);
+            }
+         }
+      }
+
+      retcode = SCIPtpiCollectJobs(jobid);
+
+      if( retcode != SCIP_OKAY )
+         break;
+
+      SCIP_CALL( shareRacingSolution(scip, racescips, racevars, nracers) );
+
+      /* the race ends if a racer stopped for another reason than the node limit of the race, e.g., because it solved
+       * the problem or hit the time limit, or if the dual bounds of the racers close the gap; the bounds are compared in
+       * the transformed space of the given SCIP, which is minimized
+       */
+      dualbound = -SCIPinfinity(scip);
+      primalbound = SCIPinfinity(scip);
+
+      for( r = 0; r < nracers; ++r )
+      {
+         SCIP_STATUS racestatus;
+
+         racestatus = SCIPgetStatus(racescips[r]);
+
+         if( racestatus != SCIP_STATUS_NODELIMIT )
+         {
+            stopped = TRUE;
+
+            if( winner == -1 && (racestatus == SCIP_STATUS_OPTIMAL || racestatus == SCIP_STATUS_INFEASIBLE
+                  || racestatus == SCIP_STATUS_UNBOUNDED || racestatus == SCIP_STATUS_INFORUNBD) )
+            {
+               winner = r;
+               *status = racestatus;
+            }
+         }
+
+         dualbound = MAX(dualbound, getRacerDualbound(racescips[r]));
+         primalbound = MIN(primalbound, getRacerPrimalbound(racescips[r]));
+      }
+
+      if( !SCIPisInfinity(scip, primalbound) && SCIPisGE(scip, dualbound, primalbound) )
+         stopped = TRUE;
+   }
+
+   SCIP_CALL( SCIPtpiExit() );
+
+   if( retcode == SCIP_OKAY )
+   {
+      /* if no racer solved the problem, the one with the best dual bound wins, on ties the one with the fewest open
+       * nodes
+       */
+      if( winner == -1 )
+      {
+         winner = 0;
+
+         for( r = 1; r < nracers; ++r )
+         {
+            if( SCIPisGT(scip, getRacerDualbound(racescips[r]), getRacerDualbound(racescips[winner]))
+               || (SCIPisEQ(scip, getRacerDualbound(racescips[r]), getRacerDualbound(racescips[winner]))
+                  && getRacerNNodesLeft(racescips[r]) < getRacerNNodesLeft(racescips[winner])) )
+               winner = r;
+         }
+      }
+      assert(winner >= 0 && winner < nracers);
+
+      for( r = 0; r < nracers; ++r )
+      {
+         SCIPverbMessage(scip, SCIP_VERBLEVEL_FULL, NULL,
+            "symmetry racer %-15s: %lld nodes, %d open, dual bound %g, primal bound %g\n", symracingnames[r],
+            SCIPgetNNodes(racescips[r]), getRacerNNodesLeft(racescips[r]),
+            SCIPretransformObj(scip, getRacerDualbound(racescips[r])),
+            SCIPretransformObj(scip, getRacerPrimalbound(racescips[r])));
+
+         /* pass the solutions of the race to the given SCIP */
+         SCIP_CALL( transferRampupSols(scip, racescips[r], racevars[r]) );
+      }
+
+      SCIPverbMessage(scip, SCIP_VERBLEVEL_HIGH, NULL, "symmetry handling method <%s> won the racing ramp-up phase\n",
+         symracingnames[winner]);
+
+      SCIPsyncstoreSetSymmetryVariant(SCIPgetSyncstore(scip), winner);
+   }
+
+   for( r = nracers - 1; r >= 0; --r )
+   {
+      SCIPfreeBufferArray(scip, &racevars[r]);
+      SCIP_CALL( SCIPfree(&racescips[r]) );
+   }
+
+   SCIPfreeBufferArray(scip, &racevars);
+   SCIPfreeBufferArray(scip, &racescips);
+
+   return retcode;
+}
+
 /** copy solving statistics */
 SCIP_RETCODE SCIPcopyConcurrentSolvingStats(
    SCIP*                 source,             /**< SCIP data structure */
@@ -668,16 +1465,22 @@ SCIP_RETCODE SCIPcopyConcurrentSolvingStats(
       }
    }
 
-   target->primal->nsolsfound = source->primal->nsolsfound;
-   target->primal->nbestsolsfound = source->primal->nbestsolsfound;
-   target->primal->nlimsolsfound = source->primal->nlimsolsfound;
-   SCIPprobSetDualbound(target->transprob, SCIPprobExternObjval(target->transprob, target->origprob, target->set, SCIPgetDualbound(source)));
-   root = SCIPgetRootNode(target);
-
-   if( root != NULL )
+   /* if the tree is split, the solutions of all solvers are added to the target and the dual bound of a single solver
+    * is only valid for its subtrees
+    */
+   if( target->set->concurrent_nsubtrees == 0 )
    {
-      /* in the copied SCIP the dualbound is in the transformed space of the target */
-      SCIP_CALL( SCIPupdateNodeLowerbound(target, root, SCIPgetDualbound(source)) );
+      target->primal->nsolsfound = source->primal->nsolsfound;
+      target->primal->nbestsolsfound = source->primal->nbestsolsfound;
+      target->primal->nlimsolsfound = source->primal->nlimsolsfound;
+      SCIPprobSetDualbound(target->transprob, SCIPprobExternObjval(target->transprob, target->origprob, target->set, SCIPgetDualbound(source)));
+      root = SCIPgetRootNode(target);
+
+      if( root != NULL )
+      {
+         /* in the copied SCIP the dualbound is in the transformed space of the target */
+         SCIP_CALL( SCIPupdateNodeLowerbound(target, root, SCIPgetDualbound(source)) );
+      }
    }
 
    target->stat->nlpiterations = source->stat->nlpiterations;
@@ -25,6 +25,7 @@
 #include "scip/type_scip.h"
 #include "scip/type_concsolver.h"
 #include "scip/type_sol.h"
+#include "scip/type_stat.h"
 #include "scip/type_var.h"
 #include "scip/type_syncstore.h"
 #include "scip/def.h"
@@ -124,6 +125,36 @@ SCIP_RETCODE SCIPconcurrentSolve(
    SCIP*                 scip                /**< pointer to scip datastructure */
    );
 
+/** converts an objective value of a copy of the transformed problem of a SCIP into the transformed space of that SCIP */
+SCIP_Real SCIPconcurrentGetCopyObjval(
+   SCIP*                 copy,               /**< copy of the transformed problem */
+   SCIP_Real             objval              /**< objective value in the original space of the copy */
+   );
+
+/** splits the search tree of the given SCIP into subtrees for the concurrent solvers */
+SCIP_RETCODE SCIPconcurrentCreateSubtrees(
+   SCIP*                 scip,               /**< SCIP datastructure in stage SCIP_STAGE_PRESOLVED */
+   int                   nsubtrees           /**< number of subtrees that should be created */
+   );
+
+/** sets the parameters of the given SCIP such that it uses the given symmetry handling method of the racing ramp-up
+ *  phase
+ */
+SCIP_RETCODE SCIPconcurrentSetSymmetryVariant(
+   SCIP*                 scip,               /**< SCIP datastructure in stage SCIP_STAGE_PROBLEM */
+   int                   symvariant          /**< index of the symmetry handling method */
+   );
+
+/** lets the symmetry handling methods race against each other on copies of the given SCIP and stores the winner in the
+ *  synchronization store
+ */
+SCIP_RETCODE SCIPconcurrentRaceSymmetry(
+   SCIP*                 scip,               /**< SCIP datastructure in stage SCIP_STAGE_PRESOLVED */
+   int                   nthreads,           /**< number of threads that can be used for the race */
+   SCIP_STATUS*          status              /**< pointer to store the status of the racer that solved the problem, or
+                                              *   SCIP_STATUS_UNKNOWN */
+   );
+
 /** disables storing global bound changes */
 void SCIPdisableConcurrentBoundStorage(
    SCIP*                 scip                /**< SCIP data structure */
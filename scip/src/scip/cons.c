@@ -40,6 +40,7 @@
 #include "scip/cons.h"
 #include "scip/branch.h"
 #include "scip/reopt.h"
+#include "scip/activation.h"
 #include "scip/pub_misc.h"
 
 #ifndef NDEBUG
@@ -6147,6 +6148,13 @@ SCIP_RETCODE SCIPconsFree(
    SCIPsetDebugMsg(set, "freeing constraint <%s> at conss pos %d of handler <%s>\n",
       (*cons)->name, (*cons)->consspos, (*cons)->conshdlr->name);
 
+   /* let the activation handler release the data it stores for this constraint; the data is stored for the original
+    * constraint, or for the constraint itself if it only exists in the transformed problem */
+   if( (*cons)->activationhdlr != NULL && ((*cons)->original || (*cons)->transorigcons == NULL) )
+   {
+      SCIP_CALL( SCIPactivationhdlrConsDelete((*cons)->activationhdlr, *cons, set) );
+   }
+
    /* free constraint data */
    if( (*cons)->conshdlr->consdelete != NULL && (*cons)->consdata != NULL && (*cons)->deleteconsdata )
    {
@@ -8073,6 +8081,7 @@ void SCIPprintLinConsStats(
 #undef SCIPconsIsInProb
 #undef SCIPconsIsOriginal
 #undef SCIPconsIsTransformed
+#undef SCIPconsGetOriginal
 #undef SCIPconsIsLockedPos
 #undef SCIPconsIsLockedNeg
 #undef SCIPconsIsLocked
@@ -8418,6 +8427,18 @@ SCIP_Bool SCIPconsIsTransformed(
    return !cons->original;
 }
 
+/** returns the constraint itself if it is an original constraint, the associated original constraint of a transformed
+ *  constraint, or NULL if the transformed constraint has no associated original constraint
+ */
+SCIP_CONS* SCIPconsGetOriginal(
+   SCIP_CONS*            cons                /**< constraint */
+   )
+{
+   assert(cons != NULL);
+
+   return cons->original ? cons : cons->transorigcons;
+}
+
 /** returns TRUE iff roundings for variables in constraint are locked */
 SCIP_Bool SCIPconsIsLockedPos(
    SCIP_CONS*            cons                /**< constraint */
@@ -583,7 +583,12 @@ SCIP_RETCODE copyToSubscip(
             SCIPconsIsChecked(conss[i]), SCIPconsIsPropagated(conss[i]), FALSE, FALSE,
             SCIPconsIsDynamic(conss[i]), SCIPconsIsRemovable(conss[i]), FALSE, FALSE, success) );
 
-      /* abort if constraint was not successfully copied */
+      /* abort if constraint was not successfully copied; a constraint whose activation could not be copied is
+       * discarded without invalidating the copy, but the solution of the component is fixed in the main problem
+       */
+      if( newcons == NULL )
+         *success = FALSE;
+
       if( !(*success) )
          return SCIP_OKAY;
 
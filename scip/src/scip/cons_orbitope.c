@@ -4384,3 +4384,65 @@ SCIP_RETCODE SCIPcreateConsBasicOrbitope(
 
    return SCIP_OKAY;
 }
+
+/** creates a submatrix that an activation handler can return as activation data of an orbitope constraint
+ *
+ *  The row and column indices are copied. The submatrix is allocated in block memory, and is freed by the orbitope
+ *  constraint after propagating it.
+ */
+SCIP_RETCODE SCIPcreateActivationSubmatrix(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_ACTIVATIONSUBMATRIX** submatrix,     /**< pointer to store the created submatrix */
+   const int*            rows,               /**< indices of the rows selected in the submatrix */
+   int                   nrows,              /**< number of selected rows */
+   const int*            cols,               /**< indices of the columns selected in the submatrix */
+   int                   ncols,              /**< number of selected columns */
+   SCIP_ORBITOPETYPE     orbitopetype,       /**< type of orbitope for the submatrix */
+   SCIP_ACTIVATIONSUBMATRIX* next            /**< next submatrix in the list, or NULL */
+   )
+{
+   assert(scip != NULL);
+   assert(submatrix != NULL);
+   assert(rows != NULL);
+   assert(cols != NULL);
+   assert(nrows > 0);
+   assert(ncols > 0);
+
+   SCIP_CALL( SCIPallocBlockMemory(scip, submatrix) );
+   SCIP_CALL( SCIPduplicateBlockMemoryArray(scip, &(*submatrix)->rows, rows, nrows) );
+   SCIP_CALL( SCIPduplicateBlockMemoryArray(scip, &(*submatrix)->cols, cols, ncols) );
+
+   (*submatrix)->nrows = nrows;
+   (*submatrix)->ncols = ncols;
+   (*submatrix)->orbitopetype = orbitopetype;
+   (*submatrix)->next = next;
+
+   return SCIP_OKAY;
+}
+
+/** frees a list of submatrices created by SCIPcreateActivationSubmatrix()
+ *
+ *  Activation handlers only need this to clean up submatrices that are not returned to the orbitope constraint,
+ *  e.g., when the find-data callback fails after some submatrices have already been created.
+ */
+void SCIPfreeActivationSubmatrices(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_ACTIVATIONSUBMATRIX** submatrix      /**< pointer to the first submatrix of the list, or to NULL */
+   )
+{
+   SCIP_ACTIVATIONSUBMATRIX* next;
+
+   assert(scip != NULL);
+   assert(submatrix != NULL);
+
+   while( *submatrix != NULL )
+   {
+      next = (*submatrix)->next;
+
+      SCIPfreeBlockMemoryArray(scip, &(*submatrix)->cols, (*submatrix)->ncols);
+      SCIPfreeBlockMemoryArray(scip, &(*submatrix)->rows, (*submatrix)->nrows);
+      SCIPfreeBlockMemory(scip, submatrix);
+
+      *submatrix = next;
+   }
+}
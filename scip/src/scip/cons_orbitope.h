@@ -27,6 +27,7 @@
 #define __SCIP_CONS_ORBITOPE_H__
 
 #include "scip/def.h"
+#include "scip/type_activation.h"
 #include "scip/type_cons.h"
 #include "scip/type_retcode.h"
 #include "scip/type_scip.h"
@@ -143,6 +144,34 @@ SCIP_RETCODE SCIPcreateConsBasicOrbitope(
                                               *   with symmetries handled by other routines */
    );
 
+/** creates a submatrix that an activation handler can return as activation data of an orbitope constraint
+ *
+ *  The row and column indices are copied. The submatrix is allocated in block memory, and is freed by the orbitope
+ *  constraint after propagating it.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPcreateActivationSubmatrix(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_ACTIVATIONSUBMATRIX** submatrix,     /**< pointer to store the created submatrix */
+   const int*            rows,               /**< indices of the rows selected in the submatrix */
+   int                   nrows,              /**< number of selected rows */
+   const int*            cols,               /**< indices of the columns selected in the submatrix */
+   int                   ncols,              /**< number of selected columns */
+   SCIP_ORBITOPETYPE     orbitopetype,       /**< type of orbitope for the submatrix */
+   SCIP_ACTIVATIONSUBMATRIX* next            /**< next submatrix in the list, or NULL */
+   );
+
+/** frees a list of submatrices created by SCIPcreateActivationSubmatrix()
+ *
+ *  Activation handlers only need this to clean up submatrices that are not returned to the orbitope constraint,
+ *  e.g., when the find-data callback fails after some submatrices have already been created.
+ */
+SCIP_EXPORT
+void SCIPfreeActivationSubmatrices(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_ACTIVATIONSUBMATRIX** submatrix      /**< pointer to the first submatrix of the list, or to NULL */
+   );
+
 /** @} */
 
 /** @} */
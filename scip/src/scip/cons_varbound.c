@@ -5082,6 +5082,35 @@ SCIP_DECL_EVENTEXEC(eventExecVarbound)
    return SCIP_OKAY;
 }
 
+/** batched execution method of bound change event handler for the bound tightenings found during propagation */
+static
+SCIP_DECL_EVENTEXECBATCH(eventExecBatchVarbound)
+{  /*lint --e{715}*/
+   SCIP_CONS* cons;
+   SCIP_CONSDATA* consdata;
+   int i;
+
+   assert(events != NULL);
+   assert(eventdata != NULL);
+
+   for( i = 0; i < nevents; ++i )
+   {
+      assert((SCIPeventGetType(events[i]) & SCIP_EVENTTYPE_BOUNDTIGHTENED) != 0);
+
+      cons = (SCIP_CONS*)eventdata[i];
+      assert(cons != NULL);
+      consdata = SCIPconsGetData(cons);
+      assert(consdata != NULL);
+
+      consdata->presolved = FALSE;
+      consdata->tightened = FALSE;
+
+      SCIP_CALL( SCIPmarkConsPropagate(scip, cons) );
+   }
+
+   return SCIP_OKAY;
+}
+
 /**@} */
 
 
@@ -5097,6 +5126,7 @@ SCIP_RETCODE SCIPincludeConshdlrVarbound(
    /* include event handler for bound change events */
    SCIP_CALL( SCIPincludeEventhdlrBasic(scip, &eventhdlr, EVENTHDLR_NAME, EVENTHDLR_DESC,
          eventExecVarbound, NULL) );
+   SCIP_CALL( SCIPsetEventhdlrExecBatch(scip, eventhdlr, eventExecBatchVarbound) );
 
    /* create variable bound constraint handler data */
    SCIP_CALL( conshdlrdataCreate(scip, &conshdlrdata, eventhdlr) );
@@ -625,34 +625,50 @@ SCIP_RETCODE isSolutionInNode(
       {
          SCIP_DOMCHGBOUND* domchgbound;
          SCIP_BOUNDCHG* boundchgs;
+         SCIP_BOUNDCHG compactboundchg;
+         SCIP_Bool compact;
+         int bytepos;
          int i;
 
          domchgbound = &node->domchg->domchgbound;
          boundchgs = domchgbound->boundchgs;
+         compact = (node->domchg->domchgcompact.domchgtype == SCIP_DOMCHGTYPE_COMPACT); /*lint !e641*/
+         compactboundchg.var = NULL;
+         bytepos = 0;
          for( i = 0; i < (int)domchgbound->nboundchgs && *solcontained; ++i )
          {
+            SCIP_BOUNDCHG* boundchg;
             SCIP_Real varsol;
 
+            /* decode the branching decisions of a leaf that is stored compactly */
+            if( compact )
+            {
+               SCIPdomchgGetCompactBoundchg(node->domchg, &bytepos, &compactboundchg);
+               boundchg = &compactboundchg;
+            }
+            else
+               boundchg = &boundchgs[i];
+
             /* get solution value of variable */
-            SCIP_CALL( getSolutionValue(set, boundchgs[i].var, &varsol) );
+            SCIP_CALL( getSolutionValue(set, boundchg->var, &varsol) );
 
             if( varsol != SCIP_UNKNOWN ) /*lint !e777*/
             {
                /* compare the bound change with the solution value */
-               if( SCIPboundchgGetBoundtype(&boundchgs[i]) == SCIP_BOUNDTYPE_LOWER )
-                  *solcontained = SCIPsetIsFeasGE(set, varsol, boundchgs[i].newbound);
+               if( SCIPboundchgGetBoundtype(boundchg) == SCIP_BOUNDTYPE_LOWER )
+                  *solcontained = SCIPsetIsFeasGE(set, varsol, boundchg->newbound);
                else
-                  *solcontained = SCIPsetIsFeasLE(set, varsol, boundchgs[i].newbound);
+                  *solcontained = SCIPsetIsFeasLE(set, varsol, boundchg->newbound);
 
-               if( !(*solcontained) && SCIPboundchgGetBoundchgtype(&boundchgs[i]) != SCIP_BOUNDCHGTYPE_BRANCHING )
+               if( !(*solcontained) && SCIPboundchgGetBoundchgtype(boundchg) != SCIP_BOUNDCHGTYPE_BRANCHING )
                {
                   SCIPerrorMessage("debugging solution was cut off in local node %p at depth %d by inference <%s>[%.15g] %s %.15g\n",
-                     (void*) node, SCIPnodeGetDepth(node), SCIPvarGetName(boundchgs[i].var), varsol,
-                     SCIPboundchgGetBoundtype(&boundchgs[i]) == SCIP_BOUNDTYPE_LOWER ? ">=" : "<=", boundchgs[i].newbound);
+                     (void*) node, SCIPnodeGetDepth(node), SCIPvarGetName(boundchg->var), varsol,
+                     SCIPboundchgGetBoundtype(boundchg) == SCIP_BOUNDTYPE_LOWER ? ">=" : "<=", boundchg->newbound);
                   SCIPABORT();
                }
             }
-            else if( SCIPboundchgGetBoundchgtype(&boundchgs[i]) == SCIP_BOUNDCHGTYPE_BRANCHING )
+            else if( SCIPboundchgGetBoundchgtype(boundchg) == SCIP_BOUNDCHGTYPE_BRANCHING )
             {
                /* we branched on a variable were we don't know the solution: no debugging can be applied in this subtree */
                *solcontained = FALSE;
@@ -160,6 +160,10 @@ SCIP_RETCODE SCIPeventhdlrFree(
    SCIPclockFree(&(*eventhdlr)->eventtime);
    SCIPclockFree(&(*eventhdlr)->setuptime);
 
+   BMSfreeMemoryArrayNull(&(*eventhdlr)->batcheventfilters);
+   BMSfreeMemoryArrayNull(&(*eventhdlr)->batcheventdata);
+   BMSfreeMemoryArrayNull(&(*eventhdlr)->batchevents);
+
    BMSfreeMemoryArrayNull(&(*eventhdlr)->name);
    BMSfreeMemoryArrayNull(&(*eventhdlr)->desc);
    BMSfreeMemory(eventhdlr);
@@ -311,6 +315,142 @@ SCIP_RETCODE SCIPeventhdlrExec(
    return SCIP_OKAY;
 }
 
+/** resizes batch arrays of event handler to be able to store at least num entries */
+static
+SCIP_RETCODE eventhdlrEnsureBatchMem(
+   SCIP_EVENTHDLR*       eventhdlr,          /**< event handler */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   int                   num                 /**< minimal number of entries in arrays */
+   )
+{
+   assert(eventhdlr != NULL);
+   assert(set != NULL);
+
+   if( num > eventhdlr->batcheventssize )
+   {
+      int newsize;
+
+      newsize = SCIPsetCalcMemGrowSize(set, num);
+      SCIP_ALLOC( BMSreallocMemoryArray(&eventhdlr->batchevents, newsize) );
+      SCIP_ALLOC( BMSreallocMemoryArray(&eventhdlr->batcheventdata, newsize) );
+      SCIP_ALLOC( BMSreallocMemoryArray(&eventhdlr->batcheventfilters, newsize) );
+      eventhdlr->batcheventssize = newsize;
+   }
+   assert(num <= eventhdlr->batcheventssize);
+
+   return SCIP_OKAY;
+}
+
+/** collects a local bound change event for the batched execution method of the event handler */
+static
+SCIP_RETCODE eventhdlrCollectEvent(
+   SCIP_EVENTHDLR*       eventhdlr,          /**< event handler */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_EVENTFILTER*     eventfilter,        /**< event filter through which the event was caught */
+   SCIP_EVENT*           event,              /**< local bound change event */
+   SCIP_EVENTDATA*       eventdata           /**< user data for the issued event */
+   )
+{
+   assert(eventhdlr != NULL);
+   assert(eventhdlr->eventexecbatch != NULL);
+   assert(eventfilter != NULL);
+   assert(event != NULL);
+   assert((event->eventtype & SCIP_EVENTTYPE_BOUNDCHANGED) != 0);
+
+   SCIP_CALL( eventhdlrEnsureBatchMem(eventhdlr, set, eventhdlr->nbatchevents+1) );
+   eventhdlr->batchevents[eventhdlr->nbatchevents] = *event;
+   eventhdlr->batcheventdata[eventhdlr->nbatchevents] = eventdata;
+   eventhdlr->batcheventfilters[eventhdlr->nbatchevents] = eventfilter;
+   eventhdlr->nbatchevents++;
+
+   return SCIP_OKAY;
+}
+
+/** removes the collected events of a dropped event catch from the batch of the event handler */
+static
+void eventhdlrRemoveBatchEvents(
+   SCIP_EVENTHDLR*       eventhdlr,          /**< event handler */
+   SCIP_EVENTFILTER*     eventfilter,        /**< event filter of the dropped catch */
+   SCIP_EVENTTYPE        eventtype,          /**< event type of the dropped catch */
+   SCIP_EVENTDATA*       eventdata           /**< user data of the dropped catch */
+   )
+{
+   int i;
+
+   assert(eventhdlr != NULL);
+
+   for( i = 0; i < eventhdlr->nbatchevents; ++i )
+   {
+      if( eventhdlr->batcheventfilters[i] == eventfilter && eventhdlr->batcheventdata[i] == eventdata
+         && (eventhdlr->batchevents[i].eventtype & eventtype) != 0 )
+         eventhdlr->batchevents[i].eventtype = SCIP_EVENTTYPE_DISABLED;
+   }
+}
+
+/** passes the collected events of the event handler to its batched execution method */
+static
+SCIP_RETCODE eventhdlrExecBatch(
+   SCIP_EVENTHDLR*       eventhdlr,          /**< event handler */
+   SCIP_SET*             set                 /**< global SCIP settings */
+   )
+{
+   SCIP_EVENT** events;
+   SCIP_EVENTDATA** eventdata;
+   int nbatchevents;
+   int nevents;
+   int i;
+
+   assert(eventhdlr != NULL);
+   assert(eventhdlr->eventexecbatch != NULL);
+   assert(set != NULL);
+
+   nbatchevents = eventhdlr->nbatchevents;
+
+   if( nbatchevents == 0 )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &events, nbatchevents) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &eventdata, nbatchevents) );
+
+   /* skip the events of catches that were dropped after the events were collected */
+   nevents = 0;
+   for( i = 0; i < nbatchevents; ++i )
+   {
+      if( eventhdlr->batchevents[i].eventtype == SCIP_EVENTTYPE_DISABLED )
+         continue;
+
+      events[nevents] = &eventhdlr->batchevents[i];
+      eventdata[nevents] = eventhdlr->batcheventdata[i];
+      ++nevents;
+   }
+
+   /* the batch is emptied before the call, such that the passed events cannot be modified during the call */
+   eventhdlr->nbatchevents = 0;
+
+   if( nevents > 0 )
+   {
+      SCIPsetDebugMsg(set, "execute event handler <%s> with batch of %d events\n", eventhdlr->name, nevents);
+
+#ifdef TIMEEVENTEXEC
+      /* start timing */
+      SCIPclockStart(eventhdlr->eventtime, set);
+#endif
+
+      SCIP_CALL( eventhdlr->eventexecbatch(set->scip, eventhdlr, events, eventdata, nevents) );
+
+#ifdef TIMEEVENTEXEC
+      /* stop timing */
+      SCIPclockStop(eventhdlr->eventtime, set);
+#endif
+   }
+   assert(eventhdlr->nbatchevents == 0);
+
+   SCIPsetFreeBufferArray(set, &eventdata);
+   SCIPsetFreeBufferArray(set, &events);
+
+   return SCIP_OKAY;
+}
+
 /** gets name of event handler */
 const char* SCIPeventhdlrGetName(
    SCIP_EVENTHDLR*       eventhdlr           /**< event handler */
@@ -419,6 +559,17 @@ void SCIPeventhdlrSetDelete(
    eventhdlr->eventdelete = eventdelete;
 }
 
+/** sets batched execution method for local bound change events of this event handler */
+void SCIPeventhdlrSetExecBatch(
+   SCIP_EVENTHDLR*       eventhdlr,          /**< event handler */
+   SCIP_DECL_EVENTEXECBATCH((*eventexecbatch)) /**< batched execution method of event handler */
+   )
+{
+   assert(eventhdlr != NULL);
+
+   eventhdlr->eventexecbatch = eventexecbatch;
+}
+
 /** is event handler initialized? */
 SCIP_Bool SCIPeventhdlrIsInitialized(
    SCIP_EVENTHDLR*       eventhdlr           /**< event handler */
@@ -1561,13 +1712,17 @@ SCIP_Real SCIPeventGetRowNewSideVal(
    return event->data.eventrowsidechanged.newval;
 }
 
-/** processes event by calling the appropriate event handlers */
-SCIP_RETCODE SCIPeventProcess(
+/** processes event by calling the appropriate event handlers; local bound change events are collected for batched
+ *  execution methods of event handlers if the event queue is given and collects them
+ */
+static
+SCIP_RETCODE eventProcess(
    SCIP_EVENT*           event,              /**< event */
    SCIP_SET*             set,                /**< global SCIP settings */
    SCIP_PRIMAL*          primal,             /**< primal data; only needed for objchanged events, or NULL */
    SCIP_LP*              lp,                 /**< current LP data; only needed for obj/boundchanged events, or NULL */
    SCIP_BRANCHCAND*      branchcand,         /**< branching candidate storage; only needed for bound change events, or NULL */
+   SCIP_EVENTQUEUE*      eventqueue,         /**< event queue that processes the event, or NULL */
    SCIP_EVENTFILTER*     eventfilter         /**< event filter for global events; not needed for variable specific events */
    )
 {
@@ -1604,7 +1759,7 @@ SCIP_RETCODE SCIPeventProcess(
    case SCIP_EVENTTYPE_ROWCONSTCHANGED: /*lint !e30 !e142*/
    case SCIP_EVENTTYPE_ROWSIDECHANGED: /*lint !e30 !e142*/
    case SCIP_EVENTTYPE_SYNC: /*lint !e30 !e142*/
-      SCIP_CALL( SCIPeventfilterProcess(eventfilter, set, event) );
+      SCIP_CALL( SCIPeventfilterProcess(eventfilter, set, eventqueue, event) );
       break;
 
    case SCIP_EVENTTYPE_VARDELETED:
@@ -1612,7 +1767,7 @@ SCIP_RETCODE SCIPeventProcess(
       assert(var != NULL);
 
       /* process variable's event filter */
-      SCIP_CALL( SCIPeventfilterProcess(var->eventfilter, set, event) );
+      SCIP_CALL( SCIPeventfilterProcess(var->eventfilter, set, eventqueue, event) );
       break;
 
    case SCIP_EVENTTYPE_VARFIXED:
@@ -1620,7 +1775,7 @@ SCIP_RETCODE SCIPeventProcess(
       assert(var != NULL);
 
       /* process variable's event filter */
-      SCIP_CALL( SCIPeventfilterProcess(var->eventfilter, set, event) );
+      SCIP_CALL( SCIPeventfilterProcess(var->eventfilter, set, eventqueue, event) );
       break;
 
    case SCIP_EVENTTYPE_VARUNLOCKED:
@@ -1628,7 +1783,7 @@ SCIP_RETCODE SCIPeventProcess(
       assert(var != NULL);
 
       /* process variable's event filter */
-      SCIP_CALL( SCIPeventfilterProcess(var->eventfilter, set, event) );
+      SCIP_CALL( SCIPeventfilterProcess(var->eventfilter, set, eventqueue, event) );
       break;
 
    case SCIP_EVENTTYPE_OBJCHANGED:
@@ -1656,7 +1811,7 @@ SCIP_RETCODE SCIPeventProcess(
       }
 
       /* process variable's event filter */
-      SCIP_CALL( SCIPeventfilterProcess(var->eventfilter, set, event) );
+      SCIP_CALL( SCIPeventfilterProcess(var->eventfilter, set, eventqueue, event) );
       break;
 
    case SCIP_EVENTTYPE_GLBCHANGED:
@@ -1672,7 +1827,7 @@ SCIP_RETCODE SCIPeventProcess(
       }
 
       /* process variable's event filter */
-      SCIP_CALL( SCIPeventfilterProcess(var->eventfilter, set, event) );
+      SCIP_CALL( SCIPeventfilterProcess(var->eventfilter, set, eventqueue, event) );
       break;
 
    case SCIP_EVENTTYPE_GUBCHANGED:
@@ -1688,7 +1843,7 @@ SCIP_RETCODE SCIPeventProcess(
       }
 
       /* process variable's event filter */
-      SCIP_CALL( SCIPeventfilterProcess(var->eventfilter, set, event) );
+      SCIP_CALL( SCIPeventfilterProcess(var->eventfilter, set, eventqueue, event) );
       break;
 
    case SCIP_EVENTTYPE_LBTIGHTENED:
@@ -1711,7 +1866,7 @@ SCIP_RETCODE SCIPeventProcess(
       }
 
       /* process variable's event filter */
-      SCIP_CALL( SCIPeventfilterProcess(var->eventfilter, set, event) );
+      SCIP_CALL( SCIPeventfilterProcess(var->eventfilter, set, eventqueue, event) );
       break;
 
    case SCIP_EVENTTYPE_UBTIGHTENED:
@@ -1734,7 +1889,7 @@ SCIP_RETCODE SCIPeventProcess(
       }
 
       /* process variable's event filter */
-      SCIP_CALL( SCIPeventfilterProcess(var->eventfilter, set, event) );
+      SCIP_CALL( SCIPeventfilterProcess(var->eventfilter, set, eventqueue, event) );
       break;
 
    case SCIP_EVENTTYPE_GHOLEADDED:
@@ -1745,7 +1900,7 @@ SCIP_RETCODE SCIPeventProcess(
       assert(var != NULL);
 
       /* process variable's event filter */
-      SCIP_CALL( SCIPeventfilterProcess(var->eventfilter, set, event) );
+      SCIP_CALL( SCIPeventfilterProcess(var->eventfilter, set, eventqueue, event) );
       break;
 
    case SCIP_EVENTTYPE_IMPLADDED:
@@ -1754,7 +1909,7 @@ SCIP_RETCODE SCIPeventProcess(
       assert(!var->eventqueueimpl);
 
       /* process variable's event filter */
-      SCIP_CALL( SCIPeventfilterProcess(var->eventfilter, set, event) );
+      SCIP_CALL( SCIPeventfilterProcess(var->eventfilter, set, eventqueue, event) );
       break;
 
    case SCIP_EVENTTYPE_TYPECHANGED:
@@ -1762,7 +1917,7 @@ SCIP_RETCODE SCIPeventProcess(
       assert(var != NULL);
 
       /* process variable's event filter */
-      SCIP_CALL( SCIPeventfilterProcess(var->eventfilter, set, event) );
+      SCIP_CALL( SCIPeventfilterProcess(var->eventfilter, set, eventqueue, event) );
       break;
 
    default:
@@ -1773,6 +1928,21 @@ SCIP_RETCODE SCIPeventProcess(
    return SCIP_OKAY;
 }
 
+/** processes event by calling the appropriate event handlers */
+SCIP_RETCODE SCIPeventProcess(
+   SCIP_EVENT*           event,              /**< event */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_PRIMAL*          primal,             /**< primal data; only needed for objchanged events, or NULL */
+   SCIP_LP*              lp,                 /**< current LP data; only needed for obj/boundchanged events, or NULL */
+   SCIP_BRANCHCAND*      branchcand,         /**< branching candidate storage; only needed for bound change events, or NULL */
+   SCIP_EVENTFILTER*     eventfilter         /**< event filter for global events; not needed for variable specific events */
+   )
+{
+   SCIP_CALL( eventProcess(event, set, primal, lp, branchcand, NULL, eventfilter) );
+
+   return SCIP_OKAY;
+}
+
 
 
 /*
@@ -1999,6 +2169,10 @@ SCIP_RETCODE SCIPeventfilterDel(
    assert(eventfilter->eventdata[filterpos] == eventdata);
    assert(eventfilter->nextpos[filterpos] == -2);
 
+   /* the event handler must not receive collected events of the dropped catch anymore */
+   if( eventhdlr->nbatchevents > 0 )
+      eventhdlrRemoveBatchEvents(eventhdlr, eventfilter, eventtype, eventdata);
+
    /* if updates are delayed, insert entry into the list of delayed deletions;
     * otherwise, delete the entry from the filter directly and add the slot to the free list
     */
@@ -2073,12 +2247,15 @@ void eventfilterProcessUpdates(
 SCIP_RETCODE SCIPeventfilterProcess(
    SCIP_EVENTFILTER*     eventfilter,        /**< event filter */
    SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_EVENTQUEUE*      eventqueue,         /**< event queue that processes the event, or NULL */
    SCIP_EVENT*           event               /**< event to process */
    )
 {
    SCIP_EVENTTYPE eventtype;
    SCIP_EVENTTYPE* eventtypes;
+   SCIP_EVENTHDLR* eventhdlr;
    SCIP_Bool processed;
+   SCIP_Bool collect;
    int len;
    int i;
 
@@ -2100,6 +2277,9 @@ SCIP_RETCODE SCIPeventfilterProcess(
     */
    eventfilterDelayUpdates(eventfilter);
 
+   /* local bound change events are collected for event handlers with batched execution method during propagation */
+   collect = (eventqueue != NULL && eventqueue->nbatchlevels > 0 && (eventtype & SCIP_EVENTTYPE_BOUNDCHANGED) != 0);
+
    /* process the event by calling the event handlers */
    processed = FALSE;
    len = eventfilter->len;
@@ -2109,8 +2289,24 @@ SCIP_RETCODE SCIPeventfilterProcess(
       /* check, if event is applicable for the filter element */
       if( (eventtype & eventtypes[i]) != 0 )
       {
-         /* call event handler */
-         SCIP_CALL( SCIPeventhdlrExec(eventfilter->eventhdlrs[i], set, event, eventfilter->eventdata[i]) );
+         eventhdlr = eventfilter->eventhdlrs[i];
+
+         if( collect && eventhdlr->eventexecbatch != NULL )
+         {
+            SCIP_CALL( eventhdlrCollectEvent(eventhdlr, set, eventfilter, event, eventfilter->eventdata[i]) );
+            eventqueue->batchespending = TRUE;
+         }
+         else
+         {
+            /* pass the collected events first, such that the event handler receives all events in order */
+            if( eventhdlr->nbatchevents > 0 )
+            {
+               SCIP_CALL( eventhdlrExecBatch(eventhdlr, set) );
+            }
+
+            /* call event handler */
+            SCIP_CALL( SCIPeventhdlrExec(eventhdlr, set, event, eventfilter->eventdata[i]) );
+         }
          processed = TRUE;
       }
    }
@@ -2146,6 +2342,8 @@ SCIP_RETCODE SCIPeventfilterProcess(
  */
 
 #undef SCIPeventqueueIsDelayed
+#undef SCIPeventqueueIsDeferringBdchgs
+#undef SCIPeventqueueGetMirrorProb
 
 /** resizes events array to be able to store at least num entries */
 static
@@ -2171,6 +2369,32 @@ SCIP_RETCODE eventqueueEnsureEventsMem(
    return SCIP_OKAY;
 }
 
+/** resizes deferred variables arrays to be able to store at least num entries */
+static
+SCIP_RETCODE eventqueueEnsureDeferredVarsMem(
+   SCIP_EVENTQUEUE*      eventqueue,         /**< event queue */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   int                   num                 /**< minimal number of variable slots in arrays */
+   )
+{
+   assert(eventqueue != NULL);
+   assert(set != NULL);
+
+   if( num > eventqueue->deferredvarssize )
+   {
+      int newsize;
+
+      newsize = SCIPsetCalcMemGrowSize(set, num);
+      SCIP_ALLOC( BMSreallocMemoryArray(&eventqueue->deferredvars, newsize) );
+      SCIP_ALLOC( BMSreallocMemoryArray(&eventqueue->deferredlbs, newsize) );
+      SCIP_ALLOC( BMSreallocMemoryArray(&eventqueue->deferredubs, newsize) );
+      eventqueue->deferredvarssize = newsize;
+   }
+   assert(num <= eventqueue->deferredvarssize);
+
+   return SCIP_OKAY;
+}
+
 /** creates an event queue */
 SCIP_RETCODE SCIPeventqueueCreate(
    SCIP_EVENTQUEUE**     eventqueue          /**< pointer to store the event queue */
@@ -2182,7 +2406,16 @@ SCIP_RETCODE SCIPeventqueueCreate(
    (*eventqueue)->events = NULL;
    (*eventqueue)->eventssize = 0;
    (*eventqueue)->nevents = 0;
+   (*eventqueue)->deferredvars = NULL;
+   (*eventqueue)->deferredlbs = NULL;
+   (*eventqueue)->deferredubs = NULL;
+   (*eventqueue)->deferredvarssize = 0;
+   (*eventqueue)->ndeferredvars = 0;
+   (*eventqueue)->mirrorprob = NULL;
+   (*eventqueue)->nbatchlevels = 0;
+   (*eventqueue)->batchespending = FALSE;
    (*eventqueue)->delayevents = FALSE;
+   (*eventqueue)->deferbdchgs = FALSE;
 
    return SCIP_OKAY;
 }
@@ -2195,7 +2428,12 @@ SCIP_RETCODE SCIPeventqueueFree(
    assert(eventqueue != NULL);
    assert(*eventqueue != NULL);
    assert((*eventqueue)->nevents == 0);
+   assert((*eventqueue)->ndeferredvars == 0);
+   assert((*eventqueue)->nbatchlevels == 0);
 
+   BMSfreeMemoryArrayNull(&(*eventqueue)->deferredubs);
+   BMSfreeMemoryArrayNull(&(*eventqueue)->deferredlbs);
+   BMSfreeMemoryArrayNull(&(*eventqueue)->deferredvars);
    BMSfreeMemoryArrayNull(&(*eventqueue)->events);
    BMSfreeMemory(eventqueue);
 
@@ -2255,7 +2493,7 @@ SCIP_RETCODE SCIPeventqueueAdd(
       SCIP_CALL( SCIPeventqueueDelay(eventqueue) );
 
       /* immediately process event */
-      SCIP_CALL( SCIPeventProcess(*event, set, primal, lp, branchcand, eventfilter) );
+      SCIP_CALL( eventProcess(*event, set, primal, lp, branchcand, eventqueue, eventfilter) );
       SCIP_CALL( SCIPeventFree(event, blkmem) );
 
       SCIP_CALL( SCIPeventqueueProcess(eventqueue, blkmem, set, primal, lp, branchcand, eventfilter) );
@@ -2500,6 +2738,13 @@ SCIP_RETCODE SCIPeventqueueProcess(
    assert(eventqueue != NULL);
    assert(eventqueue->delayevents);
 
+   /* issue the events of deferred local bound changes, such that they are processed below */
+   if( eventqueue->deferbdchgs )
+   {
+      SCIP_CALL( SCIPeventqueueFlushBdchgs(eventqueue, blkmem, set, lp, branchcand) );
+      eventqueue->deferbdchgs = FALSE;
+   }
+
    SCIPsetDebugMsg(set, "processing %d queued events\n", eventqueue->nevents);
 
    /* pass events to the responsible event filters
@@ -2540,7 +2785,7 @@ SCIP_RETCODE SCIPeventqueueProcess(
       }
 
       /* process event */
-      SCIP_CALL( SCIPeventProcess(event, set, primal, lp, branchcand, eventfilter) );
+      SCIP_CALL( eventProcess(event, set, primal, lp, branchcand, eventqueue, eventfilter) );
 
       /* free the event immediately, because additionally raised events during event processing
        * can lead to a large event queue
@@ -2564,3 +2809,185 @@ SCIP_Bool SCIPeventqueueIsDelayed(
 
    return eventqueue->delayevents;
 }
+
+/** marks delayed queue to defer local bound changes of loose and column variables: the bounds are changed directly,
+ *  but the bound change events and the updates of the parent variables are only issued for the net change of each
+ *  variable in the next call to SCIPeventqueueFlushBdchgs() or SCIPeventqueueProcess()
+ */
+SCIP_RETCODE SCIPeventqueueDeferBdchgs(
+   SCIP_EVENTQUEUE*      eventqueue          /**< event queue */
+   )
+{
+   assert(eventqueue != NULL);
+   assert(eventqueue->delayevents);
+   assert(!eventqueue->deferbdchgs);
+   assert(eventqueue->ndeferredvars == 0);
+
+   SCIPdebugMessage("local bound changes are deferred\n");
+
+   eventqueue->deferbdchgs = TRUE;
+
+   return SCIP_OKAY;
+}
+
+/** stores the current local bounds of a variable whose local bound changes are deferred from now on */
+SCIP_RETCODE SCIPeventqueueAddDeferredVar(
+   SCIP_EVENTQUEUE*      eventqueue,         /**< event queue */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_VAR*             var                 /**< loose or column variable */
+   )
+{
+   assert(eventqueue != NULL);
+   assert(eventqueue->deferbdchgs);
+   assert(var != NULL);
+   assert(!var->bdchgdeferred);
+   assert(SCIPvarGetStatus(var) == SCIP_VARSTATUS_LOOSE || SCIPvarGetStatus(var) == SCIP_VARSTATUS_COLUMN);
+
+   SCIP_CALL( eventqueueEnsureDeferredVarsMem(eventqueue, set, eventqueue->ndeferredvars+1) );
+   eventqueue->deferredvars[eventqueue->ndeferredvars] = var;
+   eventqueue->deferredlbs[eventqueue->ndeferredvars] = var->locdom.lb;
+   eventqueue->deferredubs[eventqueue->ndeferredvars] = var->locdom.ub;
+   eventqueue->ndeferredvars++;
+
+   var->bdchgdeferred = TRUE;
+
+   return SCIP_OKAY;
+}
+
+/** issues the bound change events and parent variable updates of the net changes of all deferred variables; if local
+ *  bound changes are deferred, they stay deferred
+ */
+SCIP_RETCODE SCIPeventqueueFlushBdchgs(
+   SCIP_EVENTQUEUE*      eventqueue,         /**< event queue */
+   BMS_BLKMEM*           blkmem,             /**< block memory buffer */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_LP*              lp,                 /**< current LP data */
+   SCIP_BRANCHCAND*      branchcand          /**< branching candidate storage */
+   )
+{
+   int ndeferredvars;
+   int i;
+
+   assert(eventqueue != NULL);
+   assert(eventqueue->deferbdchgs || eventqueue->ndeferredvars == 0);
+
+   if( eventqueue->ndeferredvars == 0 )
+      return SCIP_OKAY;
+
+   SCIPsetDebugMsg(set, "flushing deferred local bound changes of %d variables\n", eventqueue->ndeferredvars);
+
+   /* stop deferring while the net changes are issued, because they pass through the usual bound change processing */
+   ndeferredvars = eventqueue->ndeferredvars;
+   eventqueue->ndeferredvars = 0;
+   eventqueue->deferbdchgs = FALSE;
+
+   for( i = 0; i < ndeferredvars; ++i )
+   {
+      SCIP_CALL( SCIPvarFlushDeferredBdchgs(eventqueue->deferredvars[i], blkmem, set, lp, branchcand, eventqueue,
+            eventqueue->deferredlbs[i], eventqueue->deferredubs[i]) );
+   }
+
+   eventqueue->deferbdchgs = TRUE;
+
+   return SCIP_OKAY;
+}
+
+/** returns TRUE iff local bound changes are deferred until the next SCIPeventqueueFlushBdchgs() call */
+SCIP_Bool SCIPeventqueueIsDeferringBdchgs(
+   SCIP_EVENTQUEUE*      eventqueue          /**< event queue */
+   )
+{
+   assert(eventqueue != NULL);
+
+   return eventqueue->deferbdchgs;
+}
+
+/** sets the transformed problem whose bound mirror is updated by the bound changes that pass through the event queue,
+ *  or NULL if the bounds are not mirrored
+ */
+void SCIPeventqueueSetMirrorProb(
+   SCIP_EVENTQUEUE*      eventqueue,         /**< event queue */
+   SCIP_PROB*            prob                /**< transformed problem with bound mirror, or NULL */
+   )
+{
+   assert(eventqueue != NULL);
+
+   eventqueue->mirrorprob = prob;
+}
+
+/** gets the transformed problem whose bound mirror is updated by the bound changes, or NULL if the bounds are not
+ *  mirrored
+ */
+SCIP_PROB* SCIPeventqueueGetMirrorProb(
+   SCIP_EVENTQUEUE*      eventqueue          /**< event queue */
+   )
+{
+   assert(eventqueue != NULL);
+
+   return eventqueue->mirrorprob;
+}
+
+/** passes the collected local bound change events of all event handlers to their batched execution methods */
+static
+SCIP_RETCODE eventqueueExecBatches(
+   SCIP_EVENTQUEUE*      eventqueue,         /**< event queue */
+   SCIP_SET*             set                 /**< global SCIP settings */
+   )
+{
+   int i;
+
+   assert(eventqueue != NULL);
+   assert(set != NULL);
+
+   if( !eventqueue->batchespending )
+      return SCIP_OKAY;
+
+   eventqueue->batchespending = FALSE;
+
+   for( i = 0; i < set->neventhdlrs; ++i )
+   {
+      if( set->eventhdlrs[i]->nbatchevents > 0 )
+      {
+         SCIP_CALL( eventhdlrExecBatch(set->eventhdlrs[i], set) );
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+/** starts collecting local bound change events for the batched execution methods of event handlers until the next
+ *  call to SCIPeventqueueDeliverBdchgs(); events that are still collected from an enclosing call are passed to the
+ *  event handlers first, such that each propagation call starts on up-to-date event handler data; calls may be nested
+ */
+SCIP_RETCODE SCIPeventqueueBatchBdchgs(
+   SCIP_EVENTQUEUE*      eventqueue,         /**< event queue */
+   SCIP_SET*             set                 /**< global SCIP settings */
+   )
+{
+   assert(eventqueue != NULL);
+   assert(eventqueue->nbatchlevels >= 0);
+
+   SCIP_CALL( eventqueueExecBatches(eventqueue, set) );
+
+   eventqueue->nbatchlevels++;
+
+   return SCIP_OKAY;
+}
+
+/** passes all collected local bound change events to the batched execution methods of the event handlers and ends the
+ *  innermost call to SCIPeventqueueBatchBdchgs()
+ */
+SCIP_RETCODE SCIPeventqueueDeliverBdchgs(
+   SCIP_EVENTQUEUE*      eventqueue,         /**< event queue */
+   SCIP_SET*             set                 /**< global SCIP settings */
+   )
+{
+   assert(eventqueue != NULL);
+   assert(eventqueue->nbatchlevels > 0);
+
+   eventqueue->nbatchlevels--;
+
+   SCIP_CALL( eventqueueExecBatches(eventqueue, set) );
+
+   return SCIP_OKAY;
+}
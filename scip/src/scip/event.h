@@ -33,6 +33,7 @@
 #include "scip/type_var.h"
 #include "scip/type_sol.h"
 #include "scip/type_primal.h"
+#include "scip/type_prob.h"
 #include "scip/type_branch.h"
 #include "scip/pub_event.h"
 
@@ -157,6 +158,12 @@ void SCIPeventhdlrSetDelete(
    SCIP_DECL_EVENTDELETE ((*eventdelete))    /**< callback to free specific event data */
    );
 
+/** sets batched execution method for local bound change events of this event handler */
+void SCIPeventhdlrSetExecBatch(
+   SCIP_EVENTHDLR*       eventhdlr,          /**< event handler */
+   SCIP_DECL_EVENTEXECBATCH((*eventexecbatch)) /**< batched execution method of event handler */
+   );
+
 /** enables or disables all clocks of \p eventhdlr, depending on the value of the flag */
 void SCIPeventhdlrEnableOrDisableClocks(
    SCIP_EVENTHDLR*       eventhdlr,          /**< the event handler for which all clocks should be enabled or disabled */
@@ -440,6 +447,7 @@ SCIP_RETCODE SCIPeventfilterDel(
 SCIP_RETCODE SCIPeventfilterProcess(
    SCIP_EVENTFILTER*     eventfilter,        /**< event filter */
    SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_EVENTQUEUE*      eventqueue,         /**< event queue that processes the event, or NULL */
    SCIP_EVENT*           event               /**< event to process */
    );
 
@@ -492,6 +500,69 @@ SCIP_Bool SCIPeventqueueIsDelayed(
    SCIP_EVENTQUEUE*      eventqueue          /**< event queue */
    );
 
+/** marks delayed queue to defer local bound changes of loose and column variables: the bounds are changed directly,
+ *  but the bound change events and the updates of the parent variables are only issued for the net change of each
+ *  variable in the next call to SCIPeventqueueFlushBdchgs() or SCIPeventqueueProcess()
+ */
+SCIP_RETCODE SCIPeventqueueDeferBdchgs(
+   SCIP_EVENTQUEUE*      eventqueue          /**< event queue */
+   );
+
+/** stores the current local bounds of a variable whose local bound changes are deferred from now on */
+SCIP_RETCODE SCIPeventqueueAddDeferredVar(
+   SCIP_EVENTQUEUE*      eventqueue,         /**< event queue */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_VAR*             var                 /**< loose or column variable */
+   );
+
+/** issues the bound change events and parent variable updates of the net changes of all deferred variables; if local
+ *  bound changes are deferred, they stay deferred
+ */
+SCIP_RETCODE SCIPeventqueueFlushBdchgs(
+   SCIP_EVENTQUEUE*      eventqueue,         /**< event queue */
+   BMS_BLKMEM*           blkmem,             /**< block memory buffer */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_LP*              lp,                 /**< current LP data */
+   SCIP_BRANCHCAND*      branchcand          /**< branching candidate storage */
+   );
+
+/** returns TRUE iff local bound changes are deferred until the next SCIPeventqueueFlushBdchgs() call */
+SCIP_Bool SCIPeventqueueIsDeferringBdchgs(
+   SCIP_EVENTQUEUE*      eventqueue          /**< event queue */
+   );
+
+/** sets the transformed problem whose bound mirror is updated by the bound changes that pass through the event queue,
+ *  or NULL if the bounds are not mirrored
+ */
+void SCIPeventqueueSetMirrorProb(
+   SCIP_EVENTQUEUE*      eventqueue,         /**< event queue */
+   SCIP_PROB*            prob                /**< transformed problem with bound mirror, or NULL */
+   );
+
+/** gets the transformed problem whose bound mirror is updated by the bound changes, or NULL if the bounds are not
+ *  mirrored
+ */
+SCIP_PROB* SCIPeventqueueGetMirrorProb(
+   SCIP_EVENTQUEUE*      eventqueue          /**< event queue */
+   );
+
+/** starts collecting local bound change events for the batched execution methods of event handlers until the next
+ *  call to SCIPeventqueueDeliverBdchgs(); events that are still collected from an enclosing call are passed to the
+ *  event handlers first, such that each propagation call starts on up-to-date event handler data; calls may be nested
+ */
+SCIP_RETCODE SCIPeventqueueBatchBdchgs(
+   SCIP_EVENTQUEUE*      eventqueue,         /**< event queue */
+   SCIP_SET*             set                 /**< global SCIP settings */
+   );
+
+/** passes all collected local bound change events to the batched execution methods of the event handlers and ends the
+ *  innermost call to SCIPeventqueueBatchBdchgs()
+ */
+SCIP_RETCODE SCIPeventqueueDeliverBdchgs(
+   SCIP_EVENTQUEUE*      eventqueue,         /**< event queue */
+   SCIP_SET*             set                 /**< global SCIP settings */
+   );
+
 #ifdef NDEBUG
 
 /* In optimized mode, the function calls are overwritten by defines to reduce the number of function calls and
@@ -499,6 +570,8 @@ SCIP_Bool SCIPeventqueueIsDelayed(
  */
 
 #define SCIPeventqueueIsDelayed(eventqueue)       ((eventqueue)->delayevents)
+#define SCIPeventqueueIsDeferringBdchgs(eventqueue) ((eventqueue)->deferbdchgs)
+#define SCIPeventqueueGetMirrorProb(eventqueue)   ((eventqueue)->mirrorprob)
 
 #endif
 
@@ -4474,6 +4474,274 @@ SCIP_RETCODE SCIPcolGetStrongbranch(
    return SCIP_OKAY;
 }
 
+#ifdef _OPENMP
+/** loads the current LP with its optimal basis into a copy of the LP solver interface and solves it, used to perform
+ *  strong branching in parallel to the LP solver interface of the LP
+ *
+ *  The copy is created if it does not exist yet; otherwise, it is cleared and reused. If an error occurs, the copy is
+ *  freed, such that it is created again in the next call.
+ */
+static
+SCIP_RETCODE lpSetupSbworker(
+   SCIP_LP*              lp,                 /**< LP data */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_LPI**            worker,             /**< pointer to the copy of the LP solver interface, or to NULL */
+   SCIP_Bool*            success             /**< pointer to store whether the copy could be solved to optimality */
+   )
+{  /*lint --e{641}*/
+   static const SCIP_LPPARAM intparams[] = {SCIP_LPPAR_FASTMIP, SCIP_LPPAR_SCALING, SCIP_LPPAR_PRESOLVING,
+      SCIP_LPPAR_PRICING, SCIP_LPPAR_TIMING, SCIP_LPPAR_RANDOMSEED, SCIP_LPPAR_REFACTOR};
+   static const SCIP_LPPARAM realparams[] = {SCIP_LPPAR_FEASTOL, SCIP_LPPAR_DUALFEASTOL, SCIP_LPPAR_OBJLIM,
+      SCIP_LPPAR_MARKOWITZ, SCIP_LPPAR_ROWREPSWITCH, SCIP_LPPAR_CONDITIONLIMIT};
+   SCIP_RETCODE retcode = SCIP_OKAY;
+   SCIP_OBJSEN objsen;
+   SCIP_Real* obj = NULL;
+   SCIP_Real* lb = NULL;
+   SCIP_Real* ub = NULL;
+   SCIP_Real* lhs = NULL;
+   SCIP_Real* rhs = NULL;
+   SCIP_Real* val = NULL;
+   int* beg = NULL;
+   int* ind = NULL;
+   int* cstat = NULL;
+   int* rstat = NULL;
+   int nnonz;
+   int i;
+
+   assert(lp != NULL);
+   assert(lp->flushed);
+   assert(lp->solisbasic);
+   assert(worker != NULL);
+   assert(success != NULL);
+
+   *success = FALSE;
+
+   SCIP_CALL( SCIPlpiGetObjsen(lp->lpi, &objsen) );
+   SCIP_CALL( SCIPlpiGetNNonz(lp->lpi, &nnonz) );
+
+   SCIP_CALL_TERMINATE( retcode, SCIPsetAllocBufferArray(set, &obj, lp->nlpicols), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPsetAllocBufferArray(set, &lb, lp->nlpicols), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPsetAllocBufferArray(set, &ub, lp->nlpicols), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPsetAllocBufferArray(set, &beg, lp->nlpicols), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPsetAllocBufferArray(set, &cstat, lp->nlpicols), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPsetAllocBufferArray(set, &ind, nnonz), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPsetAllocBufferArray(set, &val, nnonz), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPsetAllocBufferArray(set, &lhs, lp->nlpirows), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPsetAllocBufferArray(set, &rhs, lp->nlpirows), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPsetAllocBufferArray(set, &rstat, lp->nlpirows), TERMINATE );
+
+   /* copy the problem as it is stored in the LP solver; the rows are added empty and filled by the columns */
+   if( lp->nlpicols > 0 )
+   {
+      SCIP_CALL_TERMINATE( retcode, SCIPlpiGetObj(lp->lpi, 0, lp->nlpicols-1, obj), TERMINATE );
+      SCIP_CALL_TERMINATE( retcode, SCIPlpiGetCols(lp->lpi, 0, lp->nlpicols-1, lb, ub, &nnonz, beg, ind, val), TERMINATE );
+   }
+   if( lp->nlpirows > 0 )
+   {
+      SCIP_CALL_TERMINATE( retcode, SCIPlpiGetSides(lp->lpi, 0, lp->nlpirows-1, lhs, rhs), TERMINATE );
+   }
+
+   if( *worker == NULL )
+   {
+      SCIP_CALL_TERMINATE( retcode, SCIPlpiCreate(worker, NULL, "sbworker", objsen), TERMINATE );
+   }
+   else
+   {
+      SCIP_CALL_TERMINATE( retcode, SCIPlpiClear(*worker), TERMINATE );
+      SCIP_CALL_TERMINATE( retcode, SCIPlpiChgObjsen(*worker, objsen), TERMINATE );
+   }
+   SCIP_CALL_TERMINATE( retcode, SCIPlpiAddRows(*worker, lp->nlpirows, lhs, rhs, NULL, 0, NULL, NULL, NULL), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPlpiAddCols(*worker, lp->nlpicols, obj, lb, ub, NULL, nnonz, beg, ind, val),
+      TERMINATE );
+
+   /* copy the parameters of the LP solver; parameters it does not know are skipped */
+   for( i = 0; i < (int)(sizeof(intparams) / sizeof(intparams[0])); ++i )
+   {
+      int ival;
+
+      if( SCIPlpiGetIntpar(lp->lpi, intparams[i], &ival) == SCIP_OKAY )
+         (void) SCIPlpiSetIntpar(*worker, intparams[i], ival);
+   }
+   for( i = 0; i < (int)(sizeof(realparams) / sizeof(realparams[0])); ++i )
+   {
+      SCIP_Real dval;
+
+      if( SCIPlpiGetRealpar(lp->lpi, realparams[i], &dval) == SCIP_OKAY )
+         (void) SCIPlpiSetRealpar(*worker, realparams[i], dval);
+   }
+   (void) SCIPlpiSetIntpar(*worker, SCIP_LPPAR_LPINFO, FALSE);
+   (void) SCIPlpiSetIntpar(*worker, SCIP_LPPAR_THREADS, 1);
+
+   /* load the optimal basis of the LP, which is stored in the columns and rows, and let the copy refactorize it */
+   for( i = 0; i < lp->nlpicols; ++i )
+      cstat[i] = (int) lp->lpicols[i]->basisstatus;
+   for( i = 0; i < lp->nlpirows; ++i )
+      rstat[i] = (int) lp->lpirows[i]->basisstatus;
+   SCIP_CALL_TERMINATE( retcode, SCIPlpiSetBase(*worker, cstat, rstat), TERMINATE );
+
+   if( SCIPlpiSolveDual(*worker) == SCIP_OKAY )
+      *success = SCIPlpiIsOptimal(*worker);
+
+TERMINATE:
+   SCIPsetFreeBufferArrayNull(set, &rstat);
+   SCIPsetFreeBufferArrayNull(set, &rhs);
+   SCIPsetFreeBufferArrayNull(set, &lhs);
+   SCIPsetFreeBufferArrayNull(set, &val);
+   SCIPsetFreeBufferArrayNull(set, &ind);
+   SCIPsetFreeBufferArrayNull(set, &cstat);
+   SCIPsetFreeBufferArrayNull(set, &beg);
+   SCIPsetFreeBufferArrayNull(set, &ub);
+   SCIPsetFreeBufferArrayNull(set, &lb);
+   SCIPsetFreeBufferArrayNull(set, &obj);
+
+   if( retcode != SCIP_OKAY && *worker != NULL )
+   {
+      (void) SCIPlpiFree(worker);
+   }
+
+   return retcode;
+}
+#endif
+
+/** performs strong branching on the given columns of the LP solver interface
+ *
+ *  If lp/sbthreads is larger than one, the columns are distributed round-robin over copies of the LP solver interface,
+ *  which are processed in parallel. Each result is written to the position of its column, so the results do not
+ *  depend on the scheduling of the threads. The copies are kept in the LP and are only set up again if the LP has
+ *  been solved again since the last call.
+ */
+static
+SCIP_RETCODE lpStrongbranches(
+   SCIP_LP*              lp,                 /**< LP data */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< problem statistics */
+   SCIP_Bool             integral,           /**< should integral strong branching be performed? */
+   int*                  lpipos,             /**< positions of the columns in the LP solver interface */
+   int                   ncols,              /**< number of columns */
+   SCIP_Real*            primsols,           /**< primal solution values of the columns */
+   int                   itlim,              /**< iteration limit for strong branchings */
+   SCIP_Real*            down,               /**< stores dual bounds after branching columns down */
+   SCIP_Real*            up,                 /**< stores dual bounds after branching columns up */
+   SCIP_Bool*            downvalid,          /**< stores whether the returned down values are valid dual bounds */
+   SCIP_Bool*            upvalid,            /**< stores whether the returned up values are valid dual bounds */
+   int*                  iter                /**< stores total number of strong branching iterations, or -1 */
+   )
+{
+#ifdef _OPENMP
+   int nworkers;
+
+   nworkers = MIN3(set->lp_sbthreads, set->parallel_maxnthreads, ncols);
+
+   if( nworkers > 1 && lp->solisbasic )
+   {
+      SCIP_LPI** workers;
+      int* workeriters;
+      SCIP_RETCODE retcode;
+      SCIP_Bool success;
+      int w;
+      int j;
+
+      /* enlarge the array of copies of the LP solver interface */
+      if( lp->nsbworkers < nworkers )
+      {
+         SCIP_ALLOC( BMSreallocMemoryArray(&lp->sbworkers, nworkers) );
+         for( w = lp->nsbworkers; w < nworkers; ++w )
+            lp->sbworkers[w] = NULL;
+         lp->nsbworkers = nworkers;
+      }
+      workers = lp->sbworkers;
+
+      /* copies that hold an older LP have to be set up again */
+      if( lp->validsbworkerlp != stat->lpcount )
+      {
+         lp->validsbworkerlp = stat->lpcount;
+         lp->nvalidsbworkers = 0;
+      }
+
+      /* the copies are set up sequentially, since they read the LP solver interface of the LP */
+      success = TRUE;
+      while( lp->nvalidsbworkers < nworkers && success )
+      {
+         SCIP_CALL( lpSetupSbworker(lp, set, &workers[lp->nvalidsbworkers], &success) );
+         if( success )
+            ++lp->nvalidsbworkers;
+      }
+
+      if( !success )
+      {
+         /* fall back to strong branching on the LP itself */
+         SCIPsetDebugMsg(set, "could not set up %d strong branching workers, performing strong branching sequentially\n",
+            nworkers);
+      }
+      else
+      {
+         SCIPsetDebugMsg(set, "performing strong branching on %d columns with %d workers\n", ncols, nworkers);
+
+         SCIP_CALL( SCIPsetAllocBufferArray(set, &workeriters, nworkers) );
+
+         retcode = SCIP_OKAY;
+
+#ifndef __INTEL_COMPILER
+         #pragma omp parallel for num_threads(nworkers) private(j) reduction(min:retcode)
+#endif
+         for( w = 0; w < nworkers; ++w )
+         {
+            SCIP_RETCODE workerretcode;
+
+            workeriters[w] = 0;
+            workerretcode = SCIPlpiStartStrongbranch(workers[w]);
+
+            for( j = w; j < ncols && workerretcode == SCIP_OKAY; j += nworkers )
+            {
+               int it = -1;
+
+               if( integral )
+                  workerretcode = SCIPlpiStrongbranchInt(workers[w], lpipos[j], primsols[j], itlim, &down[j], &up[j],
+                     &downvalid[j], &upvalid[j], &it);
+               else
+                  workerretcode = SCIPlpiStrongbranchFrac(workers[w], lpipos[j], primsols[j], itlim, &down[j], &up[j],
+                     &downvalid[j], &upvalid[j], &it);
+
+               if( it == -1 || workeriters[w] == -1 )
+                  workeriters[w] = -1;
+               else
+                  workeriters[w] += it;
+            }
+
+            if( workerretcode == SCIP_OKAY )
+               workerretcode = SCIPlpiEndStrongbranch(workers[w]);
+
+            retcode = MIN(retcode, workerretcode);
+         }
+
+         /* merge the iteration counts in a fixed order */
+         *iter = 0;
+         for( w = 0; w < nworkers; ++w )
+         {
+            if( workeriters[w] == -1 || *iter == -1 )
+               *iter = -1;
+            else
+               *iter += workeriters[w];
+         }
+
+         SCIPsetFreeBufferArray(set, &workeriters);
+
+         /* the state of the copies is unknown after an error, so they have to be set up again */
+         if( retcode != SCIP_OKAY )
+            lp->nvalidsbworkers = 0;
+
+         return retcode;
+      }
+   }
+#endif
+
+   /* call LPI strong branching */
+   if ( integral )
+      return SCIPlpiStrongbranchesInt(lp->lpi, lpipos, ncols, primsols, itlim, down, up, downvalid, upvalid, iter);
+   else
+      return SCIPlpiStrongbranchesFrac(lp->lpi, lpipos, ncols, primsols, itlim, down, up, downvalid, upvalid, iter);
+}
+
 /** gets strong branching information on column variables */
 SCIP_RETCODE SCIPcolGetStrongbranches(
    SCIP_COL**            cols,               /**< LP columns */
@@ -4589,11 +4857,9 @@ SCIP_RETCODE SCIPcolGetStrongbranches(
 
    SCIPsetDebugMsg(set, "performing strong branching on %d variables with %d iterations\n", ncols, itlim);
 
-   /* call LPI strong branching */
-   if ( integral )
-      retcode = SCIPlpiStrongbranchesInt(lp->lpi, lpipos, nsubcols, primsols, itlim, sbdown, sbup, sbdownvalid, sbupvalid, &iter);
-   else
-      retcode = SCIPlpiStrongbranchesFrac(lp->lpi, lpipos, nsubcols, primsols, itlim, sbdown, sbup, sbdownvalid, sbupvalid, &iter);
+   /* call LPI strong branching, possibly in parallel on copies of the LP solver interface */
+   retcode = lpStrongbranches(lp, set, stat, integral, lpipos, nsubcols, primsols, itlim, sbdown, sbup, sbdownvalid,
+      sbupvalid, &iter);
 
    /* check return code for errors */
    if( retcode == SCIP_LPERROR )
@@ -9166,6 +9432,10 @@ SCIP_RETCODE SCIPlpCreate(
    (*lp)->divingobjchg = FALSE;
    (*lp)->divinglazyapplied = FALSE;
    (*lp)->divelpistate = NULL;
+   (*lp)->sbworkers = NULL;
+   (*lp)->nsbworkers = 0;
+   (*lp)->nvalidsbworkers = 0;
+   (*lp)->validsbworkerlp = -1;
    (*lp)->divelpwasprimfeas = TRUE;
    (*lp)->divelpwasprimchecked = TRUE;
    (*lp)->divelpwasdualfeas = TRUE;
@@ -9387,6 +9657,16 @@ SCIP_RETCODE SCIPlpFree(
       SCIP_CALL( SCIPlpiFree(&(*lp)->lpi) );
    }
 
+   /* free the copies of the LP solver interface for parallel strong branching */
+   for( i = 0; i < (*lp)->nsbworkers; ++i )
+   {
+      if( (*lp)->sbworkers[i] != NULL )
+      {
+         SCIP_CALL( SCIPlpiFree(&(*lp)->sbworkers[i]) );
+      }
+   }
+
+   BMSfreeMemoryArrayNull(&(*lp)->sbworkers);
    BMSfreeMemoryNull(&(*lp)->storedsolvals);
    BMSfreeMemoryArrayNull(&(*lp)->lpicols);
    BMSfreeMemoryArrayNull(&(*lp)->lpirows);
@@ -9426,6 +9706,7 @@ SCIP_RETCODE SCIPlpReset(
    lp->validdegeneracylp = -1;
    lp->validsoldirlp = -1;
    lp->validsoldirsol = NULL;
+   lp->validsbworkerlp = -1;
    lp->solved = TRUE;
    lp->primalfeasible = TRUE;
    lp->primalchecked = TRUE;
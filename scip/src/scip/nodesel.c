@@ -46,9 +46,12 @@
  * node priority queue methods
  */
 
-#define PQ_PARENT(q) (((q)+1)/2-1)
-#define PQ_LEFTCHILD(p) (2*(p)+1)
-#define PQ_RIGHTCHILD(p) (2*(p)+2)
+/* both orders of the queue are 4-ary heaps: they are only half as deep as binary heaps, and the children of a slot lie
+ * next to each other in memory
+ */
+#define PQ_ARITY 4
+#define PQ_PARENT(q) (((q)-1)/PQ_ARITY)
+#define PQ_FIRSTCHILD(p) (PQ_ARITY*(p)+1)
 
 
 /** node comparator for node numbers */
@@ -88,10 +91,139 @@ SCIP_RETCODE nodepqResize(
    SCIP_ALLOC( BMSreallocMemoryArray(&nodepq->slots, nodepq->size) );
    SCIP_ALLOC( BMSreallocMemoryArray(&nodepq->bfsposs, nodepq->size) );
    SCIP_ALLOC( BMSreallocMemoryArray(&nodepq->bfsqueue, nodepq->size) );
+   SCIP_ALLOC( BMSreallocMemoryArray(&nodepq->bfslowerbounds, nodepq->size) );
 
    return SCIP_OKAY;
 }
 
+/** moves the node in the given slot downwards in the queue ordered by the node selection comparator, until the heap
+ *  property is restored; the bfs positions are not updated
+ */
+static
+void nodepqSiftDown(
+   SCIP_NODEPQ*          nodepq,             /**< node priority queue */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   int                   pos                 /**< slot of node to move downwards */
+   )
+{
+   SCIP_NODESEL* nodesel;
+   SCIP_NODE** slots;
+   SCIP_NODE* node;
+
+   nodesel = nodepq->nodesel;
+   slots = nodepq->slots;
+   node = slots[pos];
+
+   while( PQ_FIRSTCHILD(pos) < nodepq->len )
+   {
+      int childpos;
+      int brotherpos;
+      int endpos;
+
+      /* select the best child of the slot */
+      childpos = PQ_FIRSTCHILD(pos);
+      endpos = MIN(childpos + PQ_ARITY, nodepq->len);
+      for( brotherpos = childpos+1; brotherpos < endpos; ++brotherpos )
+      {
+         if( nodesel->nodeselcomp(set->scip, nodesel, slots[brotherpos], slots[childpos]) < 0 )
+            childpos = brotherpos;
+      }
+
+      if( nodesel->nodeselcomp(set->scip, nodesel, node, slots[childpos]) <= 0 )
+         break;
+
+      slots[pos] = slots[childpos];
+      pos = childpos;
+   }
+   slots[pos] = node;
+}
+
+/** moves the index in the given position downwards in the queue ordered by the lower bound, until the heap property
+ *  is restored; the bfs positions are not updated
+ */
+static
+void nodepqSiftDownBfs(
+   SCIP_NODEPQ*          nodepq,             /**< node priority queue */
+   int                   bfspos              /**< position in bfs queue of index to move downwards */
+   )
+{
+   int* bfsqueue;
+   SCIP_Real* bfslowerbounds;
+   SCIP_Real lowerbound;
+   int idx;
+
+   bfsqueue = nodepq->bfsqueue;
+   bfslowerbounds = nodepq->bfslowerbounds;
+   idx = bfsqueue[bfspos];
+   lowerbound = bfslowerbounds[bfspos];
+
+   while( PQ_FIRSTCHILD(bfspos) < nodepq->len )
+   {
+      int childpos;
+      int brotherpos;
+      int endpos;
+
+      /* select the child with the smallest lower bound */
+      childpos = PQ_FIRSTCHILD(bfspos);
+      endpos = MIN(childpos + PQ_ARITY, nodepq->len);
+      for( brotherpos = childpos+1; brotherpos < endpos; ++brotherpos )
+      {
+         if( bfslowerbounds[brotherpos] < bfslowerbounds[childpos] )
+            childpos = brotherpos;
+      }
+
+      if( lowerbound <= bfslowerbounds[childpos] )
+         break;
+
+      bfsqueue[bfspos] = bfsqueue[childpos];
+      bfslowerbounds[bfspos] = bfslowerbounds[childpos];
+      bfspos = childpos;
+   }
+   bfsqueue[bfspos] = idx;
+   bfslowerbounds[bfspos] = lowerbound;
+}
+
+/** rebuilds both orders of the queue from the unordered slots array in linear time */
+static
+void nodepqHeapify(
+   SCIP_NODEPQ*          nodepq,             /**< node priority queue */
+   SCIP_SET*             set                 /**< global SCIP settings */
+   )
+{
+   int i;
+
+   assert(nodepq != NULL);
+   assert(nodepq->nodesel != NULL);
+   assert(nodepq->nodesel->nodeselcomp != NULL);
+
+   if( nodepq->len <= 1 )
+   {
+      if( nodepq->len == 1 )
+      {
+         nodepq->bfsposs[0] = 0;
+         nodepq->bfsqueue[0] = 0;
+         nodepq->bfslowerbounds[0] = SCIPnodeGetLowerbound(nodepq->slots[0]);
+      }
+      return;
+   }
+
+   /* order the slots by the node selection comparator */
+   for( i = PQ_PARENT(nodepq->len-1); i >= 0; --i )
+      nodepqSiftDown(nodepq, set, i);
+
+   /* order the slot indices by the lower bounds of their nodes */
+   for( i = 0; i < nodepq->len; ++i )
+   {
+      nodepq->bfsqueue[i] = i;
+      nodepq->bfslowerbounds[i] = SCIPnodeGetLowerbound(nodepq->slots[i]);
+   }
+   for( i = PQ_PARENT(nodepq->len-1); i >= 0; --i )
+      nodepqSiftDownBfs(nodepq, i);
+
+   for( i = 0; i < nodepq->len; ++i )
+      nodepq->bfsposs[nodepq->bfsqueue[i]] = i;
+}
+
 /** creates node priority queue */
 SCIP_RETCODE SCIPnodepqCreate(
    SCIP_NODEPQ**         nodepq,             /**< pointer to a node priority queue */
@@ -107,6 +239,7 @@ SCIP_RETCODE SCIPnodepqCreate(
    (*nodepq)->slots = NULL;
    (*nodepq)->bfsposs = NULL;
    (*nodepq)->bfsqueue = NULL;
+   (*nodepq)->bfslowerbounds = NULL;
    (*nodepq)->len = 0;
    (*nodepq)->size = 0;
    (*nodepq)->lowerboundsum = 0.0;
@@ -125,6 +258,7 @@ void SCIPnodepqDestroy(
    BMSfreeMemoryArrayNull(&(*nodepq)->slots);
    BMSfreeMemoryArrayNull(&(*nodepq)->bfsposs);
    BMSfreeMemoryArrayNull(&(*nodepq)->bfsqueue);
+   BMSfreeMemoryArrayNull(&(*nodepq)->bfslowerbounds);
    BMSfreeMemory(nodepq);
 }
 
@@ -212,7 +346,6 @@ SCIP_RETCODE SCIPnodepqSetNodesel(
 {
    SCIP_NODEPQ* newnodepq;
    SCIP_RETCODE retcode;
-   int i;
 
    assert(nodepq != NULL);
    assert(*nodepq != NULL);
@@ -229,10 +362,13 @@ SCIP_RETCODE SCIPnodepqSetNodesel(
    /* resize the new node priority queue to be able to store all nodes */
    retcode = nodepqResize(newnodepq, set, (*nodepq)->len);
 
-   /* insert all nodes in the new node priority queue */
-   for( i = 0; i < (*nodepq)->len && retcode == SCIP_OKAY; ++i )
+   /* copy all nodes into the new node priority queue and sort them by the new node selector */
+   if( retcode == SCIP_OKAY && (*nodepq)->len > 0 )
    {
-      retcode = SCIPnodepqInsert(newnodepq, set, (*nodepq)->slots[i]);
+      BMScopyMemoryArray(newnodepq->slots, (*nodepq)->slots, (*nodepq)->len);
+      newnodepq->len = (*nodepq)->len;
+      newnodepq->lowerboundsum = (*nodepq)->lowerboundsum;
+      nodepqHeapify(newnodepq, set);
    }
 
    if( retcode != SCIP_OKAY )
@@ -278,6 +414,7 @@ SCIP_RETCODE SCIPnodepqInsert(
    SCIP_NODE** slots;
    int* bfsposs;
    int* bfsqueue;
+   SCIP_Real* bfslowerbounds;
    SCIP_Real lowerbound;
    int pos;
    int bfspos;
@@ -295,6 +432,7 @@ SCIP_RETCODE SCIPnodepqInsert(
    slots = nodepq->slots;
    bfsposs = nodepq->bfsposs;
    bfsqueue = nodepq->bfsqueue;
+   bfslowerbounds = nodepq->bfslowerbounds;
 
    /* insert node as leaf in the tree, move it towards the root as long it is better than its parent */
    nodepq->len++;
@@ -309,16 +447,18 @@ SCIP_RETCODE SCIPnodepqInsert(
    }
    slots[pos] = node;
 
-   /* insert the final position into the bfs index queue */
+   /* insert the final position into the bfs index queue; the lower bound is stored next to the index */
    lowerbound = SCIPnodeGetLowerbound(node);
    bfspos = nodepq->len-1;
-   while( bfspos > 0 && lowerbound < SCIPnodeGetLowerbound(slots[bfsqueue[PQ_PARENT(bfspos)]]) )
+   while( bfspos > 0 && lowerbound < bfslowerbounds[PQ_PARENT(bfspos)] )
    {
       bfsqueue[bfspos] = bfsqueue[PQ_PARENT(bfspos)];
+      bfslowerbounds[bfspos] = bfslowerbounds[PQ_PARENT(bfspos)];
       bfsposs[bfsqueue[bfspos]] = bfspos;
       bfspos = PQ_PARENT(bfspos);
    }
    bfsqueue[bfspos] = pos;
+   bfslowerbounds[bfspos] = lowerbound;
    bfsposs[pos] = bfspos;
 
    SCIPsetDebugMsg(set, "inserted node %p[%g] at pos %d and bfspos %d of node queue\n", (void*)node, lowerbound, pos, bfspos);
@@ -340,6 +480,7 @@ SCIP_Bool nodepqDelPos(
    SCIP_NODE** slots;
    int* bfsposs;
    int* bfsqueue;
+   SCIP_Real* bfslowerbounds;
    SCIP_NODE* lastnode;
    int lastbfspos;
    int lastbfsqueueidx;
@@ -360,6 +501,7 @@ SCIP_Bool nodepqDelPos(
    slots = nodepq->slots;
    bfsposs = nodepq->bfsposs;
    bfsqueue = nodepq->bfsqueue;
+   bfslowerbounds = nodepq->bfslowerbounds;
 
    nodepq->lowerboundsum -= SCIPnodeGetLowerbound(slots[rempos]);
    freepos = rempos;
@@ -401,18 +543,20 @@ SCIP_Bool nodepqDelPos(
       if( !parentfelldown )
       {
          /* downward moving of parents was not successful -> move children upwards */
-         while( freepos <= PQ_PARENT(nodepq->len-1) ) /* as long as free slot has children... */
+         while( PQ_FIRSTCHILD(freepos) < nodepq->len ) /* as long as free slot has children... */
          {
             int childpos;
             int brotherpos;
+            int endpos;
 
-            /* select the better child of free slot */
-            childpos = PQ_LEFTCHILD(freepos);
-            assert(childpos < nodepq->len);
-            brotherpos = PQ_RIGHTCHILD(freepos);
-            if( brotherpos < nodepq->len
-               && nodesel->nodeselcomp(set->scip, nodesel, slots[brotherpos], slots[childpos]) < 0 )
-               childpos = brotherpos;
+            /* select the best child of free slot */
+            childpos = PQ_FIRSTCHILD(freepos);
+            endpos = MIN(childpos + PQ_ARITY, nodepq->len);
+            for( brotherpos = childpos+1; brotherpos < endpos; ++brotherpos )
+            {
+               if( nodesel->nodeselcomp(set->scip, nodesel, slots[brotherpos], slots[childpos]) < 0 )
+                  childpos = brotherpos;
+            }
 
             /* exit search loop if better child is not better than last node */
             if( nodesel->nodeselcomp(set->scip, nodesel, lastnode, slots[childpos]) <= 0 )
@@ -426,7 +570,7 @@ SCIP_Bool nodepqDelPos(
          }
       }
       assert(0 <= freepos && freepos < nodepq->len);
-      assert(!parentfelldown || PQ_LEFTCHILD(freepos) < nodepq->len);
+      assert(!parentfelldown || PQ_FIRSTCHILD(freepos) < nodepq->len);
       slots[freepos] = lastnode;
       bfsposs[freepos] = lastbfspos;
       bfsqueue[lastbfspos] = freepos;
@@ -441,11 +585,12 @@ SCIP_Bool nodepqDelPos(
       int parentpos;
 
       /* try to move parents downwards to insert last queue index */
-      lastlowerbound = SCIPnodeGetLowerbound(slots[lastbfsqueueidx]);
+      lastlowerbound = bfslowerbounds[nodepq->len];
       parentpos = PQ_PARENT(freebfspos);
-      while( freebfspos > 0 && lastlowerbound < SCIPnodeGetLowerbound(slots[bfsqueue[parentpos]]) )
+      while( freebfspos > 0 && lastlowerbound < bfslowerbounds[parentpos] )
       {
          bfsqueue[freebfspos] = bfsqueue[parentpos];
+         bfslowerbounds[freebfspos] = bfslowerbounds[parentpos];
          bfsposs[bfsqueue[freebfspos]] = freebfspos;
          freebfspos = parentpos;
          parentpos = PQ_PARENT(freebfspos);
@@ -454,32 +599,36 @@ SCIP_Bool nodepqDelPos(
       if( !bfsparentfelldown )
       {
          /* downward moving of parents was not successful -> move children upwards */
-         while( freebfspos <= PQ_PARENT(nodepq->len-1) ) /* as long as free slot has children... */
+         while( PQ_FIRSTCHILD(freebfspos) < nodepq->len ) /* as long as free slot has children... */
          {
             int childpos;
             int brotherpos;
+            int endpos;
 
-            /* select the better child of free slot */
-            childpos = PQ_LEFTCHILD(freebfspos);
-            assert(childpos < nodepq->len);
-            brotherpos = PQ_RIGHTCHILD(freebfspos);
-            if( brotherpos < nodepq->len
-               && SCIPnodeGetLowerbound(slots[bfsqueue[brotherpos]]) < SCIPnodeGetLowerbound(slots[bfsqueue[childpos]]) )
-               childpos = brotherpos;
+            /* select the best child of free slot */
+            childpos = PQ_FIRSTCHILD(freebfspos);
+            endpos = MIN(childpos + PQ_ARITY, nodepq->len);
+            for( brotherpos = childpos+1; brotherpos < endpos; ++brotherpos )
+            {
+               if( bfslowerbounds[brotherpos] < bfslowerbounds[childpos] )
+                  childpos = brotherpos;
+            }
 
             /* exit search loop if better child is not better than last node */
-            if( lastlowerbound <= SCIPnodeGetLowerbound(slots[bfsqueue[childpos]]) )
+            if( lastlowerbound <= bfslowerbounds[childpos] )
                break;
 
             /* move better child upwards, free slot is now the better child's slot */
             bfsqueue[freebfspos] = bfsqueue[childpos];
+            bfslowerbounds[freebfspos] = bfslowerbounds[childpos];
             bfsposs[bfsqueue[freebfspos]] = freebfspos;
             freebfspos = childpos;
          }
       }
       assert(0 <= freebfspos && freebfspos < nodepq->len);
-      assert(!bfsparentfelldown || PQ_LEFTCHILD(freebfspos) < nodepq->len);
+      assert(!bfsparentfelldown || PQ_FIRSTCHILD(freebfspos) < nodepq->len);
       bfsqueue[freebfspos] = lastbfsqueueidx;
+      bfslowerbounds[freebfspos] = lastlowerbound;
       bfsposs[lastbfsqueueidx] = freebfspos;
    }
 
@@ -640,59 +789,65 @@ SCIP_RETCODE SCIPnodepqBound(
    SCIP_Real             cutoffbound         /**< cutoff bound: all nodes with lowerbound >= cutoffbound are cut off */
    )
 {
+   SCIP_NODE** slots;
    SCIP_NODE* node;
+   int oldlen;
    int pos;
-   SCIP_Bool parentfelldown;
+   int i;
 
    assert(nodepq != NULL);
 
    SCIPsetDebugMsg(set, "bounding node queue of length %d with cutoffbound=%g\n", nodepq->len, cutoffbound);
-   pos = nodepq->len-1;
-   while( pos >= 0 )
+
+   /* partition the slots in a single pass: the remaining nodes are moved to the front, the cut off nodes to the back */
+   slots = nodepq->slots;
+   oldlen = nodepq->len;
+   pos = 0;
+   for( i = 0; i < oldlen; ++i )
    {
-      assert(pos < nodepq->len);
-      node = nodepq->slots[pos];
+      node = slots[i];
       assert(node != NULL);
       assert(SCIPnodeGetType(node) == SCIP_NODETYPE_LEAF);
+
       if( SCIPsetIsGE(set, SCIPnodeGetLowerbound(node), cutoffbound) )
       {
-         SCIPsetDebugMsg(set, "free node in slot %d (len=%d) at depth %d with lowerbound=%g\n",
-            pos, nodepq->len, SCIPnodeGetDepth(node), SCIPnodeGetLowerbound(node));
-
-         /* cut off node; because we looped from back to front, the existing children of the node must have a smaller
-          * lower bound than the cut off value
-          */
-         assert(PQ_LEFTCHILD(pos) >= nodepq->len
-            || SCIPsetIsLT(set, SCIPnodeGetLowerbound(nodepq->slots[PQ_LEFTCHILD(pos)]), cutoffbound));
-         assert(PQ_RIGHTCHILD(pos) >= nodepq->len
-            || SCIPsetIsLT(set, SCIPnodeGetLowerbound(nodepq->slots[PQ_RIGHTCHILD(pos)]), cutoffbound));
-
-         /* free the slot in the node PQ */
-         parentfelldown = nodepqDelPos(nodepq, set, pos);
-
-         /* - if the slot was occupied by the parent, we have to check this slot (the parent) again; unfortunately,
-          *   we will check the node which occupied the parent's slot again, even though it cannot be cut off;
-          * - otherwise, the slot was the last slot or it was occupied by a node with a position greater than
-          *   the current position; this node was already checked and we can decrease the position
-          */
-         if( !parentfelldown )
-            pos--;
-
-         SCIPvisualCutoffNode(stat->visual, set, stat, node, FALSE);
-
-         if( set->reopt_enable )
-         {
-            assert(reopt != NULL);
-            SCIP_CALL( SCIPreoptCheckCutoff(reopt, set, blkmem, node, SCIP_EVENTTYPE_NODEINFEASIBLE, lp,
-                  SCIPlpGetSolstat(lp), SCIPnodeGetDepth(node) == 0, SCIPtreeGetFocusNode(tree) == node,
-                  SCIPnodeGetLowerbound(node), SCIPtreeGetEffectiveRootDepth(tree)));
-         }
+         nodepq->lowerboundsum -= SCIPnodeGetLowerbound(node);
+         continue;
+      }
 
-         /* free memory of the node */
-         SCIP_CALL( SCIPnodeFree(&node, blkmem, set, stat, eventfilter, eventqueue, tree, lp) );
+      slots[i] = slots[pos];
+      slots[pos] = node;
+      ++pos;
+   }
+
+   /* nothing to do if no node was cut off */
+   if( pos == oldlen )
+      return SCIP_OKAY;
+
+   /* restore the heap order of the remaining nodes at once */
+   nodepq->len = pos;
+   nodepqHeapify(nodepq, set);
+
+   /* free the cut off nodes, which are now stored behind the end of the queue */
+   for( i = pos; i < oldlen; ++i )
+   {
+      node = slots[i];
+
+      SCIPsetDebugMsg(set, "free node at depth %d with lowerbound=%g\n", SCIPnodeGetDepth(node),
+         SCIPnodeGetLowerbound(node));
+
+      SCIPvisualCutoffNode(stat->visual, set, stat, node, FALSE);
+
+      if( set->reopt_enable )
+      {
+         assert(reopt != NULL);
+         SCIP_CALL( SCIPreoptCheckCutoff(reopt, set, blkmem, node, SCIP_EVENTTYPE_NODEINFEASIBLE, lp,
+               SCIPlpGetSolstat(lp), SCIPnodeGetDepth(node) == 0, SCIPtreeGetFocusNode(tree) == node,
+               SCIPnodeGetLowerbound(node), SCIPtreeGetEffectiveRootDepth(tree)));
       }
-      else
-         pos--;
+
+      /* free memory of the node */
+      SCIP_CALL( SCIPnodeFree(&node, blkmem, set, stat, eventfilter, eventqueue, tree, lp) );
    }
    SCIPsetDebugMsg(set, " -> bounded node queue has length %d\n", nodepq->len);
 
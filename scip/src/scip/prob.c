@@ -152,6 +152,33 @@ SCIP_RETCODE probEnsureConssMem(
    return SCIP_OKAY;
 }
 
+/** resizes bound mirror arrays to be able to store at least num entries */
+static
+SCIP_RETCODE probEnsureMirrorMem(
+   SCIP_PROB*            prob,               /**< problem data */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   int                   num                 /**< minimal number of slots in arrays */
+   )
+{
+   assert(prob != NULL);
+   assert(set != NULL);
+
+   if( num > prob->mirrorsize )
+   {
+      int newsize;
+
+      newsize = SCIPsetCalcMemGrowSize(set, num);
+      SCIP_ALLOC( BMSreallocMemoryArray(&prob->mirrorlbslocal, newsize) );
+      SCIP_ALLOC( BMSreallocMemoryArray(&prob->mirrorubslocal, newsize) );
+      SCIP_ALLOC( BMSreallocMemoryArray(&prob->mirrorlbsglobal, newsize) );
+      SCIP_ALLOC( BMSreallocMemoryArray(&prob->mirrorubsglobal, newsize) );
+      prob->mirrorsize = newsize;
+   }
+   assert(num <= prob->mirrorsize);
+
+   return SCIP_OKAY;
+}
+
 /** returns whether the constraint has a name */
 static
 SCIP_Bool consHasName(
@@ -326,6 +353,13 @@ SCIP_RETCODE SCIPprobCreate(
    (*prob)->nlpenabled = FALSE;
    (*prob)->permuted = FALSE;
    (*prob)->conscompression = FALSE;
+   (*prob)->mirrorlbslocal = NULL;
+   (*prob)->mirrorubslocal = NULL;
+   (*prob)->mirrorlbsglobal = NULL;
+   (*prob)->mirrorubsglobal = NULL;
+   (*prob)->mirrorsize = 0;
+   (*prob)->nmirrorvars = 0;
+   (*prob)->mirrorbounds = FALSE;
 
    return SCIP_OKAY;
 }
@@ -416,6 +450,20 @@ SCIP_RETCODE SCIPprobFree(
    assert(*prob != NULL);
    assert(set != NULL);
 
+   /* stop mirroring the bounds of the variables */
+   if( (*prob)->mirrorbounds )
+   {
+      assert(eventqueue != NULL);
+      assert(SCIPeventqueueGetMirrorProb(eventqueue) == *prob);
+      SCIPeventqueueSetMirrorProb(eventqueue, NULL);
+   }
+   (*prob)->nmirrorvars = 0;
+   (*prob)->mirrorbounds = FALSE;
+   BMSfreeMemoryArrayNull(&(*prob)->mirrorubsglobal);
+   BMSfreeMemoryArrayNull(&(*prob)->mirrorlbsglobal);
+   BMSfreeMemoryArrayNull(&(*prob)->mirrorubslocal);
+   BMSfreeMemoryArrayNull(&(*prob)->mirrorlbslocal);
+
    /* remove all constraints from the problem */
    while( (*prob)->nconss > 0 )
    {
@@ -974,6 +1022,13 @@ SCIP_RETCODE SCIPprobAddVar(
       SCIP_CALL( SCIPlpUpdateAddVar(lp, set, var) );
    }
 
+   /* mirror the bounds of the variable */
+   if( prob->mirrorbounds )
+   {
+      SCIP_CALL( SCIPprobExtendBoundMirror(prob, set, var->index + 1) );
+      SCIPprobUpdateMirror(prob, var);
+   }
+
    SCIPsetDebugMsg(set, "added variable <%s> to problem (%d variables: %d binary, %d integer, %d implicit, %d continuous)\n",
       SCIPvarGetName(var), prob->nvars, prob->nbinvars, prob->nintvars, prob->nimplvars, prob->ncontvars);
 
@@ -1964,6 +2019,230 @@ SCIP_RETCODE SCIPprobExitSolve(
 
 
 
+/*
+ * bound mirror
+ */
+
+/** extends the bound mirror arrays to cover all variable indices below the given number; the entries of the new
+ *  indices stay invalid until the corresponding variables are added to the transformed problem
+ */
+SCIP_RETCODE SCIPprobExtendBoundMirror(
+   SCIP_PROB*            prob,               /**< problem data */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   int                   nvaridx             /**< number of variable indices to cover */
+   )
+{
+   int i;
+
+   assert(prob != NULL);
+
+   if( nvaridx <= prob->nmirrorvars )
+      return SCIP_OKAY;
+
+   SCIP_CALL( probEnsureMirrorMem(prob, set, nvaridx) );
+
+   /* indices of variables that do not belong to the transformed problem stay invalid */
+   for( i = prob->nmirrorvars; i < nvaridx; ++i )
+   {
+      prob->mirrorlbslocal[i] = SCIP_INVALID;
+      prob->mirrorubslocal[i] = SCIP_INVALID;
+      prob->mirrorlbsglobal[i] = SCIP_INVALID;
+      prob->mirrorubsglobal[i] = SCIP_INVALID;
+   }
+   prob->nmirrorvars = nvaridx;
+
+   return SCIP_OKAY;
+}
+
+/** starts mirroring the local and global bounds of all variables of the transformed problem in dense arrays that are
+ *  indexed by the variable index and kept up to date by every bound change
+ */
+SCIP_RETCODE SCIPprobEnableBoundMirror(
+   SCIP_PROB*            prob,               /**< transformed problem data */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< problem statistics */
+   SCIP_EVENTQUEUE*      eventqueue          /**< event queue, through which the bound changes are passed */
+   )
+{
+   SCIP_VAR* var;
+   int v;
+
+   assert(prob != NULL);
+   assert(prob->transformed);
+   assert(stat != NULL);
+   assert(eventqueue != NULL);
+
+   if( prob->mirrorbounds )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPprobExtendBoundMirror(prob, set, stat->nvaridx) );
+   prob->mirrorbounds = TRUE;
+
+   /* the bound changes of the variables find the mirror through the event queue */
+   assert(SCIPeventqueueGetMirrorProb(eventqueue) == NULL);
+   SCIPeventqueueSetMirrorProb(eventqueue, prob);
+
+   /* copy the bounds of the active and the fixed variables and of their negations; negated variables are covered
+    * through their negation variables, and the entries of aggregated and multi-aggregated variables stay invalid
+    */
+   for( v = 0; v < prob->nvars + prob->nfixedvars; ++v )
+   {
+      var = (v < prob->nvars ? prob->vars[v] : prob->fixedvars[v - prob->nvars]);
+
+      if( SCIPvarGetStatus(var) != SCIP_VARSTATUS_NEGATED && SCIPvarGetStatus(var) != SCIP_VARSTATUS_AGGREGATED
+         && SCIPvarGetStatus(var) != SCIP_VARSTATUS_MULTAGGR )
+         SCIPprobUpdateMirror(prob, var);
+   }
+
+   return SCIP_OKAY;
+}
+
+/** copies the current bounds of the variable and of its negated variable into the bound mirror arrays */
+void SCIPprobUpdateMirror(
+   SCIP_PROB*            prob,               /**< transformed problem data */
+   SCIP_VAR*             var                 /**< variable covered by the bound mirror */
+   )
+{
+   SCIP_VAR* negvar;
+
+   assert(prob != NULL);
+   assert(prob->mirrorbounds);
+   assert(var != NULL);
+   assert(0 <= var->index && var->index < prob->nmirrorvars);
+
+   prob->mirrorlbslocal[var->index] = var->locdom.lb;
+   prob->mirrorubslocal[var->index] = var->locdom.ub;
+   prob->mirrorlbsglobal[var->index] = var->glbdom.lb;
+   prob->mirrorubsglobal[var->index] = var->glbdom.ub;
+
+   /* the domain of a negated variable is only stored at its creation, so we derive its bounds from the negation */
+   negvar = var->negatedvar;
+   if( negvar != NULL && SCIPvarGetStatus(negvar) == SCIP_VARSTATUS_NEGATED && negvar->index < prob->nmirrorvars )
+   {
+      assert(negvar->negatedvar == var);
+
+      prob->mirrorlbslocal[negvar->index] = negvar->data.negate.constant - var->locdom.ub;
+      prob->mirrorubslocal[negvar->index] = negvar->data.negate.constant - var->locdom.lb;
+      prob->mirrorlbsglobal[negvar->index] = negvar->data.negate.constant - var->glbdom.ub;
+      prob->mirrorubsglobal[negvar->index] = negvar->data.negate.constant - var->glbdom.lb;
+   }
+}
+
+/** marks the entries of the variable and of its negated variable in the bound mirror arrays invalid, because the
+ *  variable has been aggregated or multi-aggregated and its bounds are derived from other variables
+ */
+void SCIPprobInvalidateMirror(
+   SCIP_PROB*            prob,               /**< transformed problem data */
+   SCIP_VAR*             var                 /**< variable that is not covered by the bound mirror anymore */
+   )
+{
+   SCIP_VAR* negvar;
+
+   assert(prob != NULL);
+   assert(prob->mirrorbounds);
+   assert(var != NULL);
+   assert(SCIPvarGetStatus(var) == SCIP_VARSTATUS_AGGREGATED || SCIPvarGetStatus(var) == SCIP_VARSTATUS_MULTAGGR);
+
+   if( var->index < prob->nmirrorvars )
+   {
+      prob->mirrorlbslocal[var->index] = SCIP_INVALID;
+      prob->mirrorubslocal[var->index] = SCIP_INVALID;
+      prob->mirrorlbsglobal[var->index] = SCIP_INVALID;
+      prob->mirrorubsglobal[var->index] = SCIP_INVALID;
+   }
+
+   negvar = var->negatedvar;
+   if( negvar != NULL && negvar->index < prob->nmirrorvars )
+   {
+      prob->mirrorlbslocal[negvar->index] = SCIP_INVALID;
+      prob->mirrorubslocal[negvar->index] = SCIP_INVALID;
+      prob->mirrorlbsglobal[negvar->index] = SCIP_INVALID;
+      prob->mirrorubsglobal[negvar->index] = SCIP_INVALID;
+   }
+}
+
+/** returns whether the bounds of the variable are covered by the bound mirror, i.e., whether the variable is active,
+ *  fixed, or the negation of such a variable
+ */
+SCIP_Bool SCIPprobIsVarMirrored(
+   SCIP_PROB*            prob,               /**< transformed problem data */
+   SCIP_VAR*             var                 /**< variable to check */
+   )
+{
+   assert(prob != NULL);
+   assert(var != NULL);
+
+   if( !prob->mirrorbounds || var->index < 0 || var->index >= prob->nmirrorvars )
+      return FALSE;
+
+   switch( SCIPvarGetStatus(var) )
+   {
+   case SCIP_VARSTATUS_LOOSE:
+   case SCIP_VARSTATUS_COLUMN:
+   case SCIP_VARSTATUS_FIXED:
+      break;
+   case SCIP_VARSTATUS_NEGATED:
+      assert(var->negatedvar != NULL);
+      if( SCIPvarGetStatus(var->negatedvar) == SCIP_VARSTATUS_AGGREGATED
+         || SCIPvarGetStatus(var->negatedvar) == SCIP_VARSTATUS_MULTAGGR )
+         return FALSE;
+      break;
+   case SCIP_VARSTATUS_ORIGINAL:
+   case SCIP_VARSTATUS_AGGREGATED:
+   case SCIP_VARSTATUS_MULTAGGR:
+   default:
+      return FALSE;
+   }
+
+   /* variables that do not belong to the transformed problem have invalid entries */
+   return prob->mirrorlbslocal[var->index] != SCIP_INVALID; /*lint !e777*/
+}
+
+/** gets the mirrored local or global bounds of the variables with the given indices */
+void SCIPprobGetMirroredBounds(
+   SCIP_PROB*            prob,               /**< transformed problem data */
+   const int*            varindices,         /**< indices of the variables */
+   int                   nvars,              /**< number of variables */
+   SCIP_Bool             global,             /**< should the global instead of the local bounds be returned? */
+   SCIP_Real*            lbs,                /**< array to store the lower bounds, or NULL */
+   SCIP_Real*            ubs                 /**< array to store the upper bounds, or NULL */
+   )
+{
+   const SCIP_Real* mirrorlbs;
+   const SCIP_Real* mirrorubs;
+   int i;
+
+   assert(prob != NULL);
+   assert(prob->mirrorbounds);
+   assert(varindices != NULL || nvars == 0);
+
+   mirrorlbs = (global ? prob->mirrorlbsglobal : prob->mirrorlbslocal);
+   mirrorubs = (global ? prob->mirrorubsglobal : prob->mirrorubslocal);
+
+   /* gather each bound type in a separate loop, such that every loop runs over contiguous memory */
+   if( lbs != NULL )
+   {
+      for( i = 0; i < nvars; ++i )
+      {
+         assert(0 <= varindices[i] && varindices[i] < prob->nmirrorvars);
+         assert(mirrorlbs[varindices[i]] != SCIP_INVALID); /*lint !e777*/
+         lbs[i] = mirrorlbs[varindices[i]];
+      }
+   }
+
+   if( ubs != NULL )
+   {
+      for( i = 0; i < nvars; ++i )
+      {
+         assert(0 <= varindices[i] && varindices[i] < prob->nmirrorvars);
+         assert(mirrorubs[varindices[i]] != SCIP_INVALID); /*lint !e777*/
+         ubs[i] = mirrorubs[varindices[i]];
+      }
+   }
+}
+
+
+
 /*
  * problem information
  */
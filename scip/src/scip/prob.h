@@ -396,6 +396,64 @@ SCIP_RETCODE SCIPprobExitSolve(
 
 
 
+/*
+ * bound mirror
+ */
+
+/** starts mirroring the local and global bounds of all variables of the transformed problem in dense arrays that are
+ *  indexed by the variable index and kept up to date by every bound change
+ */
+SCIP_RETCODE SCIPprobEnableBoundMirror(
+   SCIP_PROB*            prob,               /**< transformed problem data */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< problem statistics */
+   SCIP_EVENTQUEUE*      eventqueue          /**< event queue, through which the bound changes are passed */
+   );
+
+/** extends the bound mirror arrays to cover all variable indices below the given number; the entries of the new
+ *  indices stay invalid until the corresponding variables are added to the transformed problem
+ */
+SCIP_RETCODE SCIPprobExtendBoundMirror(
+   SCIP_PROB*            prob,               /**< transformed problem data */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   int                   nvaridx             /**< number of variable indices to cover */
+   );
+
+/** copies the current bounds of the variable and of its negated variable into the bound mirror arrays */
+void SCIPprobUpdateMirror(
+   SCIP_PROB*            prob,               /**< transformed problem data */
+   SCIP_VAR*             var                 /**< variable covered by the bound mirror */
+   );
+
+/** marks the entries of the variable and of its negated variable in the bound mirror arrays invalid, because the
+ *  variable has been aggregated or multi-aggregated and its bounds are derived from other variables
+ */
+void SCIPprobInvalidateMirror(
+   SCIP_PROB*            prob,               /**< transformed problem data */
+   SCIP_VAR*             var                 /**< variable that is not covered by the bound mirror anymore */
+   );
+
+/** returns whether the bounds of the variable are covered by the bound mirror, i.e., whether the variable is active,
+ *  fixed, or the negation of such a variable
+ */
+SCIP_Bool SCIPprobIsVarMirrored(
+   SCIP_PROB*            prob,               /**< transformed problem data */
+   SCIP_VAR*             var                 /**< variable to check */
+   );
+
+/** gets the mirrored local or global bounds of the variables with the given indices */
+void SCIPprobGetMirroredBounds(
+   SCIP_PROB*            prob,               /**< transformed problem data */
+   const int*            varindices,         /**< indices of the variables */
+   int                   nvars,              /**< number of variables */
+   SCIP_Bool             global,             /**< should the global instead of the local bounds be returned? */
+   SCIP_Real*            lbs,                /**< array to store the lower bounds, or NULL */
+   SCIP_Real*            ubs                 /**< array to store the upper bounds, or NULL */
+   );
+
+
+
+
 /*
  * problem information
  */
@@ -0,0 +1,1215 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2021 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   prop_linprop.c
+ * @ingroup DEFPLUGINS_PROP
+ * @brief  activity-based bound propagation on a row-major copy of the linear constraints
+ *
+ * When the branch-and-bound process starts, the propagator copies the global linear, knapsack, set
+ * partitioning/packing/covering, and logic or constraints, expressed in active variables, into one matrix in compressed
+ * row storage. The coefficients of each row are ordered such that the positive ones come first, and the local bounds
+ * of all columns are kept in two contiguous arrays that are updated by bound change events. Each tightened bound puts
+ * the rows of its column on a worklist.
+ *
+ * A propagation call processes the rows on the worklist. The minimal and maximal activity of a row are computed from
+ * scratch by branch-free loops over the positive and the negative coefficients, which keep several partial sums such
+ * that the compiler can vectorize them, and the bounds of the variables of the row are tightened in the same way as by
+ * the linear constraint handler: infinite bounds and huge contributions are counted instead of summed up, residual
+ * activities that lose too many digits by cancellation are recomputed, and only sufficiently large bound improvements
+ * are applied. The rows of the columns whose bounds were tightened are put on the worklist again.
+ *
+ * The propagator is disabled by default. It pays off on models with many long linear rows, for which it can take over
+ * the activity-based propagation of the constraint handlers.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "blockmemshell/memory.h"
+#include "scip/cons_knapsack.h"
+#include "scip/cons_linear.h"
+#include "scip/cons_logicor.h"
+#include "scip/cons_setppc.h"
+#include "scip/prop_linprop.h"
+#include "scip/pub_cons.h"
+#include "scip/pub_event.h"
+#include "scip/pub_message.h"
+#include "scip/pub_prop.h"
+#include "scip/pub_var.h"
+#include "scip/scip_conflict.h"
+#include "scip/scip_cons.h"
+#include "scip/scip_event.h"
+#include "scip/scip_mem.h"
+#include "scip/scip_message.h"
+#include "scip/scip_numerics.h"
+#include "scip/scip_pricer.h"
+#include "scip/scip_prob.h"
+#include "scip/scip_prop.h"
+#include "scip/scip_var.h"
+#include <string.h>
+
+/**@name Propagator properties
+ *
+ * @{
+ */
+
+#define PROP_NAME              "linprop"
+#define PROP_DESC              "activity-based bound propagation on a row-major copy of the linear constraints"
+#define PROP_TIMING             SCIP_PROPTIMING_BEFORELP
+#define PROP_PRIORITY                90 /**< propagator priority */
+#define PROP_FREQ                    -1 /**< propagator frequency */
+#define PROP_DELAY                FALSE /**< should propagation method be delayed, if other propagators found reductions? */
+
+/**@} */
+
+/**@name Event handler properties
+ *
+ * @{
+ */
+
+#define EVENTHDLR_NAME         "linprop"
+#define EVENTHDLR_DESC         "bound change event handler for the linprop propagator"
+
+/**@} */
+
+/** number of partial sums kept by the activity loops */
+#define NPARTIALSUMS 4
+
+/*
+ * Data structures
+ */
+
+/** propagator data */
+struct SCIP_PropData
+{
+   SCIP_EVENTHDLR*       eventhdlr;          /**< event handler for catching bound changes */
+   SCIP_VAR**            vars;               /**< variables of the columns */
+   SCIP_Real*            lbs;                /**< local lower bounds of the columns */
+   SCIP_Real*            ubs;                /**< local upper bounds of the columns */
+   int*                  colbeg;             /**< start of the rows of each column in colrows (ncols + 1 entries) */
+   int*                  colrows;            /**< rows containing each column */
+   int*                  rowbeg;             /**< start of each row in rowcols and rowvals (nrows + 1 entries) */
+   int*                  rowneg;             /**< start of the negative coefficients of each row in rowcols and rowvals */
+   int*                  rowcols;            /**< columns of the rows, positive coefficients first */
+   SCIP_Real*            rowvals;            /**< coefficients of the rows */
+   SCIP_Real*            lhss;               /**< left hand sides of the rows */
+   SCIP_Real*            rhss;               /**< right hand sides of the rows */
+   int*                  worklist;           /**< circular queue of rows to propagate */
+   SCIP_Bool*            inworklist;         /**< is a row contained in the worklist? */
+   int                   worklisthead;       /**< position of the first row in the worklist */
+   int                   nworklist;          /**< number of rows in the worklist */
+   int                   ncols;              /**< number of columns */
+   int                   nrows;              /**< number of rows */
+   int                   nnonzs;             /**< number of nonzero coefficients */
+   int                   rowssize;           /**< size of the row arrays */
+   int                   nonzssize;          /**< size of the nonzero arrays */
+   SCIP_Bool             initialized;        /**< was the matrix set up for the current solving process? */
+};
+
+
+/*
+ * Local methods
+ */
+
+/** puts a row at the end of the worklist, if it is not yet contained */
+static
+void addToWorklist(
+   SCIP_PROPDATA*        propdata,           /**< propagator data */
+   int                   row                 /**< row to add */
+   )
+{
+   assert(propdata != NULL);
+   assert(0 <= row && row < propdata->nrows);
+
+   if( propdata->inworklist[row] )
+      return;
+
+   assert(propdata->nworklist < propdata->nrows);
+
+   propdata->worklist[(propdata->worklisthead + propdata->nworklist) % propdata->nrows] = row;
+   propdata->inworklist[row] = TRUE;
+   ++propdata->nworklist;
+}
+
+/** puts all rows containing a column on the worklist, except the given one */
+static
+void addColRowsToWorklist(
+   SCIP_PROPDATA*        propdata,           /**< propagator data */
+   int                   col,                /**< column whose rows should be propagated */
+   int                   skiprow             /**< row to skip, or -1 */
+   )
+{
+   int i;
+
+   assert(propdata != NULL);
+   assert(0 <= col && col < propdata->ncols);
+
+   for( i = propdata->colbeg[col]; i < propdata->colbeg[col + 1]; ++i )
+   {
+      if( propdata->colrows[i] != skiprow )
+         addToWorklist(propdata, propdata->colrows[i]);
+   }
+}
+
+/** resolves a linear sum to active variables, enlarging the buffer arrays if necessary */
+static
+SCIP_RETCODE getActiveVariables(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_VAR***           vars,               /**< buffer array of variables in the linear sum */
+   SCIP_Real**           vals,               /**< buffer array of coefficients in the linear sum */
+   int*                  nvars,              /**< pointer to number of variables in the linear sum */
+   int*                  varssize,           /**< pointer to size of the buffer arrays */
+   SCIP_Real*            constant            /**< pointer to constant of the linear sum */
+   )
+{
+   int requiredsize;
+
+   SCIP_CALL( SCIPgetProbvarLinearSum(scip, *vars, *vals, nvars, *varssize, constant, &requiredsize, TRUE) );
+
+   if( requiredsize > *varssize )
+   {
+      SCIP_CALL( SCIPreallocBufferArray(scip, vars, requiredsize) );
+      SCIP_CALL( SCIPreallocBufferArray(scip, vals, requiredsize) );
+      *varssize = requiredsize;
+
+      SCIP_CALL( SCIPgetProbvarLinearSum(scip, *vars, *vals, nvars, *varssize, constant, &requiredsize, TRUE) );
+      assert(requiredsize <= *nvars);
+   }
+
+   return SCIP_OKAY;
+}
+
+/** appends a row given in active variables to the matrix; the positive coefficients are stored first */
+static
+SCIP_RETCODE addRow(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PROPDATA*        propdata,           /**< propagator data */
+   SCIP_VAR**            vars,               /**< active variables of the row */
+   SCIP_Real*            vals,               /**< coefficients of the row */
+   int                   nvars,              /**< number of variables of the row */
+   SCIP_Real             lhs,                /**< left hand side of the row */
+   SCIP_Real             rhs                 /**< right hand side of the row */
+   )
+{
+   int pos;
+   int j;
+
+   assert(propdata != NULL);
+
+   /* rows without finite sides cannot propagate anything */
+   if( nvars == 0 || (SCIPisInfinity(scip, -lhs) && SCIPisInfinity(scip, rhs)) )
+      return SCIP_OKAY;
+
+   if( propdata->nnonzs + nvars > propdata->nonzssize )
+   {
+      int newsize;
+
+      newsize = SCIPcalcMemGrowSize(scip, propdata->nnonzs + nvars);
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &propdata->rowcols, propdata->nonzssize, newsize) );
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &propdata->rowvals, propdata->nonzssize, newsize) );
+      propdata->nonzssize = newsize;
+   }
+
+   pos = propdata->nnonzs;
+   for( j = 0; j < nvars; ++j )
+   {
+      if( vals[j] > 0.0 && !SCIPisZero(scip, vals[j]) )
+      {
+         assert(SCIPvarGetProbindex(vars[j]) >= 0);
+         propdata->rowcols[pos] = SCIPvarGetProbindex(vars[j]);
+         propdata->rowvals[pos] = vals[j];
+         ++pos;
+      }
+   }
+   propdata->rowneg[propdata->nrows] = pos;
+   for( j = 0; j < nvars; ++j )
+   {
+      if( vals[j] < 0.0 && !SCIPisZero(scip, vals[j]) )
+      {
+         assert(SCIPvarGetProbindex(vars[j]) >= 0);
+         propdata->rowcols[pos] = SCIPvarGetProbindex(vars[j]);
+         propdata->rowvals[pos] = vals[j];
+         ++pos;
+      }
+   }
+
+   if( pos == propdata->nnonzs )
+      return SCIP_OKAY;
+
+   propdata->lhss[propdata->nrows] = lhs;
+   propdata->rhss[propdata->nrows] = rhs;
+   propdata->nnonzs = pos;
+   ++propdata->nrows;
+   propdata->rowbeg[propdata->nrows] = pos;
+
+   return SCIP_OKAY;
+}
+
+/** appends the rows of all global, unmodifiable constraints of a constraint handler to the matrix */
+static
+SCIP_RETCODE addConshdlrRows(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PROPDATA*        propdata,           /**< propagator data */
+   const char*           conshdlrname,       /**< name of the constraint handler */
+   SCIP_VAR***           vars,               /**< buffer array of variables */
+   SCIP_Real**           vals,               /**< buffer array of coefficients */
+   int*                  varssize            /**< pointer to size of the buffer arrays */
+   )
+{
+   SCIP_CONSHDLR* conshdlr;
+   SCIP_CONS** conss;
+   int nconss;
+   int c;
+
+   conshdlr = SCIPfindConshdlr(scip, conshdlrname);
+   if( conshdlr == NULL )
+      return SCIP_OKAY;
+
+   conss = SCIPconshdlrGetConss(conshdlr);
+   nconss = SCIPconshdlrGetNConss(conshdlr);
+
+   /* the row arrays get at most one entry per constraint */
+   if( propdata->nrows + nconss + 1 > propdata->rowssize )
+   {
+      int newsize;
+
+      newsize = SCIPcalcMemGrowSize(scip, propdata->nrows + nconss + 1);
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &propdata->rowbeg, propdata->rowssize, newsize) );
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &propdata->rowneg, propdata->rowssize, newsize) );
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &propdata->lhss, propdata->rowssize, newsize) );
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &propdata->rhss, propdata->rowssize, newsize) );
+      propdata->rowssize = newsize;
+   }
+
+   for( c = 0; c < nconss; ++c )
+   {
+      SCIP_CONS* cons;
+      SCIP_VAR** consvars;
+      SCIP_Real constant;
+      SCIP_Real lhs;
+      SCIP_Real rhs;
+      int nconsvars;
+      int j;
+
+      cons = conss[c];
+
+      if( SCIPconsIsLocal(cons) || SCIPconsIsModifiable(cons) || SCIPconsIsDeleted(cons) || !SCIPconsIsActive(cons) )
+         continue;
+
+      if( strcmp(conshdlrname, "linear") == 0 )
+      {
+         nconsvars = SCIPgetNVarsLinear(scip, cons);
+         consvars = SCIPgetVarsLinear(scip, cons);
+         lhs = SCIPgetLhsLinear(scip, cons);
+         rhs = SCIPgetRhsLinear(scip, cons);
+      }
+      else if( strcmp(conshdlrname, "knapsack") == 0 )
+      {
+         nconsvars = SCIPgetNVarsKnapsack(scip, cons);
+         consvars = SCIPgetVarsKnapsack(scip, cons);
+         lhs = -SCIPinfinity(scip);
+         rhs = (SCIP_Real)SCIPgetCapacityKnapsack(scip, cons);
+      }
+      else if( strcmp(conshdlrname, "setppc") == 0 )
+      {
+         nconsvars = SCIPgetNVarsSetppc(scip, cons);
+         consvars = SCIPgetVarsSetppc(scip, cons);
+
+         switch( SCIPgetTypeSetppc(scip, cons) )
+         {
+         case SCIP_SETPPCTYPE_PARTITIONING:
+            lhs = 1.0;
+            rhs = 1.0;
+            break;
+         case SCIP_SETPPCTYPE_PACKING:
+            lhs = -SCIPinfinity(scip);
+            rhs = 1.0;
+            break;
+         case SCIP_SETPPCTYPE_COVERING:
+            lhs = 1.0;
+            rhs = SCIPinfinity(scip);
+            break;
+         default:
+            SCIPerrorMessage("unknown setppc type\n");
+            return SCIP_INVALIDDATA;
+         }
+      }
+      else
+      {
+         assert(strcmp(conshdlrname, "logicor") == 0);
+         nconsvars = SCIPgetNVarsLogicor(scip, cons);
+         consvars = SCIPgetVarsLogicor(scip, cons);
+         lhs = 1.0;
+         rhs = SCIPinfinity(scip);
+      }
+
+      if( nconsvars > *varssize )
+      {
+         SCIP_CALL( SCIPreallocBufferArray(scip, vars, nconsvars) );
+         SCIP_CALL( SCIPreallocBufferArray(scip, vals, nconsvars) );
+         *varssize = nconsvars;
+      }
+
+      BMScopyMemoryArray(*vars, consvars, nconsvars);
+      if( strcmp(conshdlrname, "linear") == 0 )
+      {
+         BMScopyMemoryArray(*vals, SCIPgetValsLinear(scip, cons), nconsvars);
+      }
+      else if( strcmp(conshdlrname, "knapsack") == 0 )
+      {
+         SCIP_Longint* weights;
+
+         weights = SCIPgetWeightsKnapsack(scip, cons);
+         for( j = 0; j < nconsvars; ++j )
+            (*vals)[j] = (SCIP_Real)weights[j];
+      }
+      else
+      {
+         for( j = 0; j < nconsvars; ++j )
+            (*vals)[j] = 1.0;
+      }
+
+      constant = 0.0;
+      SCIP_CALL( getActiveVariables(scip, vars, vals, &nconsvars, varssize, &constant) );
+
+      if( !SCIPisInfinity(scip, -lhs) )
+         lhs -= constant;
+      if( !SCIPisInfinity(scip, rhs) )
+         rhs -= constant;
+
+      SCIP_CALL( addRow(scip, propdata, *vars, *vals, nconsvars, lhs, rhs) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** sets up the matrix, the column bounds, and the worklist, and catches the bound change events of the columns */
+static
+SCIP_RETCODE initData(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PROPDATA*        propdata            /**< propagator data */
+   )
+{
+   SCIP_VAR** vars;
+   SCIP_Real* vals;
+   int* colpos;
+   int varssize;
+   int ncols;
+   int i;
+   int j;
+
+   assert(propdata != NULL);
+   assert(!propdata->initialized);
+
+   propdata->initialized = TRUE;
+
+   /* variables may be added or deleted during pricing, which the column indices cannot follow */
+   if( SCIPgetNActivePricers(scip) > 0 )
+      return SCIP_OKAY;
+
+   ncols = SCIPgetNVars(scip);
+   if( ncols == 0 )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPduplicateBlockMemoryArray(scip, &propdata->vars, SCIPgetVars(scip), ncols) );
+   propdata->ncols = ncols;
+
+   propdata->rowssize = 0;
+   propdata->nonzssize = 0;
+   propdata->nrows = 0;
+   propdata->nnonzs = 0;
+
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->rowbeg, 1) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->rowneg, 1) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->lhss, 1) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->rhss, 1) );
+   propdata->rowssize = 1;
+   propdata->rowbeg[0] = 0;
+
+   varssize = 64;
+   SCIP_CALL( SCIPallocBufferArray(scip, &vars, varssize) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &vals, varssize) );
+
+   SCIP_CALL( addConshdlrRows(scip, propdata, "linear", &vars, &vals, &varssize) );
+   SCIP_CALL( addConshdlrRows(scip, propdata, "knapsack", &vars, &vals, &varssize) );
+   SCIP_CALL( addConshdlrRows(scip, propdata, "setppc", &vars, &vals, &varssize) );
+   SCIP_CALL( addConshdlrRows(scip, propdata, "logicor", &vars, &vals, &varssize) );
+
+   SCIPfreeBufferArray(scip, &vals);
+   SCIPfreeBufferArray(scip, &vars);
+
+   /* store the columns in column-major order to find the rows affected by a bound change */
+   SCIP_CALL( SCIPallocClearBlockMemoryArray(scip, &propdata->colbeg, ncols + 1) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->colrows, MAX(propdata->nnonzs, 1)) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &colpos, ncols) );
+
+   for( j = 0; j < propdata->nnonzs; ++j )
+      ++propdata->colbeg[propdata->rowcols[j] + 1];
+   for( j = 0; j < ncols; ++j )
+   {
+      propdata->colbeg[j + 1] += propdata->colbeg[j];
+      colpos[j] = propdata->colbeg[j];
+   }
+
+   for( i = 0; i < propdata->nrows; ++i )
+   {
+      for( j = propdata->rowbeg[i]; j < propdata->rowbeg[i + 1]; ++j )
+         propdata->colrows[colpos[propdata->rowcols[j]]++] = i;
+   }
+
+   SCIPfreeBufferArray(scip, &colpos);
+
+   SCIPdebugMsg(scip, "set up %d rows with %d nonzeros on %d columns\n", propdata->nrows, propdata->nnonzs, ncols);
+
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->lbs, ncols) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->ubs, ncols) );
+
+   for( j = 0; j < ncols; ++j )
+   {
+      propdata->lbs[j] = SCIPvarGetLbLocal(propdata->vars[j]);
+      propdata->ubs[j] = SCIPvarGetUbLocal(propdata->vars[j]);
+
+      if( propdata->colbeg[j + 1] > propdata->colbeg[j] )
+      {
+         SCIP_CALL( SCIPcatchVarEvent(scip, propdata->vars[j], SCIP_EVENTTYPE_BOUNDCHANGED, propdata->eventhdlr,
+               (SCIP_EVENTDATA*)(size_t)j, NULL) ); /*lint !e571*/
+      }
+   }
+
+   /* all rows need to be propagated once */
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->worklist, MAX(propdata->nrows, 1)) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->inworklist, MAX(propdata->nrows, 1)) );
+
+   for( i = 0; i < propdata->nrows; ++i )
+   {
+      propdata->worklist[i] = i;
+      propdata->inworklist[i] = TRUE;
+   }
+   propdata->worklisthead = 0;
+   propdata->nworklist = propdata->nrows;
+
+   return SCIP_OKAY;
+}
+
+/** drops the bound change events and frees the matrix */
+static
+SCIP_RETCODE freeData(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PROPDATA*        propdata            /**< propagator data */
+   )
+{
+   int j;
+
+   assert(propdata != NULL);
+
+   if( propdata->ncols > 0 )
+   {
+      for( j = 0; j < propdata->ncols; ++j )
+      {
+         if( propdata->colbeg[j + 1] > propdata->colbeg[j] )
+         {
+            SCIP_CALL( SCIPdropVarEvent(scip, propdata->vars[j], SCIP_EVENTTYPE_BOUNDCHANGED, propdata->eventhdlr,
+                  (SCIP_EVENTDATA*)(size_t)j, -1) ); /*lint !e571*/
+         }
+      }
+
+      SCIPfreeBlockMemoryArray(scip, &propdata->inworklist, MAX(propdata->nrows, 1));
+      SCIPfreeBlockMemoryArray(scip, &propdata->worklist, MAX(propdata->nrows, 1));
+      SCIPfreeBlockMemoryArray(scip, &propdata->ubs, propdata->ncols);
+      SCIPfreeBlockMemoryArray(scip, &propdata->lbs, propdata->ncols);
+      SCIPfreeBlockMemoryArray(scip, &propdata->colrows, MAX(propdata->nnonzs, 1));
+      SCIPfreeBlockMemoryArray(scip, &propdata->colbeg, propdata->ncols + 1);
+      SCIPfreeBlockMemoryArrayNull(scip, &propdata->rowvals, propdata->nonzssize);
+      SCIPfreeBlockMemoryArrayNull(scip, &propdata->rowcols, propdata->nonzssize);
+      SCIPfreeBlockMemoryArray(scip, &propdata->rhss, propdata->rowssize);
+      SCIPfreeBlockMemoryArray(scip, &propdata->lhss, propdata->rowssize);
+      SCIPfreeBlockMemoryArray(scip, &propdata->rowneg, propdata->rowssize);
+      SCIPfreeBlockMemoryArray(scip, &propdata->rowbeg, propdata->rowssize);
+      SCIPfreeBlockMemoryArray(scip, &propdata->vars, propdata->ncols);
+   }
+
+   propdata->ncols = 0;
+   propdata->nrows = 0;
+   propdata->nnonzs = 0;
+   propdata->rowssize = 0;
+   propdata->nonzssize = 0;
+   propdata->nworklist = 0;
+   propdata->worklisthead = 0;
+   propdata->initialized = FALSE;
+
+   return SCIP_OKAY;
+}
+
+/** adds the contributions of a segment of a row to an activity bound
+ *
+ *  The bound of each column is looked up in a contiguous array. As in the linear constraint handler, infinite bounds and
+ *  contributions with huge absolute values are counted instead of summed up, such that they cannot spoil the finite
+ *  part of the activity bound. The finite contributions are accumulated in NPARTIALSUMS interleaved partial sums. The
+ *  loop body is free of branches and the partial sums are independent of each other, such that the compiler can map
+ *  them to vector lanes without reordering floating point additions.
+ */
+static
+void addContributions(
+   const int* RESTRICT   cols,               /**< columns of the segment */
+   const SCIP_Real* RESTRICT vals,           /**< coefficients of the segment */
+   int                   n,                  /**< length of the segment */
+   const SCIP_Real* RESTRICT bds,            /**< bounds of all columns that define the activity bound */
+   SCIP_Real             infinity,           /**< value for infinity */
+   SCIP_Real             hugevalue,          /**< minimal absolute value of a contribution that is regarded as huge */
+   SCIP_Real*            sum,                /**< pointer to the finite part of the activity bound, to be increased */
+   int*                  ninf                /**< pointer to the number of infinite or huge contributions, to be increased */
+   )
+{
+   SCIP_Real partsum[NPARTIALSUMS] = { 0.0, 0.0, 0.0, 0.0 };
+   int partninf[NPARTIALSUMS] = { 0, 0, 0, 0 };
+   int k;
+   int l;
+
+   for( k = 0; k + NPARTIALSUMS <= n; k += NPARTIALSUMS )
+   {
+      for( l = 0; l < NPARTIALSUMS; ++l )
+      {
+         SCIP_Real bd;
+         SCIP_Real contribution;
+         int isinf;
+
+         bd = bds[cols[k + l]];
+         contribution = vals[k + l] * bd;
+         isinf = (REALABS(bd) >= infinity) | (REALABS(contribution) >= hugevalue);
+         partninf[l] += isinf;
+         partsum[l] += isinf ? 0.0 : contribution;
+      }
+   }
+
+   for( l = 0; k < n; ++k, ++l )
+   {
+      SCIP_Real bd;
+      SCIP_Real contribution;
+      int isinf;
+
+      bd = bds[cols[k]];
+      contribution = vals[k] * bd;
+      isinf = (REALABS(bd) >= infinity) | (REALABS(contribution) >= hugevalue);
+      partninf[l] += isinf;
+      partsum[l] += isinf ? 0.0 : contribution;
+   }
+
+   *sum += (partsum[0] + partsum[1]) + (partsum[2] + partsum[3]);
+   *ninf += partninf[0] + partninf[1] + partninf[2] + partninf[3];
+}
+
+/** computes the finite parts and the numbers of infinite or huge contributions of the minimal and maximal activity of
+ *  a row
+ */
+static
+void computeActivities(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PROPDATA*        propdata,           /**< propagator data */
+   int                   row,                /**< row to compute the activities for */
+   SCIP_Real*            minact,             /**< pointer to store the finite part of the minimal activity */
+   SCIP_Real*            maxact,             /**< pointer to store the finite part of the maximal activity */
+   int*                  nmininf,            /**< pointer to store the number of infinite or huge contributions to minact */
+   int*                  nmaxinf             /**< pointer to store the number of infinite or huge contributions to maxact */
+   )
+{
+   SCIP_Real infinity;
+   SCIP_Real hugevalue;
+   int beg;
+   int neg;
+   int end;
+
+   beg = propdata->rowbeg[row];
+   neg = propdata->rowneg[row];
+   end = propdata->rowbeg[row + 1];
+   infinity = SCIPinfinity(scip);
+   hugevalue = SCIPgetHugeValue(scip);
+
+   *minact = 0.0;
+   *maxact = 0.0;
+   *nmininf = 0;
+   *nmaxinf = 0;
+
+   /* positive coefficients: the lower bounds define the minimal and the upper bounds the maximal activity */
+   addContributions(&propdata->rowcols[beg], &propdata->rowvals[beg], neg - beg, propdata->lbs, infinity, hugevalue,
+      minact, nmininf);
+   addContributions(&propdata->rowcols[beg], &propdata->rowvals[beg], neg - beg, propdata->ubs, infinity, hugevalue,
+      maxact, nmaxinf);
+
+   /* negative coefficients: the other way round */
+   addContributions(&propdata->rowcols[neg], &propdata->rowvals[neg], end - neg, propdata->ubs, infinity, hugevalue,
+      minact, nmininf);
+   addContributions(&propdata->rowcols[neg], &propdata->rowvals[neg], end - neg, propdata->lbs, infinity, hugevalue,
+      maxact, nmaxinf);
+}
+
+/** recomputes the finite part of the minimal (rhs side) or maximal activity of a row without the contribution of one
+ *  entry by summing up the contributions of the other entries one by one; this is used if subtracting the contribution
+ *  from the activity would cancel too many digits, and requires that all other contributions are finite and not huge
+ */
+static
+SCIP_Real computeResidualActivity(
+   SCIP_PROPDATA*        propdata,           /**< propagator data */
+   int                   row,                /**< row to compute the residual activity for */
+   SCIP_Bool             rhsside,            /**< should the residual of the minimal activity be computed? */
+   int                   skippos             /**< position of the entry in rowcols and rowvals to skip */
+   )
+{
+   SCIP_Real resact;
+   int k;
+
+   resact = 0.0;
+
+   for( k = propdata->rowbeg[row]; k < propdata->rowbeg[row + 1]; ++k )
+   {
+      SCIP_Real val;
+      int col;
+
+      if( k == skippos )
+         continue;
+
+      col = propdata->rowcols[k];
+      val = propdata->rowvals[k];
+
+      resact += val * (((val > 0.0) == rhsside) ? propdata->lbs[col] : propdata->ubs[col]);
+   }
+
+   return resact;
+}
+
+/** adds the bounds that define the minimal (rhs side) or maximal (lhs side) activity of a row to the conflict
+ *  candidates, except the one of the inference variable
+ */
+static
+SCIP_RETCODE addConflictBounds(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PROPDATA*        propdata,           /**< propagator data */
+   int                   row,                /**< row that caused the propagation or infeasibility */
+   SCIP_Bool             rhsside,            /**< was the right hand side of the row responsible? */
+   SCIP_VAR*             infervar,           /**< variable whose bound was deduced, or NULL */
+   SCIP_BDCHGIDX*        bdchgidx            /**< bound change index of the deduction, or NULL for the current bounds */
+   )
+{
+   int k;
+
+   for( k = propdata->rowbeg[row]; k < propdata->rowbeg[row + 1]; ++k )
+   {
+      SCIP_VAR* var;
+
+      var = propdata->vars[propdata->rowcols[k]];
+      if( var == infervar )
+         continue;
+
+      if( (propdata->rowvals[k] > 0.0) == rhsside )
+      {
+         SCIP_CALL( SCIPaddConflictLb(scip, var, bdchgidx) );
+      }
+      else
+      {
+         SCIP_CALL( SCIPaddConflictUb(scip, var, bdchgidx) );
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+/** analyzes the infeasibility of a row with respect to the current local bounds */
+static
+SCIP_RETCODE analyzeConflict(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PROPDATA*        propdata,           /**< propagator data */
+   int                   row,                /**< infeasible row */
+   SCIP_Bool             rhsside             /**< is the right hand side violated? */
+   )
+{
+   if( !SCIPisConflictAnalysisApplicable(scip) )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPinitConflictAnalysis(scip, SCIP_CONFTYPE_PROPAGATION, FALSE) );
+   SCIP_CALL( addConflictBounds(scip, propdata, row, rhsside, NULL, NULL) );
+   SCIP_CALL( SCIPanalyzeConflict(scip, 0, NULL) );
+
+   return SCIP_OKAY;
+}
+
+/** tightens a bound of a column and puts the other rows of the column on the worklist */
+static
+SCIP_RETCODE tightenColBound(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PROP*            prop,               /**< propagator */
+   SCIP_PROPDATA*        propdata,           /**< propagator data */
+   int                   row,                /**< row that implies the bound */
+   SCIP_Bool             rhsside,            /**< is the bound implied by the right hand side of the row? */
+   int                   col,                /**< column to tighten */
+   SCIP_BOUNDTYPE        boundtype,          /**< bound to tighten */
+   SCIP_Real             newbound,           /**< new bound */
+   SCIP_Bool*            cutoff,             /**< pointer to store whether the node can be cut off */
+   SCIP_Bool*            tightened,          /**< pointer to store whether the bound was tightened */
+   int*                  nchgbds             /**< pointer to increase by the number of tightened bounds */
+   )
+{
+   SCIP_VAR* var;
+   SCIP_Bool infeasible;
+
+   var = propdata->vars[col];
+   infeasible = FALSE;
+   *tightened = FALSE;
+
+   if( boundtype == SCIP_BOUNDTYPE_UPPER )
+   {
+      if( !SCIPisLT(scip, newbound, propdata->ubs[col]) )
+         return SCIP_OKAY;
+
+      SCIP_CALL( SCIPinferVarUbProp(scip, var, newbound, prop, row, FALSE, &infeasible, tightened) );
+   }
+   else
+   {
+      if( !SCIPisGT(scip, newbound, propdata->lbs[col]) )
+         return SCIP_OKAY;
+
+      SCIP_CALL( SCIPinferVarLbProp(scip, var, newbound, prop, row, FALSE, &infeasible, tightened) );
+   }
+
+   if( infeasible )
+   {
+      SCIPdebugMsg(scip, "row %d infeasible on bound of <%s>\n", row, SCIPvarGetName(var));
+
+      SCIP_CALL( analyzeConflict(scip, propdata, row, rhsside) );
+      *cutoff = TRUE;
+      *tightened = FALSE;
+   }
+   else if( *tightened )
+   {
+      /* the bound change events are delivered later, so update the bounds of the column directly */
+      propdata->lbs[col] = SCIPvarGetLbLocal(var);
+      propdata->ubs[col] = SCIPvarGetUbLocal(var);
+      addColRowsToWorklist(propdata, col, row);
+      ++(*nchgbds);
+   }
+
+   return SCIP_OKAY;
+}
+
+/** returns whether a deduced bound of a column improves its current bound enough to be applied, in the same way as in
+ *  the linear constraint handler
+ */
+static
+SCIP_Bool isBoundImproving(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PROPDATA*        propdata,           /**< propagator data */
+   int                   col,                /**< column of the bound */
+   SCIP_BOUNDTYPE        boundtype,          /**< type of the deduced bound */
+   SCIP_Real             newbound            /**< deduced bound */
+   )
+{
+   SCIP_Real lb;
+   SCIP_Real ub;
+
+   lb = propdata->lbs[col];
+   ub = propdata->ubs[col];
+
+   if( boundtype == SCIP_BOUNDTYPE_UPPER )
+      return SCIPisUbBetter(scip, newbound, lb, ub) || (SCIPvarIsIntegral(propdata->vars[col]) && SCIPisFeasLT(scip, newbound, ub));
+   else
+      return SCIPisLbBetter(scip, newbound, lb, ub) || (SCIPvarIsIntegral(propdata->vars[col]) && SCIPisFeasGT(scip, newbound, lb));
+}
+
+/** propagates the right hand side (rhsside = TRUE) or the left hand side of a row; the minimal or maximal activity,
+ *  respectively, must have at most one infinite or huge contribution
+ */
+static
+SCIP_RETCODE propagateRowSide(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PROP*            prop,               /**< propagator */
+   SCIP_PROPDATA*        propdata,           /**< propagator data */
+   int                   row,                /**< row to propagate */
+   SCIP_Bool             rhsside,            /**< should the right hand side be propagated? */
+   SCIP_Real             act,                /**< finite part of the minimal (rhs side) or maximal activity */
+   int                   ninf,               /**< number of infinite or huge contributions to the activity */
+   SCIP_Bool*            cutoff,             /**< pointer to store whether the node can be cut off */
+   SCIP_Bool*            tightened,          /**< pointer to store whether a bound was tightened */
+   int*                  nchgbds             /**< pointer to increase by the number of tightened bounds */
+   )
+{
+   SCIP_Real side;
+   int k;
+
+   assert(ninf <= 1);
+
+   side = rhsside ? propdata->rhss[row] : propdata->lhss[row];
+
+   for( k = propdata->rowbeg[row]; k < propdata->rowbeg[row + 1] && !(*cutoff); ++k )
+   {
+      SCIP_BOUNDTYPE boundtype;
+      SCIP_Real val;
+      SCIP_Real bd;
+      SCIP_Real contribution;
+      SCIP_Real residual;
+      SCIP_Real newbound;
+      SCIP_Bool coltightened;
+      int col;
+
+      col = propdata->rowcols[k];
+      val = propdata->rowvals[k];
+
+      /* the bound of the column that contributes to the activity */
+      bd = ((val > 0.0) == rhsside) ? propdata->lbs[col] : propdata->ubs[col];
+      contribution = val * bd;
+
+      /* the residual activity is only finite if no other contribution is infinite or huge */
+      if( SCIPisInfinity(scip, REALABS(bd)) || SCIPisHugeValue(scip, REALABS(contribution)) )
+         residual = act;
+      else if( ninf == 0 )
+         residual = act - contribution;
+      else
+         continue;
+
+      /* val * x <= rhs - residual, or val * x >= lhs - residual */
+      boundtype = ((val > 0.0) == rhsside) ? SCIP_BOUNDTYPE_UPPER : SCIP_BOUNDTYPE_LOWER;
+      newbound = (side - residual) / val;
+
+      if( SCIPisInfinity(scip, REALABS(newbound)) || !isBoundImproving(scip, propdata, col, boundtype, newbound) )
+         continue;
+
+      /* if the contribution of the column cancels most digits of the activity, the residual activity is recomputed from
+       * the other contributions, as in the linear constraint handler
+       */
+      if( ninf == 0 && SCIPisUpdateUnreliable(scip, residual, act) )
+      {
+         residual = computeResidualActivity(propdata, row, rhsside, k);
+         newbound = (side - residual) / val;
+
+         if( SCIPisInfinity(scip, REALABS(newbound)) || !isBoundImproving(scip, propdata, col, boundtype, newbound) )
+            continue;
+      }
+
+      SCIP_CALL( tightenColBound(scip, prop, propdata, row, rhsside, col, boundtype, newbound, cutoff,
+            &coltightened, nchgbds) );
+      *tightened = *tightened || coltightened;
+   }
+
+   return SCIP_OKAY;
+}
+
+/** propagates a row */
+static
+SCIP_RETCODE propagateRow(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PROP*            prop,               /**< propagator */
+   SCIP_PROPDATA*        propdata,           /**< propagator data */
+   int                   row,                /**< row to propagate */
+   SCIP_Bool*            cutoff,             /**< pointer to store whether the node can be cut off */
+   int*                  nchgbds             /**< pointer to increase by the number of tightened bounds */
+   )
+{
+   SCIP_Real minact;
+   SCIP_Real maxact;
+   SCIP_Bool tightened;
+   int nmininf;
+   int nmaxinf;
+
+   computeActivities(scip, propdata, row, &minact, &maxact, &nmininf, &nmaxinf);
+
+   /* the finite parts of the activities may still become huge if many large contributions add up; these activities
+    * are numerically unreliable
+    */
+   if( SCIPisHugeValue(scip, REALABS(minact)) || SCIPisHugeValue(scip, REALABS(maxact)) )
+      return SCIP_OKAY;
+
+   if( nmininf == 0 && !SCIPisInfinity(scip, propdata->rhss[row]) && SCIPisFeasGT(scip, minact, propdata->rhss[row]) )
+   {
+      SCIPdebugMsg(scip, "row %d infeasible: minactivity %g > rhs %g\n", row, minact, propdata->rhss[row]);
+      SCIP_CALL( analyzeConflict(scip, propdata, row, TRUE) );
+      *cutoff = TRUE;
+      return SCIP_OKAY;
+   }
+
+   if( nmaxinf == 0 && !SCIPisInfinity(scip, -propdata->lhss[row]) && SCIPisFeasLT(scip, maxact, propdata->lhss[row]) )
+   {
+      SCIPdebugMsg(scip, "row %d infeasible: maxactivity %g < lhs %g\n", row, maxact, propdata->lhss[row]);
+      SCIP_CALL( analyzeConflict(scip, propdata, row, FALSE) );
+      *cutoff = TRUE;
+      return SCIP_OKAY;
+   }
+
+   tightened = FALSE;
+
+   if( nmininf <= 1 && !SCIPisInfinity(scip, propdata->rhss[row]) )
+   {
+      SCIP_CALL( propagateRowSide(scip, prop, propdata, row, TRUE, minact, nmininf, cutoff, &tightened, nchgbds) );
+
+      if( *cutoff )
+         return SCIP_OKAY;
+
+      /* the tightened bounds changed the maximal activity */
+      if( tightened )
+         computeActivities(scip, propdata, row, &minact, &maxact, &nmininf, &nmaxinf);
+   }
+
+   if( nmaxinf <= 1 && !SCIPisInfinity(scip, -propdata->lhss[row]) && !SCIPisHugeValue(scip, REALABS(maxact)) )
+   {
+      tightened = FALSE;
+
+      SCIP_CALL( propagateRowSide(scip, prop, propdata, row, FALSE, maxact, nmaxinf, cutoff, &tightened, nchgbds) );
+
+      /* the tightened bounds changed the minimal activity, such that the right hand side may propagate again */
+      if( tightened && !(*cutoff) && !SCIPisInfinity(scip, propdata->rhss[row]) )
+         addToWorklist(propdata, row);
+   }
+
+   return SCIP_OKAY;
+}
+
+
+/*
+ * Callback methods of propagator
+ */
+
+/** copy method for propagator plugins (called when SCIP copies plugins) */
+static
+SCIP_DECL_PROPCOPY(propCopyLinprop)
+{  /*lint --e{715}*/
+   assert(scip != NULL);
+   assert(prop != NULL);
+   assert(strcmp(SCIPpropGetName(prop), PROP_NAME) == 0);
+
+   /* call inclusion method of propagator */
+   SCIP_CALL( SCIPincludePropLinprop(scip) );
+
+   return SCIP_OKAY;
+}
+
+/** destructor of propagator to free user data (called when SCIP is exiting) */
+static
+SCIP_DECL_PROPFREE(propFreeLinprop)
+{  /*lint --e{715}*/
+   SCIP_PROPDATA* propdata;
+
+   /* free propagator data */
+   propdata = SCIPpropGetData(prop);
+   assert(propdata != NULL);
+   assert(!propdata->initialized);
+
+   SCIPfreeBlockMemory(scip, &propdata);
+   SCIPpropSetData(prop, NULL);
+
+   return SCIP_OKAY;
+}
+
+/** solving process deinitialization method of propagator (called before branch and bound process data is freed) */
+static
+SCIP_DECL_PROPEXITSOL(propExitsolLinprop)
+{  /*lint --e{715}*/
+   SCIP_PROPDATA* propdata;
+
+   propdata = SCIPpropGetData(prop);
+   assert(propdata != NULL);
+
+   if( propdata->initialized )
+   {
+      SCIP_CALL( freeData(scip, propdata) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** execution method of propagator */
+static
+SCIP_DECL_PROPEXEC(propExecLinprop)
+{  /*lint --e{715}*/
+   SCIP_PROPDATA* propdata;
+   SCIP_Bool cutoff;
+   int nchgbds;
+
+   *result = SCIP_DIDNOTRUN;
+
+   propdata = SCIPpropGetData(prop);
+   assert(propdata != NULL);
+
+   if( !propdata->initialized )
+   {
+      SCIP_CALL( initData(scip, propdata) );
+   }
+
+   if( propdata->nworklist == 0 )
+      return SCIP_OKAY;
+
+   *result = SCIP_DIDNOTFIND;
+   cutoff = FALSE;
+   nchgbds = 0;
+
+   while( propdata->nworklist > 0 && !cutoff )
+   {
+      int row;
+
+      row = propdata->worklist[propdata->worklisthead];
+      propdata->worklisthead = (propdata->worklisthead + 1) % propdata->nrows;
+      --propdata->nworklist;
+      propdata->inworklist[row] = FALSE;
+
+      SCIP_CALL( propagateRow(scip, prop, propdata, row, &cutoff, &nchgbds) );
+   }
+
+   SCIPdebugMsg(scip, "linprop: %d bound changes%s\n", nchgbds, cutoff ? ", cutoff" : "");
+
+   if( cutoff )
+      *result = SCIP_CUTOFF;
+   else if( nchgbds > 0 )
+      *result = SCIP_REDUCEDDOM;
+
+   return SCIP_OKAY;
+}
+
+/** propagation conflict resolving method of propagator */
+static
+SCIP_DECL_PROPRESPROP(propRespropLinprop)
+{  /*lint --e{715}*/
+   SCIP_PROPDATA* propdata;
+   SCIP_Bool rhsside;
+   int row;
+   int k;
+
+   propdata = SCIPpropGetData(prop);
+   assert(propdata != NULL);
+   assert(propdata->initialized);
+
+   row = inferinfo;
+   assert(0 <= row && row < propdata->nrows);
+
+   /* find the coefficient of the inference variable to determine the side of the row that implied the bound */
+   for( k = propdata->rowbeg[row]; k < propdata->rowbeg[row + 1]; ++k )
+   {
+      if( propdata->vars[propdata->rowcols[k]] == infervar )
+         break;
+   }
+   assert(k < propdata->rowbeg[row + 1]);
+
+   rhsside = ((propdata->rowvals[k] > 0.0) == (boundtype == SCIP_BOUNDTYPE_UPPER));
+
+   SCIP_CALL( addConflictBounds(scip, propdata, row, rhsside, infervar, bdchgidx) );
+
+   *result = SCIP_SUCCESS;
+
+   return SCIP_OKAY;
+}
+
+
+/*
+ * Callback methods of event handler
+ */
+
+/** updates the bound of a column for a bound change event and puts the rows of the column on the worklist if the bound
+ *  was tightened
+ */
+static
+void processBoundChange(
+   SCIP_PROPDATA*        propdata,           /**< propagator data */
+   SCIP_EVENT*           event,              /**< bound change event */
+   int                   col                 /**< column of the variable */
+   )
+{
+   SCIP_EVENTTYPE eventtype;
+   SCIP_Real newbound;
+
+   assert(0 <= col && col < propdata->ncols);
+
+   eventtype = SCIPeventGetType(event);
+   newbound = SCIPeventGetNewbound(event);
+
+   if( (eventtype & SCIP_EVENTTYPE_LBCHANGED) != 0 )
+   {
+      /* bounds tightened by the propagator itself are already up to date */
+      if( propdata->lbs[col] == newbound ) /*lint !e777*/
+         return;
+      propdata->lbs[col] = newbound;
+   }
+   else
+   {
+      assert((eventtype & SCIP_EVENTTYPE_UBCHANGED) != 0);
+
+      if( propdata->ubs[col] == newbound ) /*lint !e777*/
+         return;
+      propdata->ubs[col] = newbound;
+   }
+
+   if( (eventtype & SCIP_EVENTTYPE_BOUNDTIGHTENED) != 0 )
+      addColRowsToWorklist(propdata, col, -1);
+}
+
+/** execution method of bound change event handler */
+static
+SCIP_DECL_EVENTEXEC(eventExecLinprop)
+{  /*lint --e{715}*/
+   SCIP_PROPDATA* propdata;
+
+   propdata = (SCIP_PROPDATA*)SCIPeventhdlrGetData(eventhdlr);
+   assert(propdata != NULL);
+
+   processBoundChange(propdata, event, (int)(size_t)eventdata);
+
+   return SCIP_OKAY;
+}
+
+/** batched execution method of bound change event handler for the bound tightenings found during propagation */
+static
+SCIP_DECL_EVENTEXECBATCH(eventExecBatchLinprop)
+{  /*lint --e{715}*/
+   SCIP_PROPDATA* propdata;
+   int i;
+
+   assert(events != NULL);
+   assert(eventdata != NULL);
+
+   propdata = (SCIP_PROPDATA*)SCIPeventhdlrGetData(eventhdlr);
+   assert(propdata != NULL);
+
+   for( i = 0; i < nevents; ++i )
+      processBoundChange(propdata, events[i], (int)(size_t)eventdata[i]);
+
+   return SCIP_OKAY;
+}
+
+
+/*
+ * propagator specific interface methods
+ */
+
+/** creates the linprop propagator and includes it in SCIP */
+SCIP_RETCODE SCIPincludePropLinprop(
+   SCIP*                 scip                /**< SCIP data structure */
+   )
+{
+   SCIP_PROPDATA* propdata;
+   SCIP_PROP* prop;
+
+   /* create linprop propagator data */
+   SCIP_CALL( SCIPallocClearBlockMemory(scip, &propdata) );
+
+   /* include propagator */
+   SCIP_CALL( SCIPincludePropBasic(scip, &prop, PROP_NAME, PROP_DESC, PROP_PRIORITY, PROP_FREQ, PROP_DELAY, PROP_TIMING,
+         propExecLinprop, propdata) );
+   assert(prop != NULL);
+
+   /* set optional callbacks via setter functions */
+   SCIP_CALL( SCIPsetPropCopy(scip, prop, propCopyLinprop) );
+   SCIP_CALL( SCIPsetPropFree(scip, prop, propFreeLinprop) );
+   SCIP_CALL( SCIPsetPropExitsol(scip, prop, propExitsolLinprop) );
+   SCIP_CALL( SCIPsetPropResprop(scip, prop, propRespropLinprop) );
+
+   /* include event handler for bound change events */
+   SCIP_CALL( SCIPincludeEventhdlrBasic(scip, &propdata->eventhdlr, EVENTHDLR_NAME, EVENTHDLR_DESC,
+         eventExecLinprop, (SCIP_EVENTHDLRDATA*)propdata) );
+   SCIP_CALL( SCIPsetEventhdlrExecBatch(scip, propdata->eventhdlr, eventExecBatchLinprop) );
+
+   return SCIP_OKAY;
+}
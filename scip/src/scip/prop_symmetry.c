@@ -28,6 +28,7 @@
  *    - symresack constraints, which separate minimal cover inequalities
  *    - orbitope constraints, if special symmetry group structures are detected
  * - It allows to apply orbital fixing.
+ * - It allows to prune nodes whose branching decisions are symmetric to those of finished leaves.
  *
  *
  * @section SYMCOMP Symmetry Computation
@@ -49,6 +50,10 @@
  * - The code automatically detects whether symmetry substructures like symresacks or orbitopes are present and possibly
  *   adds the corresponding constraints.
  * - If orbital fixing is active, only orbitopes are added (if present) and no symresacks.
+ * - If lexicographic reduction is active, the symresacks are not added as constraints. Instead, the propagator
+ *   propagates all of them in one shared pass over the variable order.
+ * - If orbitopes on general integer variables are handled, components whose orbitopes do not contain binary rows are
+ *   propagated by orbitopal reduction in the propagator, based on lexicographically maximal and minimal columns.
  * - We try to compute symmetry as late as possible and then add constraints based on this information.
  * - Currently, we only allocate memory for pointers to symresack constraints for group generators. If further
  *   constraints are considered, we have to reallocate memory.
@@ -96,6 +101,18 @@
  *       to symmetry components that are not handled by orbitope constraints.
  *
  *
+ * @section NODEPRUNING Pruning of symmetric nodes
+ *
+ * If no other symmetry handling method is active, the propagator can prune nodes whose branching decisions are
+ * symmetric to those of a leaf that has already been finished, i.e., that has been solved without branching. Since
+ * the subproblems of both nodes are symmetric, the node cannot contain a better solution than the finished leaf. To
+ * detect symmetric nodes, the branching decisions are mapped by generators as long as their image becomes
+ * lexicographically smaller. This is cheaper than computing canonical forms, but might miss symmetric nodes.
+ *
+ * @pre The subproblem of a node is determined by its branching bound changes, i.e., no constraints have been added to
+ *      nodes on the path to the root.
+ *
+ *
  * @section SST Cuts derived from the Schreier Sims table
  *
  * SST cuts have been introduced by@n
@@ -134,6 +151,8 @@
 #include <scip/cons_logicor.h>
 #include <scip/cons_or.h>
 #include <scip/cons_orbitope.h>
+#include <scip/activation_colorcomp.h>
+#include <scip/activation_makespan.h>
 #include <scip/cons_symresack.h>
 #include <scip/cons_xor.h>
 #include <scip/cons_linking.h>
@@ -142,6 +161,8 @@
 #include <scip/pub_expr.h>
 #include <scip/misc.h>
 #include <scip/scip_datastructures.h>
+#include <scip/scip_concurrent.h>
+#include <scip/syncstore.h>
 
 #include <scip/prop_symmetry.h>
 #include <symmetry/compute_symmetry.h>
@@ -164,6 +185,7 @@
 
 /* default parameter values for symmetry computation */
 #define DEFAULT_MAXGENERATORS        1500    /**< limit on the number of generators that should be produced within symmetry detection (0 = no limit) */
+#define DEFAULT_TIMELIMIT           1e+20    /**< wall clock time limit in seconds for the search of generators; the generators found so far are used if it is reached */
 #define DEFAULT_CHECKSYMMETRIES     FALSE    /**< Should all symmetries be checked after computation? */
 #define DEFAULT_DISPLAYNORBITVARS   FALSE    /**< Should the number of variables affected by some symmetry be displayed? */
 #define DEFAULT_USECOLUMNSPARSITY   FALSE    /**< Should the number of conss a variable is contained in be exploited in symmetry detection? */
@@ -176,6 +198,7 @@
 /* default parameters for linear symmetry constraints */
 #define DEFAULT_CONSSADDLP           TRUE    /**< Should the symmetry breaking constraints be added to the LP? */
 #define DEFAULT_ADDSYMRESACKS       FALSE    /**< Add inequalities for symresacks for each generator? */
+#define DEFAULT_LEXREDUCTION        FALSE    /**< Should the symresacks be propagated by the propagator instead of adding symresack constraints? */
 #define DEFAULT_DETECTORBITOPES      TRUE    /**< Should we check whether the components of the symmetry group can be handled by orbitopes? */
 #define DEFAULT_DETECTSUBGROUPS      TRUE    /**< Should we try to detect orbitopes in subgroups of the symmetry group? */
 #define DEFAULT_ADDWEAKSBCS          TRUE    /**< Should we add weak SBCs for enclosing orbit of symmetric subgroups? */
@@ -184,11 +207,19 @@
 #define DEFAULT_MAXNCONSSSUBGROUP  500000    /**< Maximum number of constraints up to which subgroup structures are detected */
 #define DEFAULT_USEDYNAMICPROP       TRUE    /**< whether dynamic propagation should be used for full orbitopes */
 #define DEFAULT_PREFERLESSROWS       TRUE    /**< Shall orbitopes with less rows be preferred in detection? */
+#define DEFAULT_DETECTSUBSYM        FALSE    /**< Should sub-symmetry structures of orbitopes be detected and handled by activation handlers? */
+#define DEFAULT_INTORBITOPES        FALSE    /**< Should orbitopes on general integer variables be detected and handled by orbitopal reduction? */
 
 /* default parameters for orbital fixing */
 #define DEFAULT_OFSYMCOMPTIMING         2    /**< timing of symmetry computation for orbital fixing (0 = before presolving, 1 = during presolving, 2 = at first call) */
 #define DEFAULT_PERFORMPRESOLVING   FALSE    /**< Run orbital fixing during presolving? */
 #define DEFAULT_RECOMPUTERESTART        0    /**< Recompute symmetries after a restart has occurred? (0 = never, 1 = always, 2 = if OF found reduction) */
+#define DEFAULT_CACHEGENERATORS      TRUE    /**< Should generators be reused after a restart if the symmetry detection graph did not change? */
+#define DEFAULT_GENCACHEFILE          "-"    /**< file to read generators of an unchanged symmetry detection graph from and to store computed generators in ("-" if none) */
+
+/* default parameters for pruning symmetric nodes */
+#define DEFAULT_NODEPRUNING         FALSE    /**< Should nodes be pruned whose branching decisions are symmetric to those of a finished leaf
+                                              *   (only if no other symmetry handling method is active)? */
 
 /* default parameters for Schreier Sims constraints */
 #define DEFAULT_SSTTIEBREAKRULE   1          /**< index of tie break rule for selecting orbit for Schreier Sims constraints? */
@@ -202,6 +233,8 @@
 /* event handler properties */
 #define EVENTHDLR_SYMMETRY_NAME    "symmetry"
 #define EVENTHDLR_SYMMETRY_DESC    "filter global variable fixing event handler for orbital fixing"
+#define EVENTHDLR_SYMNODES_NAME    "symmetry_nodes"
+#define EVENTHDLR_SYMNODES_DESC    "event handler storing the branching decisions of finished leaves for pruning symmetric nodes"
 
 /* output table properties */
 #define TABLE_NAME_ORBITALFIXING        "orbitalfixing"
@@ -214,6 +247,14 @@
 #define MAXGENNUMERATOR          64000000    /**< determine maximal number of generators by dividing this number by the number of variables */
 #define SCIP_SPECIALVAL 1.12345678912345e+19 /**< special floating point value for handling zeros in bound disjunctions */
 #define COMPRESSNVARSLB             25000    /**< lower bound on the number of variables above which compression could be performed */
+#define MAXNODEFORMROUNDS             100    /**< maximal number of rounds of applying generators to reduce the branching decisions of a node */
+#define MAXNLEAFFORMS             1000000    /**< maximal number of stored branching decisions of finished leaves */
+
+/* constants to store fixings in lexicographic reduction */
+#define LEXNOINIT                       0    /**< entry that has not been initialized (must be 0 because of clean buffers) */
+#define LEXFIXED0                       1    /**< variable is fixed to 0 */
+#define LEXFIXED1                       2    /**< variable is fixed to 1 */
+#define LEXUNFIXED                      3    /**< variable is neither fixed to 0 nor to 1 */
 
 /* macros for getting activeness of symmetry handling methods */
 #define ISSYMRETOPESACTIVE(x)      (((unsigned) x & SYM_HANDLETYPE_SYMBREAK) != 0)
@@ -226,6 +267,29 @@
 #define ISSSTCONTACTIVE(x)         (((unsigned) x & SCIP_SSTTYPE_CONTINUOUS) != 0)
 
 
+/** generators of the last symmetry computation, which are reused if the symmetry detection graph did not change */
+struct SymGenCache
+{
+   uint64_t              hash;               /**< hash of the symmetry detection graph */
+   int                   npermvars;          /**< number of variables the generators act on */
+   int                   nperms;             /**< number of generators */
+   int**                 perms;              /**< generators as (nperms x npermvars) matrix, or NULL if no generators are cached */
+   SCIP_Real             log10groupsize;     /**< log10 of size of symmetry group */
+};
+typedef struct SymGenCache SYMGENCACHE;
+
+/** branching decisions of a node that are reduced by applying generators as long as their image becomes lexicographically
+ *  smaller; each decision is encoded by the key 2 * (index of branching variable) + (1 if it is an upper bound change)
+ */
+struct SymNodeForm
+{
+   int*                  keys;               /**< sorted keys of the branching decisions */
+   SCIP_Real*            bounds;             /**< new bounds of the branching decisions */
+   int                   nbranchings;        /**< number of branching decisions */
+};
+typedef struct SymNodeForm SYMNODEFORM;
+
+
 /** propagator data */
 struct SCIP_PropData
 {
@@ -240,6 +304,10 @@ struct SCIP_PropData
    int                   nmaxperms;          /**< maximal number of permutations (needed for freeing storage) */
    int**                 perms;              /**< pointer to store permutation generators as (nperms x npermvars) matrix */
    int**                 permstrans;         /**< pointer to store transposed permutation generators as (npermvars x nperms) matrix */
+   int*                  supportbegins;      /**< begin positions of the variables in the support arrays */
+   int*                  supportperms;       /**< permutations moving each variable (sparse transposed generators) */
+   int*                  supportimages;      /**< images of each variable under the permutations moving it */
+   int                   nsupport;           /**< total size of the support of the generators */
    SCIP_HASHMAP*         permvarmap;         /**< map of variables to indices in permvars array */
    int                   nmovedpermvars;     /**< number of variables moved by any permutation */
    int                   nmovedbinpermvars;  /**< number of binary variables moved by any permutation */
@@ -267,6 +335,7 @@ struct SCIP_PropData
 
    /* for symmetry computation */
    int                   maxgenerators;      /**< limit on the number of generators that should be produced within symmetry detection (0 = no limit) */
+   SCIP_Real             timelimit;          /**< wall clock time limit in seconds for the search of generators */
    SCIP_Bool             checksymmetries;    /**< Should all symmetries be checked after computation? */
    SCIP_Bool             displaynorbitvars;  /**< Whether the number of variables in non-trivial orbits shall be computed */
    SCIP_Bool             compresssymmetries; /**< Should non-affected variables be removed from permutation to save memory? */
@@ -291,16 +360,33 @@ struct SCIP_PropData
    int                   ngenlinconss;       /**< number of generated linear constraints */
    int                   genlinconsssize;    /**< size of linear constraints array */
    int                   nsymresacks;        /**< number of symresack constraints */
+   SCIP_Bool             lexreduction;       /**< Should the symresacks be propagated by the propagator instead of adding symresack constraints? */
+   int                   nlexperms;          /**< number of permutations handled by lexicographic reduction */
+   int*                  lexsupportbegins;   /**< begin positions of the pairs of each variable in lexsupportperms/lexsupportimages */
+   int*                  lexsupportperms;    /**< permutation of each pair, sorted by variable */
+   int*                  lexsupportimages;   /**< preimage of the variable under the permutation of each pair */
+   int*                  lexpermbegins;      /**< begin positions of the pairs of each permutation in lexpermvars/lexpermpreimages */
+   int*                  lexpermvars;        /**< variable of each pair, sorted by permutation and variable */
+   int*                  lexpermpreimages;   /**< preimage of the variable under the permutation of each pair */
+   int                   nlexpairs;          /**< number of pairs of lexicographic reduction */
    SCIP_Bool             detectorbitopes;    /**< Should we check whether the components of the symmetry group can be handled by orbitopes? */
    SCIP_Bool             detectsubgroups;    /**< Should we try to detect orbitopes in subgroups of the symmetry group? */
    SCIP_Bool             addweaksbcs;        /**< Should we add weak SBCs for enclosing orbit of symmetric subgroups? */
    SCIP_Bool             addstrongsbcs;      /**< Should we add strong SBCs for enclosing orbit of symmetric subgroups if orbitopes are not used? */
    int                   norbitopes;         /**< number of orbitope constraints */
+   SCIP_Bool             intorbitopes;       /**< Should orbitopes on general integer variables be detected and handled by orbitopal reduction? */
+   SCIP_VAR***           intorbitopevars;    /**< variable matrices (row by row) of orbitopes on general integer variables */
+   int*                  intorbitopenrows;   /**< number of rows of orbitopes on general integer variables */
+   int*                  intorbitopencols;   /**< number of columns of orbitopes on general integer variables */
+   int                   nintorbitopes;      /**< number of orbitopes on general integer variables */
+   int                   maxnintorbitopes;   /**< size of arrays of orbitopes on general integer variables */
    SCIP_Bool*            isnonlinvar;        /**< array indicating whether variables apper non-linearly */
    SCIP_CONSHDLR*        conshdlr_nonlinear; /**< nonlinear constraint handler */
    int                   maxnconsssubgroup;  /**< maximum number of constraints up to which subgroup structures are detected */
    SCIP_Bool             usedynamicprop;     /**< whether dynamic propagation should be used for full orbitopes */
    SCIP_Bool             preferlessrows;     /**< Shall orbitopes with less rows be preferred in detection? */
+   SCIP_Bool             detectsubsym;       /**< Should sub-symmetry structures of orbitopes be detected and handled by activation handlers? */
+   int                   nsubsymorbitopes;   /**< number of orbitopes whose sub-symmetries are handled by an activation handler */
 
    /* data necessary for orbital fixing */
    SCIP_Bool             ofenabled;          /**< Run orbital fixing? */
@@ -313,8 +399,19 @@ struct SCIP_PropData
    int                   nbg1;               /**< number of variables in bg1 and bg1list */
    int*                  permvarsevents;     /**< stores events caught for permvars */
    SCIP_Shortbool*       inactiveperms;      /**< array to store whether permutations are inactive */
+   int*                  ofcompvars;         /**< binary variables of the components sorted by component (orbit cache) */
+   int*                  ofcompvarbegins;    /**< begin positions of the components in ofcompvars */
+   int*                  oforbits;           /**< cached orbits, stored in the region of ofcompvars of their component */
+   int*                  oforbitbegins;      /**< cached begin positions of orbits (region of component c starts at ofcompvarbegins[c] + c) */
+   int*                  ofnorbits;          /**< cached number of orbits per component (-1 if they have to be recomputed) */
+   int*                  ofpermtocomponent;  /**< component of each permutation */
+   SCIP_Shortbool*       ofinactiveperms;    /**< inactive permutations w.r.t. which the cached orbits have been computed */
+   SCIP_Shortbool*       ofvaradded;         /**< buffer to mark variables that have been added to an orbit */
    SCIP_Bool             performpresolving;  /**< Run orbital fixing during presolving? */
    int                   recomputerestart;   /**< Recompute symmetries after a restart has occured? (0 = never, 1 = always, 2 = if OF found reduction) */
+   SCIP_Bool             cachegenerators;    /**< Should generators be reused after a restart if the symmetry detection graph did not change? */
+   SYMGENCACHE           gencache;           /**< generators of the last symmetry computation */
+   char*                 gencachefile;       /**< file to read generators of an unchanged symmetry detection graph from and to store computed generators in ("-" if none) */
    int                   ofsymcomptiming;    /**< timing of orbital fixing (0 = before presolving, 1 = during presolving, 2 = at first call) */
    int                   lastrestart;        /**< last restart for which symmetries have been computed */
    int                   nfixedzero;         /**< number of variables fixed to 0 */
@@ -322,6 +419,16 @@ struct SCIP_PropData
    SCIP_Longint          nodenumber;         /**< number of node where propagation has been last applied */
    SCIP_Bool             offoundreduction;   /**< whether orbital fixing has found a reduction since the last time computing symmetries */
 
+   /* data necessary for pruning symmetric nodes */
+   SCIP_Bool             nodepruning;        /**< Should nodes be pruned whose branching decisions are symmetric to those of a finished leaf? */
+   SCIP_Bool             nodepruningenabled; /**< whether symmetric nodes are pruned (no other symmetry handling method is active) */
+   SCIP_EVENTHDLR*       eventhdlrnodes;     /**< event handler for storing the branching decisions of finished leaves */
+   int                   nodeseventfilterpos; /**< filter position of the node events, or -1 if they are not caught */
+   SCIP_HASHTABLE*       leafforms;          /**< reduced branching decisions of finished leaves */
+   int                   nodepruningrun;     /**< run in which the branching decisions of finished leaves are valid */
+   SCIP_Longint          nodepruningnode;    /**< number of node where pruning has been last checked */
+   int                   nprunednodes;       /**< number of nodes pruned since they are symmetric to finished leaves */
+
    /* data necessary for Schreier Sims constraints */
    SCIP_Bool             sstenabled;         /**< Use Schreier Sims constraints? */
    SCIP_CONS**           sstconss;           /**< list of generated schreier sims conss */
@@ -352,6 +459,26 @@ struct SCIP_NodeData
 };
 typedef struct SCIP_NodeData SCIP_NODEDATA;
 
+/** structure of an orbitope that gives rise to sub-symmetries which can be handled by an activation handler */
+enum SubsymType
+{
+   SUBSYMTYPE_NONE      = 0,                 /**< no sub-symmetry structure has been detected */
+   SUBSYMTYPE_MAKESPAN  = 1,                 /**< every column is a knapsack with the same weights (makespan activation handler) */
+   SUBSYMTYPE_COLORCOMP = 2                  /**< the columns contain the edge conflicts of a common graph (colorcomp activation handler) */
+};
+typedef enum SubsymType SUBSYMTYPE;
+
+/** detected sub-symmetry structure of an orbitope */
+struct SubsymData
+{
+   SUBSYMTYPE            type;               /**< type of the detected structure */
+   int*                  weights;            /**< weights of the rows in the knapsacks (makespan only) */
+   int**                 adjacencies;        /**< for every row the adjacent rows in the conflict graph (colorcomp only) */
+   int*                  nadjacencies;       /**< for every row the number of adjacent rows (colorcomp only) */
+   int                   nrows;              /**< number of rows of the orbitope */
+};
+typedef struct SubsymData SUBSYMDATA;
+
 
 /*
  * Event handler callback methods
@@ -380,7 +507,7 @@ SCIP_DECL_EVENTEXEC(eventExecSymmetry)
    propdata = (SCIP_PROPDATA*) eventdata;
    assert( propdata != NULL );
    assert( propdata->permvarmap != NULL );
-   assert( propdata->permstrans != NULL );
+   assert( propdata->supportbegins != NULL );
    assert( propdata->nperms > 0 );
    assert( propdata->permvars != NULL );
    assert( propdata->npermvars > 0 );
@@ -460,6 +587,12 @@ SCIP_DECL_TABLEOUTPUT(tableOutputOrbitalfixing)
       SCIPverbMessage(scip, SCIP_VERBLEVEL_MINIMAL, file, "  vars fixed to 1  :%11d\n", tabledata->propdata->nfixedone);
    }
 
+   if ( tabledata->propdata->nodepruningenabled )
+   {
+      SCIPverbMessage(scip, SCIP_VERBLEVEL_MINIMAL, file, "Symmetric nodes    :\n");
+      SCIPverbMessage(scip, SCIP_VERBLEVEL_MINIMAL, file, "  pruned nodes     :%11d\n", tabledata->propdata->nprunednodes);
+   }
+
    return SCIP_OKAY;
 }
 
@@ -539,6 +672,80 @@ SCIP_DECL_HASHKEYVAL(SYMhashKeyValVartype)
    return SCIPhashFour(SCIPrealHashCode(k->obj), SCIPrealHashCode(k->lb), SCIPrealHashCode((double) k->nconss), SCIPrealHashCode(k->ub));
 }
 
+/** gets the key of the given element */
+static
+SCIP_DECL_HASHGETKEY(SYMhashGetKeyNodeform)
+{  /*lint --e{715}*/
+   return elem;
+}
+
+/** returns TRUE iff both keys are equal
+ *
+ *  Compare the branching decisions of two nodes, which are sorted by their keys.
+ */
+static
+SCIP_DECL_HASHKEYEQ(SYMhashKeyEQNodeform)
+{
+   SCIP* scip;
+   SYMNODEFORM* k1;
+   SYMNODEFORM* k2;
+   int i;
+
+   scip = (SCIP*) userptr;
+   k1 = (SYMNODEFORM*) key1;
+   k2 = (SYMNODEFORM*) key2;
+
+   if ( k1->nbranchings != k2->nbranchings )
+      return FALSE;
+
+   for (i = 0; i < k1->nbranchings; ++i)
+   {
+      if ( k1->keys[i] != k2->keys[i] )
+         return FALSE;
+
+      if ( ! SCIPisEQ(scip, k1->bounds[i], k2->bounds[i]) )
+         return FALSE;
+   }
+
+   return TRUE;
+}
+
+/** returns the hash value of the key
+ *
+ *  The bounds are not taken into account, since they are compared with tolerances.
+ */
+static
+SCIP_DECL_HASHKEYVAL(SYMhashKeyValNodeform)
+{  /*lint --e{715}*/
+   SYMNODEFORM* k;
+   uint64_t hash;
+   int i;
+
+   k = (SYMNODEFORM*) key;
+
+   hash = (uint64_t) k->nbranchings;
+   for (i = 0; i < k->nbranchings; ++i)
+      hash = SCIPhashTwo(hash, k->keys[i]);
+
+   return hash;
+}
+
+/** frees reduced branching decisions of a node */
+static
+void freeNodeForm(
+   SCIP*                 scip,               /**< SCIP instance */
+   SYMNODEFORM**         form                /**< pointer to reduced branching decisions */
+   )
+{
+   assert( scip != NULL );
+   assert( form != NULL );
+   assert( *form != NULL );
+
+   SCIPfreeBlockMemoryArray(scip, &(*form)->bounds, (*form)->nbranchings);
+   SCIPfreeBlockMemoryArray(scip, &(*form)->keys, (*form)->nbranchings);
+   SCIPfreeBlockMemory(scip, form);
+}
+
 /** data structure to store arrays used for sorting rhs types */
 struct SYM_Sortrhstype
 {
@@ -675,6 +882,13 @@ SCIP_Bool checkSymmetryDataFree(
    assert( propdata->permvars == NULL );
    assert( propdata->permvarsobj == NULL );
    assert( propdata->inactiveperms == NULL );
+   assert( propdata->supportbegins == NULL );
+   assert( propdata->ofcompvars == NULL );
+   assert( propdata->lexsupportbegins == NULL );
+   assert( propdata->nlexperms == 0 );
+   assert( propdata->intorbitopevars == NULL );
+   assert( propdata->nintorbitopes == 0 );
+   assert( propdata->leafforms == NULL );
    assert( propdata->perms == NULL );
    assert( propdata->permstrans == NULL );
    assert( propdata->nonbinpermvarcaptured == NULL );
@@ -820,6 +1034,90 @@ SCIP_RETCODE freeSymmetryData(
    /* other data */
    SCIPfreeBlockMemoryArrayNull(scip, &propdata->inactiveperms, propdata->nperms);
 
+   /* free support of permutations */
+   if ( propdata->supportbegins != NULL )
+   {
+      SCIPfreeBlockMemoryArray(scip, &propdata->supportimages, MAX(propdata->nsupport, 1));
+      SCIPfreeBlockMemoryArray(scip, &propdata->supportperms, MAX(propdata->nsupport, 1));
+      SCIPfreeBlockMemoryArray(scip, &propdata->supportbegins, propdata->npermvars + 1);
+      propdata->nsupport = 0;
+   }
+
+   /* free data of lexicographic reduction */
+   if ( propdata->lexsupportbegins != NULL )
+   {
+      SCIPfreeBlockMemoryArray(scip, &propdata->lexpermpreimages, MAX(propdata->nlexpairs, 1));
+      SCIPfreeBlockMemoryArray(scip, &propdata->lexpermvars, MAX(propdata->nlexpairs, 1));
+      SCIPfreeBlockMemoryArray(scip, &propdata->lexpermbegins, propdata->nlexperms + 1);
+      SCIPfreeBlockMemoryArray(scip, &propdata->lexsupportimages, MAX(propdata->nlexpairs, 1));
+      SCIPfreeBlockMemoryArray(scip, &propdata->lexsupportperms, MAX(propdata->nlexpairs, 1));
+      SCIPfreeBlockMemoryArray(scip, &propdata->lexsupportbegins, propdata->npermvars + 1);
+      propdata->nlexpairs = 0;
+      propdata->nlexperms = 0;
+   }
+
+   /* free orbitopes on general integer variables */
+   if ( propdata->intorbitopevars != NULL )
+   {
+      int k;
+
+      for (k = propdata->nintorbitopes - 1; k >= 0; --k)
+      {
+         int nentries;
+
+         nentries = propdata->intorbitopenrows[k] * propdata->intorbitopencols[k];
+         for (i = 0; i < nentries; ++i)
+         {
+            SCIP_CALL( SCIPreleaseVar(scip, &propdata->intorbitopevars[k][i]) );
+         }
+         SCIPfreeBlockMemoryArray(scip, &propdata->intorbitopevars[k], nentries);
+      }
+      SCIPfreeBlockMemoryArray(scip, &propdata->intorbitopencols, propdata->maxnintorbitopes);
+      SCIPfreeBlockMemoryArray(scip, &propdata->intorbitopenrows, propdata->maxnintorbitopes);
+      SCIPfreeBlockMemoryArray(scip, &propdata->intorbitopevars, propdata->maxnintorbitopes);
+      propdata->nintorbitopes = 0;
+      propdata->maxnintorbitopes = 0;
+   }
+
+   /* free branching decisions of finished leaves */
+   if ( propdata->leafforms != NULL )
+   {
+      SYMNODEFORM* form;
+      int nentries;
+
+      if ( propdata->nodeseventfilterpos >= 0 )
+      {
+         SCIP_CALL( SCIPdropEvent(scip, SCIP_EVENTTYPE_NODEFEASIBLE | SCIP_EVENTTYPE_NODEINFEASIBLE,
+               propdata->eventhdlrnodes, (SCIP_EVENTDATA*) propdata, propdata->nodeseventfilterpos) );
+         propdata->nodeseventfilterpos = -1;
+      }
+
+      nentries = SCIPhashtableGetNEntries(propdata->leafforms);
+      for (i = 0; i < nentries; ++i)
+      {
+         form = (SYMNODEFORM*) SCIPhashtableGetEntry(propdata->leafforms, i);
+         if ( form != NULL )
+            freeNodeForm(scip, &form);
+      }
+      SCIPhashtableFree(&propdata->leafforms);
+   }
+   propdata->nodepruningenabled = FALSE;
+
+   /* free orbit cache of orbital fixing */
+   if ( propdata->ofcompvars != NULL )
+   {
+      assert( propdata->ncomponents > 0 );
+
+      SCIPfreeBlockMemoryArray(scip, &propdata->ofvaradded, propdata->nbinpermvars);
+      SCIPfreeBlockMemoryArray(scip, &propdata->ofinactiveperms, propdata->nperms);
+      SCIPfreeBlockMemoryArray(scip, &propdata->ofpermtocomponent, propdata->nperms);
+      SCIPfreeBlockMemoryArray(scip, &propdata->ofnorbits, propdata->ncomponents);
+      SCIPfreeBlockMemoryArray(scip, &propdata->oforbitbegins, propdata->nbinpermvars + propdata->ncomponents);
+      SCIPfreeBlockMemoryArray(scip, &propdata->oforbits, propdata->nbinpermvars);
+      SCIPfreeBlockMemoryArray(scip, &propdata->ofcompvarbegins, propdata->ncomponents + 1);
+      SCIPfreeBlockMemoryArray(scip, &propdata->ofcompvars, propdata->nbinpermvars);
+   }
+
    /* free permstrans matrix*/
    if ( propdata->permstrans != NULL )
    {
@@ -1337,7 +1635,8 @@ SCIP_RETCODE collectCoefficients(
 /** checks whether given permutations form a symmetry of a MIP
  *
  *  We need the matrix and rhs in the original order in order to speed up the comparison process. The matrix is needed
- *  in the right order to easily check rows. The rhs is used because of cache effects.
+ *  in the right order to easily check rows. The rhs is used because of cache effects. Moreover, permutations have to
+ *  respect the colors of the variables, i.e., their objective coefficients, bounds, and types.
  */
 static
 SCIP_RETCODE checkSymmetriesAreSymmetries(
@@ -1345,7 +1644,8 @@ SCIP_RETCODE checkSymmetriesAreSymmetries(
    SYM_SPEC              fixedtype,          /**< variable types that must be fixed by symmetries */
    SYM_MATRIXDATA*       matrixdata,         /**< matrix data */
    int                   nperms,             /**< number of permutations */
-   int**                 perms               /**< permutations */
+   int**                 perms,              /**< permutations */
+   SCIP_Bool*            issymmetry          /**< pointer to store whether all permutations are symmetries */
    )
 {
    SCIP_CONSHDLR* conshdlr;
@@ -1361,8 +1661,12 @@ SCIP_RETCODE checkSymmetriesAreSymmetries(
    int j;
    int p;
 
+   assert( issymmetry != NULL );
+
    SCIPdebugMsg(scip, "Checking whether symmetries are symmetries (generators: %d).\n", nperms);
 
+   *issymmetry = TRUE;
+
    /* set up dense row for permuted row */
    SCIP_CALL( SCIPallocBlockMemoryArray(scip, &permrow, matrixdata->npermvars) );
 
@@ -1399,7 +1703,7 @@ SCIP_RETCODE checkSymmetriesAreSymmetries(
       permrow[j] = 0.0;
 
    /* check all generators */
-   for (p = 0; p < nperms; ++p)
+   for (p = 0; p < nperms && *issymmetry; ++p)
    {
       int* P;
       int r1;
@@ -1414,9 +1718,20 @@ SCIP_RETCODE checkSymmetriesAreSymmetries(
          if ( SymmetryFixVar(fixedtype, matrixdata->permvars[j]) && P[j] != j )
          {
             SCIPdebugMsg(scip, "Permutation does not fix types %u, moving variable %d.\n", fixedtype, j);
-            return SCIP_ERROR;
+            *issymmetry = FALSE;
+            break;
+         }
+
+         /* variables can only be mapped to variables with the same objective, bounds, and type */
+         if ( matrixdata->permvarcolors[P[j]] != matrixdata->permvarcolors[j] )
+         {
+            SCIPdebugMsg(scip, "Permutation maps variable %d to variable %d of different color.\n", j, P[j]);
+            *issymmetry = FALSE;
+            break;
          }
       }
+      if ( ! *issymmetry )
+         break;
 
       /*
        *  linear part
@@ -1476,11 +1791,10 @@ SCIP_RETCODE checkSymmetriesAreSymmetries(
                }
             }
 
-            assert( found );
-            if ( ! found ) /*lint !e774*/
+            if ( ! found )
             {
-               SCIPerrorMessage("Found permutation that is not a symmetry.\n");
-               return SCIP_ERROR;
+               SCIPdebugMsg(scip, "Permutation %d does not map row %d to a row of the problem.\n", p, r1);
+               *issymmetry = FALSE;
             }
          }
 
@@ -1493,7 +1807,12 @@ SCIP_RETCODE checkSymmetriesAreSymmetries(
             permrow[varidx] = 0.0;
             ++j;
          }
+
+         if ( ! *issymmetry )
+            break;
       }
+      if ( ! *issymmetry )
+         break;
 
       /*
        *  non-linear part
@@ -1574,11 +1893,11 @@ SCIP_RETCODE checkSymmetriesAreSymmetries(
             SCIP_CALL( SCIPreleaseExpr(scip, &permutedexpr) );
             SCIP_CALL( SCIPreleaseCons(scip, &permutedcons) );
 
-            assert( found );
-            if( !found ) /*lint !e774*/
+            if ( ! found )
             {
-               SCIPerrorMessage("Found permutation that is not a symmetry.\n");
-               return SCIP_ERROR;
+               SCIPdebugMsg(scip, "Permutation %d does not map nonlinear constraint %d to a constraint of the problem.\n", p, i);
+               *issymmetry = FALSE;
+               break;
             }
          }
       }
@@ -1645,6 +1964,33 @@ SCIP_Bool hasNonlinearConstraints(
    return propdata->conshdlr_nonlinear != NULL && SCIPconshdlrGetNActiveConss(propdata->conshdlr_nonlinear) > 0;
 }
 
+/** returns whether a general integer variable is affected by some symmetry */
+static
+SCIP_Bool isIntVarAffected(
+   SCIP_PROPDATA*        propdata            /**< propagator data */
+   )
+{
+   int i;
+   int p;
+
+   assert( propdata != NULL );
+   assert( propdata->nperms <= 0 || propdata->perms != NULL );
+
+   for (i = 0; i < propdata->npermvars; ++i)
+   {
+      if ( SCIPvarIsBinary(propdata->permvars[i]) || ! SCIPvarIsIntegral(propdata->permvars[i]) )
+         continue;
+
+      for (p = 0; p < propdata->nperms; ++p)
+      {
+         if ( propdata->perms[p][i] != i )
+            return TRUE;
+      }
+   }
+
+   return FALSE;
+}
+
 /** set symmetry data */
 static
 SCIP_RETCODE setSymmetryData(
@@ -1776,135 +2122,548 @@ SCIP_RETCODE setSymmetryData(
 }
 
 
-/** computes symmetry group of a MIP */
+/** updates a 64-bit hash value by an integer */
 static
-SCIP_RETCODE computeSymmetryGroup(
-   SCIP*                 scip,               /**< SCIP pointer */
-   SCIP_Bool             doubleequations,    /**< Double equations to positive/negative version? */
-   SCIP_Bool             compresssymmetries, /**< Should non-affected variables be removed from permutation to save memory? */
-   SCIP_Real             compressthreshold,  /**< Compression is used if percentage of moved vars is at most the threshold. */
+uint64_t updateGraphHash(
+   uint64_t              hash,               /**< hash value */
+   int                   val                 /**< integer to add to the hash value */
+   )
+{
+   hash ^= (uint64_t) (unsigned int) val;
+   hash *= UINT64_C(0x100000001b3);
+   hash ^= hash >> 29;
+
+   return hash;
+}
+
+
+/** computes a hash of the colored symmetry detection graph of the linear part
+ *
+ *  Two problems with the same hash have the same variables, constraint matrix pattern and colors, and thus the same
+ *  symmetry group (up to hash collisions).
+ */
+static
+uint64_t hashSymmetryGraph(
+   SYM_MATRIXDATA*       matrixdata,         /**< matrix data */
    int                   maxgenerators,      /**< maximal number of generators constructed (= 0 if unlimited) */
-   SYM_SPEC              fixedtype,          /**< variable types that must be fixed by symmetries */
-   SCIP_Bool             local,              /**< Use local variable bounds? */
-   SCIP_Bool             checksymmetries,    /**< Should all symmetries be checked after computation? */
-   SCIP_Bool             usecolumnsparsity,  /**< Should the number of conss a variable is contained in be exploited in symmetry detection? */
-   SCIP_CONSHDLR*        conshdlr_nonlinear, /**< Nonlinear constraint handler, if included */
-   int*                  npermvars,          /**< pointer to store number of variables for permutations */
-   int*                  nbinpermvars,       /**< pointer to store number of binary variables for permutations */
-   SCIP_VAR***           permvars,           /**< pointer to store variables on which permutations act */
-   int*                  nperms,             /**< pointer to store number of permutations */
-   int*                  nmaxperms,          /**< pointer to store maximal number of permutations (needed for freeing storage) */
-   int***                perms,              /**< pointer to store permutation generators as (nperms x npermvars) matrix */
-   SCIP_Real*            log10groupsize,     /**< pointer to store log10 of size of group */
-   int*                  nmovedvars,         /**< pointer to store number of moved vars */
-   SCIP_Bool**           isnonlinvar,        /**< pointer to store which variables appear nonlinearly */
-   SCIP_Bool*            binvaraffected,     /**< pointer to store wether a binary variable is affected by symmetry */
-   SCIP_Bool*            compressed,         /**< pointer to store whether compression has been performed */
-   SCIP_Bool*            success             /**< pointer to store whether symmetry computation was successful */
+   SYM_SPEC              fixedtype           /**< variable types that must be fixed by symmetries */
    )
 {
-   SCIP_CONSHDLR* conshdlr;
-   SYM_MATRIXDATA matrixdata;
-   SYM_EXPRDATA exprdata;
-   SCIP_HASHTABLE* vartypemap;
-   SCIP_VAR** consvars;
-   SCIP_Real* consvals;
-   SCIP_CONS** conss;
-   SCIP_VAR** vars;
-   SCIP_EXPRITER* it = NULL;
-   SCIP_HASHSET* auxvars = NULL;
-   SYM_VARTYPE* uniquevararray;
-   SYM_RHSSENSE oldsense = SYM_SENSE_UNKOWN;
-   SYM_SORTRHSTYPE sortrhstype;
-   SCIP_Real oldcoef = SCIP_INVALID;
-   SCIP_Real val;
-   int* nconssforvar = NULL;
-   int nuniquevararray = 0;
-   int nhandleconss;
-   int nactiveconss;
-   int nnlconss;
-   int nconss;
-   int nvars;
-   int nbinvars;
-   int nvarsorig;
-   int nallvars;
-   int c;
+   uint64_t hash = UINT64_C(0xcbf29ce484222325);
    int j;
 
-   assert( scip != NULL );
-   assert( npermvars != NULL );
-   assert( nbinpermvars != NULL );
-   assert( permvars != NULL );
-   assert( nperms != NULL );
-   assert( nmaxperms != NULL );
-   assert( perms != NULL );
-   assert( log10groupsize != NULL );
-   assert( binvaraffected != NULL );
-   assert( compressed != NULL );
-   assert( success != NULL );
-   assert( isnonlinvar != NULL );
-   assert( SYMcanComputeSymmetry() );
-
-   /* init */
-   *npermvars = 0;
-   *nbinpermvars = 0;
-   *permvars = NULL;
-   *nperms = 0;
-   *nmaxperms = 0;
-   *perms = NULL;
-   *log10groupsize = 0;
-   *nmovedvars = -1;
-   *binvaraffected = FALSE;
-   *compressed = FALSE;
-   *success = FALSE;
+   assert( matrixdata != NULL );
 
-   nconss = SCIPgetNConss(scip);
-   nvars = SCIPgetNVars(scip);
-   nbinvars = SCIPgetNBinVars(scip);
-   nvarsorig = nvars;
+   hash = updateGraphHash(hash, maxgenerators);
+   hash = updateGraphHash(hash, (int) fixedtype);
+   hash = updateGraphHash(hash, matrixdata->npermvars);
+   hash = updateGraphHash(hash, matrixdata->nmatcoef);
+   hash = updateGraphHash(hash, matrixdata->nrhscoef);
 
-   /* exit if no constraints or no variables are available */
-   if ( nconss == 0 || nvars == 0 )
+   for (j = 0; j < matrixdata->npermvars; ++j)
    {
-      *success = TRUE;
-      return SCIP_OKAY;
+      hash = updateGraphHash(hash, SCIPvarGetIndex(matrixdata->permvars[j]));
+      hash = updateGraphHash(hash, matrixdata->permvarcolors[j]);
    }
 
-   conss = SCIPgetConss(scip);
-   assert( conss != NULL );
-
-   /* compute the number of active constraints */
-   nactiveconss = SCIPgetNActiveConss(scip);
-   nnlconss = conshdlr_nonlinear != NULL ? SCIPconshdlrGetNActiveConss(conshdlr_nonlinear) : 0;
-
-   /* exit if no active constraints are available */
-   if ( nactiveconss == 0 )
+   for (j = 0; j < matrixdata->nrhscoef; ++j)
    {
-      *success = TRUE;
-      return SCIP_OKAY;
+      hash = updateGraphHash(hash, (int) matrixdata->rhssense[j]);
+      hash = updateGraphHash(hash, matrixdata->rhscoefcolors[j]);
    }
 
-   /* before we set up the matrix, check whether we can handle all constraints */
-   nhandleconss = getNSymhandableConss(scip, conshdlr_nonlinear);
-   assert( nhandleconss <= nactiveconss );
-   if ( nhandleconss < nactiveconss )
+   for (j = 0; j < matrixdata->nmatcoef; ++j)
    {
-      /* In this case we found unkown constraints and we exit, since we cannot handle them. */
-      *success = FALSE;
-      *nperms = -1;
-      return SCIP_OKAY;
+      hash = updateGraphHash(hash, matrixdata->matrhsidx[j]);
+      hash = updateGraphHash(hash, matrixdata->matvaridx[j]);
+      hash = updateGraphHash(hash, matrixdata->matcoefcolors[j]);
    }
 
-   SCIPdebugMsg(scip, "Detecting %ssymmetry on %d variables and %d constraints.\n", local ? "local " : "", nvars, nactiveconss);
-
-   /* copy variables */
-   SCIP_CALL( SCIPduplicateBlockMemoryArray(scip, &vars, SCIPgetVars(scip), nvars) ); /*lint !e666*/
-   assert( vars != NULL );
+   return hash;
+}
 
-   /* fill matrixdata */
 
-   /* use a staggered scheme for allocating space for non-zeros of constraint matrix since it can become large */
-   if ( nvars <= 100000 )
+/** frees the cached generators */
+static
+void freeGenCache(
+   SCIP*                 scip,               /**< SCIP instance */
+   SYMGENCACHE*          gencache            /**< generator cache */
+   )
+{
+   int p;
+
+   assert( scip != NULL );
+   assert( gencache != NULL );
+
+   if ( gencache->perms != NULL )
+   {
+      for (p = 0; p < gencache->nperms; ++p)
+      {
+         SCIPfreeBlockMemoryArray(scip, &gencache->perms[p], gencache->npermvars);
+      }
+      SCIPfreeBlockMemoryArray(scip, &gencache->perms, gencache->nperms);
+   }
+
+   gencache->hash = 0;
+   gencache->npermvars = 0;
+   gencache->nperms = 0;
+   gencache->log10groupsize = 0.0;
+}
+
+
+/** frees generators that have been read from a generator file */
+static
+void freeReadGenerators(
+   SCIP*                 scip,               /**< SCIP instance */
+   int                   npermvars,          /**< number of variables the permutations act on */
+   int                   nperms,             /**< number of allocated permutations */
+   int***                perms               /**< pointer to permutations, entries may be NULL */
+   )
+{
+   int p;
+
+   assert( scip != NULL );
+   assert( perms != NULL );
+
+   if ( *perms == NULL )
+      return;
+
+   for (p = 0; p < nperms; ++p)
+   {
+      SCIPfreeBlockMemoryArrayNull(scip, &(*perms)[p], npermvars);
+   }
+   SCIPfreeBlockMemoryArray(scip, perms, nperms);
+}
+
+
+/** reads generators of the symmetry group from a generator file
+ *
+ *  The generators are only used if the file has been written for a symmetry detection graph with the same hash and
+ *  number of variables, every generator is a permutation, and all generators are symmetries of the problem, i.e.,
+ *  they only map variables to variables of the same color and rows to rows.
+ */
+static
+SCIP_RETCODE readGenCacheFile(
+   SCIP*                 scip,               /**< SCIP instance */
+   const char*           filename,           /**< name of generator file */
+   uint64_t              hash,               /**< hash of the current symmetry detection graph */
+   SYM_SPEC              fixedtype,          /**< variable types that must be fixed by symmetries */
+   SYM_MATRIXDATA*       matrixdata,         /**< matrix data */
+   int*                  nperms,             /**< pointer to store number of permutations */
+   int*                  nmaxperms,          /**< pointer to store maximal number of permutations (needed for freeing storage) */
+   int***                perms,              /**< pointer to store permutation generators as (nperms x npermvars) matrix */
+   SCIP_Real*            log10groupsize,     /**< pointer to store log10 of size of group */
+   SCIP_Bool*            success             /**< pointer to store whether valid generators have been read */
+   )
+{
+   SCIP_Shortbool* isimage = NULL;
+   unsigned long long filehash;
+   SCIP_Real filegroupsize;
+   FILE* file;
+   int** fileperms = NULL;
+   int filenpermvars;
+   int filenperms;
+   int version;
+   int npermvars;
+   int p;
+   int j;
+
+   assert( scip != NULL );
+   assert( filename != NULL );
+   assert( matrixdata != NULL );
+   assert( success != NULL );
+
+   *success = FALSE;
+   npermvars = matrixdata->npermvars;
+
+   file = fopen(filename, "r");
+   if ( file == NULL )
+   {
+      SCIPdebugMsg(scip, "Could not open generator file <%s>.\n", filename);
+      return SCIP_OKAY;
+   }
+
+   if ( fscanf(file, "symmetrygenerators %d", &version) != 1 || version != 1
+      || fscanf(file, "%llu %d %d %lf", &filehash, &filenpermvars, &filenperms, &filegroupsize) != 4
+      || (uint64_t) filehash != hash || filenpermvars != npermvars || filenperms <= 0 )
+   {
+      SCIPdebugMsg(scip, "Generator file <%s> does not belong to the current symmetry detection graph.\n", filename);
+      (void) fclose(file);
+      return SCIP_OKAY;
+   }
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &isimage, npermvars) );
+   SCIP_CALL( SCIPallocClearBlockMemoryArray(scip, &fileperms, filenperms) );
+
+   *success = TRUE;
+   for (p = 0; p < filenperms && *success; ++p)
+   {
+      int nmoved;
+
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &fileperms[p], npermvars) );
+      for (j = 0; j < npermvars; ++j)
+      {
+         fileperms[p][j] = j;
+         isimage[j] = FALSE;
+      }
+
+      if ( fscanf(file, "%d", &nmoved) != 1 || nmoved <= 0 || nmoved > npermvars )
+      {
+         *success = FALSE;
+         break;
+      }
+
+      /* read the moved variables together with their images */
+      for (j = 0; j < nmoved; ++j)
+      {
+         int var;
+         int image;
+
+         if ( fscanf(file, "%d %d", &var, &image) != 2 || var < 0 || var >= npermvars || image < 0 || image >= npermvars )
+         {
+            *success = FALSE;
+            break;
+         }
+         fileperms[p][var] = image;
+      }
+
+      /* check whether the generator is a permutation */
+      for (j = 0; j < npermvars && *success; ++j)
+      {
+         if ( isimage[fileperms[p][j]] )
+            *success = FALSE;
+         isimage[fileperms[p][j]] = TRUE;
+      }
+   }
+   (void) fclose(file);
+
+   SCIPfreeBufferArray(scip, &isimage);
+
+   /* make sure that the generators are symmetries of the current problem */
+   if ( *success )
+   {
+      SCIP_CALL( checkSymmetriesAreSymmetries(scip, fixedtype, matrixdata, filenperms, fileperms, success) );
+   }
+
+   if ( ! *success )
+   {
+      SCIPdebugMsg(scip, "Generator file <%s> does not contain symmetries of the problem.\n", filename);
+      freeReadGenerators(scip, npermvars, filenperms, &fileperms);
+      return SCIP_OKAY;
+   }
+
+   *nperms = filenperms;
+   *nmaxperms = filenperms;
+   *perms = fileperms;
+   *log10groupsize = filegroupsize;
+
+   return SCIP_OKAY;
+}
+
+
+/** writes generators of the symmetry group to a generator file */
+static
+void writeGenCacheFile(
+   SCIP*                 scip,               /**< SCIP instance */
+   const char*           filename,           /**< name of generator file */
+   uint64_t              hash,               /**< hash of the symmetry detection graph */
+   int                   npermvars,          /**< number of variables the permutations act on */
+   int                   nperms,             /**< number of permutations */
+   int**                 perms,              /**< permutation generators as (nperms x npermvars) matrix */
+   SCIP_Real             log10groupsize      /**< log10 of size of group */
+   )
+{
+   FILE* file;
+   int p;
+   int j;
+
+   assert( scip != NULL );
+   assert( filename != NULL );
+   assert( perms != NULL );
+
+   file = fopen(filename, "w");
+   if ( file == NULL )
+   {
+      SCIPwarningMessage(scip, "Could not write symmetry generators to file <%s>.\n", filename);
+      return;
+   }
+
+   /* header: format version, hash of the symmetry detection graph, number of variables and generators, group size */
+   (void) fprintf(file, "symmetrygenerators 1\n");
+   (void) fprintf(file, "%llu %d %d %.17g\n", (unsigned long long) hash, npermvars, nperms, log10groupsize);
+
+   /* generators in sparse form: number of moved variables followed by pairs of moved variables and their images */
+   for (p = 0; p < nperms; ++p)
+   {
+      int nmoved = 0;
+
+      for (j = 0; j < npermvars; ++j)
+      {
+         if ( perms[p][j] != j )
+            ++nmoved;
+      }
+
+      (void) fprintf(file, "%d", nmoved);
+      for (j = 0; j < npermvars; ++j)
+      {
+         if ( perms[p][j] != j )
+            (void) fprintf(file, " %d %d", j, perms[p][j]);
+      }
+      (void) fprintf(file, "\n");
+   }
+
+   (void) fclose(file);
+}
+
+
+/** computes the generators of the symmetry group, or takes them from the cache if the symmetry detection graph did not
+ *  change since they have been computed
+ *
+ *  Besides the generator cache of the current solving process, the generators can be read from a file that has been
+ *  written by an earlier solving process for the same symmetry detection graph. Since graphs are only compared by
+ *  their hash, both cached generators and generators read from the file are checked to be symmetries before they are
+ *  used.
+ */
+static
+SCIP_RETCODE computeOrGetCachedGenerators(
+   SCIP*                 scip,               /**< SCIP instance */
+   int                   maxgenerators,      /**< maximal number of generators constructed (= 0 if unlimited) */
+   SYM_SPEC              fixedtype,          /**< variable types that must be fixed by symmetries */
+   SYM_MATRIXDATA*       matrixdata,         /**< matrix data */
+   SYM_EXPRDATA*         exprdata,           /**< expression data */
+   SYMGENCACHE*          gencache,           /**< generator cache, or NULL if generators should not be cached */
+   const char*           gencachefile,       /**< file to read and store generators, or NULL if no file is used */
+   SCIP_Real             timelimit,          /**< wall clock time limit for the search in seconds (infinity if unlimited) */
+   int*                  nperms,             /**< pointer to store number of permutations */
+   int*                  nmaxperms,          /**< pointer to store maximal number of permutations (needed for freeing storage) */
+   int***                perms,              /**< pointer to store permutation generators as (nperms x npermvars) matrix */
+   SCIP_Real*            log10groupsize      /**< pointer to store log10 of size of group */
+   )
+{
+   SCIP_Bool interrupted = FALSE;
+   SCIP_Bool success = FALSE;
+   uint64_t hash;
+   int p;
+
+   assert( scip != NULL );
+   assert( matrixdata != NULL );
+
+   if ( gencache == NULL && gencachefile == NULL )
+   {
+      SCIP_CALL( SYMcomputeSymmetryGenerators(scip, maxgenerators, matrixdata, exprdata, nperms, nmaxperms,
+            perms, log10groupsize, timelimit, &interrupted) );
+
+      return SCIP_OKAY;
+   }
+
+   hash = hashSymmetryGraph(matrixdata, maxgenerators, fixedtype);
+
+   if ( gencache != NULL && gencache->perms != NULL && gencache->hash == hash && gencache->npermvars == matrixdata->npermvars )
+   {
+      /* a hash collision must not lead to wrong generators */
+      SCIP_CALL( checkSymmetriesAreSymmetries(scip, fixedtype, matrixdata, gencache->nperms, gencache->perms, &success) );
+
+      if ( success )
+      {
+         SCIPverbMessage(scip, SCIP_VERBLEVEL_HIGH, NULL,
+            "   (%.1fs) symmetry detection graph did not change, reusing %d generators\n",
+            SCIPgetSolvingTime(scip), gencache->nperms);
+
+         *nperms = gencache->nperms;
+         *nmaxperms = gencache->nperms;
+         *log10groupsize = gencache->log10groupsize;
+
+         SCIP_CALL( SCIPallocBlockMemoryArray(scip, perms, gencache->nperms) );
+         for (p = 0; p < gencache->nperms; ++p)
+         {
+            SCIP_CALL( SCIPduplicateBlockMemoryArray(scip, &(*perms)[p], gencache->perms[p], gencache->npermvars) );
+         }
+
+         return SCIP_OKAY;
+      }
+
+      SCIPdebugMsg(scip, "Cached generators are no symmetries of the changed symmetry detection graph.\n");
+      success = FALSE;
+   }
+
+   if ( gencachefile != NULL )
+   {
+      SCIP_CALL( readGenCacheFile(scip, gencachefile, hash, fixedtype, matrixdata, nperms, nmaxperms, perms,
+            log10groupsize, &success) );
+
+      if ( success )
+      {
+         SCIPverbMessage(scip, SCIP_VERBLEVEL_HIGH, NULL,
+            "   (%.1fs) read %d generators of the symmetry group from file <%s>\n",
+            SCIPgetSolvingTime(scip), *nperms, gencachefile);
+      }
+   }
+
+   if ( ! success )
+   {
+      SCIP_CALL( SYMcomputeSymmetryGenerators(scip, maxgenerators, matrixdata, exprdata, nperms, nmaxperms,
+            perms, log10groupsize, timelimit, &interrupted) );
+
+      /* do not store generators of an interrupted computation */
+      if ( gencachefile != NULL && *nperms > 0 && ! interrupted && ! SCIPisStopped(scip) )
+         writeGenCacheFile(scip, gencachefile, hash, matrixdata->npermvars, *nperms, *perms, *log10groupsize);
+   }
+
+   if ( gencache == NULL )
+      return SCIP_OKAY;
+
+   /* do not cache generators of an interrupted computation */
+   freeGenCache(scip, gencache);
+   if ( *nperms > 0 && ! interrupted && ! SCIPisStopped(scip) )
+   {
+      gencache->hash = hash;
+      gencache->npermvars = matrixdata->npermvars;
+      gencache->nperms = *nperms;
+      gencache->log10groupsize = *log10groupsize;
+
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &gencache->perms, *nperms) );
+      for (p = 0; p < *nperms; ++p)
+      {
+         SCIP_CALL( SCIPduplicateBlockMemoryArray(scip, &gencache->perms[p], (*perms)[p], matrixdata->npermvars) );
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+
+/** computes symmetry group of a MIP */
+static
+SCIP_RETCODE computeSymmetryGroup(
+   SCIP*                 scip,               /**< SCIP pointer */
+   SCIP_Bool             doubleequations,    /**< Double equations to positive/negative version? */
+   SCIP_Bool             compresssymmetries, /**< Should non-affected variables be removed from permutation to save memory? */
+   SCIP_Real             compressthreshold,  /**< Compression is used if percentage of moved vars is at most the threshold. */
+   int                   maxgenerators,      /**< maximal number of generators constructed (= 0 if unlimited) */
+   SYM_SPEC              fixedtype,          /**< variable types that must be fixed by symmetries */
+   SCIP_Bool             local,              /**< Use local variable bounds? */
+   SCIP_Bool             checksymmetries,    /**< Should all symmetries be checked after computation? */
+   SCIP_Bool             usecolumnsparsity,  /**< Should the number of conss a variable is contained in be exploited in symmetry detection? */
+   SCIP_CONSHDLR*        conshdlr_nonlinear, /**< Nonlinear constraint handler, if included */
+   SYMGENCACHE*          gencache,           /**< cache of generators of the linear part, or NULL if no cache is used */
+   const char*           gencachefile,       /**< file to read and store generators of the linear part, or NULL if no file is used */
+   SCIP_Real             timelimit,          /**< wall clock time limit for the search of generators in seconds */
+   int*                  npermvars,          /**< pointer to store number of variables for permutations */
+   int*                  nbinpermvars,       /**< pointer to store number of binary variables for permutations */
+   SCIP_VAR***           permvars,           /**< pointer to store variables on which permutations act */
+   int*                  nperms,             /**< pointer to store number of permutations */
+   int*                  nmaxperms,          /**< pointer to store maximal number of permutations (needed for freeing storage) */
+   int***                perms,              /**< pointer to store permutation generators as (nperms x npermvars) matrix */
+   SCIP_Real*            log10groupsize,     /**< pointer to store log10 of size of group */
+   int*                  nmovedvars,         /**< pointer to store number of moved vars */
+   SCIP_Bool**           isnonlinvar,        /**< pointer to store which variables appear nonlinearly */
+   SCIP_Bool*            binvaraffected,     /**< pointer to store wether a binary variable is affected by symmetry */
+   SCIP_Bool*            compressed,         /**< pointer to store whether compression has been performed */
+   SCIP_Bool*            success             /**< pointer to store whether symmetry computation was successful */
+   )
+{
+   SCIP_CONSHDLR* conshdlr;
+   SYM_MATRIXDATA matrixdata;
+   SYM_EXPRDATA exprdata;
+   SCIP_HASHTABLE* vartypemap;
+   SCIP_VAR** consvars;
+   SCIP_Real* consvals;
+   SCIP_CONS** conss;
+   SCIP_VAR** vars;
+   SCIP_EXPRITER* it = NULL;
+   SCIP_HASHSET* auxvars = NULL;
+   SYM_VARTYPE* uniquevararray;
+   SYM_RHSSENSE oldsense = SYM_SENSE_UNKOWN;
+   SYM_SORTRHSTYPE sortrhstype;
+   SCIP_Real oldcoef = SCIP_INVALID;
+   SCIP_Real val;
+   int* nconssforvar = NULL;
+   int nuniquevararray = 0;
+   int nhandleconss;
+   int nactiveconss;
+   int nnlconss;
+   int nconss;
+   int nvars;
+   int nbinvars;
+   int nvarsorig;
+   int nallvars;
+   int c;
+   int j;
+
+   assert( scip != NULL );
+   assert( npermvars != NULL );
+   assert( nbinpermvars != NULL );
+   assert( permvars != NULL );
+   assert( nperms != NULL );
+   assert( nmaxperms != NULL );
+   assert( perms != NULL );
+   assert( log10groupsize != NULL );
+   assert( binvaraffected != NULL );
+   assert( compressed != NULL );
+   assert( success != NULL );
+   assert( isnonlinvar != NULL );
+   assert( SYMcanComputeSymmetry() );
+
+   /* init */
+   *npermvars = 0;
+   *nbinpermvars = 0;
+   *permvars = NULL;
+   *nperms = 0;
+   *nmaxperms = 0;
+   *perms = NULL;
+   *log10groupsize = 0;
+   *nmovedvars = -1;
+   *binvaraffected = FALSE;
+   *compressed = FALSE;
+   *success = FALSE;
+
+   nconss = SCIPgetNConss(scip);
+   nvars = SCIPgetNVars(scip);
+   nbinvars = SCIPgetNBinVars(scip);
+   nvarsorig = nvars;
+
+   /* exit if no constraints or no variables are available */
+   if ( nconss == 0 || nvars == 0 )
+   {
+      *success = TRUE;
+      return SCIP_OKAY;
+   }
+
+   conss = SCIPgetConss(scip);
+   assert( conss != NULL );
+
+   /* compute the number of active constraints */
+   nactiveconss = SCIPgetNActiveConss(scip);
+   nnlconss = conshdlr_nonlinear != NULL ? SCIPconshdlrGetNActiveConss(conshdlr_nonlinear) : 0;
+
+   /* exit if no active constraints are available */
+   if ( nactiveconss == 0 )
+   {
+      *success = TRUE;
+      return SCIP_OKAY;
+   }
+
+   /* before we set up the matrix, check whether we can handle all constraints */
+   nhandleconss = getNSymhandableConss(scip, conshdlr_nonlinear);
+   assert( nhandleconss <= nactiveconss );
+   if ( nhandleconss < nactiveconss )
+   {
+      /* In this case we found unkown constraints and we exit, since we cannot handle them. */
+      *success = FALSE;
+      *nperms = -1;
+      return SCIP_OKAY;
+   }
+
+   SCIPdebugMsg(scip, "Detecting %ssymmetry on %d variables and %d constraints.\n", local ? "local " : "", nvars, nactiveconss);
+
+   /* copy variables */
+   SCIP_CALL( SCIPduplicateBlockMemoryArray(scip, &vars, SCIPgetVars(scip), nvars) ); /*lint !e666*/
+   assert( vars != NULL );
+
+   /* fill matrixdata */
+
+   /* use a staggered scheme for allocating space for non-zeros of constraint matrix since it can become large */
+   if ( nvars <= 100000 )
       matrixdata.nmaxmatcoef = 100 * nvars;
    else if ( nvars <= 1000000 )
       matrixdata.nmaxmatcoef = 32 * nvars;
@@ -2529,15 +3288,25 @@ SCIP_RETCODE computeSymmetryGroup(
    /* do not compute symmetry if all variables are non-equivalent (unique) or if all matrix coefficients are different */
    if ( matrixdata.nuniquevars < nvars && (matrixdata.nuniquemat == 0 || matrixdata.nuniquemat < matrixdata.nmatcoef) )
    {
-      /* determine generators */
-      SCIP_CALL( SYMcomputeSymmetryGenerators(scip, maxgenerators, &matrixdata, &exprdata, nperms, nmaxperms,
-            perms, log10groupsize) );
+      /* determine generators (the cache only covers the linear part of the symmetry detection graph) */
+      SCIP_CALL( computeOrGetCachedGenerators(scip, maxgenerators, fixedtype, &matrixdata, &exprdata,
+            nnlconss == 0 ? gencache : NULL, nnlconss == 0 ? gencachefile : NULL, timelimit, nperms, nmaxperms, perms,
+            log10groupsize) );
       assert( *nperms <= *nmaxperms );
 
       /* SCIPisStopped() might call SCIPgetGap() which is only available after initpresolve */
       if ( checksymmetries && SCIPgetStage(scip) > SCIP_STAGE_INITPRESOLVE && ! SCIPisStopped(scip) )
       {
-         SCIP_CALL( checkSymmetriesAreSymmetries(scip, fixedtype, &matrixdata, *nperms, *perms) );
+         SCIP_Bool issymmetry;
+
+         SCIP_CALL( checkSymmetriesAreSymmetries(scip, fixedtype, &matrixdata, *nperms, *perms, &issymmetry) );
+
+         assert( issymmetry );
+         if ( ! issymmetry ) /*lint !e774*/
+         {
+            SCIPerrorMessage("Found permutation that is not a symmetry.\n");
+            return SCIP_ERROR;
+         }
       }
 
       if ( *nperms > 0 )
@@ -2591,6 +3360,348 @@ SCIP_RETCODE computeSymmetryGroup(
 }
 
 
+/** creates the dense transposed permutation matrix
+ *
+ *  The matrix is created from the generators if they are still stored densely, and from their support otherwise. If
+ *  orbital fixing is enabled without Schreier Sims constraints, symmetry information on non-binary variables is
+ *  ignored.
+ */
+static
+SCIP_RETCODE createPermstrans(
+   SCIP*                 scip,               /**< SCIP instance */
+   SCIP_PROPDATA*        propdata            /**< propagator data */
+   )
+{
+   SCIP_Bool ignorenonbinary;
+   int v;
+   int p;
+
+   assert( scip != NULL );
+   assert( propdata != NULL );
+   assert( propdata->permstrans == NULL );
+   assert( propdata->perms != NULL || propdata->supportbegins != NULL );
+   assert( propdata->nperms > 0 );
+   assert( propdata->npermvars > 0 );
+
+   ignorenonbinary = propdata->ofenabled && ! propdata->sstenabled;
+
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->permstrans, propdata->npermvars) );
+   for (v = 0; v < propdata->npermvars; ++v)
+   {
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(propdata->permstrans[v]), propdata->nmaxperms) );
+      for (p = 0; p < propdata->nperms; ++p)
+         propdata->permstrans[v][p] = v;
+
+      if ( ignorenonbinary && ! SCIPvarIsBinary(propdata->permvars[v]) )
+         continue;
+
+      if ( propdata->perms != NULL )
+      {
+         for (p = 0; p < propdata->nperms; ++p)
+            propdata->permstrans[v][p] = propdata->perms[p][v];
+      }
+      else
+      {
+         for (p = propdata->supportbegins[v]; p < propdata->supportbegins[v + 1]; ++p)
+            propdata->permstrans[v][propdata->supportperms[p]] = propdata->supportimages[p];
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+
+/*
+ * Local methods for pruning symmetric nodes
+ */
+
+/** returns whether the first branching decisions are lexicographically smaller than the second ones
+ *
+ *  Both arrays of keys are sorted and do not contain duplicates.
+ */
+static
+SCIP_Bool isNodeFormLexSmaller(
+   SCIP*                 scip,               /**< SCIP instance */
+   int*                  keys1,              /**< keys of first branching decisions */
+   SCIP_Real*            bounds1,            /**< bounds of first branching decisions */
+   int*                  keys2,              /**< keys of second branching decisions */
+   SCIP_Real*            bounds2,            /**< bounds of second branching decisions */
+   int                   nbranchings         /**< number of branching decisions */
+   )
+{
+   int i;
+
+   for (i = 0; i < nbranchings; ++i)
+   {
+      if ( keys1[i] != keys2[i] )
+         return keys1[i] < keys2[i];
+
+      if ( ! SCIPisEQ(scip, bounds1[i], bounds2[i]) )
+         return SCIPisLT(scip, bounds1[i], bounds2[i]);
+   }
+
+   return FALSE;
+}
+
+/** computes the branching decisions of a node and reduces them by the generators
+ *
+ *  As long as the image of the branching decisions w.r.t. a generator is lexicographically smaller, the decisions are
+ *  replaced by their image. Thus, two nodes with the same reduced decisions are symmetric, while symmetric nodes need
+ *  not lead to the same reduced decisions. If the subproblem of the node is not determined by its branching bound
+ *  changes, i.e., constraints have been added to nodes on the path to the root, or a branching variable is not known to
+ *  the symmetry group, no decisions are returned.
+ */
+static
+SCIP_RETCODE computeNodeForm(
+   SCIP*                 scip,               /**< SCIP instance */
+   SCIP_PROPDATA*        propdata,           /**< propagator data */
+   SCIP_NODE*            node,               /**< node */
+   SYMNODEFORM**         form                /**< pointer to store the reduced branching decisions, or NULL if not available */
+   )
+{
+   SCIP_VAR** branchvars;
+   SCIP_Real* branchbounds;
+   SCIP_BOUNDTYPE* boundtypes;
+   SCIP_NODE* ancestor;
+   SCIP_Real* bounds;
+   SCIP_Real* imgbounds;
+   int* keys;
+   int* imgkeys;
+   SCIP_Bool improved = TRUE;
+   int maxnbranchings;
+   int nbranchings;
+   int nkeys;
+   int round;
+   int varidx;
+   int p;
+   int i;
+
+   assert( scip != NULL );
+   assert( propdata != NULL );
+   assert( propdata->permvarmap != NULL );
+   assert( propdata->perms != NULL );
+   assert( node != NULL );
+   assert( form != NULL );
+
+   *form = NULL;
+
+   /* constraints added to the path might not be symmetric */
+   for (ancestor = node; SCIPnodeGetDepth(ancestor) > 0; ancestor = SCIPnodeGetParent(ancestor))
+   {
+      if ( SCIPnodeGetNAddedConss(ancestor) > 0 )
+         return SCIP_OKAY;
+   }
+
+   /* collect branching decisions */
+   maxnbranchings = SCIPnodeGetDepth(node);
+   SCIP_CALL( SCIPallocBufferArray(scip, &branchvars, maxnbranchings) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &branchbounds, maxnbranchings) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &boundtypes, maxnbranchings) );
+
+   SCIPnodeGetAncestorBranchings(node, branchvars, branchbounds, boundtypes, &nbranchings, maxnbranchings);
+   if ( nbranchings > maxnbranchings )
+   {
+      maxnbranchings = nbranchings;
+      SCIP_CALL( SCIPreallocBufferArray(scip, &branchvars, maxnbranchings) );
+      SCIP_CALL( SCIPreallocBufferArray(scip, &branchbounds, maxnbranchings) );
+      SCIP_CALL( SCIPreallocBufferArray(scip, &boundtypes, maxnbranchings) );
+
+      SCIPnodeGetAncestorBranchings(node, branchvars, branchbounds, boundtypes, &nbranchings, maxnbranchings);
+   }
+   assert( nbranchings <= maxnbranchings );
+
+   if ( nbranchings == 0 )
+   {
+      SCIPfreeBufferArray(scip, &boundtypes);
+      SCIPfreeBufferArray(scip, &branchbounds);
+      SCIPfreeBufferArray(scip, &branchvars);
+
+      return SCIP_OKAY;
+   }
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &keys, nbranchings) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &bounds, nbranchings) );
+
+   /* encode branching decisions; variables not contained in compressed permutations are not moved */
+   for (i = 0; i < nbranchings; ++i)
+   {
+      varidx = SCIPhashmapGetImageInt(propdata->permvarmap, (void*) branchvars[i]);
+      if ( varidx == INT_MAX )
+      {
+         if ( ! propdata->compressed || SCIPvarGetProbindex(branchvars[i]) < 0 )
+            break;
+
+         varidx = propdata->npermvars + SCIPvarGetProbindex(branchvars[i]);
+      }
+
+      keys[i] = 2 * varidx + (boundtypes[i] == SCIP_BOUNDTYPE_UPPER ? 1 : 0);
+      bounds[i] = branchbounds[i];
+   }
+
+   SCIPfreeBufferArray(scip, &boundtypes);
+   SCIPfreeBufferArray(scip, &branchbounds);
+   SCIPfreeBufferArray(scip, &branchvars);
+
+   if ( i < nbranchings )
+   {
+      SCIPfreeBufferArray(scip, &bounds);
+      SCIPfreeBufferArray(scip, &keys);
+
+      return SCIP_OKAY;
+   }
+
+   /* keep only the tightest bound change per variable and bound type */
+   SCIPsortIntReal(keys, bounds, nbranchings);
+   nkeys = 0;
+   for (i = 0; i < nbranchings; ++i)
+   {
+      if ( nkeys > 0 && keys[nkeys - 1] == keys[i] )
+      {
+         if ( keys[i] % 2 == 1 )
+            bounds[nkeys - 1] = MIN(bounds[nkeys - 1], bounds[i]);
+         else
+            bounds[nkeys - 1] = MAX(bounds[nkeys - 1], bounds[i]);
+      }
+      else
+      {
+         keys[nkeys] = keys[i];
+         bounds[nkeys++] = bounds[i];
+      }
+   }
+
+   /* replace the decisions by their image as long as it is lexicographically smaller */
+   SCIP_CALL( SCIPallocBufferArray(scip, &imgkeys, nkeys) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &imgbounds, nkeys) );
+
+   for (round = 0; round < MAXNODEFORMROUNDS && improved; ++round)
+   {
+      improved = FALSE;
+
+      for (p = 0; p < propdata->nperms; ++p)
+      {
+         for (i = 0; i < nkeys; ++i)
+         {
+            varidx = keys[i] / 2;
+            if ( varidx < propdata->npermvars )
+               imgkeys[i] = 2 * propdata->perms[p][varidx] + keys[i] % 2;
+            else
+               imgkeys[i] = keys[i];
+            imgbounds[i] = bounds[i];
+         }
+         SCIPsortIntReal(imgkeys, imgbounds, nkeys);
+
+         if ( isNodeFormLexSmaller(scip, imgkeys, imgbounds, keys, bounds, nkeys) )
+         {
+            BMScopyMemoryArray(keys, imgkeys, nkeys);
+            BMScopyMemoryArray(bounds, imgbounds, nkeys);
+            improved = TRUE;
+         }
+      }
+   }
+
+   SCIP_CALL( SCIPallocBlockMemory(scip, form) );
+   SCIP_CALL( SCIPduplicateBlockMemoryArray(scip, &(*form)->keys, keys, nkeys) );
+   SCIP_CALL( SCIPduplicateBlockMemoryArray(scip, &(*form)->bounds, bounds, nkeys) );
+   (*form)->nbranchings = nkeys;
+
+   SCIPfreeBufferArray(scip, &imgbounds);
+   SCIPfreeBufferArray(scip, &imgkeys);
+   SCIPfreeBufferArray(scip, &bounds);
+   SCIPfreeBufferArray(scip, &keys);
+
+   return SCIP_OKAY;
+}
+
+/** exec the event handler for storing the branching decisions of finished leaves
+ *
+ *  A leaf is finished if it is solved without branching, i.e., it is either infeasible, cut off, or its relaxation
+ *  solution is feasible. Every node that is symmetric to a finished leaf cannot contain a better solution and can be
+ *  pruned.
+ */
+static
+SCIP_DECL_EVENTEXEC(eventExecSymmetryNodes)
+{
+   SCIP_PROPDATA* propdata;
+   SYMNODEFORM* form;
+
+   assert( eventhdlr != NULL );
+   assert( eventdata != NULL );
+   assert( strcmp(SCIPeventhdlrGetName(eventhdlr), EVENTHDLR_SYMNODES_NAME) == 0 );
+   assert( event != NULL );
+
+   propdata = (SCIP_PROPDATA*) eventdata;
+   assert( propdata != NULL );
+   assert( propdata->leafforms != NULL );
+
+   /* the branching decisions are only valid in the run in which symmetries have been computed */
+   if ( SCIPgetNRuns(scip) != propdata->nodepruningrun )
+      return SCIP_OKAY;
+
+   if ( SCIPhashtableGetNElements(propdata->leafforms) >= MAXNLEAFFORMS )
+      return SCIP_OKAY;
+
+   if ( SCIPinProbing(scip) || SCIPnodeGetDepth(SCIPeventGetNode(event)) <= 0 )
+      return SCIP_OKAY;
+
+   SCIP_CALL( computeNodeForm(scip, propdata, SCIPeventGetNode(event), &form) );
+   if ( form == NULL )
+      return SCIP_OKAY;
+
+   if ( SCIPhashtableExists(propdata->leafforms, (void*) form) )
+      freeNodeForm(scip, &form);
+   else
+   {
+      SCIP_CALL( SCIPhashtableInsert(propdata->leafforms, (void*) form) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** sets up the data for pruning nodes that are symmetric to finished leaves */
+static
+SCIP_RETCODE setupNodePruning(
+   SCIP*                 scip,               /**< SCIP instance */
+   SCIP_PROPDATA*        propdata            /**< propagator data */
+   )
+{
+   int v;
+
+   assert( scip != NULL );
+   assert( propdata != NULL );
+   assert( propdata->nperms > 0 );
+   assert( propdata->perms != NULL );
+   assert( propdata->leafforms == NULL );
+   assert( ! propdata->ofenabled );
+   assert( ! propdata->symconsenabled );
+   assert( ! propdata->sstenabled );
+
+   /* create hashmap for storing the indices of variables */
+   if ( propdata->permvarmap == NULL )
+   {
+      SCIP_CALL( SCIPhashmapCreate(&propdata->permvarmap, SCIPblkmem(scip), propdata->npermvars) );
+
+      for (v = 0; v < propdata->npermvars; ++v)
+      {
+         SCIP_CALL( SCIPhashmapInsertInt(propdata->permvarmap, propdata->permvars[v], v) );
+      }
+   }
+
+   SCIP_CALL( SCIPhashtableCreate(&propdata->leafforms, SCIPblkmem(scip), SCIPcalcMemGrowSize(scip, propdata->npermvars),
+         SYMhashGetKeyNodeform, SYMhashKeyEQNodeform, SYMhashKeyValNodeform, (void*) scip) );
+
+   SCIP_CALL( SCIPcatchEvent(scip, SCIP_EVENTTYPE_NODEFEASIBLE | SCIP_EVENTTYPE_NODEINFEASIBLE, propdata->eventhdlrnodes,
+         (SCIP_EVENTDATA*) propdata, &propdata->nodeseventfilterpos) );
+
+   propdata->nodepruningrun = SCIPgetNRuns(scip);
+   propdata->nodepruningenabled = TRUE;
+
+   SCIPverbMessage(scip, SCIP_VERBLEVEL_HIGH, NULL,
+      "   (%.1fs) prune nodes whose branching decisions are symmetric to those of finished leaves\n", SCIPgetSolvingTime(scip));
+
+   return SCIP_OKAY;
+}
+
+
 /** determines symmetry */
 static
 SCIP_RETCODE determineSymmetry(
@@ -2601,6 +3712,7 @@ SCIP_RETCODE determineSymmetry(
    )
 { /*lint --e{641}*/
    SCIP_Bool successful;
+   SCIP_Real timelimit;
    int maxgenerators;
    int nhandleconss;
    int nconss;
@@ -2612,7 +3724,7 @@ SCIP_RETCODE determineSymmetry(
    assert( scip != NULL );
    assert( propdata != NULL );
    assert( propdata->usesymmetry >= 0 );
-   assert( propdata->ofenabled || propdata->symconsenabled || propdata->sstenabled );
+   assert( propdata->ofenabled || propdata->symconsenabled || propdata->sstenabled || propdata->nodepruning );
 
    /* do not compute symmetry if reoptimization is enabled */
    if ( SCIPisReoptEnabled(scip) )
@@ -2675,7 +3787,7 @@ SCIP_RETCODE determineSymmetry(
    }
 
    /* do not compute symmetry if there are no binary variables and non-binary variables cannot be handled, but only binary variables would be used */
-   if ( propdata->onlybinarysymmetry && SCIPgetNBinVars(scip) == 0 )
+   if ( propdata->onlybinarysymmetry && SCIPgetNBinVars(scip) == 0 && ! (propdata->intorbitopes && SCIPgetNIntVars(scip) > 0) )
    {
       propdata->ofenabled = FALSE;
       propdata->symconsenabled = FALSE;
@@ -2781,9 +3893,17 @@ SCIP_RETCODE determineSymmetry(
    maxgenerators = propdata->maxgenerators;
    maxgenerators = MIN(maxgenerators, MAXGENNUMERATOR / nvars);
 
+   /* the search for generators must not exceed the remaining time of the solving process */
+   SCIP_CALL( SCIPgetRealParam(scip, "limits/time", &timelimit) );
+   if ( ! SCIPisInfinity(scip, timelimit) )
+      timelimit = MAX(timelimit - SCIPgetSolvingTime(scip), 0.0);
+   timelimit = MIN(timelimit, propdata->timelimit);
+
    /* actually compute (global) symmetry */
    SCIP_CALL( computeSymmetryGroup(scip, propdata->doubleequations, propdata->compresssymmetries, propdata->compressthreshold,
 	 maxgenerators, symspecrequirefixed, FALSE, propdata->checksymmetries, propdata->usecolumnsparsity, propdata->conshdlr_nonlinear,
+         propdata->cachegenerators && propdata->recomputerestart != SCIP_RECOMPUTESYM_NEVER ? &propdata->gencache : NULL,
+         strcmp(propdata->gencachefile, DEFAULT_GENCACHEFILE) != 0 ? propdata->gencachefile : NULL, timelimit,
          &propdata->npermvars, &propdata->nbinpermvars, &propdata->permvars, &propdata->nperms, &propdata->nmaxperms,
          &propdata->perms, &propdata->log10groupsize, &propdata->nmovedvars, &propdata->isnonlinvar,
          &propdata->binvaraffected, &propdata->compressed, &successful) );
@@ -2844,8 +3964,17 @@ SCIP_RETCODE determineSymmetry(
    }
    SCIPverbMessage(scip, SCIP_VERBLEVEL_HIGH, NULL, ")\n");
 
+   /* without symmetry on binary variables, only orbitopes on general integer variables can be handled by constraints */
+   if ( ! propdata->binvaraffected && propdata->intorbitopes && propdata->symconsenabled && isIntVarAffected(propdata) )
+   {
+      SCIPverbMessage(scip, SCIP_VERBLEVEL_HIGH, NULL,
+         "   (%.1fs) no symmetry on binary variables present, only handle orbitopes on general integer variables.\n",
+         SCIPgetSolvingTime(scip));
+
+      propdata->ofenabled = FALSE;
+   }
    /* exit if no binary variables are affected by symmetry and we cannot handle non-binary symmetries */
-   if ( ! propdata->binvaraffected )
+   else if ( ! propdata->binvaraffected )
    {
       SCIPverbMessage(scip, SCIP_VERBLEVEL_HIGH, NULL, "   (%.1fs) no symmetry on binary variables present.\n", SCIPgetSolvingTime(scip));
 
@@ -2858,13 +3987,17 @@ SCIP_RETCODE determineSymmetry(
       {
          propdata->sstenabled = FALSE;
 
-         SCIPverbMessage(scip, SCIP_VERBLEVEL_HIGH, NULL, "   (%.1fs) -> no handable symmetry found, free symmetry data.\n",
-            SCIPgetSolvingTime(scip));
+         /* symmetries on non-binary variables can still be used for pruning symmetric nodes */
+         if ( ! propdata->nodepruning )
+         {
+            SCIPverbMessage(scip, SCIP_VERBLEVEL_HIGH, NULL, "   (%.1fs) -> no handable symmetry found, free symmetry data.\n",
+               SCIPgetSolvingTime(scip));
 
-         /* free data and exit */
-         SCIP_CALL( freeSymmetryData(scip, propdata) );
+            /* free data and exit */
+            SCIP_CALL( freeSymmetryData(scip, propdata) );
 
-         return SCIP_OKAY;
+            return SCIP_OKAY;
+         }
       }
    }
 
@@ -2880,13 +4013,18 @@ SCIP_RETCODE determineSymmetry(
    SCIPverbMessage(scip, SCIP_VERBLEVEL_HIGH, NULL, "   (%.1fs) component computation started\n", SCIPgetSolvingTime(scip));
 #endif
 
-   /* we only need the components for orbital fixing, orbitope and subgroup detection, and Schreier Sims constraints */
+   /* we only need the components for orbital fixing, orbitope and subgroup detection, and Schreier Sims constraints;
+    * they are computed from the support of the generators, which is also stored for orbital fixing */
    if ( propdata->ofenabled || ( propdata->symconsenabled && propdata->detectorbitopes )
       || propdata->detectsubgroups || propdata->sstenabled )
    {
-      SCIP_CALL( SCIPcomputeComponentsSym(scip, propdata->perms, propdata->nperms, propdata->permvars,
-            propdata->npermvars, FALSE, &propdata->components, &propdata->componentbegins,
-            &propdata->vartocomponent, &propdata->componentblocked, &propdata->ncomponents) );
+      assert( propdata->supportbegins == NULL );
+      SCIP_CALL( SCIPcomputeSupportSym(scip, propdata->perms, propdata->nperms, propdata->npermvars, NULL,
+            &propdata->supportbegins, &propdata->supportperms, &propdata->supportimages, &propdata->nsupport) );
+
+      SCIP_CALL( SCIPcomputeComponentsSupportSym(scip, propdata->supportbegins, propdata->supportperms,
+            propdata->supportimages, propdata->nperms, propdata->npermvars, &propdata->components,
+            &propdata->componentbegins, &propdata->vartocomponent, &propdata->componentblocked, &propdata->ncomponents) );
    }
 
 #ifdef SCIP_OUTPUT_COMPONENT
@@ -2899,19 +4037,8 @@ SCIP_RETCODE determineSymmetry(
       int componentidx;
       int v;
 
-      /* transpose symmetries matrix here if necessary */
-      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->permstrans, propdata->npermvars) );
-      for (v = 0; v < propdata->npermvars; ++v)
-      {
-         SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(propdata->permstrans[v]), propdata->nmaxperms) );
-         for (p = 0; p < propdata->nperms; ++p)
-         {
-            if ( SCIPvarIsBinary(propdata->permvars[v]) || propdata->sstenabled )
-               propdata->permstrans[v][p] = propdata->perms[p][v];
-            else
-               propdata->permstrans[v][p] = v; /* ignore symmetry information on non-binary variables */
-         }
-      }
+      /* orbital fixing only visits the support of binary variables, which are mapped to binary variables */
+      assert( propdata->supportbegins != NULL );
 
       /* prepare array for active permutations */
       SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->inactiveperms, propdata->nperms) );
@@ -2968,21 +4095,17 @@ SCIP_RETCODE determineSymmetry(
       assert( propdata->nbg1 == 0 );
    }
 
-   /* set up data for Schreier Sims constraints or subgroup detection */
+   /* set up data for Schreier Sims constraints, which need the transposed permutations (subgroup detection and OF
+    * compute orbits from the original permutations and the sparse support, respectively) */
+   if ( propdata->sstenabled )
+   {
+      SCIP_CALL( createPermstrans(scip, propdata) );
+   }
+
    if ( (propdata->sstenabled || propdata->detectsubgroups) && ! propdata->ofenabled )
    {
       int v;
 
-      /* transpose symmetries matrix here if necessary */
-      assert( propdata->permstrans == NULL );
-      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->permstrans, propdata->npermvars) );
-      for (v = 0; v < propdata->npermvars; ++v)
-      {
-         SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(propdata->permstrans[v]), propdata->nmaxperms) );
-         for (p = 0; p < propdata->nperms; ++p)
-            propdata->permstrans[v][p] = propdata->perms[p][v];
-      }
-
       /* create hashmap for storing the indices of variables */
       assert( propdata->permvarmap == NULL );
       SCIP_CALL( SCIPhashmapCreate(&propdata->permvarmap, SCIPblkmem(scip), propdata->npermvars) );
@@ -3052,32 +4175,574 @@ SCIP_RETCODE determineSymmetry(
 
          if ( propdata->compressed )
          {
-            SCIP_CALL( SCIPmarkDoNotMultaggrVar(scip, propdata->permvars[j]) );
+            SCIP_CALL( SCIPmarkDoNotMultaggrVar(scip, propdata->permvars[j]) );
+         }
+         else
+         {
+            for (p = 0; p < propdata->nperms; ++p)
+            {
+               if ( propdata->perms[p][j] != j )
+               {
+                  SCIP_CALL( SCIPmarkDoNotMultaggrVar(scip, propdata->permvars[j]) );
+                  break;
+               }
+            }
+         }
+      }
+   }
+
+   /* prune symmetric nodes if no other symmetry handling method is active, since these might break the symmetry */
+   if ( propdata->nodepruning && ! propdata->ofenabled && ! propdata->symconsenabled && ! propdata->sstenabled
+      && SCIPallowStrongDualReds(scip) )
+   {
+      SCIP_CALL( setupNodePruning(scip, propdata) );
+   }
+
+   /* free original perms matrix if no symmetry constraints are added and symmetric nodes are not pruned */
+   if ( ! propdata->symconsenabled && ! propdata->sstenabled && ! propdata->nodepruningenabled )
+   {
+      for (p = 0; p < propdata->nperms; ++p)
+      {
+         SCIPfreeBlockMemoryArray(scip, &(propdata->perms)[p], propdata->npermvars);
+      }
+      SCIPfreeBlockMemoryArrayNull(scip, &propdata->perms, propdata->nmaxperms);
+   }
+
+   return SCIP_OKAY;
+}
+
+
+/*
+ * Detection of sub-symmetry structures of orbitopes
+ */
+
+/** gets the representation lhs <= vals^T vars <= rhs of a linear constraint in terms of active variables
+ *
+ *  A linear representation is available for the linear, setppc, knapsack, logicor and varbound constraint handlers.
+ *  For other constraints, @p success is set to FALSE and no arrays are allocated; otherwise, the buffer arrays
+ *  @p vars and @p vals have to be freed by the caller.
+ */
+static
+SCIP_RETCODE getSubsymLinearCons(
+   SCIP*                 scip,               /**< SCIP instance */
+   SCIP_CONS*            cons,               /**< constraint */
+   SCIP_VAR***           vars,               /**< pointer to store the buffer array of active variables */
+   SCIP_Real**           vals,               /**< pointer to store the buffer array of coefficients */
+   int*                  nvars,              /**< pointer to store the number of variables */
+   SCIP_Real*            lhs,                /**< pointer to store the left-hand side */
+   SCIP_Real*            rhs,                /**< pointer to store the right-hand side */
+   SCIP_Bool*            success             /**< pointer to store whether a linear representation is available */
+   )
+{
+   const char* conshdlrname;
+   SCIP_VAR** consvars;
+   SCIP_Real constant = 0.0;
+   int nconsvars;
+   int i;
+
+   assert( scip != NULL );
+   assert( cons != NULL );
+   assert( vars != NULL );
+   assert( vals != NULL );
+   assert( nvars != NULL );
+   assert( lhs != NULL );
+   assert( rhs != NULL );
+   assert( success != NULL );
+
+   *success = TRUE;
+   conshdlrname = SCIPconshdlrGetName(SCIPconsGetHdlr(cons));
+
+   if ( strcmp(conshdlrname, "linear") == 0 )
+   {
+      nconsvars = SCIPgetNVarsLinear(scip, cons);
+      consvars = SCIPgetVarsLinear(scip, cons);
+      *lhs = SCIPgetLhsLinear(scip, cons);
+      *rhs = SCIPgetRhsLinear(scip, cons);
+   }
+   else if ( strcmp(conshdlrname, "setppc") == 0 )
+   {
+      nconsvars = SCIPgetNVarsSetppc(scip, cons);
+      consvars = SCIPgetVarsSetppc(scip, cons);
+      *lhs = SCIPgetTypeSetppc(scip, cons) == SCIP_SETPPCTYPE_PACKING ? -SCIPinfinity(scip) : 1.0;
+      *rhs = SCIPgetTypeSetppc(scip, cons) == SCIP_SETPPCTYPE_COVERING ? SCIPinfinity(scip) : 1.0;
+   }
+   else if ( strcmp(conshdlrname, "knapsack") == 0 )
+   {
+      nconsvars = SCIPgetNVarsKnapsack(scip, cons);
+      consvars = SCIPgetVarsKnapsack(scip, cons);
+      *lhs = -SCIPinfinity(scip);
+      *rhs = (SCIP_Real) SCIPgetCapacityKnapsack(scip, cons);
+   }
+   else if ( strcmp(conshdlrname, "logicor") == 0 )
+   {
+      nconsvars = SCIPgetNVarsLogicor(scip, cons);
+      consvars = SCIPgetVarsLogicor(scip, cons);
+      *lhs = 1.0;
+      *rhs = SCIPinfinity(scip);
+   }
+   else if ( strcmp(conshdlrname, "varbound") == 0 )
+   {
+      nconsvars = 2;
+      consvars = NULL;
+      *lhs = SCIPgetLhsVarbound(scip, cons);
+      *rhs = SCIPgetRhsVarbound(scip, cons);
+   }
+   else
+   {
+      *success = FALSE;
+      return SCIP_OKAY;
+   }
+
+   *nvars = nconsvars;
+   SCIP_CALL( SCIPallocBufferArray(scip, vars, MAX(nconsvars, 1)) );
+   SCIP_CALL( SCIPallocBufferArray(scip, vals, MAX(nconsvars, 1)) );
+
+   if ( consvars == NULL )
+   {
+      (*vars)[0] = SCIPgetVarVarbound(scip, cons);
+      (*vals)[0] = 1.0;
+      (*vars)[1] = SCIPgetVbdvarVarbound(scip, cons);
+      (*vals)[1] = SCIPgetVbdcoefVarbound(scip, cons);
+   }
+   else
+   {
+      for (i = 0; i < nconsvars; ++i)
+      {
+         (*vars)[i] = consvars[i];
+         (*vals)[i] = 1.0;
+      }
+
+      if ( strcmp(conshdlrname, "linear") == 0 )
+      {
+         for (i = 0; i < nconsvars; ++i)
+            (*vals)[i] = SCIPgetValsLinear(scip, cons)[i];
+      }
+      else if ( strcmp(conshdlrname, "knapsack") == 0 )
+      {
+         for (i = 0; i < nconsvars; ++i)
+            (*vals)[i] = (SCIP_Real) SCIPgetWeightsKnapsack(scip, cons)[i];
+      }
+   }
+
+   SCIP_CALL( getActiveVariables(scip, vars, vals, nvars, &constant, SCIPconsIsTransformed(cons)) );
+
+   if ( ! SCIPisInfinity(scip, -*lhs) )
+      *lhs -= constant;
+   if ( ! SCIPisInfinity(scip, *rhs) )
+      *rhs -= constant;
+
+   return SCIP_OKAY;
+}
+
+/** checks whether a constraint without linear representation contains a variable of the orbitope */
+static
+SCIP_RETCODE subsymConsContainsOrbitopeVar(
+   SCIP*                 scip,               /**< SCIP instance */
+   SCIP_CONS*            cons,               /**< constraint */
+   SCIP_HASHMAP*         varmap,             /**< map from the variables of the orbitope to their positions */
+   SCIP_Bool*            contains            /**< pointer to store whether the constraint might contain a variable of the orbitope */
+   )
+{
+   SCIP_VAR** consvars;
+   SCIP_Bool success;
+   int nconsvars;
+   int i;
+
+   assert( scip != NULL );
+   assert( cons != NULL );
+   assert( varmap != NULL );
+   assert( contains != NULL );
+
+   *contains = TRUE;
+
+   SCIP_CALL( SCIPgetConsNVars(scip, cons, &nconsvars, &success) );
+   if ( ! success )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &consvars, MAX(nconsvars, 1)) );
+   SCIP_CALL( SCIPgetConsVars(scip, cons, consvars, nconsvars, &success) );
+
+   if ( success )
+   {
+      *contains = FALSE;
+      for (i = 0; i < nconsvars && ! *contains; ++i)
+      {
+         SCIP_VAR* var = SCIPvarGetProbvar(consvars[i]);
+
+         if ( var != NULL && SCIPhashmapExists(varmap, (void*) var) )
+            *contains = TRUE;
+      }
+   }
+
+   SCIPfreeBufferArray(scip, &consvars);
+
+   return SCIP_OKAY;
+}
+
+/** frees the data of a detected sub-symmetry structure */
+static
+void freeSubsymData(
+   SCIP*                 scip,               /**< SCIP instance */
+   SUBSYMDATA*           subsymdata          /**< detected sub-symmetry structure */
+   )
+{
+   int r;
+
+   assert( scip != NULL );
+   assert( subsymdata != NULL );
+
+   if ( subsymdata->adjacencies != NULL )
+   {
+      for (r = subsymdata->nrows - 1; r >= 0; --r)
+      {
+         SCIPfreeBlockMemoryArrayNull(scip, &subsymdata->adjacencies[r], MAX(subsymdata->nadjacencies[r], 1));
+      }
+      SCIPfreeBlockMemoryArray(scip, &subsymdata->adjacencies, subsymdata->nrows);
+      SCIPfreeBlockMemoryArray(scip, &subsymdata->nadjacencies, subsymdata->nrows);
+   }
+   SCIPfreeBlockMemoryArrayNull(scip, &subsymdata->weights, subsymdata->nrows);
+
+   subsymdata->type = SUBSYMTYPE_NONE;
+}
+
+/** detects whether the constraints containing the variables of an orbitope give rise to sub-symmetries that can be
+ *  handled by one of the activation handlers
+ *
+ *  Every constraint that contains a variable of the orbitope has to be either a row constraint, which contains all
+ *  variables of one row with the same coefficient (and is thus invariant under permuting the columns), or a column
+ *  constraint, which only contains variables of one column. The structure is then given by the column constraints:
+ *  - if every column is a knapsack over all rows with the same weights, the makespan activation handler applies, since
+ *    columns with equal (fixed) weight in the first rows can be permuted in the remaining rows;
+ *  - if the column constraints are set packings that encode the edges of the same conflict graph in every column, the
+ *    colorcomp activation handler applies.
+ *
+ *  Both activation handlers return packing submatrices, so a structure is only detected if every row of the orbitope
+ *  is a set packing or set partitioning row constraint; otherwise, the orbitope is only handled as a full orbitope.
+ *  Only structures whose activation handler has been included are detected.
+ */
+static
+SCIP_RETCODE detectSubsymmetryStructure(
+   SCIP*                 scip,               /**< SCIP instance */
+   SCIP_PROPDATA*        propdata,           /**< data of symmetry propagator */
+   SCIP_VAR***           vars,               /**< variable matrix of the orbitope */
+   int                   nrows,              /**< number of rows of the orbitope */
+   int                   ncols,              /**< number of columns of the orbitope */
+   SUBSYMDATA*           subsymdata          /**< pointer to store the detected structure */
+   )
+{
+   SCIP_HASHMAP* varmap;
+   SCIP_HASHSET** edges;
+   SCIP_CONS** conss;
+   SCIP_Real* knapsackweights;
+   SCIP_Shortbool* packingrows;
+   int* nknapsacks;
+   SCIP_Bool usemakespan;
+   SCIP_Bool usecolorcomp;
+   SCIP_Bool valid = TRUE;
+   int nconss;
+   int c;
+   int r;
+   int i;
+
+   assert( scip != NULL );
+   assert( propdata != NULL );
+   assert( vars != NULL );
+   assert( nrows > 0 );
+   assert( ncols > 0 );
+   assert( subsymdata != NULL );
+
+   subsymdata->type = SUBSYMTYPE_NONE;
+   subsymdata->weights = NULL;
+   subsymdata->adjacencies = NULL;
+   subsymdata->nadjacencies = NULL;
+   subsymdata->nrows = nrows;
+
+   usemakespan = SCIPfindActivationhdlr(scip, "makespan") != NULL;
+   usecolorcomp = SCIPfindActivationhdlr(scip, "colorcomp") != NULL;
+
+   if ( ! propdata->detectsubsym || ncols < 2 || (! usemakespan && ! usecolorcomp) )
+      return SCIP_OKAY;
+
+   /* map the variables of the orbitope to their position in the matrix */
+   SCIP_CALL( SCIPhashmapCreate(&varmap, SCIPblkmem(scip), nrows * ncols) );
+   for (r = 0; r < nrows; ++r)
+   {
+      for (c = 0; c < ncols; ++c)
+      {
+         SCIP_CALL( SCIPhashmapInsertInt(varmap, (void*) vars[r][c], r * ncols + c) );
+      }
+   }
+
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &nknapsacks, ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &knapsackweights, nrows * ncols) );
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &packingrows, nrows) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &edges, ncols) );
+   for (c = 0; c < ncols; ++c)
+   {
+      SCIP_CALL( SCIPhashsetCreate(&edges[c], SCIPblkmem(scip), nrows) );
+   }
+
+   conss = SCIPgetConss(scip);
+   nconss = SCIPgetNConss(scip);
+
+   for (i = 0; i < nconss && valid; ++i)
+   {
+      const char* conshdlrname;
+      SCIP_VAR** consvars;
+      SCIP_Real* consvals;
+      SCIP_Real lhs;
+      SCIP_Real rhs;
+      SCIP_Real firstval = 0.0;
+      SCIP_Bool singlerow = TRUE;
+      SCIP_Bool singlecol = TRUE;
+      SCIP_Bool equalvals = TRUE;
+      SCIP_Bool othervars = FALSE;
+      SCIP_Bool success;
+      int nconsvars;
+      int norbvars = 0;
+      int row = -1;
+      int col = -1;
+      int v;
+
+      if ( ! SCIPconsIsActive(conss[i]) )
+         continue;
+
+      /* symmetry handling constraints do not restrict the symmetries */
+      conshdlrname = SCIPconshdlrGetName(SCIPconsGetHdlr(conss[i]));
+      if ( strcmp(conshdlrname, "orbitope") == 0 || strcmp(conshdlrname, "orbisack") == 0
+         || strcmp(conshdlrname, "symresack") == 0 )
+         continue;
+
+      SCIP_CALL( getSubsymLinearCons(scip, conss[i], &consvars, &consvals, &nconsvars, &lhs, &rhs, &success) );
+
+      if ( ! success )
+      {
+         SCIP_Bool contains;
+
+         SCIP_CALL( subsymConsContainsOrbitopeVar(scip, conss[i], varmap, &contains) );
+         valid = ! contains;
+         continue;
+      }
+
+      for (v = 0; v < nconsvars; ++v)
+      {
+         int idx;
+
+         if ( SCIPisZero(scip, consvals[v]) )
+            continue;
+
+         idx = SCIPhashmapGetImageInt(varmap, (void*) consvars[v]);
+         if ( idx == INT_MAX )
+         {
+            othervars = TRUE;
+            continue;
+         }
+
+         if ( norbvars == 0 )
+         {
+            row = idx / ncols;
+            col = idx % ncols;
+            firstval = consvals[v];
+         }
+         else
+         {
+            singlerow = singlerow && idx / ncols == row;
+            singlecol = singlecol && idx % ncols == col;
+            equalvals = equalvals && SCIPisEQ(scip, consvals[v], firstval);
+         }
+         ++norbvars;
+      }
+
+      /* row constraints are invariant under permutations of the columns */
+      if ( norbvars == 0 || (singlerow && norbvars == ncols && equalvals) )
+      {
+         /* check whether the row constraint implies that at most one variable of the row is 1 */
+         if ( norbvars > 0 && ! othervars )
+         {
+            if ( SCIPisPositive(scip, firstval) && SCIPisEQ(scip, rhs, firstval) )
+               packingrows[row] = TRUE;
+            else if ( SCIPisNegative(scip, firstval) && SCIPisEQ(scip, lhs, firstval) )
+               packingrows[row] = TRUE;
+         }
+
+         SCIPfreeBufferArray(scip, &consvals);
+         SCIPfreeBufferArray(scip, &consvars);
+         continue;
+      }
+
+      /* bring column constraint into the form vals^T vars <= rhs */
+      if ( SCIPisInfinity(scip, rhs) && ! SCIPisInfinity(scip, -lhs) )
+      {
+         for (v = 0; v < nconsvars; ++v)
+            consvals[v] = -consvals[v];
+         rhs = -lhs;
+         lhs = -SCIPinfinity(scip);
+      }
+
+      valid = singlecol && ! othervars && norbvars >= 2 && SCIPisInfinity(scip, -lhs) && ! SCIPisInfinity(scip, rhs);
+      for (v = 0; v < nconsvars && valid; ++v)
+         valid = SCIPisPositive(scip, consvals[v]) && SCIPisIntegral(scip, consvals[v]);
+
+      if ( valid && norbvars == nrows )
+      {
+         /* knapsack over the whole column */
+         for (v = 0; v < nconsvars; ++v)
+         {
+            r = SCIPhashmapGetImageInt(varmap, (void*) consvars[v]) / ncols;
+            knapsackweights[col * nrows + r] = consvals[v];
+         }
+         ++nknapsacks[col];
+      }
+      else if ( valid && equalvals && SCIPisEQ(scip, consvals[0], 1.0) && SCIPisEQ(scip, rhs, 1.0) )
+      {
+         int w;
+
+         /* set packing: all pairs of its rows are in conflict */
+         for (v = 0; v < nconsvars; ++v)
+         {
+            for (w = v + 1; w < nconsvars; ++w)
+            {
+               size_t r1 = (size_t) SCIPhashmapGetImageInt(varmap, (void*) consvars[v]) / ncols;
+               size_t r2 = (size_t) SCIPhashmapGetImageInt(varmap, (void*) consvars[w]) / ncols;
+
+               SCIP_CALL( SCIPhashsetInsert(edges[col], SCIPblkmem(scip),
+                     (void*) (MIN(r1, r2) * nrows + MAX(r1, r2) + 1)) );
+            }
+         }
+      }
+      else
+         valid = FALSE;
+
+      SCIPfreeBufferArray(scip, &consvals);
+      SCIPfreeBufferArray(scip, &consvars);
+   }
+
+   /* the submatrices of the activation handlers are only valid if all rows are set packings or partitionings */
+   for (r = 0; r < nrows && valid; ++r)
+      valid = packingrows[r];
+
+   /* check whether all columns are knapsacks with the same weights */
+   usemakespan = usemakespan && valid;
+   for (c = 0; c < ncols && usemakespan; ++c)
+   {
+      usemakespan = nknapsacks[c] == 1 && SCIPhashsetGetNElements(edges[c]) == 0;
+      for (r = 0; r < nrows && usemakespan; ++r)
+      {
+         usemakespan = SCIPisEQ(scip, knapsackweights[c * nrows + r], knapsackweights[r])
+            && knapsackweights[r] <= (SCIP_Real) INT_MAX;
+      }
+   }
+
+   /* check whether all columns contain the edges of the same conflict graph */
+   usecolorcomp = usecolorcomp && valid && ! usemakespan && SCIPhashsetGetNElements(edges[0]) > 0;
+   for (c = 0; c < ncols && usecolorcomp; ++c)
+   {
+      void** slots = SCIPhashsetGetSlots(edges[c]);
+      int nslots = SCIPhashsetGetNSlots(edges[c]);
+
+      usecolorcomp = nknapsacks[c] == 0 && SCIPhashsetGetNElements(edges[c]) == SCIPhashsetGetNElements(edges[0]);
+      for (i = 0; i < nslots && usecolorcomp; ++i)
+         usecolorcomp = slots[i] == NULL || SCIPhashsetExists(edges[0], slots[i]);
+   }
+
+   if ( usemakespan )
+   {
+      subsymdata->type = SUBSYMTYPE_MAKESPAN;
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &subsymdata->weights, nrows) );
+      for (r = 0; r < nrows; ++r)
+         subsymdata->weights[r] = (int) SCIPround(scip, knapsackweights[r]);
+   }
+   else if ( usecolorcomp )
+   {
+      void** slots = SCIPhashsetGetSlots(edges[0]);
+      int nslots = SCIPhashsetGetNSlots(edges[0]);
+      int* sizes;
+
+      subsymdata->type = SUBSYMTYPE_COLORCOMP;
+      SCIP_CALL( SCIPallocClearBlockMemoryArray(scip, &subsymdata->nadjacencies, nrows) );
+      SCIP_CALL( SCIPallocClearBlockMemoryArray(scip, &subsymdata->adjacencies, nrows) );
+      SCIP_CALL( SCIPallocClearBufferArray(scip, &sizes, nrows) );
+
+      for (i = 0; i < nslots; ++i)
+      {
+         if ( slots[i] != NULL )
+         {
+            ++sizes[((size_t) slots[i] - 1) / nrows];
+            ++sizes[((size_t) slots[i] - 1) % nrows];
          }
-         else
+      }
+
+      /* the activation handler duplicates the adjacency arrays, so also isolated vertices need a (non-NULL) array */
+      for (r = 0; r < nrows; ++r)
+      {
+         SCIP_CALL( SCIPallocBlockMemoryArray(scip, &subsymdata->adjacencies[r], MAX(sizes[r], 1)) );
+      }
+
+      for (i = 0; i < nslots; ++i)
+      {
+         if ( slots[i] != NULL )
          {
-            for (p = 0; p < propdata->nperms; ++p)
-            {
-               if ( propdata->perms[p][j] != j )
-               {
-                  SCIP_CALL( SCIPmarkDoNotMultaggrVar(scip, propdata->permvars[j]) );
-                  break;
-               }
-            }
+            int r1 = (int) (((size_t) slots[i] - 1) / nrows);
+            int r2 = (int) (((size_t) slots[i] - 1) % nrows);
+
+            subsymdata->adjacencies[r1][subsymdata->nadjacencies[r1]++] = r2;
+            subsymdata->adjacencies[r2][subsymdata->nadjacencies[r2]++] = r1;
          }
       }
+
+      SCIPfreeBufferArray(scip, &sizes);
    }
 
-   /* free original perms matrix if no symmetry constraints are added */
-   if ( ! propdata->symconsenabled && ! propdata->sstenabled )
+   for (c = ncols - 1; c >= 0; --c)
+      SCIPhashsetFree(&edges[c], SCIPblkmem(scip));
+   SCIPfreeBufferArray(scip, &edges);
+   SCIPfreeBufferArray(scip, &packingrows);
+   SCIPfreeBufferArray(scip, &knapsackweights);
+   SCIPfreeBufferArray(scip, &nknapsacks);
+   SCIPhashmapFree(&varmap);
+
+   return SCIP_OKAY;
+}
+
+/** lets the activation handler of a detected sub-symmetry structure handle the sub-symmetries of an orbitope */
+static
+SCIP_RETCODE registerSubsymmetryActivation(
+   SCIP*                 scip,               /**< SCIP instance */
+   SCIP_PROPDATA*        propdata,           /**< data of symmetry propagator */
+   SCIP_CONS*            cons,               /**< orbitope constraint */
+   SCIP_VAR***           vars,               /**< variable matrix of the orbitope */
+   int                   nrows,              /**< number of rows of the orbitope */
+   int                   ncols,              /**< number of columns of the orbitope */
+   SUBSYMDATA*           subsymdata          /**< detected sub-symmetry structure */
+   )
+{
+   assert( scip != NULL );
+   assert( propdata != NULL );
+   assert( cons != NULL );
+   assert( subsymdata != NULL );
+
+   switch ( subsymdata->type )
    {
-      for (p = 0; p < propdata->nperms; ++p)
-      {
-         SCIPfreeBlockMemoryArray(scip, &(propdata->perms)[p], propdata->npermvars);
-      }
-      SCIPfreeBlockMemoryArrayNull(scip, &propdata->perms, propdata->nmaxperms);
+   case SUBSYMTYPE_NONE:
+      return SCIP_OKAY;
+   case SUBSYMTYPE_MAKESPAN:
+      SCIP_CALL( SCIPregisterConsActivationMakespan(scip, cons, vars, subsymdata->weights, ncols, nrows) );
+      break;
+   case SUBSYMTYPE_COLORCOMP:
+      SCIP_CALL( SCIPregisterConsActivationColorComp(scip, cons, vars, nrows, ncols, subsymdata->adjacencies,
+            subsymdata->nadjacencies, TRUE, 0) );
+      break;
+   default:
+      SCIPerrorMessage("unknown sub-symmetry structure %d\n", subsymdata->type);
+      return SCIP_ERROR;
    }
 
+   ++propdata->nsubsymorbitopes;
+
+   SCIPverbMessage(scip, SCIP_VERBLEVEL_HIGH, NULL, "   (%.1fs) sub-symmetries of orbitope <%s> (%d x %d) are handled by activation handler <%s>\n",
+      SCIPgetSolvingTime(scip), SCIPconsGetName(cons), nrows, ncols,
+      subsymdata->type == SUBSYMTYPE_MAKESPAN ? "makespan" : "colorcomp");
+
    return SCIP_OKAY;
 }
 
@@ -3653,6 +5318,7 @@ SCIP_RETCODE addOrbitopeSubgroup(
 {  /*lint --e{571}*/
    char name[SCIP_MAXSTRLEN];
    SCIP_VAR*** orbitopevarmatrix;
+   SUBSYMDATA subsymdata;
    SCIP_Shortbool* activevars;
    int** orbitopevaridx;
    int* columnorder;
@@ -3816,6 +5482,8 @@ SCIP_RETCODE addOrbitopeSubgroup(
 
    (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "suborbitope_%d_%d", graphcoloridx, propdata->norbitopes);
 
+   SCIP_CALL( detectSubsymmetryStructure(scip, propdata, orbitopevarmatrix, nrows, ngencols, &subsymdata) );
+
    SCIP_CALL( SCIPcreateConsOrbitope(scip, &cons, name, orbitopevarmatrix,
          SCIP_ORBITOPETYPE_FULL, nrows, ngencols, FALSE, mayinteract, FALSE, FALSE, propdata->conssaddlp,
          TRUE, FALSE, TRUE, TRUE, FALSE, FALSE, FALSE, FALSE, FALSE) );
@@ -3823,6 +5491,9 @@ SCIP_RETCODE addOrbitopeSubgroup(
    SCIP_CALL( SCIPaddCons(scip, cons) );
    *success = TRUE;
 
+   SCIP_CALL( registerSubsymmetryActivation(scip, propdata, cons, orbitopevarmatrix, nrows, ngencols, &subsymdata) );
+   freeSubsymData(scip, &subsymdata);
+
    /* do not release constraint here - will be done later */
    propdata->genorbconss[propdata->ngenorbconss++] = cons;
    ++propdata->norbitopes;
@@ -4012,8 +5683,9 @@ SCIP_RETCODE addWeakSBCsSubgroup(
          usedvars[graphcomponents[k]] = TRUE;
       }
 
+      assert( propdata->perms != NULL );
       SCIP_CALL( SCIPcomputeOrbitVar(scip, propdata->npermvars, propdata->perms,
-            propdata->permstrans, propdata->components, propdata->componentbegins,
+            NULL, propdata->components, propdata->componentbegins,
             usedvars, varfound, firstvaridxpercolor[j],symgrpcompidx,
             orbit[activeorb], &orbitsize[activeorb]) );
 
@@ -4763,7 +6435,8 @@ SCIP_RETCODE detectAndHandleSubgroups(
    }
 
 #ifdef SCIP_DEBUG
-   SCIPdebugMsg(scip, "total number of added (sub-)orbitopes: %d\n", norbitopes);
+   SCIPdebugMsg(scip, "total number of added (sub-)orbitopes: %d (sub-symmetries handled for %d orbitopes)\n", norbitopes,
+      propdata->nsubsymorbitopes);
    SCIPdebugMsg(scip, "total number of added strong sbcs: %d\n", nstrongsbcs);
    SCIPdebugMsg(scip, "total number of added weak sbcs: %d\n", nweaksbcs);
 #endif
@@ -4871,6 +6544,104 @@ SCIP_RETCODE SCIPsortOrbitope(
 }
 
 
+/** stores an orbitope on general integer variables, which is handled by orbitopal reduction in the propagator
+ *
+ *  The orbitope is only stored if all its variables are integral, because orbitopal reduction relies on integral
+ *  domains.
+ */
+static
+SCIP_RETCODE addIntOrbitope(
+   SCIP*                 scip,               /**< SCIP instance */
+   SCIP_PROPDATA*        propdata,           /**< pointer to data of symmetry propagator */
+   int                   componentidx,       /**< index of component of the orbitope */
+   int**                 orbitopevaridx,     /**< variable index matrix of orbitope */
+   int*                  columnorder,        /**< permutation to reorder columns of orbitopevaridx */
+   int*                  nusedelems,         /**< array storing how often an element was used in the orbitope */
+   int                   nrows,              /**< number of rows of orbitope */
+   int                   ncols               /**< number of columns of orbitope */
+   )
+{
+   SCIP_VAR*** vars;
+   SCIP_VAR*** varsallocorder;
+   SCIP_Bool infeasibleorbitope = FALSE;
+   int i;
+   int j;
+
+   assert( scip != NULL );
+   assert( propdata != NULL );
+   assert( propdata->intorbitopes );
+   assert( orbitopevaridx != NULL );
+   assert( nrows > 0 );
+   assert( ncols > 0 );
+
+   for (i = 0; i < nrows; ++i)
+   {
+      for (j = 0; j < ncols; ++j)
+      {
+         if ( ! SCIPvarIsIntegral(propdata->permvars[orbitopevaridx[i][j]]) )
+            return SCIP_OKAY;
+      }
+   }
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &vars, nrows) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &varsallocorder, nrows) );
+   for (i = 0; i < nrows; ++i)
+   {
+      SCIP_CALL( SCIPallocBufferArray(scip, &vars[i], ncols) ); /*lint !e866*/
+      varsallocorder[i] = vars[i]; /* to ensure that we can free the buffer in reverse order */
+   }
+
+   SCIP_CALL( SCIPgenerateOrbitopeVarsMatrix(scip, &vars, nrows, ncols, propdata->permvars, propdata->npermvars,
+         orbitopevaridx, columnorder, nusedelems, NULL, &infeasibleorbitope, FALSE, NULL, NULL, NULL) );
+
+   if ( ! infeasibleorbitope )
+   {
+      SCIP_VAR** orbitopevars;
+
+      SCIPdebugMsg(scip, "found an orbitope on general integer variables of size %d x %d in component %d\n",
+         nrows, ncols, componentidx);
+
+      /* to ensure same orbitope is added if different sets of generators are found */
+      SCIP_CALL( SCIPsortOrbitope(scip, orbitopevaridx, vars, nrows, ncols) );
+
+      if ( propdata->intorbitopevars == NULL )
+      {
+         propdata->maxnintorbitopes = propdata->ncomponents;
+         SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->intorbitopevars, propdata->maxnintorbitopes) );
+         SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->intorbitopenrows, propdata->maxnintorbitopes) );
+         SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->intorbitopencols, propdata->maxnintorbitopes) );
+      }
+      assert( propdata->nintorbitopes < propdata->maxnintorbitopes );
+
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &orbitopevars, nrows * ncols) );
+      for (i = 0; i < nrows; ++i)
+      {
+         for (j = 0; j < ncols; ++j)
+         {
+            orbitopevars[i * ncols + j] = vars[i][j];
+            SCIP_CALL( SCIPcaptureVar(scip, vars[i][j]) );
+         }
+      }
+
+      propdata->intorbitopevars[propdata->nintorbitopes] = orbitopevars;
+      propdata->intorbitopenrows[propdata->nintorbitopes] = nrows;
+      propdata->intorbitopencols[propdata->nintorbitopes] = ncols;
+      ++propdata->nintorbitopes;
+
+      propdata->componentblocked[componentidx] |= SYM_HANDLETYPE_SYMBREAK;
+   }
+
+   for (i = nrows - 1; i >= 0; --i)
+   {
+      SCIPfreeBufferArray(scip, &varsallocorder[i]);
+   }
+   SCIPfreeBufferArray(scip, &varsallocorder);
+   SCIPfreeBufferArray(scip, &vars);
+
+   return SCIP_OKAY;
+}
+
+
 /** checks whether components of the symmetry group can be completely handled by orbitopes */
 static
 SCIP_RETCODE detectOrbitopes(
@@ -4903,8 +6674,8 @@ SCIP_RETCODE detectOrbitopes(
    assert( propdata->npermvars >= 0 );
    assert( propdata->permvars != NULL );
 
-   /* exit if no symmetry on binary variables is present */
-   if ( propdata->nbinpermvars == 0 )
+   /* exit if no symmetry on binary variables is present and orbitopes on general integer variables are not handled */
+   if ( propdata->nbinpermvars == 0 && ! propdata->intorbitopes )
    {
       assert( ! propdata->binvaraffected );
       return SCIP_OKAY;
@@ -4958,8 +6729,8 @@ SCIP_RETCODE detectOrbitopes(
             ntwocyclescomp = ntwocyclesperm;
             nbincyclescomp = nbincyclesperm;
 
-            /* if there are no binary rows */
-            if ( nbincyclescomp == 0 )
+            /* if there are no binary rows and orbitopes on general integer variables are not handled */
+            if ( nbincyclescomp == 0 && ! propdata->intorbitopes )
             {
                isorbitope = FALSE;
                break;
@@ -5009,6 +6780,14 @@ SCIP_RETCODE detectOrbitopes(
       if ( ! isorbitope )
          goto FREEDATASTRUCTURES;
 
+      /* orbitopes without binary rows are handled by orbitopal reduction for general integer variables */
+      if ( nbincyclescomp == 0 )
+      {
+         SCIP_CALL( addIntOrbitope(scip, propdata, i, orbitopevaridx, columnorder, nusedelems, ntwocyclescomp,
+               npermsincomponent + 1) );
+         goto FREEDATASTRUCTURES;
+      }
+
       /* we have found a potential orbitope, prepare data for orbitope conshdlr */
       SCIP_CALL( SCIPallocBufferArray(scip, &vars, nbincyclescomp) );
       SCIP_CALL( SCIPallocBufferArray(scip, &varsallocorder, nbincyclescomp) );
@@ -5032,6 +6811,7 @@ SCIP_RETCODE detectOrbitopes(
       if ( ! infeasibleorbitope )
       {
          char name[SCIP_MAXSTRLEN];
+         SUBSYMDATA subsymdata;
 
          SCIPdebugMsg(scip, "found an orbitope of size %d x %d in component %d\n", ntwocyclescomp, npermsincomponent + 1, i);
 
@@ -5040,12 +6820,19 @@ SCIP_RETCODE detectOrbitopes(
          /* to ensure same orbitope is added if different sets of generators are found */
          SCIP_CALL( SCIPsortOrbitope(scip, orbitopevaridx, vars, nbincyclescomp, npermsincomponent + 1) );
 
+         /* the rows of submatrices of activation handlers refer to the static row order of the orbitope */
+         SCIP_CALL( detectSubsymmetryStructure(scip, propdata, vars, nbincyclescomp, npermsincomponent + 1, &subsymdata) );
+
          SCIP_CALL( SCIPcreateConsOrbitope(scip, &cons, name, vars, SCIP_ORBITOPETYPE_FULL,
-               nbincyclescomp, npermsincomponent + 1, propdata->usedynamicprop, FALSE, FALSE, FALSE,
-               propdata->conssaddlp, TRUE, FALSE, TRUE, TRUE, FALSE, FALSE, FALSE, FALSE, FALSE) );
+               nbincyclescomp, npermsincomponent + 1, propdata->usedynamicprop && subsymdata.type == SUBSYMTYPE_NONE,
+               FALSE, FALSE, FALSE, propdata->conssaddlp, TRUE, FALSE, TRUE, TRUE, FALSE, FALSE, FALSE, FALSE, FALSE) );
 
          SCIP_CALL( SCIPaddCons(scip, cons) );
 
+         SCIP_CALL( registerSubsymmetryActivation(scip, propdata, cons, vars, nbincyclescomp, npermsincomponent + 1,
+               &subsymdata) );
+         freeSubsymData(scip, &subsymdata);
+
          /* do not release constraint here - will be done later */
          propdata->genorbconss[propdata->ngenorbconss++] = cons;
          ++propdata->norbitopes;
@@ -5382,7 +7169,101 @@ SCIP_RETCODE freeConflictGraphSST(
 }
 
 
-/** adds symresack constraints */
+/** sets up the data of lexicographic reduction, which propagates the symresacks of the given permutations in one pass
+ *
+ *  For each pair of a binary variable moved by a permutation and its preimage, we store the pairs sorted by variables
+ *  (for the shared pass over the variable order) and sorted by permutations (to peek ahead within one symresack).
+ */
+static
+SCIP_RETCODE setupLexReduction(
+   SCIP*                 scip,               /**< SCIP instance */
+   SCIP_PROPDATA*        propdata,           /**< data of symmetry propagator */
+   int*                  lexperms,           /**< indices of permutations whose symresacks are propagated */
+   int                   nlexperms           /**< number of permutations whose symresacks are propagated */
+   )
+{
+   SCIP_Shortbool* ignorevars;
+   int** invperms;
+   int* permpos;
+   int npermvars;
+   int i;
+   int p;
+
+   assert( scip != NULL );
+   assert( propdata != NULL );
+   assert( propdata->lexsupportbegins == NULL );
+   assert( lexperms != NULL );
+   assert( nlexperms > 0 );
+
+   npermvars = propdata->npermvars;
+
+   /* symresacks propagate x >= perm(x), i.e., they compare variable i with the preimage of i */
+   SCIP_CALL( SCIPallocBufferArray(scip, &invperms, nlexperms) );
+   for (p = 0; p < nlexperms; ++p)
+   {
+      int* perm;
+
+      perm = propdata->perms[lexperms[p]];
+      SCIP_CALL( SCIPallocBufferArray(scip, &invperms[p], npermvars) );
+      for (i = 0; i < npermvars; ++i)
+         invperms[p][perm[i]] = i;
+   }
+
+   /* symresacks only act on binary variables */
+   SCIP_CALL( SCIPallocBufferArray(scip, &ignorevars, npermvars) );
+   for (i = 0; i < npermvars; ++i)
+      ignorevars[i] = ! SCIPvarIsBinary(propdata->permvars[i]);
+
+   SCIP_CALL( SCIPcomputeSupportSym(scip, invperms, nlexperms, npermvars, ignorevars, &propdata->lexsupportbegins,
+         &propdata->lexsupportperms, &propdata->lexsupportimages, &propdata->nlexpairs) );
+
+   SCIPfreeBufferArray(scip, &ignorevars);
+   for (p = nlexperms - 1; p >= 0; --p)
+   {
+      SCIPfreeBufferArray(scip, &invperms[p]);
+   }
+   SCIPfreeBufferArray(scip, &invperms);
+
+   /* transpose the pairs such that they are sorted by permutations */
+   SCIP_CALL( SCIPallocClearBlockMemoryArray(scip, &propdata->lexpermbegins, nlexperms + 1) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->lexpermvars, MAX(propdata->nlexpairs, 1)) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->lexpermpreimages, MAX(propdata->nlexpairs, 1)) );
+
+   for (i = 0; i < propdata->nlexpairs; ++i)
+      ++propdata->lexpermbegins[propdata->lexsupportperms[i] + 1];
+   for (p = 0; p < nlexperms; ++p)
+      propdata->lexpermbegins[p + 1] += propdata->lexpermbegins[p];
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &permpos, nlexperms) );
+   for (p = 0; p < nlexperms; ++p)
+      permpos[p] = propdata->lexpermbegins[p];
+
+   for (i = 0; i < npermvars; ++i)
+   {
+      int j;
+
+      for (j = propdata->lexsupportbegins[i]; j < propdata->lexsupportbegins[i + 1]; ++j)
+      {
+         int pos;
+
+         pos = permpos[propdata->lexsupportperms[j]]++;
+         propdata->lexpermvars[pos] = i;
+         propdata->lexpermpreimages[pos] = propdata->lexsupportimages[j];
+      }
+   }
+   SCIPfreeBufferArray(scip, &permpos);
+
+   propdata->nlexperms = nlexperms;
+
+   return SCIP_OKAY;
+}
+
+
+/** adds symresack constraints
+ *
+ *  If lexicographic reduction is enabled, the symresacks are not added as constraints, but propagated by the
+ *  propagator in one shared pass.
+ */
 static
 SCIP_RETCODE addSymresackConss(
    SCIP*                 scip,               /**< SCIP instance */
@@ -5398,6 +7279,9 @@ SCIP_RETCODE addSymresackConss(
    int** modifiedperms = NULL;
    SCIP_VAR** modifiedpermvars = NULL;
    int** perms;
+   int* lexperms = NULL;
+   SCIP_Bool uselexreduction;
+   int nlexperms = 0;
    int nsymresackcons = 0;
    int npermvars;
    int nperms;
@@ -5429,6 +7313,13 @@ SCIP_RETCODE addSymresackConss(
    assert( permvars != NULL );
    assert( npermvars > 0 );
 
+   /* lexicographic reduction propagates w.r.t. the natural variable order */
+   uselexreduction = propdata->lexreduction && ! (propdata->nleaders > 0 && ISSSTBINACTIVE(propdata->sstleadervartype));
+   if ( uselexreduction )
+   {
+      SCIP_CALL( SCIPallocBufferArray(scip, &lexperms, nperms) );
+   }
+
    /* adapt natural variable order to a variable order that is compatible with Schreier Sims constraints */
    if ( propdata->nleaders > 0 && ISSSTBINACTIVE(propdata->sstleadervartype) )
    {
@@ -5459,6 +7350,12 @@ SCIP_RETCODE addSymresackConss(
          SCIP_CONS* cons;
          char name[SCIP_MAXSTRLEN];
 
+         if ( uselexreduction )
+         {
+            lexperms[nlexperms++] = p;
+            continue;
+         }
+
          (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "symbreakcons_perm%d", p);
 
          SCIP_CALL( SCIPcreateSymbreakCons(scip, &cons, name, perms[p], permvars, npermvars, FALSE,
@@ -5498,6 +7395,13 @@ SCIP_RETCODE addSymresackConss(
             char name[SCIP_MAXSTRLEN];
 
             permidx = components[p];
+            propdata->componentblocked[i] |= SYM_HANDLETYPE_SYMBREAK;
+
+            if ( uselexreduction )
+            {
+               lexperms[nlexperms++] = permidx;
+               continue;
+            }
 
             (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "symbreakcons_component%d_perm%d", i, permidx);
 
@@ -5516,7 +7420,6 @@ SCIP_RETCODE addSymresackConss(
                SCIP_CALL( SCIPcreateSymbreakCons(scip, &cons, name, perms[permidx], permvars, npermvars, FALSE,
                      conssaddlp, TRUE, FALSE, TRUE, TRUE, FALSE, FALSE, FALSE, FALSE, FALSE) );
             }
-            propdata->componentblocked[i] |= SYM_HANDLETYPE_SYMBREAK;
             SCIP_CALL( SCIPaddCons(scip, cons) );
 
             /* do not release constraint here - will be done later */
@@ -5540,6 +7443,19 @@ SCIP_RETCODE addSymresackConss(
       SCIPfreeBufferArray(scip, &modifiedperms);
    }
 
+   if ( uselexreduction )
+   {
+      if ( nlexperms > 0 )
+      {
+         SCIP_CALL( setupLexReduction(scip, propdata, lexperms, nlexperms) );
+
+         SCIPverbMessage(scip, SCIP_VERBLEVEL_HIGH, NULL,
+            "   (%.1fs) lexicographic reduction propagates symresacks of %d permutations\n",
+            SCIPgetSolvingTime(scip), nlexperms);
+      }
+      SCIPfreeBufferArray(scip, &lexperms);
+   }
+
    SCIPdebugMsg(scip, "Added %d symresack constraints.\n", nsymresackcons);
 
    return SCIP_OKAY;
@@ -6346,13 +8262,13 @@ SCIP_RETCODE tryAddSymmetryHandlingConss(
    if ( propdata->nperms <= 0 || (! propdata->symconsenabled && ! propdata->sstenabled) )
       return SCIP_OKAY;
 
-   if ( ! propdata->binvaraffected )
+   if ( ! propdata->binvaraffected && ! (propdata->intorbitopes && isIntVarAffected(propdata)) )
    {
       SCIPdebugMsg(scip, "Symmetry propagator: problem is linear and no symmetry on binary variables has been found, turning symretope constraints off.\n");
       propdata->symconsenabled = FALSE;
    }
    assert( propdata->nperms > 0 );
-   assert( hasNonlinearConstraints(propdata) || propdata->binvaraffected || propdata->sstenabled );
+   assert( hasNonlinearConstraints(propdata) || propdata->binvaraffected || propdata->sstenabled || propdata->intorbitopes );
 
    propdata->triedaddconss = TRUE;
 
@@ -6367,7 +8283,7 @@ SCIP_RETCODE tryAddSymmetryHandlingConss(
    }
 
    /* disable orbital fixing if all components are handled by orbitopes */
-   if ( propdata->ncomponents == propdata->norbitopes )
+   if ( propdata->ncomponents == propdata->norbitopes + propdata->nintorbitopes )
       propdata->ofenabled = FALSE;
 
    /* possibly stop */
@@ -6380,7 +8296,8 @@ SCIP_RETCODE tryAddSymmetryHandlingConss(
       return SCIP_OKAY;
    }
 
-   if ( propdata->ncompblocked < propdata->ncomponents && propdata->detectsubgroups && propdata->symconsenabled )
+   if ( propdata->ncompblocked < propdata->ncomponents && propdata->detectsubgroups && propdata->symconsenabled
+      && propdata->binvaraffected )
    {
       /* @TODO: create array only when needed */
       propdata->genlinconsssize = propdata->nperms;
@@ -6620,44 +8537,195 @@ SCIP_RETCODE computeBranchingVariables(
             boundchg = SCIPdomchgGetBoundchg(domchg, i);
             assert( boundchg != NULL );
 
-            /* branching decisions have to be in the beginning of the bound change array */
-            if ( SCIPboundchgGetBoundchgtype(boundchg) != SCIP_BOUNDCHGTYPE_BRANCHING )
-               break;
+            /* branching decisions have to be in the beginning of the bound change array */
+            if ( SCIPboundchgGetBoundchgtype(boundchg) != SCIP_BOUNDCHGTYPE_BRANCHING )
+               break;
+
+            /* get corresponding branching variable */
+            branchvar = SCIPboundchgGetVar(boundchg);
+
+            /* we only consider binary variables */
+            if ( SCIPvarGetType(branchvar) == SCIP_VARTYPE_BINARY )
+            {
+               /* if branching variable is not known (may have been created meanwhile,
+                * e.g., by prop_inttobinary; may have been removed from symmetry data
+                * due to compression), continue with parent node */
+               if ( ! SCIPhashmapExists(varmap, (void*) branchvar) )
+                  break;
+
+               if ( SCIPvarGetLbLocal(branchvar) > 0.5 )
+               {
+                  int branchvaridx;
+
+                  branchvaridx = SCIPhashmapGetImageInt(varmap, (void*) branchvar);
+                  assert( branchvaridx < nvars );
+
+                  /* the variable might already be fixed to 1 */
+                  if ( ! bg1[branchvaridx] )
+                  {
+                     bg1[branchvaridx] = TRUE;
+                     bg1list[(*nbg1)++] = branchvaridx;
+                  }
+               }
+            }
+         }
+      }
+
+      node = SCIPnodeGetParent(node);
+   }
+
+   return SCIP_OKAY;
+}
+
+
+/** creates the cache of orbits of binary variables for orbital fixing
+ *
+ *  Orbits are cached per component of the symmetry group: the orbits of a component only have to be recomputed if the
+ *  set of its active permutations differs from the one w.r.t. which they have been computed.
+ */
+static
+SCIP_RETCODE createOrbitCache(
+   SCIP*                 scip,               /**< SCIP pointer */
+   SCIP_PROPDATA*        propdata            /**< data of symmetry breaking propagator */
+   )
+{
+   int nbinpermvars;
+   int ncomponents;
+   int c;
+   int p;
+   int v;
+
+   assert( scip != NULL );
+   assert( propdata != NULL );
+   assert( propdata->ofcompvars == NULL );
+   assert( propdata->ncomponents > 0 );
+   assert( propdata->nperms > 0 );
+
+   nbinpermvars = propdata->nbinpermvars;
+   ncomponents = propdata->ncomponents;
+
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->ofcompvars, nbinpermvars) );
+   SCIP_CALL( SCIPallocClearBlockMemoryArray(scip, &propdata->ofcompvarbegins, ncomponents + 1) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->oforbits, nbinpermvars) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->oforbitbegins, nbinpermvars + ncomponents) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->ofnorbits, ncomponents) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->ofpermtocomponent, propdata->nperms) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->ofinactiveperms, propdata->nperms) );
+   SCIP_CALL( SCIPallocClearBlockMemoryArray(scip, &propdata->ofvaradded, nbinpermvars) );
+
+   /* sort binary variables by component (counting sort) */
+   for (v = 0; v < nbinpermvars; ++v)
+   {
+      if ( propdata->vartocomponent[v] >= 0 )
+         ++propdata->ofcompvarbegins[propdata->vartocomponent[v] + 1];
+   }
+   for (c = 0; c < ncomponents; ++c)
+      propdata->ofcompvarbegins[c + 1] += propdata->ofcompvarbegins[c];
+
+   for (v = 0; v < nbinpermvars; ++v)
+   {
+      c = propdata->vartocomponent[v];
+      if ( c >= 0 )
+         propdata->ofcompvars[propdata->ofcompvarbegins[c]++] = v;
+   }
+   for (c = ncomponents; c > 0; --c)
+      propdata->ofcompvarbegins[c] = propdata->ofcompvarbegins[c - 1];
+   propdata->ofcompvarbegins[0] = 0;
+
+   for (c = 0; c < ncomponents; ++c)
+   {
+      propdata->ofnorbits[c] = -1;
+      for (p = propdata->componentbegins[c]; p < propdata->componentbegins[c + 1]; ++p)
+         propdata->ofpermtocomponent[propdata->components[p]] = c;
+   }
+
+   for (p = 0; p < propdata->nperms; ++p)
+      propdata->ofinactiveperms[p] = FALSE;
+
+   return SCIP_OKAY;
+}
+
+
+/** recomputes the cached orbits of the binary variables of a component w.r.t. the active permutations */
+static
+void computeComponentOrbits(
+   SCIP_PROPDATA*        propdata,           /**< data of symmetry breaking propagator */
+   int                   componentidx        /**< index of component */
+   )
+{
+   SCIP_Shortbool* varadded;
+   int* orbits;
+   int* orbitbegins;
+   int* compvars;
+   int ncompvars;
+   int orbitidx = 0;
+   int norbits = 0;
+   int i;
+
+   assert( propdata != NULL );
+   assert( propdata->ofcompvars != NULL );
+   assert( 0 <= componentidx && componentidx < propdata->ncomponents );
 
-            /* get corresponding branching variable */
-            branchvar = SCIPboundchgGetVar(boundchg);
+   compvars = &propdata->ofcompvars[propdata->ofcompvarbegins[componentidx]];
+   ncompvars = propdata->ofcompvarbegins[componentidx + 1] - propdata->ofcompvarbegins[componentidx];
+   orbits = &propdata->oforbits[propdata->ofcompvarbegins[componentidx]];
+   orbitbegins = &propdata->oforbitbegins[propdata->ofcompvarbegins[componentidx] + componentidx];
+   varadded = propdata->ofvaradded;
 
-            /* we only consider binary variables */
-            if ( SCIPvarGetType(branchvar) == SCIP_VARTYPE_BINARY )
-            {
-               /* if branching variable is not known (may have been created meanwhile,
-                * e.g., by prop_inttobinary; may have been removed from symmetry data
-                * due to compression), continue with parent node */
-               if ( ! SCIPhashmapExists(varmap, (void*) branchvar) )
-                  break;
+   for (i = 0; i < ncompvars; ++i)
+   {
+      int beginorbitidx;
+      int j;
 
-               if ( SCIPvarGetLbLocal(branchvar) > 0.5 )
-               {
-                  int branchvaridx;
+      /* skip variable already contained in an orbit of a previous variable */
+      if ( varadded[compvars[i]] )
+         continue;
 
-                  branchvaridx = SCIPhashmapGetImageInt(varmap, (void*) branchvar);
-                  assert( branchvaridx < nvars );
+      /* store first variable */
+      beginorbitidx = orbitidx;
+      orbits[orbitidx++] = compvars[i];
+      varadded[compvars[i]] = TRUE;
 
-                  /* the variable might already be fixed to 1 */
-                  if ( ! bg1[branchvaridx] )
-                  {
-                     bg1[branchvaridx] = TRUE;
-                     bg1list[(*nbg1)++] = branchvaridx;
-                  }
-               }
+      /* iterate over variables in curorbit and compute their images under the permutations moving them */
+      for (j = beginorbitidx; j < orbitidx; ++j)
+      {
+         int k;
+
+         for (k = propdata->supportbegins[orbits[j]]; k < propdata->supportbegins[orbits[j] + 1]; ++k)
+         {
+            int image;
+
+            if ( propdata->inactiveperms[propdata->supportperms[k]] )
+               continue;
+
+            image = propdata->supportimages[k];
+            assert( propdata->vartocomponent[image] == componentidx );
+
+            /* found new element of the orbit */
+            if ( ! varadded[image] )
+            {
+               orbits[orbitidx++] = image;
+               assert( orbitidx <= ncompvars );
+               varadded[image] = TRUE;
             }
          }
       }
 
-      node = SCIPnodeGetParent(node);
+      /* if the orbit is trivial, reset storage, otherwise store orbit */
+      if ( orbitidx <= beginorbitidx + 1 )
+         orbitidx = beginorbitidx;
+      else
+         orbitbegins[norbits++] = beginorbitidx;
    }
 
-   return SCIP_OKAY;
+   /* store end in "last" orbitbegins entry */
+   assert( norbits < MAX(ncompvars, 1) );
+   orbitbegins[norbits] = orbitidx;
+   propdata->ofnorbits[componentidx] = norbits;
+
+   /* clean buffer */
+   for (i = 0; i < ncompvars; ++i)
+      varadded[compvars[i]] = FALSE;
 }
 
 
@@ -6674,10 +8742,6 @@ SCIP_RETCODE propagateOrbitalFixing(
    SCIP_Shortbool* bg0;
    SCIP_Shortbool* bg1;
    SCIP_VAR** permvars;
-   int* orbitbegins;
-   int* orbits;
-   int* components;
-   int* componentbegins;
    int* vartocomponent;
    int ncomponents;
    int* bg0list;
@@ -6688,7 +8752,9 @@ SCIP_RETCODE propagateOrbitalFixing(
    int norbits;
    int npermvars;
    int nbinpermvars;
-   int** permstrans;
+   int* supportbegins;
+   int* supportperms;
+   int* supportimages;
    int nperms;
    int p;
    int v;
@@ -6723,7 +8789,7 @@ SCIP_RETCODE propagateOrbitalFixing(
    assert( propdata->permvars != NULL );
    assert( propdata->npermvars > 0 );
    assert( propdata->permvarmap != NULL );
-   assert( propdata->permstrans != NULL );
+   assert( propdata->supportbegins != NULL );
    assert( propdata->inactiveperms != NULL );
    assert( propdata->components != NULL );
    assert( propdata->componentbegins != NULL );
@@ -6733,10 +8799,10 @@ SCIP_RETCODE propagateOrbitalFixing(
    permvars = propdata->permvars;
    npermvars = propdata->npermvars;
    nbinpermvars = propdata->nbinpermvars;
-   permstrans = propdata->permstrans;
+   supportbegins = propdata->supportbegins;
+   supportperms = propdata->supportperms;
+   supportimages = propdata->supportimages;
    inactiveperms = propdata->inactiveperms;
-   components = propdata->components;
-   componentbegins = propdata->componentbegins;
    vartocomponent = propdata->vartocomponent;
    ncomponents = propdata->ncomponents;
 
@@ -6772,153 +8838,651 @@ SCIP_RETCODE propagateOrbitalFixing(
    /* filter out permutations that move variables that are fixed to 0 */
    for (j = 0; j < nbg0 && nactiveperms > 0; ++j)
    {
-      int* pt;
-
       v = bg0list[j];
       assert( 0 <= v && v < npermvars );
       assert( bg0[v] );
 
-      componentidx = vartocomponent[v];
+      componentidx = vartocomponent[v];
+
+      /* skip unaffected variables and blocked components */
+      if ( componentidx < 0 || propdata->componentblocked[componentidx] )
+         continue;
+
+      /* only the permutations moving v are stored in the support */
+      for (p = supportbegins[v]; p < supportbegins[v + 1]; ++p)
+      {
+         int img;
+         int perm;
+
+         perm = supportperms[p];
+
+         /* skip inactive permutations */
+         if ( inactiveperms[perm] )
+            continue;
+
+         img = supportimages[p];
+
+         if ( img != v )
+         {
+#ifndef NDEBUG
+            SCIP_VAR* varv = permvars[v];
+            SCIP_VAR* varimg = permvars[img];
+
+            /* check whether moved variables have the same type (might have been aggregated in the meanwhile) */
+            assert( SCIPvarGetType(varv) == SCIPvarGetType(varimg) ||
+               (SCIPvarIsBinary(varv) && SCIPvarIsBinary(varimg)) ||
+               (SCIPvarGetType(varv) == SCIP_VARTYPE_IMPLINT && SCIPvarGetType(varimg) == SCIP_VARTYPE_CONTINUOUS &&
+                  SCIPisEQ(scip, SCIPvarGetLbGlobal(varv), SCIPvarGetLbGlobal(varimg)) &&
+                  SCIPisEQ(scip, SCIPvarGetUbGlobal(varv), SCIPvarGetUbGlobal(varimg))) ||
+               (SCIPvarGetType(varv) == SCIP_VARTYPE_CONTINUOUS && SCIPvarGetType(varimg) == SCIP_VARTYPE_IMPLINT &&
+                  SCIPisEQ(scip, SCIPvarGetLbGlobal(varv), SCIPvarGetLbGlobal(varimg)) &&
+                  SCIPisEQ(scip, SCIPvarGetUbGlobal(varv), SCIPvarGetUbGlobal(varimg))) );
+            assert( SCIPisEQ(scip, propdata->permvarsobj[v], propdata->permvarsobj[img]) );
+#endif
+
+            /* we are moving a variable globally fixed to 0 to a variable not of this type */
+            if ( ! bg0[img] )
+            {
+               inactiveperms[perm] = TRUE; /* mark as inactive */
+               --nactiveperms;
+            }
+         }
+      }
+   }
+
+   /* filter out permutations that move variables that are fixed to different values */
+   for (j = 0; j < nbg1 && nactiveperms > 0; ++j)
+   {
+      v = bg1list[j];
+      assert( 0 <= v && v < npermvars );
+      assert( bg1[v] );
+
+      componentidx = vartocomponent[v];
+
+      /* skip unaffected variables and blocked components */
+      if ( componentidx < 0 || propdata->componentblocked[componentidx] )
+         continue;
+
+      /* only the permutations moving v are stored in the support */
+      for (p = supportbegins[v]; p < supportbegins[v + 1]; ++p)
+      {
+         int img;
+         int perm;
+
+         perm = supportperms[p];
+
+         /* skip inactive permutations */
+         if ( inactiveperms[perm] )
+            continue;
+
+         img = supportimages[p];
+
+         if ( img != v )
+         {
+#ifndef NDEBUG
+            SCIP_VAR* varv = permvars[v];
+            SCIP_VAR* varimg = permvars[img];
+
+            /* check whether moved variables have the same type (might have been aggregated in the meanwhile) */
+            assert( SCIPvarGetType(varv) == SCIPvarGetType(varimg) ||
+               (SCIPvarIsBinary(varv) && SCIPvarIsBinary(varimg)) ||
+               (SCIPvarGetType(varv) == SCIP_VARTYPE_IMPLINT && SCIPvarGetType(varimg) == SCIP_VARTYPE_CONTINUOUS &&
+                  SCIPisEQ(scip, SCIPvarGetLbGlobal(varv), SCIPvarGetLbGlobal(varimg)) &&
+                  SCIPisEQ(scip, SCIPvarGetUbGlobal(varv), SCIPvarGetUbGlobal(varimg))) ||
+               (SCIPvarGetType(varv) == SCIP_VARTYPE_CONTINUOUS && SCIPvarGetType(varimg) == SCIP_VARTYPE_IMPLINT &&
+                  SCIPisEQ(scip, SCIPvarGetLbGlobal(varv), SCIPvarGetLbGlobal(varimg)) &&
+                  SCIPisEQ(scip, SCIPvarGetUbGlobal(varv), SCIPvarGetUbGlobal(varimg))) );
+            assert( SCIPisEQ(scip, propdata->permvarsobj[v], propdata->permvarsobj[img]) );
+#endif
+
+            /* we are moving a variable globally fixed or branched to 1 to a variable not of this type */
+            if ( ! bg1[img] )
+            {
+               inactiveperms[perm] = TRUE; /* mark as inactive */
+               --nactiveperms;
+            }
+         }
+      }
+   }
+
+   /* Clean bg1 list - need to do this after the main loop! (Not needed for bg0.)
+    * Note that variables globally fixed to 1 are not resetted, since the loop starts at propdata->nbg1. */
+   for (j = propdata->nbg1; j < nbg1; ++j)
+      bg1[bg1list[j]] = FALSE;
+
+   /* exit if no active permuations left */
+   if ( nactiveperms == 0 )
+      return SCIP_OKAY;
+
+   /* compute orbits of binary variables: only components whose active permutations have changed since the orbits
+    * have been computed last are recomputed */
+   if ( propdata->ofcompvars == NULL )
+   {
+      SCIP_CALL( createOrbitCache(scip, propdata) );
+   }
+   assert( propdata->ofcompvars != NULL );
+
+   for (p = 0; p < nperms; ++p)
+   {
+      if ( inactiveperms[p] != propdata->ofinactiveperms[p] )
+      {
+         propdata->ofnorbits[propdata->ofpermtocomponent[p]] = -1;
+         propdata->ofinactiveperms[p] = inactiveperms[p];
+      }
+   }
+
+   for (componentidx = 0; componentidx < ncomponents && ! *infeasible; ++componentidx)
+   {
+      int nfixedzero = 0;
+      int nfixedone = 0;
+      int compstart;
+
+      if ( propdata->componentblocked[componentidx] )
+         continue;
+
+      if ( propdata->ofnorbits[componentidx] < 0 )
+         computeComponentOrbits(propdata, componentidx);
+
+      norbits = propdata->ofnorbits[componentidx];
+      if ( norbits == 0 )
+         continue;
+
+      compstart = propdata->ofcompvarbegins[componentidx];
+
+      SCIPdebugMsg(scip, "Perform orbital fixing on %d orbits of component %d (%d active perms).\n", norbits, componentidx,
+         nactiveperms);
+      SCIP_CALL( performOrbitalFixing(scip, permvars, nbinpermvars, &propdata->oforbits[compstart],
+            &propdata->oforbitbegins[compstart + componentidx], norbits, infeasible, &nfixedzero, &nfixedone) );
+
+      propdata->nfixedzero += nfixedzero;
+      propdata->nfixedone += nfixedone;
+      *nprop += nfixedzero + nfixedone;
+
+      SCIPdebugMsg(scip, "Orbital fixings: %d 0s, %d 1s.\n", nfixedzero, nfixedone);
+   }
+
+   return SCIP_OKAY;
+}
+
+
+
+/*
+ * Local methods for lexicographic reduction
+ */
+
+/** returns the fixing status of a binary variable, taking virtual fixings into account */
+static
+int getLexFixing(
+   SCIP_VAR*             var,                /**< variable */
+   int                   virtualfixing       /**< virtual fixing of the variable (LEXNOINIT if there is none) */
+   )
+{
+   assert( var != NULL );
+
+   if ( virtualfixing != LEXNOINIT )
+      return virtualfixing;
+
+   if ( SCIPvarGetUbLocal(var) < 0.5 )
+      return LEXFIXED0;
+   if ( SCIPvarGetLbLocal(var) > 0.5 )
+      return LEXFIXED1;
+
+   return LEXUNFIXED;
+}
+
+
+/** checks whether the symresack of a permutation can still be satisfied if the pairs before the given position are
+ *  equal and additional virtual fixings are applied
+ *
+ *  The pairs of the permutation are given by the variables and their preimages in positions @p start up to @p end of
+ *  lexpermvars and lexpermpreimages.
+ */
+static
+void checkLexFeasible(
+   SCIP_PROPDATA*        propdata,           /**< data of symmetry propagator */
+   int                   start,              /**< position of the first pair that is not known to be equal */
+   int                   end,                /**< position after the last pair of the permutation */
+   int*                  tempfixings,        /**< virtual fixings indexed by variables (LEXNOINIT if there is none) */
+   int*                  tempfixentries,     /**< variables with virtual fixings */
+   int                   ntempfixentries,    /**< number of initial virtual fixings */
+   SCIP_Bool*            infeasible          /**< pointer to store whether the symresack cannot be satisfied */
+   )
+{
+   int nfixentries;
+   int i;
+
+   assert( propdata != NULL );
+   assert( tempfixings != NULL );
+   assert( tempfixentries != NULL );
+   assert( infeasible != NULL );
+
+   *infeasible = FALSE;
+   nfixentries = ntempfixentries;
+
+   for (i = start; i < end; ++i)
+   {
+      int var1;
+      int var2;
+      int var1fix;
+      int var2fix;
+
+      var1 = propdata->lexpermvars[i];
+      var2 = propdata->lexpermpreimages[i];
+      assert( var1 != var2 );
+
+      var1fix = getLexFixing(propdata->permvars[var1], tempfixings[var1]);
+      var2fix = getLexFixing(propdata->permvars[var2], tempfixings[var2]);
+
+      /* (1, 0) can be constructed, so the symresack can be satisfied */
+      if ( var1fix != LEXFIXED0 && var2fix != LEXFIXED1 )
+         break;
+
+      /* (0, 1) violates the lexicographic order */
+      if ( var1fix == LEXFIXED0 && var2fix == LEXFIXED1 )
+      {
+         *infeasible = TRUE;
+         break;
+      }
+
+      /* (0, _) and (_, 1) can only become equal */
+      if ( var2fix == LEXUNFIXED )
+      {
+         tempfixings[var2] = LEXFIXED0;
+         tempfixentries[nfixentries++] = var2;
+      }
+      else if ( var1fix == LEXUNFIXED )
+      {
+         tempfixings[var1] = LEXFIXED1;
+         tempfixentries[nfixentries++] = var1;
+      }
+   }
+
+   /* undo virtual fixings of this function */
+   for (i = ntempfixentries; i < nfixentries; ++i)
+      tempfixings[tempfixentries[i]] = LEXNOINIT;
+}
+
+
+/** propagates the symresacks of all permutations of lexicographic reduction
+ *
+ *  In contrast to propagating each symresack constraint on its own, the symresacks share one pass over the variable
+ *  order: a symresack drops out of the pass as soon as its first pair that is not fixed to be equal is found, and the
+ *  pass stops once all symresacks have dropped out.
+ */
+static
+SCIP_RETCODE propagateLexReduction(
+   SCIP*                 scip,               /**< SCIP pointer */
+   SCIP_PROPDATA*        propdata,           /**< data of symmetry propagator */
+   SCIP_Bool*            infeasible,         /**< pointer to store whether the node is infeasible */
+   int*                  nprop               /**< pointer to store the number of tightened bounds */
+   )
+{
+   SCIP_VAR** permvars;
+   int* tempfixings;
+   int* tempfixentries;
+   int* permpos;
+   int nactiveperms;
+   int npermvars;
+   int i;
+
+   assert( scip != NULL );
+   assert( propdata != NULL );
+   assert( propdata->nlexperms > 0 );
+   assert( propdata->lexsupportbegins != NULL );
+   assert( infeasible != NULL );
+   assert( nprop != NULL );
+
+   *infeasible = FALSE;
+   *nprop = 0;
+
+   permvars = propdata->permvars;
+   npermvars = propdata->npermvars;
+
+   /* permpos[p] is the position of the next pair of permutation p, or -1 if its symresack dropped out of the pass */
+   SCIP_CALL( SCIPallocBufferArray(scip, &permpos, propdata->nlexperms) );
+   for (i = 0; i < propdata->nlexperms; ++i)
+      permpos[i] = propdata->lexpermbegins[i];
+   nactiveperms = propdata->nlexperms;
 
-      /* skip unaffected variables and blocked components */
-      if ( componentidx < 0 || propdata->componentblocked[componentidx] )
-         continue;
+   SCIP_CALL( SCIPallocCleanBufferArray(scip, &tempfixings, npermvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &tempfixentries, npermvars) );
 
-      pt = permstrans[v];
-      assert( pt != NULL );
+   for (i = 0; i < npermvars && nactiveperms > 0 && ! *infeasible; ++i)
+   {
+      int j;
 
-      for (p = componentbegins[componentidx]; p < componentbegins[componentidx + 1]; ++p)
+      for (j = propdata->lexsupportbegins[i]; j < propdata->lexsupportbegins[i + 1]; ++j)
       {
-         int img;
-         int perm;
-
-         perm = components[p];
+         SCIP_Bool peekinfeasible;
+         SCIP_Bool tightened;
+         SCIP_VAR* var1;
+         SCIP_VAR* var2;
+         int var1fix;
+         int var2fix;
+         int pos;
+         int p;
 
-         /* skip inactive permutations */
-         if ( inactiveperms[perm] )
+         p = propdata->lexsupportperms[j];
+         if ( permpos[p] < 0 )
             continue;
 
-         img = pt[perm];
+         pos = permpos[p]++;
+         assert( propdata->lexpermvars[pos] == i );
+         assert( propdata->lexpermpreimages[pos] == propdata->lexsupportimages[j] );
 
-         if ( img != v )
-         {
-#ifndef NDEBUG
-            SCIP_VAR* varv = permvars[v];
-            SCIP_VAR* varimg = permvars[img];
+         var1 = permvars[i];
+         var2 = permvars[propdata->lexsupportimages[j]];
+         var1fix = getLexFixing(var1, LEXNOINIT);
+         var2fix = getLexFixing(var2, LEXNOINIT);
 
-            /* check whether moved variables have the same type (might have been aggregated in the meanwhile) */
-            assert( SCIPvarGetType(varv) == SCIPvarGetType(varimg) ||
-               (SCIPvarIsBinary(varv) && SCIPvarIsBinary(varimg)) ||
-               (SCIPvarGetType(varv) == SCIP_VARTYPE_IMPLINT && SCIPvarGetType(varimg) == SCIP_VARTYPE_CONTINUOUS &&
-                  SCIPisEQ(scip, SCIPvarGetLbGlobal(varv), SCIPvarGetLbGlobal(varimg)) &&
-                  SCIPisEQ(scip, SCIPvarGetUbGlobal(varv), SCIPvarGetUbGlobal(varimg))) ||
-               (SCIPvarGetType(varv) == SCIP_VARTYPE_CONTINUOUS && SCIPvarGetType(varimg) == SCIP_VARTYPE_IMPLINT &&
-                  SCIPisEQ(scip, SCIPvarGetLbGlobal(varv), SCIPvarGetLbGlobal(varimg)) &&
-                  SCIPisEQ(scip, SCIPvarGetUbGlobal(varv), SCIPvarGetUbGlobal(varimg))) );
-            assert( SCIPisEQ(scip, propdata->permvarsobj[v], propdata->permvarsobj[img]) );
-#endif
+         /* (1, 0) is possible: check whether (0, _) or (_, 1) is feasible; all later pairs can take arbitrary values;
+          * since (0, _) and (_, 1) can only be completed to (0, 0) and (1, 1), both entries are fixed virtually */
+         if ( var1fix != LEXFIXED0 && var2fix != LEXFIXED1 )
+         {
+            if ( var1fix == LEXUNFIXED )
+            {
+               tempfixings[i] = LEXFIXED0;
+               tempfixings[propdata->lexsupportimages[j]] = LEXFIXED0;
+               tempfixentries[0] = i;
+               tempfixentries[1] = propdata->lexsupportimages[j];
+               checkLexFeasible(propdata, pos + 1, propdata->lexpermbegins[p + 1], tempfixings, tempfixentries, 2,
+                  &peekinfeasible);
+               tempfixings[i] = LEXNOINIT;
+               tempfixings[propdata->lexsupportimages[j]] = LEXNOINIT;
+
+               if ( peekinfeasible )
+               {
+                  SCIP_CALL( SCIPtightenVarLb(scip, var1, 1.0, FALSE, infeasible, &tightened) );
+                  assert( ! *infeasible );
+                  if ( tightened )
+                     ++(*nprop);
+               }
+            }
 
-            /* we are moving a variable globally fixed to 0 to a variable not of this type */
-            if ( ! bg0[img] )
+            if ( var2fix == LEXUNFIXED )
             {
-               inactiveperms[perm] = TRUE; /* mark as inactive */
-               --nactiveperms;
+               tempfixings[i] = LEXFIXED1;
+               tempfixings[propdata->lexsupportimages[j]] = LEXFIXED1;
+               tempfixentries[0] = i;
+               tempfixentries[1] = propdata->lexsupportimages[j];
+               checkLexFeasible(propdata, pos + 1, propdata->lexpermbegins[p + 1], tempfixings, tempfixentries, 2,
+                  &peekinfeasible);
+               tempfixings[i] = LEXNOINIT;
+               tempfixings[propdata->lexsupportimages[j]] = LEXNOINIT;
+
+               if ( peekinfeasible )
+               {
+                  SCIP_CALL( SCIPtightenVarUb(scip, var2, 0.0, FALSE, infeasible, &tightened) );
+                  assert( ! *infeasible );
+                  if ( tightened )
+                     ++(*nprop);
+               }
             }
+
+            permpos[p] = -1;
+            --nactiveperms;
          }
+         /* (0, 1) violates the lexicographic order */
+         else if ( var1fix == LEXFIXED0 && var2fix == LEXFIXED1 )
+         {
+            SCIPdebugMsg(scip, "Lexicographic reduction: pair (%d,%d) is fixed to (0,1), node is infeasible.\n",
+               i, propdata->lexsupportimages[j]);
+            *infeasible = TRUE;
+            break;
+         }
+         /* (0, _): fix second entry to 0 */
+         else if ( var1fix == LEXFIXED0 && var2fix == LEXUNFIXED )
+         {
+            SCIP_CALL( SCIPtightenVarUb(scip, var2, 0.0, FALSE, infeasible, &tightened) );
+            assert( ! *infeasible );
+            if ( tightened )
+               ++(*nprop);
+         }
+         /* (_, 1): fix first entry to 1 */
+         else if ( var1fix == LEXUNFIXED && var2fix == LEXFIXED1 )
+         {
+            SCIP_CALL( SCIPtightenVarLb(scip, var1, 1.0, FALSE, infeasible, &tightened) );
+            assert( ! *infeasible );
+            if ( tightened )
+               ++(*nprop);
+         }
+         /* remaining cases are (0, 0) and (1, 1), in which we continue with the next pair */
       }
    }
 
-   /* filter out permutations that move variables that are fixed to different values */
-   for (j = 0; j < nbg1 && nactiveperms > 0; ++j)
-   {
-      int* pt;
+   SCIPfreeBufferArray(scip, &tempfixentries);
+   SCIPfreeCleanBufferArray(scip, &tempfixings);
+   SCIPfreeBufferArray(scip, &permpos);
 
-      v = bg1list[j];
-      assert( 0 <= v && v < npermvars );
-      assert( bg1[v] );
+   return SCIP_OKAY;
+}
 
-      componentidx = vartocomponent[v];
 
-      /* skip unaffected variables and blocked components */
-      if ( componentidx < 0 || propdata->componentblocked[componentidx] )
-         continue;
 
-      pt = permstrans[v];
-      assert( pt != NULL );
+/*
+ * Local methods for orbitopal reduction of orbitopes on general integer variables
+ */
 
-      for (p = componentbegins[componentidx]; p < componentbegins[componentidx + 1]; ++p)
-      {
-         int img;
-         int perm;
+/** computes the lexicographically maximal vector within the bounds of a column that is lexicographically not larger
+ *  than a given vector
+ *
+ *  The entries of the given vector are integral. If no such vector exists, infeasible is set to TRUE.
+ */
+static
+void computeLexMaxColumn(
+   SCIP*                 scip,               /**< SCIP pointer */
+   SCIP_VAR**            vars,               /**< variable matrix of orbitope (row by row) */
+   int                   nrows,              /**< number of rows of orbitope */
+   int                   ncols,              /**< number of columns of orbitope */
+   int                   col,                /**< column for which the vector is computed */
+   SCIP_Real*            lexmax,             /**< matrix of lexmax vectors (row by row); column col - 1 is the bound */
+   SCIP_Bool*            infeasible          /**< pointer to store whether no such vector exists */
+   )
+{
+   int lastdecrease = -1;
+   int i;
 
-         perm = components[p];
+   assert( col > 0 );
 
-         /* skip inactive permutations */
-         if ( inactiveperms[perm] )
-            continue;
+   *infeasible = FALSE;
+
+   for (i = 0; i < nrows; ++i)
+   {
+      SCIP_Real bound;
+      SCIP_Real lb;
+      SCIP_Real ub;
 
-         img = pt[perm];
+      bound = lexmax[i * ncols + col - 1];
+      lb = SCIPvarGetLbLocal(vars[i * ncols + col]);
+      ub = SCIPvarGetUbLocal(vars[i * ncols + col]);
 
-         if ( img != v )
+      /* the column becomes strictly smaller, so the remaining entries can be maximal */
+      if ( SCIPisLT(scip, ub, bound) )
+      {
+         for (; i < nrows; ++i)
+            lexmax[i * ncols + col] = SCIPvarGetUbLocal(vars[i * ncols + col]);
+         return;
+      }
+
+      /* the column cannot be equal to the bound in this row: become strictly smaller in an earlier row */
+      if ( SCIPisGT(scip, lb, bound) )
+      {
+         if ( lastdecrease < 0 )
          {
-#ifndef NDEBUG
-            SCIP_VAR* varv = permvars[v];
-            SCIP_VAR* varimg = permvars[img];
+            *infeasible = TRUE;
+            return;
+         }
 
-            /* check whether moved variables have the same type (might have been aggregated in the meanwhile) */
-            assert( SCIPvarGetType(varv) == SCIPvarGetType(varimg) ||
-               (SCIPvarIsBinary(varv) && SCIPvarIsBinary(varimg)) ||
-               (SCIPvarGetType(varv) == SCIP_VARTYPE_IMPLINT && SCIPvarGetType(varimg) == SCIP_VARTYPE_CONTINUOUS &&
-                  SCIPisEQ(scip, SCIPvarGetLbGlobal(varv), SCIPvarGetLbGlobal(varimg)) &&
-                  SCIPisEQ(scip, SCIPvarGetUbGlobal(varv), SCIPvarGetUbGlobal(varimg))) ||
-               (SCIPvarGetType(varv) == SCIP_VARTYPE_CONTINUOUS && SCIPvarGetType(varimg) == SCIP_VARTYPE_IMPLINT &&
-                  SCIPisEQ(scip, SCIPvarGetLbGlobal(varv), SCIPvarGetLbGlobal(varimg)) &&
-                  SCIPisEQ(scip, SCIPvarGetUbGlobal(varv), SCIPvarGetUbGlobal(varimg))) );
-            assert( SCIPisEQ(scip, propdata->permvarsobj[v], propdata->permvarsobj[img]) );
-#endif
+         lexmax[lastdecrease * ncols + col] -= 1.0;
+         for (i = lastdecrease + 1; i < nrows; ++i)
+            lexmax[i * ncols + col] = SCIPvarGetUbLocal(vars[i * ncols + col]);
+         return;
+      }
 
-            /* we are moving a variable globally fixed or branched to 1 to a variable not of this type */
-            if ( ! bg1[img] )
-            {
-               inactiveperms[perm] = TRUE; /* mark as inactive */
-               --nactiveperms;
-            }
+      lexmax[i * ncols + col] = bound;
+      if ( SCIPisLT(scip, lb, bound) )
+         lastdecrease = i;
+   }
+}
+
+
+/** computes the lexicographically minimal vector within the bounds of a column that is lexicographically not smaller
+ *  than a given vector
+ *
+ *  The entries of the given vector are integral. If no such vector exists, infeasible is set to TRUE.
+ */
+static
+void computeLexMinColumn(
+   SCIP*                 scip,               /**< SCIP pointer */
+   SCIP_VAR**            vars,               /**< variable matrix of orbitope (row by row) */
+   int                   nrows,              /**< number of rows of orbitope */
+   int                   ncols,              /**< number of columns of orbitope */
+   int                   col,                /**< column for which the vector is computed */
+   SCIP_Real*            lexmin,             /**< matrix of lexmin vectors (row by row); column col + 1 is the bound */
+   SCIP_Bool*            infeasible          /**< pointer to store whether no such vector exists */
+   )
+{
+   int lastincrease = -1;
+   int i;
+
+   assert( col < ncols - 1 );
+
+   *infeasible = FALSE;
+
+   for (i = 0; i < nrows; ++i)
+   {
+      SCIP_Real bound;
+      SCIP_Real lb;
+      SCIP_Real ub;
+
+      bound = lexmin[i * ncols + col + 1];
+      lb = SCIPvarGetLbLocal(vars[i * ncols + col]);
+      ub = SCIPvarGetUbLocal(vars[i * ncols + col]);
+
+      /* the column becomes strictly larger, so the remaining entries can be minimal */
+      if ( SCIPisGT(scip, lb, bound) )
+      {
+         for (; i < nrows; ++i)
+            lexmin[i * ncols + col] = SCIPvarGetLbLocal(vars[i * ncols + col]);
+         return;
+      }
+
+      /* the column cannot be equal to the bound in this row: become strictly larger in an earlier row */
+      if ( SCIPisLT(scip, ub, bound) )
+      {
+         if ( lastincrease < 0 )
+         {
+            *infeasible = TRUE;
+            return;
          }
+
+         lexmin[lastincrease * ncols + col] += 1.0;
+         for (i = lastincrease + 1; i < nrows; ++i)
+            lexmin[i * ncols + col] = SCIPvarGetLbLocal(vars[i * ncols + col]);
+         return;
       }
+
+      lexmin[i * ncols + col] = bound;
+      if ( SCIPisGT(scip, ub, bound) )
+         lastincrease = i;
    }
+}
 
-   /* Clean bg1 list - need to do this after the main loop! (Not needed for bg0.)
-    * Note that variables globally fixed to 1 are not resetted, since the loop starts at propdata->nbg1. */
-   for (j = propdata->nbg1; j < nbg1; ++j)
-      bg1[bg1list[j]] = FALSE;
 
-   /* exit if no active permuations left */
-   if ( nactiveperms == 0 )
-      return SCIP_OKAY;
+/** propagates an orbitope on general integer variables
+ *
+ *  The columns of the orbitope are sorted lexicographically non-increasingly. Similar to the propagation of full
+ *  orbitopes on binary variables, we compute for each column the lexicographically maximal and minimal vectors that are
+ *  compatible with the local bounds and the order of the columns. Each column is lexicographically between these two
+ *  vectors. Thus, the entries up to the first row in which they differ are fixed, and the entry in this row is bounded
+ *  by the entries of the two vectors.
+ */
+static
+SCIP_RETCODE propagateIntOrbitope(
+   SCIP*                 scip,               /**< SCIP pointer */
+   SCIP_VAR**            vars,               /**< variable matrix of orbitope (row by row) */
+   int                   nrows,              /**< number of rows of orbitope */
+   int                   ncols,              /**< number of columns of orbitope */
+   SCIP_Bool*            infeasible,         /**< pointer to store whether the node is infeasible */
+   int*                  nprop               /**< pointer to store the number of tightened bounds */
+   )
+{
+   SCIP_Real* lexmax;
+   SCIP_Real* lexmin;
+   int i;
+   int j;
+
+   assert( scip != NULL );
+   assert( vars != NULL );
+   assert( nrows > 0 );
+   assert( ncols > 0 );
+   assert( infeasible != NULL );
+   assert( nprop != NULL );
+
+   *infeasible = FALSE;
+   *nprop = 0;
 
-   /* compute orbits of binary variables */
-   SCIP_CALL( SCIPallocBufferArray(scip, &orbits, nbinpermvars) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &orbitbegins, nbinpermvars) );
-   SCIP_CALL( SCIPcomputeOrbitsFilterSym(scip, nbinpermvars, permstrans, nperms, inactiveperms,
-         orbits, orbitbegins, &norbits, components, componentbegins, vartocomponent, propdata->componentblocked, ncomponents, propdata->nmovedpermvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &lexmax, nrows * ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &lexmin, nrows * ncols) );
 
-   if ( norbits > 0 )
+   /* the first column is bounded by the upper bounds, the last column by the lower bounds */
+   for (i = 0; i < nrows; ++i)
    {
-      int nfixedzero = 0;
-      int nfixedone = 0;
+      lexmax[i * ncols] = SCIPvarGetUbLocal(vars[i * ncols]);
+      lexmin[i * ncols + ncols - 1] = SCIPvarGetLbLocal(vars[i * ncols + ncols - 1]);
+   }
 
-      SCIPdebugMsg(scip, "Perform orbital fixing on %d orbits (%d active perms).\n", norbits, nactiveperms);
-      SCIP_CALL( performOrbitalFixing(scip, permvars, nbinpermvars, orbits, orbitbegins, norbits, infeasible, &nfixedzero, &nfixedone) );
+   for (j = 1; j < ncols && ! *infeasible; ++j)
+      computeLexMaxColumn(scip, vars, nrows, ncols, j, lexmax, infeasible);
 
-      propdata->nfixedzero += nfixedzero;
-      propdata->nfixedone += nfixedone;
-      *nprop = nfixedzero + nfixedone;
+   for (j = ncols - 2; j >= 0 && ! *infeasible; --j)
+      computeLexMinColumn(scip, vars, nrows, ncols, j, lexmin, infeasible);
 
-      SCIPdebugMsg(scip, "Orbital fixings: %d 0s, %d 1s.\n", nfixedzero, nfixedone);
+   for (j = 0; j < ncols && ! *infeasible; ++j)
+   {
+      for (i = 0; i < nrows; ++i)
+      {
+         SCIP_Bool tightened;
+         SCIP_VAR* var;
+         SCIP_Real minval;
+         SCIP_Real maxval;
+
+         var = vars[i * ncols + j];
+         minval = lexmin[i * ncols + j];
+         maxval = lexmax[i * ncols + j];
+
+         if ( SCIPisGT(scip, minval, maxval) )
+         {
+            *infeasible = TRUE;
+            break;
+         }
+
+         if ( ! SCIPisInfinity(scip, -minval) && SCIPisGT(scip, minval, SCIPvarGetLbLocal(var)) )
+         {
+            SCIP_CALL( SCIPtightenVarLb(scip, var, minval, FALSE, infeasible, &tightened) );
+            if ( *infeasible )
+               break;
+            if ( tightened )
+               ++(*nprop);
+         }
+
+         if ( ! SCIPisInfinity(scip, maxval) && SCIPisLT(scip, maxval, SCIPvarGetUbLocal(var)) )
+         {
+            SCIP_CALL( SCIPtightenVarUb(scip, var, maxval, FALSE, infeasible, &tightened) );
+            if ( *infeasible )
+               break;
+            if ( tightened )
+               ++(*nprop);
+         }
+
+         /* the entries below the first row in which the two vectors differ are not restricted */
+         if ( SCIPisLT(scip, minval, maxval) )
+            break;
+      }
    }
 
-   SCIPfreeBufferArray(scip, &orbitbegins);
-   SCIPfreeBufferArray(scip, &orbits);
+   SCIPfreeBufferArray(scip, &lexmin);
+   SCIPfreeBufferArray(scip, &lexmax);
 
    return SCIP_OKAY;
 }
@@ -6949,6 +9513,10 @@ SCIP_DECL_PROPINITPRE(propInitpreSymmetry)
    {
       SCIP_CALL( SCIPgetIntParam(scip, "misc/usesymmetry", &propdata->usesymmetry) );
 
+      /* symmetries are not handled if the presolved problem is copied to racing symmetry handling methods */
+      if ( SCIPsyncstoreIsSymmetryRacingScip(SCIPgetSyncstore(scip), scip) )
+         propdata->usesymmetry = 0;
+
       if ( ISSYMRETOPESACTIVE(propdata->usesymmetry) )
          propdata->symconsenabled = TRUE;
       else
@@ -7030,6 +9598,13 @@ SCIP_DECL_PROPEXITPRE(propExitpreSymmetry)
       assert( propdata->binvaraffected || ! propdata->ofenabled );
    }
 
+   /* compute symmetries for pruning symmetric nodes if no other symmetry handling method is active */
+   if ( propdata->nodepruning && ! propdata->ofenabled && ! propdata->symconsenabled && ! propdata->sstenabled
+      && SCIPgetStatus(scip) == SCIP_STATUS_UNKNOWN )
+   {
+      SCIP_CALL( determineSymmetry(scip, propdata, SYM_SPEC_BINARY | SYM_SPEC_INTEGER | SYM_SPEC_REAL, 0) );
+   }
+
    return SCIP_OKAY;
 }
 
@@ -7198,14 +9773,15 @@ SCIP_DECL_PROPEXEC(propExecSymmetry)
    SCIP_Bool infeasible = FALSE;
    SCIP_Longint nodenumber;
    int nprop = 0;
+   int i;
 
    assert( scip != NULL );
    assert( result != NULL );
 
    *result = SCIP_DIDNOTRUN;
 
-   /* do not run if we are in the root or not yet solving */
-   if ( SCIPgetDepth(scip) <= 0 || SCIPgetStage(scip) < SCIP_STAGE_SOLVING )
+   /* do not run if we are not yet solving */
+   if ( SCIPgetStage(scip) < SCIP_STAGE_SOLVING )
       return SCIP_OKAY;
 
    /* do nothing if we are in a probing node */
@@ -7224,6 +9800,10 @@ SCIP_DECL_PROPEXEC(propExecSymmetry)
    if ( propdata->usesymmetry < 0 )
    {
       SCIP_CALL( SCIPgetIntParam(scip, "misc/usesymmetry", &propdata->usesymmetry) );
+
+      /* symmetries are not handled if the presolved problem is copied to racing symmetry handling methods */
+      if ( SCIPsyncstoreIsSymmetryRacingScip(SCIPgetSyncstore(scip), scip) )
+         propdata->usesymmetry = 0;
       if ( ISSYMRETOPESACTIVE(propdata->usesymmetry) )
          propdata->symconsenabled = TRUE;
       else
@@ -7240,14 +9820,79 @@ SCIP_DECL_PROPEXEC(propExecSymmetry)
          propdata->sstenabled = FALSE;
    }
 
-   /* do not propagate if orbital fixing is not enabled */
-   if ( ! propdata->ofenabled )
-      return SCIP_OKAY;
-
    /* return if there is no symmetry available */
    if ( propdata->nperms == 0 )
       return SCIP_OKAY;
 
+   /* prune node if its branching decisions are symmetric to those of a finished leaf */
+   if ( propdata->nodepruningenabled && SCIPgetDepth(scip) > 0 && SCIPgetNRuns(scip) == propdata->nodepruningrun )
+   {
+      nodenumber = SCIPnodeGetNumber(SCIPgetCurrentNode(scip));
+      if ( nodenumber != propdata->nodepruningnode )
+      {
+         SYMNODEFORM* form;
+         SCIP_Bool symmetric;
+
+         propdata->nodepruningnode = nodenumber;
+         *result = SCIP_DIDNOTFIND;
+
+         SCIP_CALL( computeNodeForm(scip, propdata, SCIPgetCurrentNode(scip), &form) );
+         if ( form != NULL )
+         {
+            symmetric = SCIPhashtableExists(propdata->leafforms, (void*) form);
+            freeNodeForm(scip, &form);
+
+            if ( symmetric )
+            {
+               SCIPdebugMsg(scip, "Node %" SCIP_LONGINT_FORMAT " is symmetric to a finished leaf.\n", nodenumber);
+
+               ++propdata->nprunednodes;
+               *result = SCIP_CUTOFF;
+
+               return SCIP_OKAY;
+            }
+         }
+      }
+   }
+
+   /* propagate symresacks by lexicographic reduction */
+   if ( propdata->nlexperms > 0 )
+   {
+      *result = SCIP_DIDNOTFIND;
+
+      SCIP_CALL( propagateLexReduction(scip, propdata, &infeasible, &nprop) );
+
+      if ( infeasible )
+      {
+         *result = SCIP_CUTOFF;
+         return SCIP_OKAY;
+      }
+      else if ( nprop > 0 )
+         *result = SCIP_REDUCEDDOM;
+   }
+
+   /* propagate orbitopes on general integer variables by orbitopal reduction */
+   for (i = 0; i < propdata->nintorbitopes; ++i)
+   {
+      if ( *result == SCIP_DIDNOTRUN )
+         *result = SCIP_DIDNOTFIND;
+
+      SCIP_CALL( propagateIntOrbitope(scip, propdata->intorbitopevars[i], propdata->intorbitopenrows[i],
+            propdata->intorbitopencols[i], &infeasible, &nprop) );
+
+      if ( infeasible )
+      {
+         *result = SCIP_CUTOFF;
+         return SCIP_OKAY;
+      }
+      else if ( nprop > 0 )
+         *result = SCIP_REDUCEDDOM;
+   }
+
+   /* do not propagate if orbital fixing is not enabled or if there are no branching decisions in the root */
+   if ( ! propdata->ofenabled || SCIPgetDepth(scip) <= 0 )
+      return SCIP_OKAY;
+
    /* return if we already ran in this node */
    nodenumber = SCIPnodeGetNumber(SCIPgetCurrentNode(scip));
    if ( nodenumber == propdata->nodenumber )
@@ -7255,7 +9900,8 @@ SCIP_DECL_PROPEXEC(propExecSymmetry)
    propdata->nodenumber = nodenumber;
 
    /* propagate */
-   *result = SCIP_DIDNOTFIND;
+   if ( *result == SCIP_DIDNOTRUN )
+      *result = SCIP_DIDNOTFIND;
 
    SCIPdebugMsg(scip, "Propagating <%s>.\n", SCIPpropGetName(prop));
 
@@ -7292,6 +9938,7 @@ SCIP_DECL_PROPEXIT(propExitSymmetry)
    assert( propdata != NULL );
 
    SCIP_CALL( freeSymmetryData(scip, propdata) );
+   freeGenCache(scip, &propdata->gencache);
 
    /* reset basic data */
    propdata->usesymmetry = -1;
@@ -7299,6 +9946,7 @@ SCIP_DECL_PROPEXIT(propExitSymmetry)
    propdata->triedaddconss = FALSE;
    propdata->nsymresacks = 0;
    propdata->norbitopes = 0;
+   propdata->nsubsymorbitopes = 0;
    propdata->ofenabled = FALSE;
    propdata->sstenabled = FALSE;
    propdata->lastrestart = 0;
@@ -7306,6 +9954,9 @@ SCIP_DECL_PROPEXIT(propExitSymmetry)
    propdata->nfixedone = 0;
    propdata->nodenumber = -1;
    propdata->offoundreduction = FALSE;
+   propdata->nodepruningrun = -1;
+   propdata->nodepruningnode = -1;
+   propdata->nprunednodes = 0;
 
    return SCIP_OKAY;
 }
@@ -7370,6 +10021,12 @@ SCIP_RETCODE SCIPincludePropSymmetry(
    propdata->npermvars = 0;
    propdata->nbinpermvars = 0;
    propdata->permvars = NULL;
+   propdata->gencache.hash = 0;
+   propdata->gencache.npermvars = 0;
+   propdata->gencache.nperms = 0;
+   propdata->gencache.perms = NULL;
+   propdata->gencache.log10groupsize = 0.0;
+   propdata->gencachefile = NULL;
 #ifndef NDEBUG
    propdata->permvarsobj = NULL;
 #endif
@@ -7403,6 +10060,7 @@ SCIP_RETCODE SCIPincludePropSymmetry(
    propdata->genlinconsssize = 0;
    propdata->nsymresacks = 0;
    propdata->norbitopes = 0;
+   propdata->nsubsymorbitopes = 0;
    propdata->isnonlinvar = NULL;
 
    propdata->ofenabled = FALSE;
@@ -7414,6 +10072,31 @@ SCIP_RETCODE SCIPincludePropSymmetry(
    propdata->nbg1 = 0;
    propdata->permvarsevents = NULL;
    propdata->inactiveperms = NULL;
+   propdata->supportbegins = NULL;
+   propdata->supportperms = NULL;
+   propdata->supportimages = NULL;
+   propdata->nsupport = 0;
+   propdata->nlexperms = 0;
+   propdata->intorbitopevars = NULL;
+   propdata->intorbitopenrows = NULL;
+   propdata->intorbitopencols = NULL;
+   propdata->nintorbitopes = 0;
+   propdata->maxnintorbitopes = 0;
+   propdata->lexsupportbegins = NULL;
+   propdata->lexsupportperms = NULL;
+   propdata->lexsupportimages = NULL;
+   propdata->lexpermbegins = NULL;
+   propdata->lexpermvars = NULL;
+   propdata->lexpermpreimages = NULL;
+   propdata->nlexpairs = 0;
+   propdata->ofcompvars = NULL;
+   propdata->ofcompvarbegins = NULL;
+   propdata->oforbits = NULL;
+   propdata->oforbitbegins = NULL;
+   propdata->ofnorbits = NULL;
+   propdata->ofpermtocomponent = NULL;
+   propdata->ofinactiveperms = NULL;
+   propdata->ofvaradded = NULL;
    propdata->nmovedpermvars = -1;
    propdata->nmovedbinpermvars = 0;
    propdata->nmovedintpermvars = 0;
@@ -7425,6 +10108,13 @@ SCIP_RETCODE SCIPincludePropSymmetry(
    propdata->nodenumber = -1;
    propdata->offoundreduction = FALSE;
 
+   propdata->nodepruningenabled = FALSE;
+   propdata->nodeseventfilterpos = -1;
+   propdata->leafforms = NULL;
+   propdata->nodepruningrun = -1;
+   propdata->nodepruningnode = -1;
+   propdata->nprunednodes = 0;
+
    propdata->sstenabled = FALSE;
    propdata->sstconss = NULL;
    propdata->nsstconss = 0;
@@ -7439,6 +10129,11 @@ SCIP_RETCODE SCIPincludePropSymmetry(
          eventExecSymmetry, NULL) );
    assert( propdata->eventhdlr != NULL );
 
+   propdata->eventhdlrnodes = NULL;
+   SCIP_CALL( SCIPincludeEventhdlrBasic(scip, &(propdata->eventhdlrnodes), EVENTHDLR_SYMNODES_NAME, EVENTHDLR_SYMNODES_DESC,
+         eventExecSymmetryNodes, NULL) );
+   assert( propdata->eventhdlrnodes != NULL );
+
    /* include constraint handler */
    SCIP_CALL( SCIPincludePropBasic(scip, &prop, PROP_NAME, PROP_DESC,
          PROP_PRIORITY, PROP_FREQ, PROP_DELAY, PROP_TIMING, propExecSymmetry, propdata) );
@@ -7464,6 +10159,11 @@ SCIP_RETCODE SCIPincludePropSymmetry(
          "limit on the number of generators that should be produced within symmetry detection (0 = no limit)",
          &propdata->maxgenerators, TRUE, DEFAULT_MAXGENERATORS, 0, INT_MAX, NULL, NULL) );
 
+   SCIP_CALL( SCIPaddRealParam(scip,
+         "propagating/" PROP_NAME "/timelimit",
+         "wall clock time limit in seconds for the search of generators (the generators found so far are used if it is reached)",
+         &propdata->timelimit, TRUE, DEFAULT_TIMELIMIT, 0.0, SCIP_REAL_MAX, NULL, NULL) );
+
    SCIP_CALL( SCIPaddBoolParam(scip,
          "propagating/" PROP_NAME "/checksymmetries",
          "Should all symmetries be checked after computation?",
@@ -7490,6 +10190,11 @@ SCIP_RETCODE SCIPincludePropSymmetry(
          "Add inequalities for symresacks for each generator?",
          &propdata->addsymresacks, TRUE, DEFAULT_ADDSYMRESACKS, NULL, NULL) );
 
+   SCIP_CALL( SCIPaddBoolParam(scip,
+         "propagating/" PROP_NAME "/lexreduction",
+         "Should the symresacks be propagated by the propagator instead of adding symresack constraints?",
+         &propdata->lexreduction, TRUE, DEFAULT_LEXREDUCTION, NULL, NULL) );
+
    SCIP_CALL( SCIPaddBoolParam(scip,
          "propagating/" PROP_NAME "/detectorbitopes",
          "Should we check whether the components of the symmetry group can be handled by orbitopes?",
@@ -7526,6 +10231,21 @@ SCIP_RETCODE SCIPincludePropSymmetry(
          "recompute symmetries after a restart has occured? (0 = never, 1 = always, 2 = if OF found reduction)",
          &propdata->recomputerestart, TRUE, DEFAULT_RECOMPUTERESTART, 0, 2, NULL, NULL) );
 
+   SCIP_CALL( SCIPaddBoolParam(scip,
+         "propagating/" PROP_NAME "/cachegenerators",
+         "Should generators be reused after a restart if the symmetry detection graph did not change?",
+         &propdata->cachegenerators, TRUE, DEFAULT_CACHEGENERATORS, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddStringParam(scip,
+         "propagating/" PROP_NAME "/gencachefile",
+         "file to read generators of an unchanged symmetry detection graph from and to store computed generators in (\"-\" if none)",
+         &propdata->gencachefile, TRUE, DEFAULT_GENCACHEFILE, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddBoolParam(scip,
+         "propagating/" PROP_NAME "/nodepruning",
+         "Should nodes be pruned whose branching decisions are symmetric to those of a finished leaf (only if no other symmetry handling method is active)?",
+         &propdata->nodepruning, TRUE, DEFAULT_NODEPRUNING, NULL, NULL) );
+
    SCIP_CALL( SCIPaddBoolParam(scip,
          "propagating/" PROP_NAME "/compresssymmetries",
          "Should non-affected variables be removed from permutation to save memory?",
@@ -7551,6 +10271,16 @@ SCIP_RETCODE SCIPincludePropSymmetry(
          "whether dynamic propagation should be used for full orbitopes",
          &propdata->usedynamicprop, TRUE, DEFAULT_USEDYNAMICPROP, NULL, NULL) );
 
+   SCIP_CALL( SCIPaddBoolParam(scip,
+         "propagating/" PROP_NAME "/detectsubsym",
+         "Should sub-symmetry structures of orbitopes be detected and handled by activation handlers?",
+         &propdata->detectsubsym, TRUE, DEFAULT_DETECTSUBSYM, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddBoolParam(scip,
+         "propagating/" PROP_NAME "/intorbitopes",
+         "Should orbitopes on general integer variables be detected and handled by orbitopal reduction?",
+         &propdata->intorbitopes, TRUE, DEFAULT_INTORBITOPES, NULL, NULL) );
+
    SCIP_CALL( SCIPaddBoolParam(scip,
          "propagating/" PROP_NAME "/addstrongsbcs",
          "Should strong SBCs for enclosing orbit of symmetric subgroups be added if orbitopes are not used?",
@@ -7667,6 +10397,12 @@ SCIP_RETCODE SCIPgetSymmetry(
 
    if ( permstrans != NULL )
    {
+      /* the transposed permutations are only stored densely on demand */
+      if ( propdata->permstrans == NULL && propdata->nperms > 0 )
+      {
+         SCIP_CALL( createPermstrans(scip, propdata) );
+      }
+
       *permstrans = propdata->permstrans;
       assert( *permstrans != NULL || *nperms <= 0 );
    }
@@ -739,6 +739,14 @@ SCIP_Bool SCIPconsIsTransformed(
    SCIP_CONS*            cons                /**< constraint */
    );
 
+/** returns the constraint itself if it is an original constraint, the associated original constraint of a transformed
+ *  constraint, or NULL if the transformed constraint has no associated original constraint
+ */
+SCIP_EXPORT
+SCIP_CONS* SCIPconsGetOriginal(
+   SCIP_CONS*            cons                /**< constraint */
+   );
+
 /** returns TRUE iff roundings for variables in constraint are locked */
 SCIP_EXPORT
 SCIP_Bool SCIPconsIsLockedPos(
@@ -865,6 +873,7 @@ int SCIPconsGetNUpgradeLocks(
 #define SCIPconsIsInProb(cons)          ((cons)->addconssetchg == NULL && (cons)->addarraypos >= 0)
 #define SCIPconsIsOriginal(cons)        (cons)->original
 #define SCIPconsIsTransformed(cons)     !(cons)->original
+#define SCIPconsGetOriginal(cons)       ((cons)->original ? (cons) : (cons)->transorigcons)
 #define SCIPconsIsLockedPos(cons)       ((cons)->nlockspos[SCIP_LOCKTYPE_MODEL] > 0)
 #define SCIPconsIsLockedNeg(cons)       ((cons)->nlocksneg[SCIP_LOCKTYPE_MODEL] > 0)
 #define SCIPconsIsLocked(cons)          ((cons)->nlockspos[SCIP_LOCKTYPE_MODEL] > 0 || (cons)->nlocksneg[SCIP_LOCKTYPE_MODEL] > 0)
@@ -204,6 +204,10 @@ void SCIPnodeGetNDomchg(
 
 /** gets the domain change information of the node, i.e., the information about the differences in the
  *  variables domains to the parent node
+ *
+ *  @note the bound changes of a leaf may be stored compactly if the memory limit is approached; use
+ *        SCIPnodeGetParentBranchings() to access the branching decisions of leaves, or expand them with
+ *        SCIPexpandNodeDomchg() first
  */
 SCIP_EXPORT
 SCIP_DOMCHG* SCIPnodeGetDomchg(
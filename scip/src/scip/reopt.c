@@ -3927,7 +3927,7 @@ SCIP_RETCODE addSplitcons(
 
            if ( SCIPsetIsFeasEQ(set, consval, 1.0) )
            {
-              SCIP_CALL( SCIPvarNegate(consvars[v], blkmem, set, stat, &consvars[v]) );
+              SCIP_CALL( SCIPvarNegate(consvars[v], blkmem, set, stat, transprob, &consvars[v]) );
               assert(SCIPvarIsNegated(consvars[v]));
            }
          }
@@ -7730,7 +7730,7 @@ SCIP_RETCODE SCIPreoptApplyGlbConss(
             if( SCIPsetIsFeasEQ(set, reopt->glbconss[c]->vals[v], 0.0) )
             {
                assert(reopt->glbconss[c]->boundtypes[v] == SCIP_BOUNDTYPE_UPPER);
-               SCIP_CALL( SCIPvarNegate(consvars[v], blkmem, set, stat, &consvars[v]) );
+               SCIP_CALL( SCIPvarNegate(consvars[v], blkmem, set, stat, NULL, &consvars[v]) );
             }
          }
 
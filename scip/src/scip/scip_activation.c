@@ -154,6 +154,38 @@ SCIP_RETCODE SCIPsetActivationhdlrFindActivationData(
    return SCIP_OKAY;
 }
 
+/** sets constraint deletion method of activation handler */
+SCIP_RETCODE SCIPsetActivationhdlrConsDelete(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_ACTIVATIONHDLR*  activationhdlr,     /**< activation handler */
+   SCIP_DECL_ACTIVATIONCONSDELETE((*activationconsdelete))     /**< constraint deletion method of activation handler */
+   )
+{
+   SCIP_CALL( SCIPcheckStage(scip, "SCIPsetActivationhdlrConsDelete", TRUE, TRUE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE) );
+
+   assert(activationhdlr != NULL);
+
+   SCIPactivationhdlrSetConsDelete(activationhdlr, activationconsdelete);
+
+   return SCIP_OKAY;
+}
+
+/** sets constraint copying method of activation handler */
+SCIP_RETCODE SCIPsetActivationhdlrConsCopy(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_ACTIVATIONHDLR*  activationhdlr,     /**< activation handler */
+   SCIP_DECL_ACTIVATIONCONSCOPY((*activationconscopy))     /**< constraint copying method of activation handler */
+   )
+{
+   SCIP_CALL( SCIPcheckStage(scip, "SCIPsetActivationhdlrConsCopy", TRUE, TRUE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE) );
+
+   assert(activationhdlr != NULL);
+
+   SCIPactivationhdlrSetConsCopy(activationhdlr, activationconscopy);
+
+   return SCIP_OKAY;
+}
+
 /** returns the activation handler of the given name, or NULL if not existing */
 SCIP_EXPORT
 SCIP_ACTIVATIONHDLR* SCIPfindActivationhdlr(
@@ -102,6 +102,22 @@ SCIP_RETCODE SCIPsetActivationhdlrFindActivationData(
    SCIP_DECL_ACTIVATIONFINDDATA((*activationfindactivationdata))     /**< TODO */
    );
 
+/** sets constraint deletion method of activation handler */
+SCIP_EXPORT
+SCIP_RETCODE SCIPsetActivationhdlrConsDelete(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_ACTIVATIONHDLR*  activationhdlr,     /**< activation handler */
+   SCIP_DECL_ACTIVATIONCONSDELETE((*activationconsdelete))     /**< constraint deletion method of activation handler */
+   );
+
+/** sets constraint copying method of activation handler */
+SCIP_EXPORT
+SCIP_RETCODE SCIPsetActivationhdlrConsCopy(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_ACTIVATIONHDLR*  activationhdlr,     /**< activation handler */
+   SCIP_DECL_ACTIVATIONCONSCOPY((*activationconscopy))     /**< constraint copying method of activation handler */
+   );
+
 /** returns the activation handler of the given name, or NULL if not existing */
 SCIP_EXPORT
 SCIP_ACTIVATIONHDLR* SCIPfindActivationhdlr(
@@ -36,6 +36,7 @@
 /*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
 
 #include "blockmemshell/memory.h"
+#include "scip/activation.h"
 #include "scip/benders.h"
 #include "scip/clock.h"
 #include "scip/conflictstore.h"
@@ -45,6 +46,7 @@
 #include "scip/debug.h"
 #include "scip/primal.h"
 #include "scip/prob.h"
+#include "scip/pub_activation.h"
 #include "scip/pub_cons.h"
 #include "scip/pub_cutpool.h"
 #include "scip/pub_implics.h"
@@ -54,6 +56,7 @@
 #include "scip/pub_nlpi.h"
 #include "scip/pub_sol.h"
 #include "scip/pub_var.h"
+#include "scip/scip_activation.h"
 #include "scip/scip_branch.h"
 #include "scip/scip_cons.h"
 #include "scip/scip_copy.h"
@@ -1544,6 +1547,9 @@ SCIP_RETCODE SCIPtranslateSubSols(
  *  @note The constraint is always captured, either during the creation of the copy or after finding the copy of the
  *        constraint in the constraint hash map
  *
+ *  @note If the source constraint has an activation handler whose activation data cannot be copied, no target
+ *        constraint is created, but the copy stays valid, since these constraints only handle symmetries
+ *
  *  @note In a multi thread case, you need to lock the copying procedure from outside with a mutex.
  *  @note Do not change the source SCIP environment during the copying process
  *
@@ -1654,6 +1660,36 @@ SCIP_RETCODE SCIPgetConsCopy(
       /* it is possible for the constraint handler to declare the copy valid although no target constraint was created */
       assert(*targetcons == NULL || *valid);
 
+      /* register the copy with the activation handler of the target SCIP, such that it is only active where the source
+       * constraint is active; a copy that would always be active might cut off solutions, so it is discarded if its
+       * activation cannot be copied; constraints with an activation handler handle symmetries, so discarding them
+       * only relaxes the copy and the copy stays valid
+       */
+      if( *targetcons != NULL && SCIPconsGetActivationhdlr(sourcecons) != NULL )
+      {
+         SCIP_ACTIVATIONHDLR* sourceactivationhdlr;
+         SCIP_ACTIVATIONHDLR* targetactivationhdlr;
+         SCIP_Bool activationvalid;
+
+         sourceactivationhdlr = SCIPconsGetActivationhdlr(sourcecons);
+         targetactivationhdlr = SCIPfindActivationhdlr(targetscip, SCIPactivationhdlrGetName(sourceactivationhdlr));
+         activationvalid = FALSE;
+
+         if( targetactivationhdlr != NULL )
+         {
+            SCIP_CALL( SCIPactivationhdlrConsCopy(targetactivationhdlr, targetscip->set, sourcescip,
+                  sourceactivationhdlr, sourcecons, *targetcons, localvarmap, &activationvalid) );
+         }
+
+         if( !activationvalid )
+         {
+            SCIPdebugMsg(targetscip, "could not copy activation of constraint <%s>, discarding its copy\n",
+               SCIPconsGetName(sourcecons));
+
+            SCIP_CALL( SCIPreleaseCons(targetscip, targetcons) );
+         }
+      }
+
       /* if a target constraint was created */
       if( *targetcons != NULL && !uselocalconsmap )
       {
@@ -1859,9 +1895,11 @@ SCIP_RETCODE SCIPcopyConss(
          {
             /* if an enforced or checked constraint could not be copied, then the copy is not valid, i.e.,
              * the feasible set may be larger; for other constraints, it should be safe if they are omitted
-             * from the copy
+             * from the copy; constraints with an activation handler only handle symmetries, so omitting them
+             * only relaxes the copy
              */
-            if( SCIPconsIsEnforced(sourceconss[c]) || SCIPconsIsChecked(sourceconss[c]) )
+            if( (SCIPconsIsEnforced(sourceconss[c]) || SCIPconsIsChecked(sourceconss[c]))
+               && SCIPconsGetActivationhdlr(sourceconss[c]) == NULL )
                *valid = FALSE;
             SCIPdebugMsg(sourcescip, "Constraint %s not copied, copy is %svalid\n",
                   SCIPconsGetName(sourceconss[c]), *valid ? "" : "not ");
@@ -1997,10 +2035,12 @@ SCIP_RETCODE SCIPcopyOrigConss(
             SCIPconsIsPropagated(sourceconss[c]), FALSE, SCIPconsIsModifiable(sourceconss[c]),
             SCIPconsIsDynamic(sourceconss[c]), SCIPconsIsRemovable(sourceconss[c]), FALSE, TRUE, &success) );
 
-      /* add the copied constraint to target SCIP if the copying process was valid */
-      if( success )
+      /* add the copied constraint to target SCIP if the copying process was valid; a constraint whose activation could
+       * not be copied is discarded without invalidating the copy
+       */
+      if( targetcons != NULL )
       {
-         assert(targetcons != NULL);
+         assert(success);
 
          if( !enablepricing )
             SCIPconsSetModifiable(targetcons, FALSE);
@@ -2011,7 +2051,7 @@ SCIP_RETCODE SCIPcopyOrigConss(
          /* release constraint once for the creation capture */
          SCIP_CALL( SCIPreleaseCons(targetscip, &targetcons) );
       }
-      else
+      else if( !success && SCIPconsGetActivationhdlr(sourceconss[c]) == NULL )
       {
          *valid = FALSE;
          SCIPdebugMsg(sourcescip, "failed to copy constraint %s\n", SCIPconsGetName(sourceconss[c]));
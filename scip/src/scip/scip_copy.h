@@ -523,6 +523,9 @@ SCIP_RETCODE SCIPtranslateSubSols(
  *  @note The constraint is always captured, either during the creation of the copy or after finding the copy of the
  *        constraint in the constraint hash map
  *
+ *  @note If the source constraint has an activation handler whose activation data cannot be copied, no target
+ *        constraint is created, but the copy stays valid, since these constraints only handle symmetries
+ *
  *  @note In a multi thread case, you need to lock the copying procedure from outside with a mutex.
  *  @note Do not change the source SCIP environment during the copying process
  *
@@ -88,7 +88,7 @@ SCIP_RETCODE SCIPincludeEventhdlr(
 /** creates an event handler and includes it in SCIP with all its non-fundamental callbacks set
  *  to NULL; if needed, non-fundamental callbacks can be set afterwards via setter functions
  *  SCIPsetEventhdlrCopy(), SCIPsetEventhdlrFree(), SCIPsetEventhdlrInit(), SCIPsetEventhdlrExit(),
- *  SCIPsetEventhdlrInitsol(), SCIPsetEventhdlrExitsol(), and SCIPsetEventhdlrDelete()
+ *  SCIPsetEventhdlrInitsol(), SCIPsetEventhdlrExitsol(), SCIPsetEventhdlrDelete(), and SCIPsetEventhdlrExecBatch()
  *
  *  @note if you want to set all callbacks with a single method call, consider using SCIPincludeEventhdlr() instead
  */
@@ -221,6 +221,20 @@ SCIP_RETCODE SCIPsetEventhdlrDelete(
    return SCIP_OKAY;
 }
 
+/** sets batched execution method of the event handler for local bound change events caught during propagation */
+SCIP_RETCODE SCIPsetEventhdlrExecBatch(
+   SCIP*                 scip,               /**< scip instance */
+   SCIP_EVENTHDLR*       eventhdlr,          /**< event handler */
+   SCIP_DECL_EVENTEXECBATCH((*eventexecbatch)) /**< batched execution method of event handler */
+   )
+{
+   assert(scip != NULL);
+   SCIP_CALL( SCIPcheckStage(scip, "SCIPsetEventhdlrExecBatch", TRUE, TRUE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE) );
+
+   SCIPeventhdlrSetExecBatch(eventhdlr, eventexecbatch);
+   return SCIP_OKAY;
+}
+
 /** returns the event handler of the given name, or NULL if not existing */
 SCIP_EVENTHDLR* SCIPfindEventhdlr(
    SCIP*                 scip,               /**< SCIP data structure */
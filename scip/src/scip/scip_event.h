@@ -73,7 +73,7 @@ SCIP_RETCODE SCIPincludeEventhdlr(
 /** creates an event handler and includes it in SCIP with all its non-fundamental callbacks set
  *  to NULL; if needed, non-fundamental callbacks can be set afterwards via setter functions
  *  SCIPsetEventhdlrCopy(), SCIPsetEventhdlrFree(), SCIPsetEventhdlrInit(), SCIPsetEventhdlrExit(),
- *  SCIPsetEventhdlrInitsol(), SCIPsetEventhdlrExitsol(), and SCIPsetEventhdlrDelete()
+ *  SCIPsetEventhdlrInitsol(), SCIPsetEventhdlrExitsol(), SCIPsetEventhdlrDelete(), and SCIPsetEventhdlrExecBatch()
  *
  *  @note if you want to set all callbacks with a single method call, consider using SCIPincludeEventhdlr() instead
  */
@@ -143,6 +143,14 @@ SCIP_RETCODE SCIPsetEventhdlrDelete(
    SCIP_DECL_EVENTDELETE ((*eventdelete))    /**< free specific event data */
    );
 
+/** sets batched execution method of the event handler for local bound change events caught during propagation */
+SCIP_EXPORT
+SCIP_RETCODE SCIPsetEventhdlrExecBatch(
+   SCIP*                 scip,               /**< scip instance */
+   SCIP_EVENTHDLR*       eventhdlr,          /**< event handler */
+   SCIP_DECL_EVENTEXECBATCH((*eventexecbatch)) /**< batched execution method of event handler */
+   );
+
 /** returns the event handler of the given name, or NULL if not existing */
 SCIP_EXPORT
 SCIP_EVENTHDLR* SCIPfindEventhdlr(
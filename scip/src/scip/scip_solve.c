@@ -2976,6 +2976,16 @@ SCIP_RETCODE SCIPsolveConcurrent(
       SCIP_Real*            prios;
       int                   ncandsolvertypes;
       SCIP_Real             prefpriosum;
+      SCIP_Bool             symracing;
+
+      /* if the symmetry handling methods race against each other, the main SCIP must not handle symmetries itself, since
+       * its presolved problem is copied to the racers and the concurrent solvers; this is recorded in the syncstore
+       * until the transformed problem is freed, so that misc/usesymmetry keeps the value set by the user
+       */
+      symracing = scip->set->concurrent_symracing && scip->set->concurrent_nsubtrees == 0;
+
+      if( symracing )
+         SCIPsyncstoreSetSymmetryRacingScip(scip->syncstore, scip);
 
       /* check if concurrent solve is configured to presolve the problem
        * before setting up the concurrent solvers
@@ -3038,6 +3048,42 @@ SCIP_RETCODE SCIPsolveConcurrent(
       nthreads = MIN(nthreads, maxnthreads);
       SCIPverbMessage(scip, SCIP_VERBLEVEL_FULL, NULL, "using %lli threads for concurrent solve\n", nthreads);
 
+      /* let the symmetry handling methods race against each other, so that the concurrent solvers use the winner */
+      if( symracing )
+      {
+         SCIP_STATUS racestatus;
+
+         SCIP_CALL( SCIPconcurrentRaceSymmetry(scip, (int) nthreads, &racestatus) );
+
+         /* if a racer solved the problem, its solutions were added to the main SCIP and its result is used instead of
+          * solving the problem concurrently
+          */
+         if( racestatus != SCIP_STATUS_UNKNOWN )
+         {
+            SCIP_CALL( initSolve(scip, TRUE) );
+
+            scip->stat->status = racestatus;
+
+            if( racestatus == SCIP_STATUS_OPTIMAL )
+            {
+               SCIP_CALL( SCIPupdateNodeLowerbound(scip, SCIPgetRootNode(scip), SCIPgetUpperbound(scip)) );
+            }
+
+            scip->set->stage = SCIP_STAGE_SOLVED;
+
+            SCIP_CALL( displayRelevantStats(scip) );
+            return SCIP_OKAY;
+         }
+      }
+
+      /* split the search tree before the concurrent solvers are created, so that they start with the best solution */
+      if( scip->set->concurrent_nsubtrees > 0 )
+      {
+         SCIP_CALL( SCIPconcurrentCreateSubtrees(scip, (int) nthreads * scip->set->concurrent_nsubtrees) );
+         SCIPverbMessage(scip, SCIP_VERBLEVEL_HIGH, NULL, "split search tree into %d subtrees for concurrent solve\n",
+            SCIPsyncstoreGetNSubtrees(SCIPgetSyncstore(scip)));
+      }
+
       /* now set up nthreads many concurrent solvers that will be used for the concurrent solve
        * using the preferred priorities of each concurrent solver
        */
@@ -3464,6 +3510,11 @@ SCIP_RETCODE SCIPfreeTransform(
       /* free transformed problem data structures */
       SCIP_CALL( freeTransform(scip) );
       assert(scip->set->stage == SCIP_STAGE_PROBLEM);
+
+      /* enable symmetry handling again, which was disabled for a concurrent solve with symmetry racing */
+      if( SCIPsyncstoreIsSymmetryRacingScip(scip->syncstore, scip) )
+         SCIPsyncstoreSetSymmetryRacingScip(scip->syncstore, NULL);
+
       return SCIP_OKAY;
 
    case SCIP_STAGE_TRANSFORMING:
@@ -454,6 +454,27 @@ SCIP_RETCODE SCIPrepropagateNode(
    return SCIP_OKAY;
 }
 
+/** expands the branching decisions of a leaf that are stored compactly if the memory limit is approached, such that
+ *  the bound changes of SCIPnodeGetDomchg() can be accessed
+ *
+ *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
+ *          SCIP_Retcode "SCIP_RETCODE" for a complete list of error codes.
+ *
+ *  @pre This method can be called if @p scip is in one of the following stages:
+ *       - \ref SCIP_STAGE_SOLVING
+ */
+SCIP_RETCODE SCIPexpandNodeDomchg(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_NODE*            node                /**< node whose domain change data should be expanded */
+   )
+{
+   SCIP_CALL( SCIPcheckStage(scip, "SCIPexpandNodeDomchg", FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, TRUE, FALSE, FALSE, FALSE, FALSE) );
+
+   SCIP_CALL( SCIPnodeExpandDomchg(node, scip->mem->probmem) );
+
+   return SCIP_OKAY;
+}
+
 /** returns depth of first node in active path that is marked being cutoff
  *
  *  @return depth of first node in active path that is marked being cutoff
@@ -401,6 +401,21 @@ SCIP_RETCODE SCIPrepropagateNode(
    SCIP_NODE*            node                /**< node that should be propagated again */
    );
 
+/** expands the branching decisions of a leaf that are stored compactly if the memory limit is approached, such that
+ *  the bound changes of SCIPnodeGetDomchg() can be accessed
+ *
+ *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
+ *          SCIP_Retcode "SCIP_RETCODE" for a complete list of error codes.
+ *
+ *  @pre This method can be called if @p scip is in one of the following stages:
+ *       - \ref SCIP_STAGE_SOLVING
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPexpandNodeDomchg(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_NODE*            node                /**< node whose domain change data should be expanded */
+   );
+
 /** returns depth of first node in active path that is marked being cutoff
  *
  *  @return depth of first node in active path that is marked being cutoff
@@ -1447,7 +1447,7 @@ SCIP_RETCODE SCIPgetTransformedVar(
       *transvar = var;
    else
    {
-      SCIP_CALL( SCIPvarGetTransformed(var, scip->mem->probmem, scip->set, scip->stat, transvar) );
+      SCIP_CALL( SCIPvarGetTransformed(var, scip->mem->probmem, scip->set, scip->stat, scip->transprob, transvar) );
    }
 
    return SCIP_OKAY;
@@ -1494,7 +1494,7 @@ SCIP_RETCODE SCIPgetTransformedVars(
          transvars[v] = vars[v];
       else
       {
-         SCIP_CALL( SCIPvarGetTransformed(vars[v], scip->mem->probmem, scip->set, scip->stat, &transvars[v]) );
+         SCIP_CALL( SCIPvarGetTransformed(vars[v], scip->mem->probmem, scip->set, scip->stat, scip->transprob, &transvars[v]) );
       }
    }
 
@@ -1530,7 +1530,7 @@ SCIP_RETCODE SCIPgetNegatedVar(
    SCIP_CALL( SCIPcheckStage(scip, "SCIPgetNegatedVar", FALSE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, FALSE) );
    assert( var->scip == scip );
 
-   SCIP_CALL( SCIPvarNegate(var, scip->mem->probmem, scip->set, scip->stat, negvar) );
+   SCIP_CALL( SCIPvarNegate(var, scip->mem->probmem, scip->set, scip->stat, scip->transprob, negvar) );
 
    return SCIP_OKAY;
 }
@@ -1567,7 +1567,7 @@ SCIP_RETCODE SCIPgetNegatedVars(
 
    for( v = 0; v < nvars; ++v )
    {
-      SCIP_CALL( SCIPvarNegate(vars[v], scip->mem->probmem, scip->set, scip->stat, &(negvars[v])) );
+      SCIP_CALL( SCIPvarNegate(vars[v], scip->mem->probmem, scip->set, scip->stat, scip->transprob, &(negvars[v])) );
    }
 
    return SCIP_OKAY;
@@ -2293,6 +2293,151 @@ SCIP_Bool SCIPgetVarWasFixedAtIndex(
       || (SCIPvarGetUbLocal(var) < 0.5 && SCIPgetVarUbAtIndex(scip, var, bdchgidx, after) < 0.5));
 }
 
+/** starts mirroring the local and global bounds of the variables of the transformed problem in dense arrays indexed by
+ *  the variable index (see SCIPvarGetIndex()), such that the bounds of many variables can be read at once with
+ *  SCIPgetMirroredVarBoundsLocal() and SCIPgetMirroredVarBoundsGlobal(); once enabled, the mirror is kept up to date
+ *  by every bound change until the transformed problem is freed
+ *
+ *  This method is typically called by plugins that repeatedly scan the bounds of a fixed set of variables, e.g., in
+ *  their initsol callback.
+ *
+ *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
+ *          SCIP_Retcode "SCIP_RETCODE" for a complete list of error codes.
+ *
+ *  @pre This method can be called if @p scip is in one of the following stages:
+ *       - \ref SCIP_STAGE_TRANSFORMED
+ *       - \ref SCIP_STAGE_INITPRESOLVE
+ *       - \ref SCIP_STAGE_PRESOLVING
+ *       - \ref SCIP_STAGE_EXITPRESOLVE
+ *       - \ref SCIP_STAGE_PRESOLVED
+ *       - \ref SCIP_STAGE_INITSOLVE
+ *       - \ref SCIP_STAGE_SOLVING
+ */
+SCIP_RETCODE SCIPenableVarBoundMirror(
+   SCIP*                 scip                /**< SCIP data structure */
+   )
+{
+   SCIP_CALL( SCIPcheckStage(scip, "SCIPenableVarBoundMirror", FALSE, FALSE, FALSE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, FALSE, FALSE, FALSE, FALSE) );
+
+   SCIP_CALL( SCIPprobEnableBoundMirror(scip->transprob, scip->set, scip->stat, scip->eventqueue) );
+
+   return SCIP_OKAY;
+}
+
+/** returns whether the bounds of the variables are mirrored in dense arrays
+ *
+ *  @pre This method can be called if @p scip is in one of the following stages:
+ *       - \ref SCIP_STAGE_TRANSFORMED
+ *       - \ref SCIP_STAGE_INITPRESOLVE
+ *       - \ref SCIP_STAGE_PRESOLVING
+ *       - \ref SCIP_STAGE_EXITPRESOLVE
+ *       - \ref SCIP_STAGE_PRESOLVED
+ *       - \ref SCIP_STAGE_INITSOLVE
+ *       - \ref SCIP_STAGE_SOLVING
+ *       - \ref SCIP_STAGE_SOLVED
+ *       - \ref SCIP_STAGE_EXITSOLVE
+ *
+ *  @see SCIPenableVarBoundMirror
+ */
+SCIP_Bool SCIPisVarBoundMirrorEnabled(
+   SCIP*                 scip                /**< SCIP data structure */
+   )
+{
+   SCIP_CALL_ABORT( SCIPcheckStage(scip, "SCIPisVarBoundMirrorEnabled", FALSE, FALSE, FALSE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, FALSE, FALSE) );
+
+   return scip->transprob->mirrorbounds;
+}
+
+/** returns whether the bounds of a transformed variable are covered by the bound mirror; this is the case for
+ *  active and fixed variables and for the negations of such variables, but not for aggregated and multi-aggregated
+ *  variables, whose bounds are derived from other variables and have to be read with SCIPvarGetLbLocal() and
+ *  SCIPvarGetUbLocal()
+ *
+ *  @pre This method can be called if @p scip is in one of the following stages:
+ *       - \ref SCIP_STAGE_TRANSFORMED
+ *       - \ref SCIP_STAGE_INITPRESOLVE
+ *       - \ref SCIP_STAGE_PRESOLVING
+ *       - \ref SCIP_STAGE_EXITPRESOLVE
+ *       - \ref SCIP_STAGE_PRESOLVED
+ *       - \ref SCIP_STAGE_INITSOLVE
+ *       - \ref SCIP_STAGE_SOLVING
+ *       - \ref SCIP_STAGE_SOLVED
+ *       - \ref SCIP_STAGE_EXITSOLVE
+ *
+ *  @see SCIPenableVarBoundMirror
+ */
+SCIP_Bool SCIPisVarBoundMirrored(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_VAR*             var                 /**< transformed variable */
+   )
+{
+   SCIP_CALL_ABORT( SCIPcheckStage(scip, "SCIPisVarBoundMirrored", FALSE, FALSE, FALSE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, FALSE, FALSE) );
+
+   return SCIPprobIsVarMirrored(scip->transprob, var);
+}
+
+/** gets the current local bounds of the transformed variables with the given indices from the bound mirror; this
+ *  avoids dereferencing every variable, but the indices have to be collected beforehand with SCIPvarGetIndex()
+ *
+ *  @pre The bound mirror has to be enabled with SCIPenableVarBoundMirror().
+ *
+ *  @pre The bounds of all given variables have to be covered by the bound mirror, see SCIPisVarBoundMirrored().
+ *
+ *  @pre This method can be called if @p scip is in one of the following stages:
+ *       - \ref SCIP_STAGE_TRANSFORMED
+ *       - \ref SCIP_STAGE_INITPRESOLVE
+ *       - \ref SCIP_STAGE_PRESOLVING
+ *       - \ref SCIP_STAGE_EXITPRESOLVE
+ *       - \ref SCIP_STAGE_PRESOLVED
+ *       - \ref SCIP_STAGE_INITSOLVE
+ *       - \ref SCIP_STAGE_SOLVING
+ *       - \ref SCIP_STAGE_SOLVED
+ *       - \ref SCIP_STAGE_EXITSOLVE
+ */
+void SCIPgetMirroredVarBoundsLocal(
+   SCIP*                 scip,               /**< SCIP data structure */
+   const int*            varindices,         /**< indices of transformed variables */
+   int                   nvars,              /**< number of variables */
+   SCIP_Real*            lbs,                /**< array to store the local lower bounds, or NULL */
+   SCIP_Real*            ubs                 /**< array to store the local upper bounds, or NULL */
+   )
+{
+   SCIP_CALL_ABORT( SCIPcheckStage(scip, "SCIPgetMirroredVarBoundsLocal", FALSE, FALSE, FALSE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, FALSE, FALSE) );
+
+   SCIPprobGetMirroredBounds(scip->transprob, varindices, nvars, FALSE, lbs, ubs);
+}
+
+/** gets the current global bounds of the transformed variables with the given indices from the bound mirror; this
+ *  avoids dereferencing every variable, but the indices have to be collected beforehand with SCIPvarGetIndex()
+ *
+ *  @pre The bound mirror has to be enabled with SCIPenableVarBoundMirror().
+ *
+ *  @pre The bounds of all given variables have to be covered by the bound mirror, see SCIPisVarBoundMirrored().
+ *
+ *  @pre This method can be called if @p scip is in one of the following stages:
+ *       - \ref SCIP_STAGE_TRANSFORMED
+ *       - \ref SCIP_STAGE_INITPRESOLVE
+ *       - \ref SCIP_STAGE_PRESOLVING
+ *       - \ref SCIP_STAGE_EXITPRESOLVE
+ *       - \ref SCIP_STAGE_PRESOLVED
+ *       - \ref SCIP_STAGE_INITSOLVE
+ *       - \ref SCIP_STAGE_SOLVING
+ *       - \ref SCIP_STAGE_SOLVED
+ *       - \ref SCIP_STAGE_EXITSOLVE
+ */
+void SCIPgetMirroredVarBoundsGlobal(
+   SCIP*                 scip,               /**< SCIP data structure */
+   const int*            varindices,         /**< indices of transformed variables */
+   int                   nvars,              /**< number of variables */
+   SCIP_Real*            lbs,                /**< array to store the global lower bounds, or NULL */
+   SCIP_Real*            ubs                 /**< array to store the global upper bounds, or NULL */
+   )
+{
+   SCIP_CALL_ABORT( SCIPcheckStage(scip, "SCIPgetMirroredVarBoundsGlobal", FALSE, FALSE, FALSE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, FALSE, FALSE) );
+
+   SCIPprobGetMirroredBounds(scip->transprob, varindices, nvars, TRUE, lbs, ubs);
+}
+
 /** gets solution value for variable in current node
  *
  *  @return solution value for variable in current node
@@ -960,6 +960,129 @@ SCIP_Bool SCIPgetVarWasFixedAtIndex(
    SCIP_Bool             after               /**< should the bound change with given index be included? */
    );
 
+/** starts mirroring the local and global bounds of the variables of the transformed problem in dense arrays indexed by
+ *  the variable index (see SCIPvarGetIndex()), such that the bounds of many variables can be read at once with
+ *  SCIPgetMirroredVarBoundsLocal() and SCIPgetMirroredVarBoundsGlobal(); once enabled, the mirror is kept up to date
+ *  by every bound change until the transformed problem is freed
+ *
+ *  This method is typically called by plugins that repeatedly scan the bounds of a fixed set of variables, e.g., in
+ *  their initsol callback.
+ *
+ *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
+ *          SCIP_Retcode "SCIP_RETCODE" for a complete list of error codes.
+ *
+ *  @pre This method can be called if @p scip is in one of the following stages:
+ *       - \ref SCIP_STAGE_TRANSFORMED
+ *       - \ref SCIP_STAGE_INITPRESOLVE
+ *       - \ref SCIP_STAGE_PRESOLVING
+ *       - \ref SCIP_STAGE_EXITPRESOLVE
+ *       - \ref SCIP_STAGE_PRESOLVED
+ *       - \ref SCIP_STAGE_INITSOLVE
+ *       - \ref SCIP_STAGE_SOLVING
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPenableVarBoundMirror(
+   SCIP*                 scip                /**< SCIP data structure */
+   );
+
+/** returns whether the bounds of the variables are mirrored in dense arrays
+ *
+ *  @pre This method can be called if @p scip is in one of the following stages:
+ *       - \ref SCIP_STAGE_TRANSFORMED
+ *       - \ref SCIP_STAGE_INITPRESOLVE
+ *       - \ref SCIP_STAGE_PRESOLVING
+ *       - \ref SCIP_STAGE_EXITPRESOLVE
+ *       - \ref SCIP_STAGE_PRESOLVED
+ *       - \ref SCIP_STAGE_INITSOLVE
+ *       - \ref SCIP_STAGE_SOLVING
+ *       - \ref SCIP_STAGE_SOLVED
+ *       - \ref SCIP_STAGE_EXITSOLVE
+ *
+ *  @see SCIPenableVarBoundMirror
+ */
+SCIP_EXPORT
+SCIP_Bool SCIPisVarBoundMirrorEnabled(
+   SCIP*                 scip                /**< SCIP data structure */
+   );
+
+/** returns whether the bounds of a transformed variable are covered by the bound mirror; this is the case for
+ *  active and fixed variables and for the negations of such variables, but not for aggregated and multi-aggregated
+ *  variables, whose bounds are derived from other variables and have to be read with SCIPvarGetLbLocal() and
+ *  SCIPvarGetUbLocal()
+ *
+ *  @pre This method can be called if @p scip is in one of the following stages:
+ *       - \ref SCIP_STAGE_TRANSFORMED
+ *       - \ref SCIP_STAGE_INITPRESOLVE
+ *       - \ref SCIP_STAGE_PRESOLVING
+ *       - \ref SCIP_STAGE_EXITPRESOLVE
+ *       - \ref SCIP_STAGE_PRESOLVED
+ *       - \ref SCIP_STAGE_INITSOLVE
+ *       - \ref SCIP_STAGE_SOLVING
+ *       - \ref SCIP_STAGE_SOLVED
+ *       - \ref SCIP_STAGE_EXITSOLVE
+ *
+ *  @see SCIPenableVarBoundMirror
+ */
+SCIP_EXPORT
+SCIP_Bool SCIPisVarBoundMirrored(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_VAR*             var                 /**< transformed variable */
+   );
+
+/** gets the current local bounds of the transformed variables with the given indices from the bound mirror; this
+ *  avoids dereferencing every variable, but the indices have to be collected beforehand with SCIPvarGetIndex()
+ *
+ *  @pre The bound mirror has to be enabled with SCIPenableVarBoundMirror().
+ *
+ *  @pre The bounds of all given variables have to be covered by the bound mirror, see SCIPisVarBoundMirrored().
+ *
+ *  @pre This method can be called if @p scip is in one of the following stages:
+ *       - \ref SCIP_STAGE_TRANSFORMED
+ *       - \ref SCIP_STAGE_INITPRESOLVE
+ *       - \ref SCIP_STAGE_PRESOLVING
+ *       - \ref SCIP_STAGE_EXITPRESOLVE
+ *       - \ref SCIP_STAGE_PRESOLVED
+ *       - \ref SCIP_STAGE_INITSOLVE
+ *       - \ref SCIP_STAGE_SOLVING
+ *       - \ref SCIP_STAGE_SOLVED
+ *       - \ref SCIP_STAGE_EXITSOLVE
+ */
+SCIP_EXPORT
+void SCIPgetMirroredVarBoundsLocal(
+   SCIP*                 scip,               /**< SCIP data structure */
+   const int*            varindices,         /**< indices of transformed variables */
+   int                   nvars,              /**< number of variables */
+   SCIP_Real*            lbs,                /**< array to store the local lower bounds, or NULL */
+   SCIP_Real*            ubs                 /**< array to store the local upper bounds, or NULL */
+   );
+
+/** gets the current global bounds of the transformed variables with the given indices from the bound mirror; this
+ *  avoids dereferencing every variable, but the indices have to be collected beforehand with SCIPvarGetIndex()
+ *
+ *  @pre The bound mirror has to be enabled with SCIPenableVarBoundMirror().
+ *
+ *  @pre The bounds of all given variables have to be covered by the bound mirror, see SCIPisVarBoundMirrored().
+ *
+ *  @pre This method can be called if @p scip is in one of the following stages:
+ *       - \ref SCIP_STAGE_TRANSFORMED
+ *       - \ref SCIP_STAGE_INITPRESOLVE
+ *       - \ref SCIP_STAGE_PRESOLVING
+ *       - \ref SCIP_STAGE_EXITPRESOLVE
+ *       - \ref SCIP_STAGE_PRESOLVED
+ *       - \ref SCIP_STAGE_INITSOLVE
+ *       - \ref SCIP_STAGE_SOLVING
+ *       - \ref SCIP_STAGE_SOLVED
+ *       - \ref SCIP_STAGE_EXITSOLVE
+ */
+SCIP_EXPORT
+void SCIPgetMirroredVarBoundsGlobal(
+   SCIP*                 scip,               /**< SCIP data structure */
+   const int*            varindices,         /**< indices of transformed variables */
+   int                   nvars,              /**< number of variables */
+   SCIP_Real*            lbs,                /**< array to store the global lower bounds, or NULL */
+   SCIP_Real*            ubs                 /**< array to store the global upper bounds, or NULL */
+   );
+
 /** gets solution value for variable in current node
  *
  *  @return solution value for variable in current node
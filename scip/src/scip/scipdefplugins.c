@@ -194,6 +194,7 @@ SCIP_RETCODE SCIPincludeDefaultPlugins(
    SCIP_CALL( SCIPincludeHeurZirounding(scip) );
    SCIP_CALL( SCIPincludePropDualfix(scip) );
    SCIP_CALL( SCIPincludePropGenvbounds(scip) );
+   SCIP_CALL( SCIPincludePropLinprop(scip) );
    SCIP_CALL( SCIPincludePropObbt(scip) );
    SCIP_CALL( SCIPincludePropNlobbt(scip) );
    SCIP_CALL( SCIPincludePropProbing(scip) );
@@ -201,6 +202,10 @@ SCIP_RETCODE SCIPincludeDefaultPlugins(
    SCIP_CALL( SCIPincludePropRedcost(scip) );
    SCIP_CALL( SCIPincludePropRootredcost(scip) );
    SCIP_CALL( SCIPincludePropSymmetry(scip) );
+   SCIP_CALL( SCIPincludeActivationSuborbitope(scip) ); /* activation handlers can be attached to orbitopes by symmetry detection */
+   SCIP_CALL( SCIPincludeActivationMakespan(scip) );
+   SCIP_CALL( SCIPincludeActivationColorComp(scip) );
+   SCIP_CALL( SCIPincludeActivationVarFix(scip) );
    SCIP_CALL( SCIPincludePropVbounds(scip) );
    SCIP_CALL( SCIPincludeSepaCGMIP(scip) );
    SCIP_CALL( SCIPincludeSepaClique(scip) );
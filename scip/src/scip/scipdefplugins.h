@@ -176,6 +176,7 @@
 #include "scip/activation_suborbitope.h"
 #include "scip/activation_makespan.h"
 #include "scip/activation_colorcomp.h"
+#include "scip/activation_varfix.h"
 #include "scip/presol_redvub.h"
 #include "scip/presol_qpkktref.h"
 #include "scip/presol_trivial.h"
@@ -185,6 +186,7 @@
 #include "scip/presol_stuffing.h"
 #include "scip/prop_dualfix.h"
 #include "scip/prop_genvbounds.h"
+#include "scip/prop_linprop.h"
 #include "scip/prop_nlobbt.h"
 #include "scip/prop_obbt.h"
 #include "scip/prop_probing.h"
@@ -252,6 +252,8 @@
 #define SCIP_DEFAULT_LP_ROWREPSWITCH        1.2 /**< simplex algorithm shall use row representation of the basis
                                                  *   if number of rows divided by number of columns exceeds this value */
 #define SCIP_DEFAULT_LP_THREADS               0 /**< number of threads used for solving the LP (0: automatic) */
+#define SCIP_DEFAULT_LP_SBTHREADS             1 /**< number of threads used for strong branching on copies of the LP
+                                                 *   (1: strong branching on the LP itself) */
 #define SCIP_DEFAULT_LP_RESOLVEITERFAC     -1.0 /**< factor of average LP iterations that is used as LP iteration limit
                                                  *   for LP resolve (-1.0: unlimited) */
 #define SCIP_DEFAULT_LP_RESOLVEITERMIN     1000 /**< minimum number of iterations that are allowed for LP resolve */
@@ -268,6 +270,8 @@
 /* Memory */
 
 #define SCIP_DEFAULT_MEM_SAVEFAC            0.8 /**< fraction of maximal mem usage when switching to memory saving mode */
+#define SCIP_DEFAULT_MEM_COMPACTFAC         0.6 /**< fraction of maximal mem usage when storing the branching decisions
+                                                 *   of open nodes compactly */
 #define SCIP_DEFAULT_MEM_TREEGROWFAC        2.0 /**< memory growing factor for tree array */
 #define SCIP_DEFAULT_MEM_PATHGROWFAC        2.0 /**< memory growing factor for path array */
 #define SCIP_DEFAULT_MEM_TREEGROWINIT     65536 /**< initial size of tree array */
@@ -319,6 +323,8 @@
 
 #define SCIP_DEFAULT_NODESEL_CHILDSEL       'h' /**< child selection rule ('d'own, 'u'p, 'p'seudo costs, 'i'nference, 'l'p value,
                                                  *   'r'oot LP value difference, 'h'brid inference/root LP value difference) */
+#define SCIP_DEFAULT_NODESEL_NETSWITCH    FALSE /**< should path switching issue bound change events only for the net bound
+                                                 *   changes between the old and the new focus node? */
 
 
 /* Presolving */
@@ -460,6 +466,12 @@
 #define SCIP_DEFAULT_CONCURRENT_CHANGECHILDSEL  TRUE /**< should the concurrent solvers use different child selection rules? */
 #define SCIP_DEFAULT_CONCURRENT_COMMVARBNDS     TRUE /**< should the concurrent solvers communicate variable bounds? */
 #define SCIP_DEFAULT_CONCURRENT_PRESOLVEBEFORE  TRUE /**< should the problem be presolved before it is copied to the concurrent solvers? */
+#define SCIP_DEFAULT_CONCURRENT_NSUBTREES          0 /**< number of subtrees per concurrent solver that are created in a ramp-up phase
+                                                       *   to split the search tree among the solvers (0: no tree splitting) */
+#define SCIP_DEFAULT_CONCURRENT_SYMRACING    FALSE /**< should the symmetry handling methods race against each other in a ramp-up
+                                                      *   phase before the concurrent solvers are set up with the best one? */
+#define SCIP_DEFAULT_CONCURRENT_SYMRACINGNODES  1000LL /**< number of nodes each symmetry handling method may process in
+                                                       *   the racing ramp-up phase */
 #define SCIP_DEFAULT_CONCURRENT_INITSEED     5131912 /**< the seed used to initialize the random seeds for the concurrent solvers */
 #define SCIP_DEFAULT_CONCURRENT_FREQINIT        10.0 /**< initial frequency of synchronization with other threads
                                                       *   (fraction of time required for solving the root LP) */
@@ -1852,6 +1864,11 @@ SCIP_RETCODE SCIPsetCreate(
          "number of threads used for solving the LP (0: automatic)",
          &(*set)->lp_threads, TRUE, SCIP_DEFAULT_LP_THREADS, 0, 64,
          NULL, NULL) );
+   SCIP_CALL( SCIPsetAddIntParam(*set, messagehdlr, blkmem,
+         "lp/sbthreads",
+         "number of threads used for strong branching on copies of the LP (1: strong branching on the LP itself)",
+         &(*set)->lp_sbthreads, TRUE, SCIP_DEFAULT_LP_SBTHREADS, 1, 64,
+         NULL, NULL) );
    SCIP_CALL( SCIPsetAddRealParam(*set, messagehdlr, blkmem,
          "lp/resolveiterfac",
          "factor of average LP iterations that is used as LP iteration limit for LP resolve (-1: unlimited)",
@@ -1898,6 +1915,11 @@ SCIP_RETCODE SCIPsetCreate(
          "fraction of maximal memory usage resulting in switch to memory saving mode",
          &(*set)->mem_savefac, FALSE, SCIP_DEFAULT_MEM_SAVEFAC, 0.0, 1.0,
          NULL, NULL) );
+   SCIP_CALL( SCIPsetAddRealParam(*set, messagehdlr, blkmem,
+         "memory/compactfac",
+         "fraction of maximal memory usage resulting in compact storage of the branching decisions of open nodes",
+         &(*set)->mem_compactfac, FALSE, SCIP_DEFAULT_MEM_COMPACTFAC, 0.0, 1.0,
+         NULL, NULL) );
    SCIP_CALL( SCIPsetAddRealParam(*set, messagehdlr, blkmem,
          "memory/arraygrowfac",
          "memory growing factor for dynamically allocated arrays",
@@ -2082,6 +2104,11 @@ SCIP_RETCODE SCIPsetCreate(
          "child selection rule ('d'own, 'u'p, 'p'seudo costs, 'i'nference, 'l'p value, 'r'oot LP value difference, 'h'ybrid inference/root LP value difference)",
          &(*set)->nodesel_childsel, FALSE, SCIP_DEFAULT_NODESEL_CHILDSEL, "dupilrh",
          NULL, NULL) );
+   SCIP_CALL( SCIPsetAddBoolParam(*set, messagehdlr, blkmem,
+         "nodeselection/netswitch",
+         "should path switching issue bound change events only for the net bound changes between the old and the new focus node?",
+         &(*set)->nodesel_netswitch, TRUE, SCIP_DEFAULT_NODESEL_NETSWITCH,
+         NULL, NULL) );
 
    /* numerical parameters */
    SCIP_CALL( SCIPsetAddRealParam(*set, messagehdlr, blkmem,
@@ -2550,6 +2577,21 @@ SCIP_RETCODE SCIPsetCreate(
          "should the problem be presolved before it is copied to the concurrent solvers?",
          &(*set)->concurrent_presolvebefore, FALSE, SCIP_DEFAULT_CONCURRENT_PRESOLVEBEFORE,
          NULL, NULL) );
+   SCIP_CALL( SCIPsetAddIntParam(*set, messagehdlr, blkmem,
+         "concurrent/nsubtrees",
+         "number of subtrees per concurrent solver that are created in a ramp-up phase to split the search tree among the solvers (0: no tree splitting)",
+         &(*set)->concurrent_nsubtrees, FALSE, SCIP_DEFAULT_CONCURRENT_NSUBTREES, 0, 1000,
+         NULL, NULL) );
+   SCIP_CALL( SCIPsetAddBoolParam(*set, messagehdlr, blkmem,
+         "concurrent/symracing",
+         "should the symmetry handling methods race against each other in a ramp-up phase before the concurrent solvers are set up with the best one (ignored if the search tree is split)?",
+         &(*set)->concurrent_symracing, FALSE, SCIP_DEFAULT_CONCURRENT_SYMRACING,
+         NULL, NULL) );
+   SCIP_CALL( SCIPsetAddLongintParam(*set, messagehdlr, blkmem,
+         "concurrent/symracingnodes",
+         "number of nodes each symmetry handling method may process in the racing ramp-up phase",
+         &(*set)->concurrent_symracingnodes, TRUE, SCIP_DEFAULT_CONCURRENT_SYMRACINGNODES, 1LL, SCIP_LONGINT_MAX,
+         NULL, NULL) );
    SCIP_CALL( SCIPsetAddIntParam(*set, messagehdlr, blkmem,
          "concurrent/initseed",
          "maximum number of solutions that will be shared in a one synchronization",
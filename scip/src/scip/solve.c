@@ -396,6 +396,7 @@ SCIP_RETCODE propagationRound(
    SCIP_SET*             set,                /**< global SCIP settings */
    SCIP_STAT*            stat,               /**< dynamic problem statistics */
    SCIP_TREE*            tree,               /**< branch and bound tree */
+   SCIP_EVENTQUEUE*      eventqueue,         /**< event queue */
    int                   depth,              /**< depth level to use for propagator frequency checks */
    SCIP_Bool             fullpropagation,    /**< should all constraints be propagated (or only new ones)? */
    SCIP_Bool             onlydelayed,        /**< should only delayed propagators be called? */
@@ -406,6 +407,7 @@ SCIP_RETCODE propagationRound(
    SCIP_Bool*            postpone            /**< pointer to store whether the node should be postponed */
    )
 {  /*lint --e{715}*/
+   SCIP_RETCODE retcode;
    SCIP_RESULT result;
    SCIP_Bool abortoncutoff;
    int i;
@@ -445,7 +447,13 @@ SCIP_RETCODE propagationRound(
 
       SCIPsetDebugMsg(set, "calling propagator <%s>\n", SCIPpropGetName(set->props[i]));
 
-      SCIP_CALL( SCIPpropExec(set->props[i], set, stat, depth, onlydelayed, tree->sbprobing, timingmask, &result) );
+      /* event handlers with batched execution method receive the local bound changes at the end of the call */
+      SCIP_CALL( SCIPeventqueueBatchBdchgs(eventqueue, set) );
+      retcode = SCIPpropExec(set->props[i], set, stat, depth, onlydelayed, tree->sbprobing, timingmask, &result);
+
+      /* the batch also ends if the propagator failed, such that the event queue stops collecting events */
+      SCIP_CALL( SCIPeventqueueDeliverBdchgs(eventqueue, set) );
+      SCIP_CALL( retcode );
 
 #ifndef NDEBUG
       if( BMSgetNUsedBufferMemory(SCIPbuffer(set->scip)) > nusedbuffer )
@@ -490,8 +498,14 @@ SCIP_RETCODE propagationRound(
 
       SCIPsetDebugMsg(set, "calling propagation method of constraint handler <%s>\n", SCIPconshdlrGetName(set->conshdlrs[i]));
 
-      SCIP_CALL( SCIPconshdlrPropagate(set->conshdlrs[i], blkmem, set, stat, depth, fullpropagation, onlydelayed,
-            tree->sbprobing, timingmask, &result) );
+      /* event handlers with batched execution method receive the local bound changes at the end of the call */
+      SCIP_CALL( SCIPeventqueueBatchBdchgs(eventqueue, set) );
+      retcode = SCIPconshdlrPropagate(set->conshdlrs[i], blkmem, set, stat, depth, fullpropagation, onlydelayed,
+         tree->sbprobing, timingmask, &result);
+
+      /* the batch also ends if the constraint handler failed, such that the event queue stops collecting events */
+      SCIP_CALL( SCIPeventqueueDeliverBdchgs(eventqueue, set) );
+      SCIP_CALL( retcode );
       *delayed = *delayed || (result == SCIP_DELAYED);
       *propagain = *propagain || (result == SCIP_REDUCEDDOM);
 
@@ -531,7 +545,13 @@ SCIP_RETCODE propagationRound(
 
       SCIPsetDebugMsg(set, "calling propagator <%s>\n", SCIPpropGetName(set->props[i]));
 
-      SCIP_CALL( SCIPpropExec(set->props[i], set, stat, depth, onlydelayed, tree->sbprobing, timingmask, &result) );
+      /* event handlers with batched execution method receive the local bound changes at the end of the call */
+      SCIP_CALL( SCIPeventqueueBatchBdchgs(eventqueue, set) );
+      retcode = SCIPpropExec(set->props[i], set, stat, depth, onlydelayed, tree->sbprobing, timingmask, &result);
+
+      /* the batch also ends if the propagator failed, such that the event queue stops collecting events */
+      SCIP_CALL( SCIPeventqueueDeliverBdchgs(eventqueue, set) );
+      SCIP_CALL( retcode );
       *delayed = *delayed || (result == SCIP_DELAYED);
       *propagain = *propagain || (result == SCIP_REDUCEDDOM);
 
@@ -565,6 +585,7 @@ SCIP_RETCODE propagateDomains(
    SCIP_SET*             set,                /**< global SCIP settings */
    SCIP_STAT*            stat,               /**< dynamic problem statistics */
    SCIP_TREE*            tree,               /**< branch and bound tree */
+   SCIP_EVENTQUEUE*      eventqueue,         /**< event queue */
    int                   depth,              /**< depth level to use for propagator frequency checks */
    int                   maxproprounds,      /**< maximal number of propagation rounds (-1: no limit, 0: parameter settings) */
    SCIP_Bool             fullpropagation,    /**< should all constraints be propagated (or only new ones)? */
@@ -608,13 +629,13 @@ SCIP_RETCODE propagateDomains(
       propround++;
 
       /* perform the propagation round by calling the propagators and constraint handlers */
-      SCIP_CALL( propagationRound(blkmem, set, stat, tree, depth, fullpropagation, FALSE, &delayed, &propagain, timingmask, cutoff, postpone) );
+      SCIP_CALL( propagationRound(blkmem, set, stat, tree, eventqueue, depth, fullpropagation, FALSE, &delayed, &propagain, timingmask, cutoff, postpone) );
 
       /* if the propagation will be terminated, call the delayed propagators */
       while( delayed && (!propagain || propround >= maxproprounds) && !(*cutoff) )
       {
          /* call the delayed propagators and constraint handlers */
-         SCIP_CALL( propagationRound(blkmem, set, stat, tree, depth, fullpropagation, TRUE, &delayed, &propagain, timingmask, cutoff, postpone) );
+         SCIP_CALL( propagationRound(blkmem, set, stat, tree, eventqueue, depth, fullpropagation, TRUE, &delayed, &propagain, timingmask, cutoff, postpone) );
       }
 
       /* if a reduction was found, we want to do another full propagation round (even if the propagator only claimed
@@ -657,7 +678,7 @@ SCIP_RETCODE SCIPpropagateDomains(
    SCIP_Bool postpone;
 
    /* apply domain propagation */
-   SCIP_CALL( propagateDomains(blkmem, set, stat, tree, depth, maxproprounds, TRUE, timingmask, cutoff, &postpone) );
+   SCIP_CALL( propagateDomains(blkmem, set, stat, tree, eventqueue, depth, maxproprounds, TRUE, timingmask, cutoff, &postpone) );
 
    /* flush the conflict set storage */
    SCIP_CALL( SCIPconflictFlushConss(conflict, blkmem, set, stat, transprob, origprob, tree, reopt, lp, branchcand, eventqueue, cliquetable) );
@@ -2421,7 +2442,7 @@ SCIP_RETCODE priceAndCutLoop(
 
                SCIPsetDebugMsg(set, " -> LP solved: call propagators that are applicable during LP solving loop\n");
 
-               SCIP_CALL( propagateDomains(blkmem, set, stat, tree, SCIPtreeGetCurrentDepth(tree), 0, FALSE,
+               SCIP_CALL( propagateDomains(blkmem, set, stat, tree, eventqueue, SCIPtreeGetCurrentDepth(tree), 0, FALSE,
                      SCIP_PROPTIMING_DURINGLPLOOP, cutoff, &postpone) );
                assert(BMSgetNUsedBufferMemory(mem->buffer) == 0);
                assert(!postpone);
@@ -3744,7 +3765,7 @@ SCIP_RETCODE propAndSolve(
       /* call after LP propagators */
       if( ((*afterlpproplps) < stat->nnodelps && (*lpsolved)) || (*relaxcalled) )
       {
-         SCIP_CALL( propagateDomains(blkmem, set, stat, tree, SCIPtreeGetCurrentDepth(tree), 0, *fullpropagation,
+         SCIP_CALL( propagateDomains(blkmem, set, stat, tree, eventqueue, SCIPtreeGetCurrentDepth(tree), 0, *fullpropagation,
                SCIP_PROPTIMING_AFTERLPLOOP, cutoff, postpone) );
          assert(BMSgetNUsedBufferMemory(mem->buffer) == 0);
 
@@ -3757,7 +3778,7 @@ SCIP_RETCODE propAndSolve(
       /* call before LP propagators */
       if( propagate && !(*cutoff) )
       {
-         SCIP_CALL( propagateDomains(blkmem, set, stat, tree, SCIPtreeGetCurrentDepth(tree), 0, *fullpropagation,
+         SCIP_CALL( propagateDomains(blkmem, set, stat, tree, eventqueue, SCIPtreeGetCurrentDepth(tree), 0, *fullpropagation,
                SCIP_PROPTIMING_BEFORELP, cutoff, postpone) );
          assert(BMSgetNUsedBufferMemory(mem->buffer) == 0);
       }
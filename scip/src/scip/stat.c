@@ -292,6 +292,7 @@ void SCIPstatReset(
    stat->nenabledconss = 0;
    stat->solindex = 0;
    stat->memsavemode = FALSE;
+   stat->compactleaves = FALSE;
    stat->nnodesbeforefirst = -1;
    stat->ninitconssadded = 0;
    stat->nactiveconssadded = 0;
@@ -684,7 +685,9 @@ void SCIPstatEnforceLPUpdates(
    stat->lpcount++;
 }
 
-/** depending on the current memory usage, switches mode flag to standard or memory saving mode */
+/** depending on the current memory usage, switches mode flag to standard or memory saving mode, and decides whether
+ *  the branching decisions of open nodes are stored compactly
+ */
 void SCIPstatUpdateMemsaveMode(
    SCIP_STAT*            stat,               /**< problem statistics data */
    SCIP_SET*             set,                /**< global SCIP settings */
@@ -721,6 +724,27 @@ void SCIPstatUpdateMemsaveMode(
    }
    else
       stat->memsavemode = FALSE;
+
+   /* the branching decisions of open nodes are stored compactly as long as the memory usage did not drop clearly below
+    * the threshold, similar to the memory saving mode
+    */
+   if( SCIPsetIsLT(set, set->mem_compactfac, 1.0) )
+   {
+      SCIP_Longint memused;
+
+      memused = SCIPmemGetTotal(mem);
+      if( !stat->compactleaves && memused >= set->mem_compactfac * set->limit_memory * 1024.0 * 1024.0 )
+      {
+         SCIPmessagePrintVerbInfo(messagehdlr, set->disp_verblevel, SCIP_VERBLEVEL_HIGH,
+            "(node %" SCIP_LONGINT_FORMAT ") storing branching decisions of open nodes compactly (mem: %.1fM/%.1fM)\n",
+            stat->nnodes, (SCIP_Real)memused/(1024.0*1024.0), set->limit_memory);
+         stat->compactleaves = TRUE;
+      }
+      else if( stat->compactleaves && memused < 0.5 * set->mem_compactfac * set->limit_memory * 1024.0 * 1024.0 )
+         stat->compactleaves = FALSE;
+   }
+   else
+      stat->compactleaves = FALSE;
 }
 
 /** returns the estimated number of bytes used by extern software, e.g., the LP solver */
@@ -159,7 +159,9 @@ void SCIPstatEnforceLPUpdates(
    SCIP_STAT*            stat                /**< problem statistics data */
    );
 
-/** depending on the current memory usage, switches mode flag to standard or memory saving mode */
+/** depending on the current memory usage, switches mode flag to standard or memory saving mode, and decides whether
+ *  the branching decisions of open nodes are stored compactly
+ */
 void SCIPstatUpdateMemsaveMode(
    SCIP_STAT*            stat,               /**< problem statistics data */
    SCIP_SET*             set,                /**< global SCIP settings */
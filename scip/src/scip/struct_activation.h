@@ -44,6 +44,8 @@ struct SCIP_Activationhdlr
    SCIP_DECL_ACTIVATIONEXIT((*activationexit));    /**< deinitialize activation handler */
    SCIP_DECL_ACTIVATIONISACTIVE((*activationisactive));    /**< is active method of activation handler */
    SCIP_DECL_ACTIVATIONFINDDATA((*activationfindactivationdata));    /**< TODO */
+   SCIP_DECL_ACTIVATIONCONSDELETE((*activationconsdelete));    /**< constraint deletion method of activation handler */
+   SCIP_DECL_ACTIVATIONCONSCOPY((*activationconscopy));    /**< constraint copying method of activation handler */
    SCIP_ACTIVATIONHDLRDATA* activationhdlrdata;       /**< activation handler local data */
    SCIP_Bool             initialized;        /**< is activation handler initialized? */
 };
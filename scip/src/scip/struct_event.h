@@ -28,6 +28,7 @@
 #include "scip/def.h"
 #include "scip/type_clock.h"
 #include "scip/type_event.h"
+#include "scip/type_prob.h"
 #include "scip/type_var.h"
 #include "scip/type_sol.h"
 #include "scip/type_tree.h"
@@ -204,7 +205,13 @@ struct SCIP_Eventhdlr
    SCIP_DECL_EVENTEXITSOL((*eventexitsol));  /**< solving process deinitialization method of event handler */
    SCIP_DECL_EVENTDELETE ((*eventdelete));   /**< free specific event data */
    SCIP_DECL_EVENTEXEC   ((*eventexec));     /**< execute event handler */
+   SCIP_DECL_EVENTEXECBATCH((*eventexecbatch)); /**< execute event handler on a batch of local bound change events, or NULL */
    SCIP_EVENTHDLRDATA*   eventhdlrdata;      /**< event handler data */
+   SCIP_EVENT*           batchevents;        /**< local bound change events collected for the batched execution method */
+   SCIP_EVENTDATA**      batcheventdata;     /**< user data of the collected events */
+   SCIP_EVENTFILTER**    batcheventfilters;  /**< event filters through which the collected events were caught */
+   int                   batcheventssize;    /**< size of batch arrays */
+   int                   nbatchevents;       /**< number of collected events */
    SCIP_CLOCK*           setuptime;          /**< time spend for setting up this event handler for the next stages */
    SCIP_CLOCK*           eventtime;          /**< time spend in this event handler execution method */
    SCIP_Bool             initialized;        /**< is event handler initialized? */
@@ -216,7 +223,20 @@ struct SCIP_EventQueue
    SCIP_EVENT**          events;             /**< array with queued events */
    int                   eventssize;         /**< number of available slots in events array */
    int                   nevents;            /**< number of events in queue (used slots if events array) */
+   SCIP_VAR**            deferredvars;       /**< variables with deferred local bound changes */
+   SCIP_Real*            deferredlbs;        /**< local lower bounds of the deferred variables before their first deferred change */
+   SCIP_Real*            deferredubs;        /**< local upper bounds of the deferred variables before their first deferred change */
+   int                   deferredvarssize;   /**< number of available slots in deferred variables arrays */
+   int                   ndeferredvars;      /**< number of variables with deferred local bound changes */
+   SCIP_PROB*            mirrorprob;         /**< transformed problem whose bound mirror is kept up to date by the bound
+                                              *   changes, or NULL if the bounds are not mirrored */
+   int                   nbatchlevels;       /**< number of nested propagation calls during which local bound change
+                                              *   events are collected for batched execution methods */
+   SCIP_Bool             batchespending;     /**< may an event handler have collected events that are not delivered yet? */
    SCIP_Bool             delayevents;        /**< should the events be delayed and processed later? */
+   SCIP_Bool             deferbdchgs;        /**< should local bound changes of loose and column variables only be
+                                              *   recorded, and their events and parent updates be issued for the net
+                                              *   change later? */
 };
 
 #ifdef __cplusplus
@@ -293,6 +293,7 @@ struct SCIP_Lp
    SCIP_ROW**            rows;               /**< array with current LP rows in correct order */
    SCIP_Real*            soldirection;       /**< normalized vector in direction of primal solution from current LP solution */
    SCIP_LPISTATE*        divelpistate;       /**< stores LPI state (basis information) before diving starts */
+   SCIP_LPI**            sbworkers;          /**< copies of the LP solver interface for parallel strong branching, or NULL */
    SCIP_Real*            divechgsides;       /**< stores the lhs/rhs changed in the current diving */
    SCIP_SIDETYPE*        divechgsidetypes;   /**< stores the side type of the changes done in the current diving */
    SCIP_ROW**            divechgrows;        /**< stores the rows changed in the current diving */
@@ -303,11 +304,14 @@ struct SCIP_Lp
    SCIP_Longint          validsoldirlp;      /**< LP number for which the currently stored solution direction vector is valid */
    SCIP_Longint          validdegeneracylp;  /**< LP number for which the currently stored degeneracy information is valid */
    SCIP_Longint          divenolddomchgs;    /**< number of domain changes before diving has started */
+   SCIP_Longint          validsbworkerlp;    /**< LP number for which the valid strong branching copies hold the optimal basis */
    int                   lpicolssize;        /**< available slots in lpicols vector */
    int                   nlpicols;           /**< number of columns in the LP solver */
    int                   lpifirstchgcol;     /**< first column of the LP which differs from the column in the LP solver */
    int                   lpirowssize;        /**< available slots in lpirows vector */
    int                   nlpirows;           /**< number of rows in the LP solver */
+   int                   nsbworkers;         /**< number of copies of the LP solver interface for parallel strong branching */
+   int                   nvalidsbworkers;    /**< number of copies that hold the LP with number validsbworkerlp */
    int                   lpifirstchgrow;     /**< first row of the LP which differs from the row in the LP solver */
    int                   chgcolssize;        /**< available slots in chgcols vector */
    int                   nchgcols;           /**< current number of chgcols (number of used slots in chgcols vector) */
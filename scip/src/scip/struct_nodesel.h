@@ -44,6 +44,7 @@ struct SCIP_NodePQ
    SCIP_NODE**           slots;              /**< array of element slots */
    int*                  bfsposs;            /**< position of the slot in the bfs ordered queue */
    int*                  bfsqueue;           /**< queue of slots[] indices sorted by best lower bound */
+   SCIP_Real*            bfslowerbounds;     /**< lower bounds of the nodes in the bfs ordered queue, stored next to bfsqueue[] */
    int                   len;                /**< number of used element slots */
    int                   size;               /**< total number of available element slots */
 };
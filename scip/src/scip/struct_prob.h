@@ -57,6 +57,10 @@ struct SCIP_Prob
    SCIP_VAR**            deletedvars;        /**< array to temporarily store deleted variables */
    SCIP_HASHTABLE*       consnames;          /**< hash table storing constraints' names */
    SCIP_CONS**           conss;              /**< array with constraints of the problem */
+   SCIP_Real*            mirrorlbslocal;     /**< local lower bounds of the variables by variable index, if mirrored */
+   SCIP_Real*            mirrorubslocal;     /**< local upper bounds of the variables by variable index, if mirrored */
+   SCIP_Real*            mirrorlbsglobal;    /**< global lower bounds of the variables by variable index, if mirrored */
+   SCIP_Real*            mirrorubsglobal;    /**< global upper bounds of the variables by variable index, if mirrored */
    int                   varssize;           /**< available slots in vars array */
    int                   nvars;              /**< number of active variables in the problem (used slots in vars array) */
    int                   nbinvars;           /**< number of binary variables */
@@ -74,12 +78,15 @@ struct SCIP_Prob
    int                   maxnconss;          /**< maximum number of constraints existing at the same time */
    int                   startnvars;         /**< number of variables existing when problem solving started */
    int                   startnconss;        /**< number of constraints existing when problem solving started */
+   int                   mirrorsize;         /**< available slots in bound mirror arrays */
+   int                   nmirrorvars;        /**< number of variable indices covered by the bound mirror arrays */
    SCIP_OBJSENSE         objsense;           /**< objective sense of the original problem */
    SCIP_Bool             objisintegral;      /**< is objective value always integral for feasible solutions? */
    SCIP_Bool             transformed;        /**< TRUE iff problem is the transformed problem */
    SCIP_Bool             nlpenabled;         /**< marks whether an NLP relaxation should be constructed */
    SCIP_Bool             permuted;           /**< TRUE iff the problem is already permuted */
    SCIP_Bool             conscompression;    /**< TRUE for problems for which constraint compression on a set of fixed variables is desired */
+   SCIP_Bool             mirrorbounds;       /**< are the bounds of the variables mirrored in dense arrays? */
 };
 
 #ifdef __cplusplus
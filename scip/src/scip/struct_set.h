@@ -362,6 +362,8 @@ struct SCIP_Set
    SCIP_Real             lp_rowrepswitch;    /**< simplex algorithm shall use row representation of the basis
                                               *   if number of rows divided by number of columns exceeds this value */
    int                   lp_threads;         /**< number of threads used for solving the LP (0: automatic) */
+   int                   lp_sbthreads;       /**< number of threads used for strong branching on copies of the LP
+                                              *   (1: strong branching on the LP itself) */
    SCIP_Real             lp_resolveiterfac;  /**< factor of average LP iterations that is used as LP iteration limit
                                               *   for LP resolve (-1: unlimited) */
    int                   lp_resolveitermin;  /**< minimum number of iterations that are allowed for LP resolve */
@@ -375,6 +377,7 @@ struct SCIP_Set
 
    /* memory settings */
    SCIP_Real             mem_savefac;        /**< fraction of maximal memory usage resulting in switch to memory saving mode */
+   SCIP_Real             mem_compactfac;     /**< fraction of maximal memory usage resulting in compact storage of the branching decisions of open nodes */
    SCIP_Real             mem_arraygrowfac;   /**< memory growing factor for dynamically allocated arrays */
    SCIP_Real             mem_treegrowfac;    /**< memory growing factor for tree array */
    SCIP_Real             mem_pathgrowfac;    /**< memory growing factor for path array */
@@ -421,6 +424,8 @@ struct SCIP_Set
    /* node selection settings */
    char                  nodesel_childsel;   /**< child selection rule ('d'own, 'u'p, 'p'seudo costs, 'i'nference, 'l'p value,
                                               *   'r'oot LP value difference, 'h'brid inference/root LP value difference) */
+   SCIP_Bool             nodesel_netswitch;  /**< should path switching issue bound change events only for the net bound
+                                              *   changes between the old and the new focus node? */
 
    /* numerical settings */
    SCIP_Real             num_infinity;       /**< values larger than this are considered infinity */
@@ -571,6 +576,12 @@ struct SCIP_Set
    SCIP_Bool             concurrent_changechildsel; /**< change the child selection rule in different solvers? */
    SCIP_Bool             concurrent_commvarbnds;    /**< should the concurrent solvers communicate global variable bound changes? */
    SCIP_Bool             concurrent_presolvebefore; /**< should the problem be presolved before it is copied to the concurrent solvers? */
+   int                   concurrent_nsubtrees;      /**< number of subtrees per concurrent solver that are created in a ramp-up phase
+                                                     *   to split the search tree among the solvers (0: no tree splitting) */
+   SCIP_Bool             concurrent_symracing;      /**< should the symmetry handling methods race against each other in a
+                                                     *   ramp-up phase before the concurrent solvers are set up? */
+   SCIP_Longint          concurrent_symracingnodes; /**< number of nodes each symmetry handling method may process in the
+                                                     *   racing ramp-up phase */
    int                   concurrent_initseed;       /**< the seed for computing the concurrent solver seeds */
    SCIP_Real             concurrent_freqinit;       /**< initial frequency of synchronization */
    SCIP_Real             concurrent_freqmax;        /**< maximal frequency of synchronization */
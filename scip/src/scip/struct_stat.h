@@ -266,6 +266,7 @@ struct SCIP_Stat
    int                   nclockskipsleft;    /**< how many times the timing should be skipped in SCIPsolveIsStopped() */
    int                   nactiveexpriter;    /**< number of active expression iterators */
    SCIP_Bool             memsavemode;        /**< should algorithms be switched to memory saving mode? */
+   SCIP_Bool             compactleaves;      /**< should the branching decisions of open nodes be stored compactly? */
    SCIP_Bool             userinterrupt;      /**< has the user asked to interrupt the solving process? */
    SCIP_Bool             userrestart;        /**< has the user asked to restart the solving process? */
    SCIP_Bool             inrestart;          /**< are we currently restarting the system? */
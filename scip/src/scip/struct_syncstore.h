@@ -62,6 +62,17 @@ struct SCIP_SyncStore
    SCIP_Real             syncfreqmax;        /**< the maximum synchronization frequency */
    int                   maxnsols;           /**< maximum number of solutions that can be shared in one synchronization */
    int                   nsolvers;           /**< number of solvers synchronizing with this syncstore */
+   int                   nfinished;          /**< number of solvers that processed all their subtrees and no longer synchronize */
+
+   /* pool of subtrees for splitting the search tree among the solvers */
+   SCIP_BOUNDSTORE**     subtrees;           /**< branching decisions defining the subtrees created in the ramp-up phase */
+   SCIP_Real*            subtreebounds;      /**< lower bounds of the subtrees, or infinity for subtrees that were solved */
+   int                   nsubtrees;          /**< number of subtrees in the pool */
+   int                   subtreessize;       /**< size of the subtree arrays */
+   int                   nextsubtree;        /**< next subtree to hand out in opportunistic mode */
+   int                   symvariant;         /**< symmetry handling method that won the racing ramp-up phase, or -1 */
+   SCIP*                 symracingscip;      /**< SCIP whose presolved problem is copied to the symmetry racers, so that it
+                                              *   must not handle symmetries itself, or NULL */
 };
 
 
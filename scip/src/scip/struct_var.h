@@ -147,12 +147,27 @@ struct SCIP_DomChgDyn
    int                   holechgssize;       /**< size of hole changes array */
 };
 
+/** tracks branching decisions of a leaf node in a compact byte encoding (static, bound changes only)
+ *
+ *  Every bound change is encoded by a flag byte, the difference of its variable's address to the address of the
+ *  previous bound change's variable, the new bound (as integer if it is integral), and the LP solution value of the
+ *  branching variable (if known).
+ */
+struct SCIP_DomChgCompact
+{
+   unsigned int          nboundchgs:30;      /**< number of bound changes (must be first structure entry!) */
+   unsigned int          domchgtype:2;       /**< type of domain change data (must be first structure entry!) */
+   int                   nbytes;             /**< number of bytes of the encoded bound changes */
+   unsigned char*        bytes;              /**< encoded bound changes */
+};
+
 /** tracks changes of the variables' domains */
 union SCIP_DomChg
 {
    SCIP_DOMCHGBOUND      domchgbound;        /**< bound changes */
    SCIP_DOMCHGBOTH       domchgboth;         /**< bound and hole changes */
    SCIP_DOMCHGDYN        domchgdyn;          /**< bound and hole changes with dynamic arrays */
+   SCIP_DOMCHGCOMPACT    domchgcompact;      /**< branching decisions in compact encoding */
 };
 
 /** domain of a variable */
@@ -273,6 +288,7 @@ struct SCIP_Var
    unsigned int          pseudocostflag:2;   /**< temporary flag used in pseudo cost update */
    unsigned int          branchdirection:2;  /**< preferred branching direction of the variable (downwards, upwards, auto) */
    unsigned int          eventqueueimpl:1;   /**< is an IMPLADDED event on this variable currently in the event queue? */
+   unsigned int          bdchgdeferred:1;    /**< are local bound changes of the variable currently deferred in the event queue? */
    unsigned int          delglobalstructs:1; /**< is variable marked to be removed from global structures (cliques etc.)? */
    unsigned int          relaxationonly:1;   /**< TRUE if variable has been introduced only to define a relaxation */
 #ifndef NDEBUG
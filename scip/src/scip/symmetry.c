@@ -753,15 +753,186 @@ SCIP_RETCODE SCIPextendSubOrbitope(
 }
 
 
-/** compute components of symmetry group */
-SCIP_RETCODE SCIPcomputeComponentsSym(
+/** computes the support of permutations as sparse transposed permutation matrix
+ *
+ *  For every variable i, the entries supportbegins[i], ..., supportbegins[i + 1] - 1 of supportperms and supportimages
+ *  contain the permutations that move i (sorted increasingly) and the images of i under these permutations. The arrays
+ *  are allocated in block memory; supportperms and supportimages have length MAX(nsupport, 1).
+ */
+SCIP_RETCODE SCIPcomputeSupportSym(
    SCIP*                 scip,               /**< SCIP instance */
-   int**                 perms,              /**< permutation generators as
-                                              *   (either nperms x npermvars or npermvars x nperms) matrix */
+   int**                 perms,              /**< permutation generators as (nperms x npermvars) matrix */
    int                   nperms,             /**< number of permutations */
-   SCIP_VAR**            permvars,           /**< variables on which permutations act */
    int                   npermvars,          /**< number of variables for permutations */
+   SCIP_Shortbool*       ignorevars,         /**< array marking variables whose images shall be ignored (or NULL) */
+   int**                 supportbegins,      /**< pointer to store begin positions of the variables in the support arrays */
+   int**                 supportperms,       /**< pointer to store the permutations moving the variables */
+   int**                 supportimages,      /**< pointer to store the images of the variables */
+   int*                  nsupport            /**< pointer to store the total size of the support */
+   )
+{
+   int* pos;
+   int p;
+   int i;
+
+   assert( scip != NULL );
+   assert( perms != NULL || nperms == 0 );
+   assert( npermvars > 0 );
+   assert( supportbegins != NULL );
+   assert( supportperms != NULL );
+   assert( supportimages != NULL );
+   assert( nsupport != NULL );
+
+   /* count the number of permutations moving each variable */
+   SCIP_CALL( SCIPallocClearBlockMemoryArray(scip, supportbegins, npermvars + 1) );
+   for (p = 0; p < nperms; ++p)
+   {
+      for (i = 0; i < npermvars; ++i)
+      {
+         if ( perms[p][i] != i && (ignorevars == NULL || ! ignorevars[i]) )
+            ++(*supportbegins)[i + 1];
+      }
+   }
+
+   for (i = 0; i < npermvars; ++i)
+      (*supportbegins)[i + 1] += (*supportbegins)[i];
+   *nsupport = (*supportbegins)[npermvars];
+
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, supportperms, MAX(*nsupport, 1)) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, supportimages, MAX(*nsupport, 1)) );
+
+   /* fill the support; iterating over the permutations first sorts the entries of each variable */
+   SCIP_CALL( SCIPduplicateBufferArray(scip, &pos, *supportbegins, npermvars) );
+   for (p = 0; p < nperms; ++p)
+   {
+      for (i = 0; i < npermvars; ++i)
+      {
+         if ( perms[p][i] != i && (ignorevars == NULL || ! ignorevars[i]) )
+         {
+            (*supportperms)[pos[i]] = p;
+            (*supportimages)[pos[i]++] = perms[p][i];
+         }
+      }
+   }
+
+   SCIPfreeBufferArray(scip, &pos);
+
+   return SCIP_OKAY;
+}
+
+
+/** compute non-trivial orbits of symmetry group from the support of its generators
+ *
+ *  The support is given as computed by SCIPcomputeSupportSym(). The orbits are stored as by SCIPcomputeOrbitsSym(), but
+ *  only the permutations moving a variable are visited, such that the running time is linear in the size of the
+ *  support instead of in nperms x npermvars. Permutations marked by @p inactiveperms are ignored.
+ */
+SCIP_RETCODE SCIPcomputeOrbitsSupportSym(
+   SCIP*                 scip,               /**< SCIP instance */
+   int                   npermvars,          /**< length of a permutation array */
+   int*                  supportbegins,      /**< begin positions of the variables in the support arrays */
+   int*                  supportperms,       /**< permutations moving the variables */
+   int*                  supportimages,      /**< images of the variables */
+   SCIP_Shortbool*       inactiveperms,      /**< array to store whether permutations are inactive (or NULL) */
+   int*                  orbits,             /**< array of non-trivial orbits */
+   int*                  orbitbegins,        /**< array containing begin positions of new orbits in orbits array */
+   int*                  norbits             /**< pointer to number of orbits currently stored in orbits */
+   )
+{
+   SCIP_Shortbool* varadded;
+   int orbitidx = 0;
+   int i;
+
+   assert( scip != NULL );
+   assert( npermvars > 0 );
+   assert( supportbegins != NULL );
+   assert( supportperms != NULL );
+   assert( supportimages != NULL );
+   assert( orbits != NULL );
+   assert( orbitbegins != NULL );
+   assert( norbits != NULL );
+
+   /* init data structures */
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &varadded, npermvars) );
+
+   /* find variable orbits */
+   *norbits = 0;
+   for (i = 0; i < npermvars; ++i)
+   {
+      int beginorbitidx;
+      int j;
+
+      /* skip variable already contained in an orbit of a previous variable and variables that are not moved */
+      if ( varadded[i] || supportbegins[i] == supportbegins[i + 1] )
+         continue;
+
+      /* store first variable */
+      beginorbitidx = orbitidx;
+      orbits[orbitidx++] = i;
+      varadded[i] = TRUE;
+
+      /* iterate over variables in curorbit and compute their images under the permutations moving them */
+      for (j = beginorbitidx; j < orbitidx; ++j)
+      {
+         int curelem;
+         int k;
+
+         curelem = orbits[j];
+
+         for (k = supportbegins[curelem]; k < supportbegins[curelem + 1]; ++k)
+         {
+            int image;
+
+            if ( inactiveperms != NULL && inactiveperms[supportperms[k]] )
+               continue;
+
+            image = supportimages[k];
+
+            /* found new element of the orbit of i */
+            if ( ! varadded[image] )
+            {
+               orbits[orbitidx++] = image;
+               assert( orbitidx <= npermvars );
+               varadded[image] = TRUE;
+            }
+         }
+      }
+
+      /* if the orbit is trivial, reset storage, otherwise store orbit */
+      if ( orbitidx <= beginorbitidx + 1 )
+         orbitidx = beginorbitidx;
+      else
+         orbitbegins[(*norbits)++] = beginorbitidx;
+   }
+
+   /* store end in "last" orbitbegins entry */
+   assert( *norbits < npermvars );
+   orbitbegins[*norbits] = orbitidx;
+
+   /* free memory */
+   SCIPfreeBufferArray(scip, &varadded);
+
+   return SCIP_OKAY;
+}
+
+
+/** compute components of symmetry group, whose generators are given either densely or by their support
+ *
+ *  If @p supportbegins is not NULL, only the permutations stored in the support of a variable are visited; otherwise,
+ *  all permutations of @p perms are visited. In both cases, the permutations moving a variable are visited in
+ *  increasing order, such that both representations yield the same components.
+ */
+static
+SCIP_RETCODE computeComponents(
+   SCIP*                 scip,               /**< SCIP instance */
+   int**                 perms,              /**< permutation generators as
+                                              *   (either nperms x npermvars or npermvars x nperms) matrix, or NULL */
    SCIP_Bool             transposed,         /**< transposed permutation generators as (npermvars x nperms) matrix */
+   int*                  supportbegins,      /**< begin positions of the variables in the support arrays, or NULL */
+   int*                  supportperms,       /**< permutations moving the variables, or NULL */
+   int*                  supportimages,      /**< images of the variables, or NULL */
+   int                   nperms,             /**< number of permutations */
+   int                   npermvars,          /**< number of variables for permutations */
    int**                 components,         /**< array containing the indices of permutations sorted by components */
    int**                 componentbegins,    /**< array containing in i-th position the first position of
                                               *   component i in components array */
@@ -780,9 +951,9 @@ SCIP_RETCODE SCIPcomputeComponentsSym(
    int idx;
 
    assert( scip != NULL );
-   assert( permvars != NULL );
    assert( npermvars > 0 );
-   assert( perms != NULL );
+   assert( perms != NULL || supportbegins != NULL );
+   assert( supportbegins == NULL || (supportperms != NULL && supportimages != NULL) );
    assert( components != NULL );
    assert( componentbegins != NULL );
    assert( vartocomponent != NULL );
@@ -804,13 +975,26 @@ SCIP_RETCODE SCIPcomputeComponentsSym(
    SCIP_CALL( SCIPallocBlockMemoryArray(scip, vartocomponent, npermvars) );
    for (i = 0; i < npermvars; ++i)
    {
+      int nimages;
+      int k;
+
       (*vartocomponent)[i] = -1;
 
-      for (p = 0; p < nperms; ++p)
+      nimages = supportbegins != NULL ? supportbegins[i + 1] - supportbegins[i] : nperms;
+      for (k = 0; k < nimages; ++k)
       {
          int img;
 
-         img = transposed ? perms[i][p] : perms[p][i];
+         if ( supportbegins != NULL )
+         {
+            p = supportperms[supportbegins[i] + k];
+            img = supportimages[supportbegins[i] + k];
+         }
+         else
+         {
+            p = k;
+            img = transposed ? perms[i][p] : perms[p][i];
+         }
 
          /* perm p affects i -> possibly merge var components */
          if ( img != i )
@@ -954,6 +1138,239 @@ SCIP_RETCODE SCIPcomputeComponentsSym(
 }
 
 
+
+/** compute components of symmetry group */
+SCIP_RETCODE SCIPcomputeComponentsSym(
+   SCIP*                 scip,               /**< SCIP instance */
+   int**                 perms,              /**< permutation generators as
+                                              *   (either nperms x npermvars or npermvars x nperms) matrix */
+   int                   nperms,             /**< number of permutations */
+   SCIP_VAR**            permvars,           /**< variables on which permutations act */
+   int                   npermvars,          /**< number of variables for permutations */
+   SCIP_Bool             transposed,         /**< transposed permutation generators as (npermvars x nperms) matrix */
+   int**                 components,         /**< array containing the indices of permutations sorted by components */
+   int**                 componentbegins,    /**< array containing in i-th position the first position of
+                                              *   component i in components array */
+   int**                 vartocomponent,     /**< array containing for each permvar the index of the component it is
+                                              *   contained in (-1 if not affected) */
+   unsigned**            componentblocked,   /**< array to store which symmetry methods have been used on a component
+                                              *   using the same bitset information as for misc/usesymmetry */
+   int*                  ncomponents         /**< pointer to store number of components of symmetry group */
+   )
+{
+   assert( permvars != NULL );
+   assert( perms != NULL );
+
+   SCIP_CALL( computeComponents(scip, perms, transposed, NULL, NULL, NULL, nperms, npermvars, components,
+         componentbegins, vartocomponent, componentblocked, ncomponents) );
+
+   return SCIP_OKAY;
+}
+
+
+/** compute components of symmetry group from the support of its generators
+ *
+ *  The support is given as computed by SCIPcomputeSupportSym(); the running time is linear in its size (up to the
+ *  operations on the disjoint sets) instead of in nperms x npermvars.
+ */
+SCIP_RETCODE SCIPcomputeComponentsSupportSym(
+   SCIP*                 scip,               /**< SCIP instance */
+   int*                  supportbegins,      /**< begin positions of the variables in the support arrays */
+   int*                  supportperms,       /**< permutations moving the variables */
+   int*                  supportimages,      /**< images of the variables */
+   int                   nperms,             /**< number of permutations */
+   int                   npermvars,          /**< number of variables for permutations */
+   int**                 components,         /**< array containing the indices of permutations sorted by components */
+   int**                 componentbegins,    /**< array containing in i-th position the first position of
+                                              *   component i in components array */
+   int**                 vartocomponent,     /**< array containing for each permvar the index of the component it is
+                                              *   contained in (-1 if not affected) */
+   unsigned**            componentblocked,   /**< array to store which symmetry methods have been used on a component
+                                              *   using the same bitset information as for misc/usesymmetry */
+   int*                  ncomponents         /**< pointer to store number of components of symmetry group */
+   )
+{
+   assert( supportbegins != NULL );
+   assert( supportperms != NULL );
+   assert( supportimages != NULL );
+
+   SCIP_CALL( computeComponents(scip, NULL, FALSE, supportbegins, supportperms, supportimages, nperms, npermvars,
+         components, componentbegins, vartocomponent, componentblocked, ncomponents) );
+
+   return SCIP_OKAY;
+}
+
+
+/** signatures of the vertices in a round of color refinement
+ *
+ *  The signature of a vertex consists of its color and the sorted colors of its neighbors, which are stored in the
+ *  region of the vertex in the adjacency array. The hash value of the signature is only used to compare signatures
+ *  quickly; signatures with equal hash values are compared completely.
+ */
+struct SYM_Signatures
+{
+   int*                  colors;             /**< colors of the vertices */
+   int*                  adjbegins;          /**< begin positions of the adjacency lists of the vertices */
+   int*                  neighborcolors;     /**< sorted colors of the neighbors of each vertex */
+   uint32_t*             hashes;             /**< hash values of the signatures */
+};
+typedef struct SYM_Signatures SYM_SIGNATURES;
+
+/** comparison method for the signatures of two vertices */
+static
+SCIP_DECL_SORTINDCOMP(compSignatures)
+{
+   SYM_SIGNATURES* signatures;
+   int len1;
+   int len2;
+   int i;
+
+   signatures = (SYM_SIGNATURES*) dataptr;
+
+   if ( signatures->colors[ind1] != signatures->colors[ind2] )
+      return signatures->colors[ind1] < signatures->colors[ind2] ? -1 : 1;
+
+   if ( signatures->hashes[ind1] != signatures->hashes[ind2] )
+      return signatures->hashes[ind1] < signatures->hashes[ind2] ? -1 : 1;
+
+   len1 = signatures->adjbegins[ind1 + 1] - signatures->adjbegins[ind1];
+   len2 = signatures->adjbegins[ind2 + 1] - signatures->adjbegins[ind2];
+   if ( len1 != len2 )
+      return len1 < len2 ? -1 : 1;
+
+   for (i = 0; i < len1; ++i)
+   {
+      int color1;
+      int color2;
+
+      color1 = signatures->neighborcolors[signatures->adjbegins[ind1] + i];
+      color2 = signatures->neighborcolors[signatures->adjbegins[ind2] + i];
+      if ( color1 != color2 )
+         return color1 < color2 ? -1 : 1;
+   }
+
+   return 0;
+}
+
+
+/** refines the colors of the vertices of a graph by the colors of their neighbors
+ *
+ *  In each round, the vertices of each color are split by the multiset of the colors of their neighbors. The refined
+ *  coloring only depends on the structure of the graph and the initial colors, such that it is respected by every
+ *  automorphism that respects the initial colors. The refinement stops if no color has been split in a round (the
+ *  coloring is stable) or after @p maxrounds rounds. Each round takes O((nvertices + nadj) log nvertices) time, where
+ *  nadj = adjbegins[nvertices].
+ *
+ *  On input, @p colors contains arbitrary nonnegative initial colors; on output, it contains the refined colors, which
+ *  are numbered consecutively from 0 to ncolors - 1.
+ */
+SCIP_RETCODE SCIPrefineColorsSym(
+   SCIP*                 scip,               /**< SCIP instance */
+   int                   nvertices,          /**< number of vertices */
+   int*                  adjbegins,          /**< begin positions of the adjacency lists (length nvertices + 1) */
+   int*                  adj,                /**< adjacency lists of the vertices */
+   int                   maxrounds,          /**< maximal number of rounds (-1: unlimited) */
+   int*                  colors,             /**< colors of the vertices */
+   int*                  ncolors,            /**< pointer to store the number of colors */
+   SCIP_Bool*            stable              /**< pointer to store whether the coloring is stable */
+   )
+{
+   SYM_SIGNATURES signatures;
+   int* newcolors;
+   int* order;
+   int round;
+   int v;
+   int i;
+
+   assert( scip != NULL );
+   assert( nvertices >= 0 );
+   assert( adjbegins != NULL );
+   assert( adj != NULL || adjbegins[nvertices] == 0 );
+   assert( colors != NULL || nvertices == 0 );
+   assert( ncolors != NULL );
+   assert( stable != NULL );
+
+   *ncolors = 0;
+   *stable = TRUE;
+
+   if ( nvertices == 0 )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &order, nvertices) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &newcolors, nvertices) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &signatures.hashes, nvertices) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &signatures.neighborcolors, MAX(adjbegins[nvertices], 1)) );
+   signatures.colors = colors;
+   signatures.adjbegins = adjbegins;
+
+   /* number the initial colors consecutively */
+   for (v = 0; v < nvertices; ++v)
+   {
+      assert( colors[v] >= 0 );
+      order[v] = v;
+      newcolors[v] = colors[v];
+   }
+   SCIPsortIntInt(newcolors, order, nvertices);
+
+   for (i = 0; i < nvertices; ++i)
+   {
+      if ( i > 0 && newcolors[i] != newcolors[i - 1] )
+         ++(*ncolors);
+      colors[order[i]] = *ncolors;
+   }
+   ++(*ncolors);
+
+   *stable = FALSE;
+   for (round = 0; (maxrounds < 0 || round < maxrounds) && ! *stable; ++round)
+   {
+      int nnewcolors = 0;
+
+      /* compute the signatures of the vertices */
+      for (v = 0; v < nvertices; ++v)
+      {
+         uint32_t hash;
+
+         for (i = adjbegins[v]; i < adjbegins[v + 1]; ++i)
+            signatures.neighborcolors[i] = colors[adj[i]];
+         SCIPsortInt(&signatures.neighborcolors[adjbegins[v]], adjbegins[v + 1] - adjbegins[v]);
+
+         hash = (uint32_t) (adjbegins[v + 1] - adjbegins[v]);
+         for (i = adjbegins[v]; i < adjbegins[v + 1]; ++i)
+            hash = SCIPhashTwo(hash, signatures.neighborcolors[i]);
+         signatures.hashes[v] = hash;
+
+         order[v] = v;
+      }
+
+      /* sort the vertices by their signatures, whose first entry is the old color, and number the signatures */
+      SCIPsortInd(order, compSignatures, (void*) &signatures, nvertices);
+
+      for (i = 0; i < nvertices; ++i)
+      {
+         if ( i > 0 && compSignatures((void*) &signatures, order[i - 1], order[i]) != 0 )
+            ++nnewcolors;
+         newcolors[order[i]] = nnewcolors;
+      }
+      ++nnewcolors;
+
+      for (v = 0; v < nvertices; ++v)
+         colors[v] = newcolors[v];
+
+      /* since the new coloring refines the old one, it is the same if the number of colors did not change */
+      assert( nnewcolors >= *ncolors );
+      *stable = (nnewcolors == *ncolors);
+      *ncolors = nnewcolors;
+   }
+
+   SCIPfreeBufferArray(scip, &signatures.neighborcolors);
+   SCIPfreeBufferArray(scip, &signatures.hashes);
+   SCIPfreeBufferArray(scip, &newcolors);
+   SCIPfreeBufferArray(scip, &order);
+
+   return SCIP_OKAY;
+}
+
+
 /** generate variable matrix for orbitope constraint handler
  *
  * @pre if storelexorder is TRUE, then the permutations define an orbitope
@@ -968,7 +1385,8 @@ SCIP_RETCODE SCIPgenerateOrbitopeVarsMatrix(
    int**                 orbitopevaridx,     /**< permuted index table of variables in permvars that are contained in orbitope */
    int*                  columnorder,        /**< permutation to reorder column of orbitopevaridx */
    int*                  nusedelems,         /**< array storing how often an element was used in the orbitope */
-   SCIP_Shortbool*       rowisbinary,        /**< array encoding whether a row contains only binary variables (or NULL) */
+   SCIP_Shortbool*       rowisbinary,        /**< array encoding whether a row contains only binary variables (or NULL if all
+                                              *   rows are used, e.g., for orbitopes on general integer variables) */
    SCIP_Bool*            infeasible,         /**< pointer to store whether the potential orbitope is not an orbitope */
    SCIP_Bool             storelexorder,      /**< whether the lexicographic order induced by the orbitope shall be stored */
    int**                 lexorder,           /**< pointer to array storing the lexorder (or NULL) */
@@ -1030,7 +1448,8 @@ SCIP_RETCODE SCIPgenerateOrbitopeVarsMatrix(
             continue;
 
          assert( 0 <= orbitopevaridx[i][curcolumn] && orbitopevaridx[i][curcolumn] < npermvars );
-         assert( SCIPvarIsBinary(permvars[orbitopevaridx[i][curcolumn]]) );
+         assert( rowisbinary == NULL ? SCIPvarIsIntegral(permvars[orbitopevaridx[i][curcolumn]])
+            : SCIPvarIsBinary(permvars[orbitopevaridx[i][curcolumn]]) );
 
          /* elements in first column of orbitope have to appear exactly once in the orbitope */
          if ( nfilledcols == 0 && nusedelems[orbitopevaridx[i][curcolumn]] > 1 )
@@ -1070,7 +1489,8 @@ SCIP_RETCODE SCIPgenerateOrbitopeVarsMatrix(
             continue;
 
          assert( orbitopevaridx[i][1] < npermvars );
-         assert( SCIPvarIsBinary(permvars[orbitopevaridx[i][1]]) );
+         assert( rowisbinary == NULL ? SCIPvarIsIntegral(permvars[orbitopevaridx[i][1]])
+            : SCIPvarIsBinary(permvars[orbitopevaridx[i][1]]) );
 
          if ( storelexorder )
          {
@@ -1090,7 +1510,8 @@ SCIP_RETCODE SCIPgenerateOrbitopeVarsMatrix(
             continue;
 
          assert( orbitopevaridx[i][0] < npermvars );
-         assert( SCIPvarIsBinary(permvars[orbitopevaridx[i][0]]) );
+         assert( rowisbinary == NULL ? SCIPvarIsIntegral(permvars[orbitopevaridx[i][0]])
+            : SCIPvarIsBinary(permvars[orbitopevaridx[i][0]]) );
 
          if ( storelexorder )
          {
@@ -1119,7 +1540,8 @@ SCIP_RETCODE SCIPgenerateOrbitopeVarsMatrix(
                   continue;
 
                assert( orbitopevaridx[i][curcolumn] < npermvars );
-               assert( SCIPvarIsBinary(permvars[orbitopevaridx[i][curcolumn]]) );
+               assert( rowisbinary == NULL ? SCIPvarIsIntegral(permvars[orbitopevaridx[i][curcolumn]])
+                  : SCIPvarIsBinary(permvars[orbitopevaridx[i][curcolumn]]) );
 
                /* elements in last column of orbitope have to appear exactly once in the orbitope */
                if ( nfilledcols == ncols - 1 && nusedelems[orbitopevaridx[i][curcolumn]] > 1 )
@@ -172,6 +172,45 @@ SCIP_RETCODE SCIPdetermineNVarsAffectedSym(
    int*                  nvarsaffected       /**< pointer to store number of all affected variables */
    );
 
+/** computes the support of permutations as sparse transposed permutation matrix
+ *
+ *  For every variable i, the entries supportbegins[i], ..., supportbegins[i + 1] - 1 of supportperms and supportimages
+ *  contain the permutations that move i (sorted increasingly) and the images of i under these permutations. The memory
+ *  thus scales with the total support of the permutations instead of nperms x npermvars. The arrays are allocated in
+ *  block memory; supportperms and supportimages have length MAX(nsupport, 1).
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPcomputeSupportSym(
+   SCIP*                 scip,               /**< SCIP instance */
+   int**                 perms,              /**< permutation generators as (nperms x npermvars) matrix */
+   int                   nperms,             /**< number of permutations */
+   int                   npermvars,          /**< number of variables for permutations */
+   SCIP_Shortbool*       ignorevars,         /**< array marking variables whose images shall be ignored (or NULL) */
+   int**                 supportbegins,      /**< pointer to store begin positions of the variables in the support arrays */
+   int**                 supportperms,       /**< pointer to store the permutations moving the variables */
+   int**                 supportimages,      /**< pointer to store the images of the variables */
+   int*                  nsupport            /**< pointer to store the total size of the support */
+   );
+
+/** compute non-trivial orbits of symmetry group from the support of its generators
+ *
+ *  The support is given as computed by SCIPcomputeSupportSym(). The orbits are stored as by SCIPcomputeOrbitsSym(), but
+ *  only the permutations moving a variable are visited, such that the running time is linear in the size of the
+ *  support instead of in nperms x npermvars. Permutations marked by @p inactiveperms are ignored.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPcomputeOrbitsSupportSym(
+   SCIP*                 scip,               /**< SCIP instance */
+   int                   npermvars,          /**< length of a permutation array */
+   int*                  supportbegins,      /**< begin positions of the variables in the support arrays */
+   int*                  supportperms,       /**< permutations moving the variables */
+   int*                  supportimages,      /**< images of the variables */
+   SCIP_Shortbool*       inactiveperms,      /**< array to store whether permutations are inactive (or NULL) */
+   int*                  orbits,             /**< array of non-trivial orbits */
+   int*                  orbitbegins,        /**< array containing begin positions of new orbits in orbits array */
+   int*                  norbits             /**< pointer to number of orbits currently stored in orbits */
+   );
+
 /** compute components of symmetry group */
 SCIP_EXPORT
 SCIP_RETCODE SCIPcomputeComponentsSym(
@@ -192,6 +231,52 @@ SCIP_RETCODE SCIPcomputeComponentsSym(
    int*                  ncomponents         /**< pointer to store number of components of symmetry group */
    );
 
+/** compute components of symmetry group from the support of its generators
+ *
+ *  The support is given as computed by SCIPcomputeSupportSym(); the running time is linear in its size (up to the
+ *  operations on the disjoint sets) instead of in nperms x npermvars.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPcomputeComponentsSupportSym(
+   SCIP*                 scip,               /**< SCIP instance */
+   int*                  supportbegins,      /**< begin positions of the variables in the support arrays */
+   int*                  supportperms,       /**< permutations moving the variables */
+   int*                  supportimages,      /**< images of the variables */
+   int                   nperms,             /**< number of permutations */
+   int                   npermvars,          /**< number of variables for permutations */
+   int**                 components,         /**< array containing the indices of permutations sorted by components */
+   int**                 componentbegins,    /**< array containing in i-th position the first position of
+                                              *   component i in components array */
+   int**                 vartocomponent,     /**< array containing for each permvar the index of the component it is
+                                              *   contained in (-1 if not affected) */
+   unsigned**            componentblocked,   /**< array to store which symmetry methods have been used on a component
+                                              *   using the same bitset information as for misc/usesymmetry */
+   int*                  ncomponents         /**< pointer to store number of components of symmetry group */
+   );
+
+/** refines the colors of the vertices of a graph by the colors of their neighbors
+ *
+ *  In each round, the vertices of each color are split by the multiset of the colors of their neighbors. The refined
+ *  coloring only depends on the structure of the graph and the initial colors, such that it is respected by every
+ *  automorphism that respects the initial colors. The refinement stops if no color has been split in a round (the
+ *  coloring is stable) or after @p maxrounds rounds. Each round takes O((nvertices + nadj) log nvertices) time, where
+ *  nadj = adjbegins[nvertices].
+ *
+ *  On input, @p colors contains arbitrary nonnegative initial colors; on output, it contains the refined colors, which
+ *  are numbered consecutively from 0 to ncolors - 1.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPrefineColorsSym(
+   SCIP*                 scip,               /**< SCIP instance */
+   int                   nvertices,          /**< number of vertices */
+   int*                  adjbegins,          /**< begin positions of the adjacency lists (length nvertices + 1) */
+   int*                  adj,                /**< adjacency lists of the vertices */
+   int                   maxrounds,          /**< maximal number of rounds (-1: unlimited) */
+   int*                  colors,             /**< colors of the vertices */
+   int*                  ncolors,            /**< pointer to store the number of colors */
+   SCIP_Bool*            stable              /**< pointer to store whether the coloring is stable */
+   );
+
 /** Given a matrix with nrows and \#perms + 1 columns whose first nfilledcols columns contain entries of variables, this routine
  *  checks whether the 2-cycles of perm intersect each row of column coltoextend in exactly one position. In this case,
  *  we add one column to the suborbitope of the first nfilledcols columns.
@@ -226,7 +311,8 @@ SCIP_RETCODE SCIPgenerateOrbitopeVarsMatrix(
    int**                 orbitopevaridx,     /**< permuted index table of variables in permvars that are contained in orbitope */
    int*                  columnorder,        /**< permutation to reorder column of orbitopevaridx */
    int*                  nusedelems,         /**< array storing how often an element was used in the orbitope */
-   SCIP_Shortbool*       rowisbinary,        /**< array encoding whether a row contains only binary variables */
+   SCIP_Shortbool*       rowisbinary,        /**< array encoding whether a row contains only binary variables (or NULL if all
+                                              *   rows are used, e.g., for orbitopes on general integer variables) */
    SCIP_Bool*            infeasible,         /**< pointer to store whether the potential orbitope is not an orbitope */
    SCIP_Bool             storelexorder,      /**< whether the lexicographic order induced by the orbitope shall be stored */
    int**                 lexorder,           /**< pointer to array storing the lexorder (or NULL) */
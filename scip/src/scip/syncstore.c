@@ -69,6 +69,12 @@ SCIP_RETCODE SCIPsyncstoreCreate(
    (*syncstore)->syncdata = NULL;
    (*syncstore)->stopped = FALSE;
    (*syncstore)->nuses = 1;
+   (*syncstore)->subtrees = NULL;
+   (*syncstore)->subtreebounds = NULL;
+   (*syncstore)->nsubtrees = 0;
+   (*syncstore)->subtreessize = 0;
+   (*syncstore)->symvariant = -1;
+   (*syncstore)->symracingscip = NULL;
    SCIP_CALL( SCIPtpiInitLock(&(*syncstore)->lock) );
 
    return SCIP_OKAY;
@@ -139,6 +145,8 @@ SCIP_RETCODE SCIPsyncstoreInit(
    syncstore->mainscip = scip;
    syncstore->lastsync = NULL;
    syncstore->nsolvers = SCIPgetNConcurrentSolvers(scip);
+   syncstore->nfinished = 0;
+   syncstore->nextsubtree = 0;
 
    syncstore->ninitvars = SCIPgetNVars(scip);
    SCIP_CALL( SCIPgetIntParam(scip, "concurrent/sync/maxnsols", &syncstore->maxnsols) );
@@ -218,6 +226,15 @@ SCIP_RETCODE SCIPsyncstoreExit(
 
    SCIPfreeBlockMemoryArray(syncstore->mainscip, &syncstore->syncdata, syncstore->nsyncdata);
 
+   for( i = 0; i < syncstore->nsubtrees; ++i )
+      SCIPboundstoreFree(syncstore->mainscip, &syncstore->subtrees[i]);
+
+   BMSfreeMemoryArrayNull(&syncstore->subtreebounds);
+   BMSfreeMemoryArrayNull(&syncstore->subtrees);
+   syncstore->nsubtrees = 0;
+   syncstore->subtreessize = 0;
+   syncstore->symvariant = -1;
+
    syncstore->initialized = FALSE;
    syncstore->stopped = FALSE;
 
@@ -405,7 +422,7 @@ SCIP_RETCODE SCIPsyncstoreEnsureAllSynced(
    /* check if waiting is required, make sure to hold the lock */
    SCIP_CALL( SCIPtpiAcquireLock(&syncdata->lock) );
 
-   while( syncdata->syncedcount < syncstore->nsolvers )
+   while( syncdata->syncedcount < syncstore->nsolvers - syncstore->nfinished )
    {
       /* yes, so wait on the condition variable
        * (automatically releases the lock and reacquires it after the waiting)
@@ -479,7 +496,7 @@ SCIP_RETCODE SCIPsyncstoreFinishSync(
 
    ++(*syncdata)->syncedcount;
 
-   if( (*syncdata)->syncedcount == syncstore->nsolvers )
+   if( (*syncdata)->syncedcount == syncstore->nsolvers - syncstore->nfinished )
    {
       if( (*syncdata)->status != SCIP_STATUS_UNKNOWN )
          SCIPsyncstoreSetSolveIsStopped(syncstore, TRUE);
@@ -790,3 +807,207 @@ SCIP_PARALLELMODE SCIPsyncstoreGetMode(
 
    return syncstore->mode;
 }
+
+/** marks a solver as finished, i.e., it has processed all of its subtrees and will not write to any further
+ *  synchronization data, so that the remaining solvers do not wait for it anymore
+ */
+SCIP_RETCODE SCIPsyncstoreFinishSolver(
+   SCIP_SYNCSTORE*       syncstore           /**< the synchronization store */
+   )
+{
+   int nactive;
+   int i;
+
+   assert(syncstore != NULL);
+   assert(syncstore->initialized);
+
+   SCIP_CALL( SCIPtpiAcquireLock(&syncstore->lock) );
+   ++syncstore->nfinished;
+   nactive = syncstore->nsolvers - syncstore->nfinished;
+   SCIP_CALL( SCIPtpiReleaseLock(&syncstore->lock) );
+
+   assert(nactive >= 0);
+
+   /* synchronization data that was only missing the write of this solver is complete now */
+   for( i = 0; i < syncstore->nsyncdata; ++i )
+   {
+      SCIP_SYNCDATA* syncdata;
+
+      syncdata = &syncstore->syncdata[i];
+
+      SCIP_CALL( SCIPtpiAcquireLock(&syncdata->lock) );
+
+      if( syncdata->syncnum >= 0 && syncdata->syncedcount == nactive )
+      {
+         if( syncdata->status != SCIP_STATUS_UNKNOWN )
+            SCIPsyncstoreSetSolveIsStopped(syncstore, TRUE);
+
+         if( syncstore->lastsync == NULL || syncstore->lastsync->syncnum < syncdata->syncnum )
+            syncstore->lastsync = syncdata;
+      }
+
+      SCIP_CALL( SCIPtpiBroadcastCondition(&syncdata->allsynced) );
+      SCIP_CALL( SCIPtpiReleaseLock(&syncdata->lock) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** adds a subtree to the pool of subtrees that split the search tree among the solvers;
+ *  the synchronization store takes ownership of the given bound store
+ */
+SCIP_RETCODE SCIPsyncstoreAddSubtree(
+   SCIP_SYNCSTORE*       syncstore,          /**< the synchronization store */
+   SCIP_BOUNDSTORE*      subtree,            /**< branching decisions defining the subtree, indexed like the variables
+                                              *   of the main SCIP */
+   SCIP_Real             lowerbound          /**< lower bound of the subtree in the transformed space of the main SCIP */
+   )
+{
+   assert(syncstore != NULL);
+   assert(subtree != NULL);
+
+   if( syncstore->nsubtrees == syncstore->subtreessize )
+   {
+      int newsize;
+
+      newsize = MAX(2 * syncstore->subtreessize, 8);
+      SCIP_ALLOC( BMSreallocMemoryArray(&syncstore->subtrees, newsize) );
+      SCIP_ALLOC( BMSreallocMemoryArray(&syncstore->subtreebounds, newsize) );
+      syncstore->subtreessize = newsize;
+   }
+
+   syncstore->subtrees[syncstore->nsubtrees] = subtree;
+   syncstore->subtreebounds[syncstore->nsubtrees] = lowerbound;
+   ++syncstore->nsubtrees;
+
+   return SCIP_OKAY;
+}
+
+/** gets the number of subtrees in the pool */
+int SCIPsyncstoreGetNSubtrees(
+   SCIP_SYNCSTORE*       syncstore           /**< the synchronization store */
+   )
+{
+   assert(syncstore != NULL);
+
+   return syncstore->nsubtrees;
+}
+
+/** gets the branching decisions defining the subtree with the given index */
+SCIP_BOUNDSTORE* SCIPsyncstoreGetSubtree(
+   SCIP_SYNCSTORE*       syncstore,          /**< the synchronization store */
+   int                   idx                 /**< index of the subtree */
+   )
+{
+   assert(syncstore != NULL);
+   assert(idx >= 0 && idx < syncstore->nsubtrees);
+
+   return syncstore->subtrees[idx];
+}
+
+/** gets the lower bound of the subtree with the given index */
+SCIP_Real SCIPsyncstoreGetSubtreeLowerbound(
+   SCIP_SYNCSTORE*       syncstore,          /**< the synchronization store */
+   int                   idx                 /**< index of the subtree */
+   )
+{
+   assert(syncstore != NULL);
+   assert(idx >= 0 && idx < syncstore->nsubtrees);
+
+   return syncstore->subtreebounds[idx];
+}
+
+/** sets the lower bound of the subtree with the given index; must only be called by the solver processing the subtree */
+void SCIPsyncstoreSetSubtreeLowerbound(
+   SCIP_SYNCSTORE*       syncstore,          /**< the synchronization store */
+   int                   idx,                /**< index of the subtree */
+   SCIP_Real             lowerbound          /**< the new lower bound in the transformed space of the main SCIP, or
+                                              *   infinity if the subtree was solved */
+   )
+{
+   assert(syncstore != NULL);
+   assert(idx >= 0 && idx < syncstore->nsubtrees);
+
+   syncstore->subtreebounds[idx] = lowerbound;
+}
+
+/** gets the index of the next subtree the given solver should process, or -1 if there is none left
+ *
+ *  In deterministic mode the subtrees are assigned round-robin by solver index, so that every solver processes the same
+ *  subtrees in the same order in each run. In opportunistic mode the solvers take the next unprocessed subtree from the
+ *  pool, so that solvers finishing early take over the work that is still left.
+ */
+int SCIPsyncstoreNextSubtree(
+   SCIP_SYNCSTORE*       syncstore,          /**< the synchronization store */
+   int                   solverid,           /**< index of the solver */
+   int                   nprocessed          /**< number of subtrees the solver has already processed */
+   )
+{
+   int idx;
+
+   assert(syncstore != NULL);
+   assert(syncstore->initialized);
+   assert(solverid >= 0 && solverid < syncstore->nsolvers);
+
+   if( syncstore->mode == SCIP_PARA_DETERMINISTIC )
+   {
+      idx = solverid + nprocessed * syncstore->nsolvers;
+   }
+   else
+   {
+      SCIP_CALL_ABORT( SCIPtpiAcquireLock(&syncstore->lock) );
+      idx = syncstore->nextsubtree++;
+      SCIP_CALL_ABORT( SCIPtpiReleaseLock(&syncstore->lock) );
+   }
+
+   return idx < syncstore->nsubtrees ? idx : -1;
+}
+
+/** sets the symmetry handling method that won the racing ramp-up phase */
+void SCIPsyncstoreSetSymmetryVariant(
+   SCIP_SYNCSTORE*       syncstore,          /**< the synchronization store */
+   int                   symvariant          /**< index of the symmetry handling method, or -1 if there was no race */
+   )
+{
+   assert(syncstore != NULL);
+   assert(symvariant >= -1);
+
+   syncstore->symvariant = symvariant;
+}
+
+/** gets the symmetry handling method that won the racing ramp-up phase, or -1 if there was no race */
+int SCIPsyncstoreGetSymmetryVariant(
+   SCIP_SYNCSTORE*       syncstore           /**< the synchronization store */
+   )
+{
+   assert(syncstore != NULL);
+
+   return syncstore->symvariant;
+}
+
+/** sets the SCIP whose presolved problem is copied to the symmetry racers and that must therefore not handle symmetries
+ *  itself, or NULL if there is none
+ */
+void SCIPsyncstoreSetSymmetryRacingScip(
+   SCIP_SYNCSTORE*       syncstore,          /**< the synchronization store */
+   SCIP*                 scip                /**< SCIP datastructure, or NULL */
+   )
+{
+   assert(syncstore != NULL);
+
+   syncstore->symracingscip = scip;
+}
+
+/** returns whether symmetry handling is disabled for the given SCIP, because its presolved problem is copied to the
+ *  symmetry racers
+ */
+SCIP_Bool SCIPsyncstoreIsSymmetryRacingScip(
+   SCIP_SYNCSTORE*       syncstore,          /**< the synchronization store */
+   SCIP*                 scip                /**< SCIP datastructure */
+   )
+{
+   assert(syncstore != NULL);
+   assert(scip != NULL);
+
+   return syncstore->symracingscip == scip;
+}
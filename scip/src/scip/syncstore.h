@@ -291,4 +291,96 @@ SCIP_PARALLELMODE SCIPsyncstoreGetMode(
    SCIP_SYNCSTORE*       syncstore           /**< the synchronization store */
    );
 
+/** marks a solver as finished, i.e., it has processed all of its subtrees and will not write to any further
+ *  synchronization data, so that the remaining solvers do not wait for it anymore
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPsyncstoreFinishSolver(
+   SCIP_SYNCSTORE*       syncstore           /**< the synchronization store */
+   );
+
+/** adds a subtree to the pool of subtrees that split the search tree among the solvers;
+ *  the synchronization store takes ownership of the given bound store
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPsyncstoreAddSubtree(
+   SCIP_SYNCSTORE*       syncstore,          /**< the synchronization store */
+   SCIP_BOUNDSTORE*      subtree,            /**< branching decisions defining the subtree, indexed like the variables
+                                              *   of the main SCIP */
+   SCIP_Real             lowerbound          /**< lower bound of the subtree in the transformed space of the main SCIP */
+   );
+
+/** gets the number of subtrees in the pool */
+SCIP_EXPORT
+int SCIPsyncstoreGetNSubtrees(
+   SCIP_SYNCSTORE*       syncstore           /**< the synchronization store */
+   );
+
+/** gets the branching decisions defining the subtree with the given index */
+SCIP_EXPORT
+SCIP_BOUNDSTORE* SCIPsyncstoreGetSubtree(
+   SCIP_SYNCSTORE*       syncstore,          /**< the synchronization store */
+   int                   idx                 /**< index of the subtree */
+   );
+
+/** gets the lower bound of the subtree with the given index */
+SCIP_EXPORT
+SCIP_Real SCIPsyncstoreGetSubtreeLowerbound(
+   SCIP_SYNCSTORE*       syncstore,          /**< the synchronization store */
+   int                   idx                 /**< index of the subtree */
+   );
+
+/** sets the lower bound of the subtree with the given index; must only be called by the solver processing the subtree */
+SCIP_EXPORT
+void SCIPsyncstoreSetSubtreeLowerbound(
+   SCIP_SYNCSTORE*       syncstore,          /**< the synchronization store */
+   int                   idx,                /**< index of the subtree */
+   SCIP_Real             lowerbound          /**< the new lower bound in the transformed space of the main SCIP, or
+                                              *   infinity if the subtree was solved */
+   );
+
+/** gets the index of the next subtree the given solver should process, or -1 if there is none left
+ *
+ *  In deterministic mode the subtrees are assigned round-robin by solver index, so that every solver processes the same
+ *  subtrees in the same order in each run. In opportunistic mode the solvers take the next unprocessed subtree from the
+ *  pool, so that solvers finishing early take over the work that is still left.
+ */
+SCIP_EXPORT
+int SCIPsyncstoreNextSubtree(
+   SCIP_SYNCSTORE*       syncstore,          /**< the synchronization store */
+   int                   solverid,           /**< index of the solver */
+   int                   nprocessed          /**< number of subtrees the solver has already processed */
+   );
+
+/** sets the symmetry handling method that won the racing ramp-up phase */
+SCIP_EXPORT
+void SCIPsyncstoreSetSymmetryVariant(
+   SCIP_SYNCSTORE*       syncstore,          /**< the synchronization store */
+   int                   symvariant          /**< index of the symmetry handling method, or -1 if there was no race */
+   );
+
+/** gets the symmetry handling method that won the racing ramp-up phase, or -1 if there was no race */
+SCIP_EXPORT
+int SCIPsyncstoreGetSymmetryVariant(
+   SCIP_SYNCSTORE*       syncstore           /**< the synchronization store */
+   );
+
+/** sets the SCIP whose presolved problem is copied to the symmetry racers and that must therefore not handle symmetries
+ *  itself, or NULL if there is none
+ */
+SCIP_EXPORT
+void SCIPsyncstoreSetSymmetryRacingScip(
+   SCIP_SYNCSTORE*       syncstore,          /**< the synchronization store */
+   SCIP*                 scip                /**< SCIP datastructure, or NULL */
+   );
+
+/** returns whether symmetry handling is disabled for the given SCIP, because its presolved problem is copied to the
+ *  symmetry racers
+ */
+SCIP_EXPORT
+SCIP_Bool SCIPsyncstoreIsSymmetryRacingScip(
+   SCIP_SYNCSTORE*       syncstore,          /**< the synchronization store */
+   SCIP*                 scip                /**< SCIP datastructure */
+   );
+
 #endif
@@ -1290,6 +1290,26 @@ void SCIPnodeMarkPropagated(
    }
 }
 
+/** expands the branching decisions of a leaf that are stored compactly, such that the bound changes of its domain
+ *  change data can be accessed
+ */
+SCIP_RETCODE SCIPnodeExpandDomchg(
+   SCIP_NODE*            node,               /**< node */
+   BMS_BLKMEM*           blkmem              /**< block memory */
+   )
+{
+   assert(node != NULL);
+
+   if( node->domchg != NULL && node->domchg->domchgcompact.domchgtype == SCIP_DOMCHGTYPE_COMPACT ) /*lint !e641*/
+   {
+      assert(!node->active);
+
+      SCIP_CALL( SCIPdomchgExpandCompact(&node->domchg, blkmem) );
+   }
+
+   return SCIP_OKAY;
+}
+
 /** moves the subtree repropagation counter to the next value */
 static
 void treeNextRepropsubtreecount(
@@ -1335,6 +1355,7 @@ SCIP_RETCODE nodeRepropagate(
    SCIP_Longint oldnboundchgs;
    SCIP_Bool initialreprop;
    SCIP_Bool clockisrunning;
+   SCIP_Bool deferbdchgs;
 
    assert(node != NULL);
    assert((SCIP_NODETYPE)node->nodetype == SCIP_NODETYPE_FOCUSNODE
@@ -1354,7 +1375,8 @@ SCIP_RETCODE nodeRepropagate(
 
    SCIPvisualRepropagatedNode(stat->visual, stat, node);
 
-   /* process the delayed events in order to flush the problem changes */
+   /* process the delayed events in order to flush the problem changes; this also issues deferred bound changes */
+   deferbdchgs = SCIPeventqueueIsDeferringBdchgs(eventqueue);
    SCIP_CALL( SCIPeventqueueProcess(eventqueue, blkmem, set, primal, lp, branchcand, eventfilter) );
 
    /* stop node activation timer */
@@ -1443,6 +1465,10 @@ SCIP_RETCODE nodeRepropagate(
 
    /* delay events in path switching */
    SCIP_CALL( SCIPeventqueueDelay(eventqueue) );
+   if( deferbdchgs && tree->npendingbdchgs == 0 )
+   {
+      SCIP_CALL( SCIPeventqueueDeferBdchgs(eventqueue) );
+   }
 
    /* mark the node to be cut off if a cutoff was detected */
    if( *cutoff )
@@ -1484,7 +1510,13 @@ SCIP_RETCODE nodeActivate(
    SCIPsetDebugMsg(set, "activate node #%" SCIP_LONGINT_FORMAT " at depth %d of type %d (reprop subtree mark: %u)\n",
       SCIPnodeGetNumber(node), SCIPnodeGetDepth(node), SCIPnodeGetType(node), node->repropsubtreemark);
 
-   /* apply domain and constraint set changes */
+   /* apply domain and constraint set changes; constraint activation may look at the bounds of all variables, so
+    * deferred bound changes of the path switching must be issued before
+    */
+   if( node->conssetchg != NULL )
+   {
+      SCIP_CALL( SCIPeventqueueFlushBdchgs(eventqueue, blkmem, set, lp, branchcand) );
+   }
    SCIP_CALL( SCIPconssetchgApply(node->conssetchg, blkmem, set, stat, (int) node->depth,
          (SCIPnodeGetType(node) == SCIP_NODETYPE_FOCUSNODE)) );
    SCIP_CALL( SCIPdomchgApply(node->domchg, blkmem, set, stat, lp, branchcand, eventqueue, (int) node->depth, cutoff) );
@@ -1503,6 +1535,7 @@ SCIP_RETCODE nodeActivate(
       node->reprop = set->conf_enable && set->conf_useprop;
 
       /* mark the node to be cut off */
+      SCIP_CALL( SCIPeventqueueFlushBdchgs(eventqueue, blkmem, set, lp, branchcand) );
       SCIP_CALL( SCIPnodeCutoff(node, set, stat, tree, transprob, origprob, reopt, lp, blkmem) );
    }
 
@@ -1546,8 +1579,14 @@ SCIP_RETCODE nodeDeactivate(
    SCIPsetDebugMsg(set, "deactivate node #%" SCIP_LONGINT_FORMAT " at depth %d of type %d (reprop subtree mark: %u)\n",
       SCIPnodeGetNumber(node), SCIPnodeGetDepth(node), SCIPnodeGetType(node), node->repropsubtreemark);
 
-   /* undo domain and constraint set changes */
+   /* undo domain and constraint set changes; deferred bound changes of the path switching are issued before
+    * constraints are deactivated
+    */
    SCIP_CALL( SCIPdomchgUndo(node->domchg, blkmem, set, stat, lp, branchcand, eventqueue) );
+   if( node->conssetchg != NULL )
+   {
+      SCIP_CALL( SCIPeventqueueFlushBdchgs(eventqueue, blkmem, set, lp, branchcand) );
+   }
    SCIP_CALL( SCIPconssetchgUndo(node->conssetchg, blkmem, set, stat) );
 
    /* mark node inactive */
@@ -1587,6 +1626,8 @@ SCIP_RETCODE nodeDeactivate(
    }
    if( freeNode ) 
    {
+      /* the deferred variables might be released with the node's domain changes */
+      SCIP_CALL( SCIPeventqueueFlushBdchgs(eventqueue, blkmem, set, lp, branchcand) );
       SCIP_CALL( SCIPnodeFree(&node, blkmem, set, stat, eventfilter, eventqueue, tree, lp) );
    }
 
@@ -3104,6 +3145,16 @@ SCIP_RETCODE treeSwitchPath(
    /* delay events in path switching */
    SCIP_CALL( SCIPeventqueueDelay(eventqueue) );
 
+   /* defer the local bound changes of the path switching: deactivating and activating the nodes only changes the
+    * bounds, and the events and updates of the parent variables are issued once per variable for the net change
+    * between the old and the new path when the delayed events are processed below; pending bound changes may change
+    * global bounds, so bound changes are not deferred if there are any
+    */
+   if( set->nodesel_netswitch && tree->npendingbdchgs == 0 )
+   {
+      SCIP_CALL( SCIPeventqueueDeferBdchgs(eventqueue) );
+   }
+
    /* undo the domain and constraint set changes of the old active path by deactivating the path's nodes */
    for( i = tree->pathlen-1; i > forkdepth; --i )
    {
@@ -3708,6 +3759,14 @@ SCIP_RETCODE nodeToLeaf(
       /* make the domain change data static to save memory */
       SCIP_CALL( SCIPdomchgMakeStatic(&(*node)->domchg, blkmem, set, eventqueue, lp) );
 
+      /* if the memory limit is approached, store the branching decisions compactly until the leaf gets focused;
+       * the bound changes of active nodes have to remain accessible in order to undo them
+       */
+      if( stat->compactleaves && !(*node)->active )
+      {
+         SCIP_CALL( SCIPdomchgMakeCompact(&(*node)->domchg, blkmem, set) );
+      }
+
       /* node is now member of the node queue: delete the pointer to forbid further access */
       *node = NULL;
    }
@@ -4387,6 +4446,12 @@ SCIP_RETCODE SCIPnodeFocus(
       return SCIP_OKAY;
    }
 
+   /* restore the branching decisions of a leaf that has been stored compactly */
+   if( *node != NULL && SCIPnodeGetType(*node) == SCIP_NODETYPE_LEAF )
+   {
+      SCIP_CALL( SCIPdomchgMakeStatic(&(*node)->domchg, blkmem, set, eventqueue, lp) );
+   }
+
    assert(tree->cutoffdepth == INT_MAX);
    assert(fork == NULL || fork->active);
    assert(lpstatefork == NULL || lpfork != NULL);
@@ -7523,6 +7588,10 @@ void SCIPnodeSetReoptID(
 
 /** gets the domain change information of the node, i.e., the information about the differences in the
  *  variables domains to the parent node
+ *
+ *  @note the bound changes of a leaf may be stored compactly if the memory limit is approached; use
+ *        SCIPnodeGetParentBranchings() to access the branching decisions of leaves, or expand them with
+ *        SCIPexpandNodeDomchg() first
  */
 SCIP_DOMCHG* SCIPnodeGetDomchg(
    SCIP_NODE*            node                /**< node */
@@ -7560,7 +7629,13 @@ void SCIPnodeGetNDomchg(
    if( count_prop )
       *nprop = 0;
 
-   if( node->domchg != NULL )
+   /* compact domain change data only contains branching decisions */
+   if( node->domchg != NULL && node->domchg->domchgcompact.domchgtype == SCIP_DOMCHGTYPE_COMPACT ) /*lint !e641*/
+   {
+      if( count_branchings )
+         *nbranchings = (int) node->domchg->domchgcompact.nboundchgs;
+   }
+   else if( node->domchg != NULL )
    {
       for( i = 0; i < (int) node->domchg->domchgbound.nboundchgs; i++ )
       {
@@ -7597,7 +7672,8 @@ int SCIPnodeGetNDualBndchgs(
 
    assert(node != NULL);
 
-   if( node->domchg == NULL )
+   /* compact domain change data only contains branching decisions */
+   if( node->domchg == NULL || node->domchg->domchgcompact.domchgtype == SCIP_DOMCHGTYPE_COMPACT ) /*lint !e641*/
       return 0;
 
    nboundchgs = (int)node->domchg->domchgbound.nboundchgs;
@@ -7655,7 +7731,9 @@ void SCIPnodeGetDualBoundchgs(
 
    (*nvars) = 0;
 
-   if( SCIPnodeGetDepth(node) == 0 || node->domchg == NULL )
+   /* compact domain change data only contains branching decisions */
+   if( SCIPnodeGetDepth(node) == 0 || node->domchg == NULL
+      || node->domchg->domchgcompact.domchgtype == SCIP_DOMCHGTYPE_COMPACT ) /*lint !e641*/
       return;
 
    nboundchgs = (int)node->domchg->domchgbound.nboundchgs;
@@ -7746,6 +7824,29 @@ void SCIPnodeGetParentBranchings(
    if( SCIPnodeGetDepth(node) == 0 || node->domchg == NULL )
       return;
 
+   /* decode the branching decisions of a leaf that is stored compactly */
+   if( node->domchg->domchgcompact.domchgtype == SCIP_DOMCHGTYPE_COMPACT ) /*lint !e641*/
+   {
+      SCIP_BOUNDCHG boundchg;
+      int bytepos;
+
+      *nbranchvars = (int) node->domchg->domchgcompact.nboundchgs;
+
+      if( branchvarssize >= *nbranchvars )
+      {
+         boundchg.var = NULL;
+         bytepos = 0;
+         for( i = 0; i < *nbranchvars; i++)
+         {
+            SCIPdomchgGetCompactBoundchg(node->domchg, &bytepos, &boundchg);
+            branchvars[i] = boundchg.var;
+            boundtypes[i] = (SCIP_BOUNDTYPE) boundchg.boundtype;
+            branchbounds[i] = boundchg.newbound;
+         }
+      }
+      return;
+   }
+
    nboundchgs = (int)node->domchg->domchgbound.nboundchgs;
    boundchgs = node->domchg->domchgbound.boundchgs;
 
@@ -7887,7 +7988,9 @@ void SCIPnodeGetConsProps(
 
    (*nconspropvars) = 0;
 
-   if( SCIPnodeGetDepth(node) == 0 || node->domchg == NULL )
+   /* compact domain change data only contains branching decisions */
+   if( SCIPnodeGetDepth(node) == 0 || node->domchg == NULL
+      || node->domchg->domchgcompact.domchgtype == SCIP_DOMCHGTYPE_COMPACT ) /*lint !e641*/
       return;
 
    nboundchgs = (int)node->domchg->domchgbound.nboundchgs;
@@ -7975,7 +8078,9 @@ void SCIPnodeGetBdChgsAfterDual(
 
    (*nbranchvars) = 0;
 
-   if( SCIPnodeGetDepth(node) == 0 || node->domchg == NULL )
+   /* compact domain change data only contains branching decisions */
+   if( SCIPnodeGetDepth(node) == 0 || node->domchg == NULL
+      || node->domchg->domchgcompact.domchgtype == SCIP_DOMCHGTYPE_COMPACT ) /*lint !e641*/
       return;
 
    nboundchgs = (int)node->domchg->domchgbound.nboundchgs;
@@ -8042,21 +8147,37 @@ SCIP_RETCODE SCIPnodePrintAncestorBranchings(
 
    while( SCIPnodeGetDepth(node) != 0 )
    {
+      SCIP_BOUNDCHG compactboundchg;
       SCIP_BOUNDCHG* boundchgs;
+      SCIP_BOUNDCHG* boundchg;
       char label[SCIP_MAXSTRLEN];
+      SCIP_Bool compact;
       int nboundchgs;
+      int bytepos;
       int i;
 
       nboundchgs = (int)node->domchg->domchgbound.nboundchgs;
       boundchgs = node->domchg->domchgbound.boundchgs;
+      compact = (node->domchg->domchgcompact.domchgtype == SCIP_DOMCHGTYPE_COMPACT); /*lint !e641*/
+      compactboundchg.var = NULL;
+      bytepos = 0;
 
       for( i = 0; i < nboundchgs; i++)
       {
-         if( boundchgs[i].boundchgtype != SCIP_BOUNDCHGTYPE_BRANCHING ) /*lint !e641*/
+         /* decode the branching decisions of a leaf that is stored compactly */
+         if( compact )
+         {
+            SCIPdomchgGetCompactBoundchg(node->domchg, &bytepos, &compactboundchg);
+            boundchg = &compactboundchg;
+         }
+         else
+            boundchg = &boundchgs[i];
+
+         if( boundchg->boundchgtype != SCIP_BOUNDCHGTYPE_BRANCHING ) /*lint !e641*/
             break;
 
-         (void) SCIPsnprintf(label, SCIP_MAXSTRLEN, "%s %s %g", SCIPvarGetName(boundchgs[i].var),
-            (SCIP_BOUNDTYPE) boundchgs[i].boundtype == SCIP_BOUNDTYPE_LOWER ? ">=" : "<=", boundchgs[i].newbound);
+         (void) SCIPsnprintf(label, SCIP_MAXSTRLEN, "%s %s %g", SCIPvarGetName(boundchg->var),
+            (SCIP_BOUNDTYPE) boundchg->boundtype == SCIP_BOUNDTYPE_LOWER ? ">=" : "<=", boundchg->newbound);
 
          SCIPgmlWriteNode(file, (unsigned int)nbranchings, label, "circle", NULL, NULL);
 
@@ -147,6 +147,14 @@ void SCIPnodeMarkPropagated(
    SCIP_TREE*            tree                /**< branch and bound tree */
    );
 
+/** expands the branching decisions of a leaf that are stored compactly, such that the bound changes of its domain
+ *  change data can be accessed
+ */
+SCIP_RETCODE SCIPnodeExpandDomchg(
+   SCIP_NODE*            node,               /**< node */
+   BMS_BLKMEM*           blkmem              /**< block memory */
+   );
+
 /** adds constraint locally to the node and captures it; activates constraint, if node is active;
  *  if a local constraint is added to the root node, it is automatically upgraded into a global constraint
  */
@@ -32,6 +32,7 @@
 
 #include "scip/type_scip.h"
 #include "scip/type_cons.h"
+#include "scip/type_misc.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -88,6 +89,37 @@ typedef struct SCIP_ActivationSubmatrix SCIP_ACTIVATIONSUBMATRIX;
 
 #define SCIP_DECL_ACTIVATIONFINDDATA(x) SCIP_RETCODE x (SCIP* scip, SCIP_ACTIVATIONHDLR* activationhdlr, SCIP_CONS* cons, SCIP_Bool forparentnode, void** activationdata)
 
+/** constraint deletion method of activation handler (called when an original constraint using this handler is freed)
+ *
+ *  The activation handler should release all data it stores for the constraint, such that constraints can be deleted
+ *  from the original problem and new ones can be registered afterwards.
+ *
+ *  input:
+ *  - scip            : SCIP main data structure
+ *  - activationhdlr  : the activation handler itself
+ *  - cons            : the original constraint that is freed
+ */
+#define SCIP_DECL_ACTIVATIONCONSDELETE(x) SCIP_RETCODE x (SCIP* scip, SCIP_ACTIVATIONHDLR* activationhdlr, SCIP_CONS* cons)
+
+/** constraint copying method of activation handler (called when a constraint using this handler is copied)
+ *
+ *  The activation handler should register the copied constraint with the data of the source constraint, mapped to the
+ *  variables of the target SCIP, such that the activation of the constraint is kept in copies of the problem.
+ *
+ *  input:
+ *  - scip            : target SCIP data structure
+ *  - activationhdlr  : the activation handler of the target SCIP
+ *  - sourcescip      : source SCIP data structure
+ *  - sourceactivationhdlr : the activation handler of the source SCIP
+ *  - sourcecons      : the constraint of the source SCIP
+ *  - targetcons      : the copied constraint of the target SCIP
+ *  - varmap          : hashmap mapping the variables of the source SCIP to the variables of the target SCIP
+ *
+ *  output:
+ *  - valid           : pointer to store whether the registration of the constraint could be copied
+ */
+#define SCIP_DECL_ACTIVATIONCONSCOPY(x) SCIP_RETCODE x (SCIP* scip, SCIP_ACTIVATIONHDLR* activationhdlr, SCIP* sourcescip, SCIP_ACTIVATIONHDLR* sourceactivationhdlr, SCIP_CONS* sourcecons, SCIP_CONS* targetcons, SCIP_HASHMAP* varmap, SCIP_Bool* valid)
+
 #ifdef __cplusplus
 }
 #endif
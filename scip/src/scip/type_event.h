@@ -243,6 +243,26 @@ typedef struct SCIP_EventQueue SCIP_EVENTQUEUE;   /**< event queue to cache even
  */
 #define SCIP_DECL_EVENTEXEC(x) SCIP_RETCODE x (SCIP* scip, SCIP_EVENTHDLR* eventhdlr, SCIP_EVENT* event, SCIP_EVENTDATA* eventdata)
 
+/** batched execution method of event handler
+ *
+ *  Processes a batch of local bound change events. If an event handler provides this method, the local bound change
+ *  events it catches during the call of a propagator or of the propagation method of a constraint handler are collected
+ *  and passed to this method at the end of the call instead of calling the execution method for each of them. The
+ *  events are given in the order in which they occurred. Collected events are always passed before any other event is
+ *  given to the event handler, and events of catches that were dropped in the meantime are removed from the batch.
+ *  Therefore, the event handler only has to cope with its data being updated later during propagation. The method must
+ *  neither change bounds nor drop event catches.
+ *
+ *  input:
+ *  - scip            : SCIP main data structure
+ *  - eventhdlr       : the event handler itself
+ *  - events          : array of local bound change events to process
+ *  - eventdata       : array with the user data of the events
+ *  - nevents         : number of events to process
+ */
+#define SCIP_DECL_EVENTEXECBATCH(x) SCIP_RETCODE x (SCIP* scip, SCIP_EVENTHDLR* eventhdlr, SCIP_EVENT** events, \
+      SCIP_EVENTDATA** eventdata, int nevents)
+
 #ifdef __cplusplus
 }
 #endif
@@ -64,7 +64,8 @@ enum SCIP_DomchgType
 {
    SCIP_DOMCHGTYPE_DYNAMIC = 0,         /**< dynamic bound changes with size information of arrays */
    SCIP_DOMCHGTYPE_BOTH    = 1,         /**< static domain changes: number of entries equals size of arrays */
-   SCIP_DOMCHGTYPE_BOUND   = 2          /**< static domain changes without any hole changes */
+   SCIP_DOMCHGTYPE_BOUND   = 2,         /**< static domain changes without any hole changes */
+   SCIP_DOMCHGTYPE_COMPACT = 3          /**< static branching decisions in a compact byte encoding */
 };
 typedef enum SCIP_DomchgType SCIP_DOMCHGTYPE;
 
@@ -89,6 +90,7 @@ typedef enum SCIP_LockType SCIP_LOCKTYPE;
 typedef struct SCIP_DomChgBound SCIP_DOMCHGBOUND; /**< static domain change data for bound changes */
 typedef struct SCIP_DomChgBoth SCIP_DOMCHGBOTH;   /**< static domain change data for bound and hole changes */
 typedef struct SCIP_DomChgDyn SCIP_DOMCHGDYN;     /**< dynamic domain change data for bound and hole changes */
+typedef struct SCIP_DomChgCompact SCIP_DOMCHGCOMPACT; /**< compact domain change data for branching decisions */
 typedef union SCIP_DomChg SCIP_DOMCHG;            /**< changes in domains of variables */
 typedef struct SCIP_BoundChg SCIP_BOUNDCHG;       /**< changes in bounds of variables */
 typedef struct SCIP_BdChgIdx SCIP_BDCHGIDX;       /**< bound change index in path from root to current node */
@@ -69,6 +69,14 @@
                               *   in implication graph */
 #define MAXABSVBCOEF    1e+5 /**< maximal absolute coefficient in variable bounds added due to implications */
 
+#define COMPACTFLAG_UPPER      0x01 /**< flag of a compactly stored bound change: bound type is upper */
+#define COMPACTFLAG_INTBOUND   0x02 /**< flag of a compactly stored bound change: new bound is stored as integer */
+#define COMPACTFLAG_LPSOLVAL   0x04 /**< flag of a compactly stored bound change: LP solution value is stored */
+#define COMPACTFLAG_APPLIED    0x08 /**< flag of a compactly stored bound change: bound change was applied */
+#define COMPACTFLAG_REDUNDANT  0x10 /**< flag of a compactly stored bound change: bound change is redundant */
+#define COMPACTMAXINTBOUND     1e+15 /**< maximal absolute value of integral bounds that are stored as integers */
+#define COMPACTMAXBYTES        29   /**< maximal number of bytes of a compactly stored bound change */
+
 
 /*
  * Debugging variable release and capture
@@ -409,6 +417,53 @@ void domMerge(
 #endif
 }
 
+/** updates the entries of the variable in the bound mirror of the transformed problem, if the mirror is enabled */
+static
+void varUpdateBoundMirror(
+   SCIP_VAR*             var,                /**< problem variable */
+   SCIP_EVENTQUEUE*      eventqueue          /**< event queue, may be NULL for original variables */
+   )
+{
+   SCIP_PROB* transprob;
+
+   assert(var != NULL);
+
+   if( eventqueue == NULL || SCIPvarGetStatus(var) == SCIP_VARSTATUS_ORIGINAL )
+      return;
+
+   /* the transformed problem registers its bound mirror at the event queue */
+   transprob = SCIPeventqueueGetMirrorProb(eventqueue);
+
+   if( transprob != NULL && var->index < transprob->nmirrorvars )
+   {
+      assert(transprob->mirrorbounds);
+      SCIPprobUpdateMirror(transprob, var);
+   }
+}
+
+/** removes the variable from the bound mirror of the transformed problem after it has been aggregated or
+ *  multi-aggregated, if the mirror is enabled
+ */
+static
+void varInvalidateBoundMirror(
+   SCIP_VAR*             var,                /**< aggregated or multi-aggregated variable */
+   SCIP_EVENTQUEUE*      eventqueue          /**< event queue, or NULL */
+   )
+{
+   SCIP_PROB* transprob;
+
+   assert(var != NULL);
+
+   if( eventqueue == NULL )
+      return;
+
+   /* the transformed problem registers its bound mirror at the event queue */
+   transprob = SCIPeventqueueGetMirrorProb(eventqueue);
+
+   if( transprob != NULL )
+      SCIPprobInvalidateMirror(transprob, var);
+}
+
 /*
  * domain change methods
  */
@@ -1047,6 +1102,256 @@ SCIP_RETCODE domchgCreate(
    return SCIP_OKAY;
 }
 
+/** writes an unsigned integer in 7 bit groups to the byte array and returns the number of written bytes */
+static
+int compactWriteUnsigned(
+   unsigned char*        bytes,              /**< byte array to write to */
+   uint64_t              value               /**< value to write */
+   )
+{
+   int nbytes = 0;
+
+   while( value >= 0x80 )
+   {
+      bytes[nbytes++] = (unsigned char) ((value & 0x7f) | 0x80);
+      value >>= 7;
+   }
+   bytes[nbytes++] = (unsigned char) value;
+
+   return nbytes;
+}
+
+/** reads an unsigned integer written by compactWriteUnsigned() and advances the position */
+static
+uint64_t compactReadUnsigned(
+   const unsigned char*  bytes,              /**< byte array to read from */
+   int*                  pos                 /**< pointer to position in byte array */
+   )
+{
+   uint64_t value = 0;
+   int shift = 0;
+
+   while( (bytes[*pos] & 0x80) != 0 )
+   {
+      value |= (uint64_t) (bytes[*pos] & 0x7f) << shift;
+      shift += 7;
+      ++(*pos);
+   }
+   value |= (uint64_t) bytes[*pos] << shift;
+   ++(*pos);
+
+   return value;
+}
+
+/** writes a signed integer such that values of small absolute value need few bytes, returns the number of written bytes */
+static
+int compactWriteSigned(
+   unsigned char*        bytes,              /**< byte array to write to */
+   int64_t               value               /**< value to write */
+   )
+{
+   return compactWriteUnsigned(bytes, value < 0 ? 2 * ~((uint64_t) value) + 1 : 2 * (uint64_t) value);
+}
+
+/** reads a signed integer written by compactWriteSigned() and advances the position */
+static
+int64_t compactReadSigned(
+   const unsigned char*  bytes,              /**< byte array to read from */
+   int*                  pos                 /**< pointer to position in byte array */
+   )
+{
+   uint64_t value;
+
+   value = compactReadUnsigned(bytes, pos);
+
+   return (value & 1) != 0 ? -(int64_t) (value >> 1) - 1 : (int64_t) (value >> 1);
+}
+
+/** decodes the next bound change of a compact domain change and advances the position in the byte encoding
+ *
+ *  @note boundchg->var has to be the variable of the previously decoded bound change of the domain change, or NULL
+ *        when decoding the first bound change
+ */
+void SCIPdomchgGetCompactBoundchg(
+   SCIP_DOMCHG*          domchg,             /**< compact domain change data */
+   int*                  bytepos,            /**< pointer to position in byte encoding, 0 for the first bound change */
+   SCIP_BOUNDCHG*        boundchg            /**< bound change to store decoded data in */
+   )
+{
+   const unsigned char* bytes;
+   unsigned char flags;
+   uint64_t varaddr;
+
+   assert(domchg != NULL);
+   assert(domchg->domchgcompact.domchgtype == SCIP_DOMCHGTYPE_COMPACT); /*lint !e641*/
+   assert(bytepos != NULL);
+   assert(0 <= *bytepos && *bytepos < domchg->domchgcompact.nbytes);
+   assert(boundchg != NULL);
+
+   bytes = domchg->domchgcompact.bytes;
+   flags = bytes[(*bytepos)++];
+
+   varaddr = (uint64_t) (uintptr_t) boundchg->var + (uint64_t) compactReadSigned(bytes, bytepos);
+   boundchg->var = (SCIP_VAR*) (uintptr_t) varaddr;
+
+   if( (flags & COMPACTFLAG_INTBOUND) != 0 )
+      boundchg->newbound = (SCIP_Real) compactReadSigned(bytes, bytepos);
+   else
+   {
+      BMScopyMemorySize(&boundchg->newbound, &bytes[*bytepos], sizeof(SCIP_Real));
+      *bytepos += (int) sizeof(SCIP_Real);
+   }
+
+   if( (flags & COMPACTFLAG_LPSOLVAL) != 0 )
+   {
+      BMScopyMemorySize(&boundchg->data.branchingdata.lpsolval, &bytes[*bytepos], sizeof(SCIP_Real));
+      *bytepos += (int) sizeof(SCIP_Real);
+   }
+   else
+      boundchg->data.branchingdata.lpsolval = SCIP_INVALID;
+
+   boundchg->boundchgtype = SCIP_BOUNDCHGTYPE_BRANCHING; /*lint !e641*/
+   boundchg->boundtype = (flags & COMPACTFLAG_UPPER) != 0 ? SCIP_BOUNDTYPE_UPPER : SCIP_BOUNDTYPE_LOWER; /*lint !e641*/
+   boundchg->inferboundtype = SCIP_BOUNDTYPE_LOWER; /*lint !e641*/
+   boundchg->applied = (flags & COMPACTFLAG_APPLIED) != 0;
+   boundchg->redundant = (flags & COMPACTFLAG_REDUNDANT) != 0;
+
+   assert(boundchg->var != NULL);
+   assert(*bytepos <= domchg->domchgcompact.nbytes);
+}
+
+/** converts compact domain change data back into static domain change data with bound changes only */
+SCIP_RETCODE SCIPdomchgExpandCompact(
+   SCIP_DOMCHG**         domchg,             /**< pointer to compact domain change data */
+   BMS_BLKMEM*           blkmem              /**< block memory */
+   )
+{
+   SCIP_BOUNDCHG* boundchgs;
+   int nboundchgs;
+   int bytepos;
+   int i;
+
+   assert(domchg != NULL);
+   assert(*domchg != NULL);
+   assert((*domchg)->domchgcompact.domchgtype == SCIP_DOMCHGTYPE_COMPACT); /*lint !e641*/
+   assert(blkmem != NULL);
+
+   nboundchgs = (int) (*domchg)->domchgcompact.nboundchgs;
+   assert(nboundchgs > 0);
+
+   SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &boundchgs, nboundchgs) );
+
+   /* the variables stay captured by the bound changes, see SCIPdomchgMakeCompact() */
+   bytepos = 0;
+   for( i = 0; i < nboundchgs; ++i )
+   {
+      boundchgs[i].var = (i == 0 ? NULL : boundchgs[i-1].var);
+      SCIPdomchgGetCompactBoundchg(*domchg, &bytepos, &boundchgs[i]);
+   }
+   assert(bytepos == (*domchg)->domchgcompact.nbytes);
+
+   BMSfreeBlockMemoryArray(blkmem, &(*domchg)->domchgcompact.bytes, (*domchg)->domchgcompact.nbytes);
+   SCIP_ALLOC( BMSreallocBlockMemorySize(blkmem, domchg, sizeof(SCIP_DOMCHGCOMPACT), sizeof(SCIP_DOMCHGBOUND)) );
+   (*domchg)->domchgbound.domchgtype = SCIP_DOMCHGTYPE_BOUND; /*lint !e641*/
+   (*domchg)->domchgbound.boundchgs = boundchgs;
+
+   return SCIP_OKAY;
+}
+
+/** converts static domain change data that only consists of branching decisions into compact domain change data;
+ *  the bound changes can be accessed again after converting the data back with SCIPdomchgMakeStatic() or
+ *  SCIPdomchgExpandCompact()
+ *
+ *  Domain change data with hole changes or inferred bound changes is left unchanged.
+ */
+SCIP_RETCODE SCIPdomchgMakeCompact(
+   SCIP_DOMCHG**         domchg,             /**< pointer to domain change data */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_SET*             set                 /**< global SCIP settings */
+   )
+{
+   SCIP_BOUNDCHG* boundchgs;
+   SCIP_VAR* prevvar;
+   unsigned char* bytes;
+   int nboundchgs;
+   int nbytes;
+   int i;
+
+   assert(domchg != NULL);
+   assert(blkmem != NULL);
+
+   if( *domchg == NULL || (*domchg)->domchgbound.domchgtype != SCIP_DOMCHGTYPE_BOUND ) /*lint !e641*/
+      return SCIP_OKAY;
+
+   nboundchgs = (int) (*domchg)->domchgbound.nboundchgs;
+   boundchgs = (*domchg)->domchgbound.boundchgs;
+   assert(nboundchgs > 0);
+
+   for( i = 0; i < nboundchgs; ++i )
+   {
+      if( boundchgs[i].boundchgtype != SCIP_BOUNDCHGTYPE_BRANCHING ) /*lint !e641*/
+         return SCIP_OKAY;
+   }
+
+   SCIPsetDebugMsg(set, "making domain change data %p pointing to %p compact\n", (void*)domchg, (void*)*domchg);
+
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &bytes, nboundchgs * COMPACTMAXBYTES) );
+
+   /* the variables stay captured, such that their addresses remain valid */
+   nbytes = 0;
+   prevvar = NULL;
+   for( i = 0; i < nboundchgs; ++i )
+   {
+      SCIP_Real newbound;
+      int flagpos;
+
+      assert(boundchgs[i].var != NULL);
+
+      newbound = boundchgs[i].newbound;
+      flagpos = nbytes++;
+      bytes[flagpos] = 0;
+
+      if( boundchgs[i].boundtype == SCIP_BOUNDTYPE_UPPER ) /*lint !e641*/
+         bytes[flagpos] |= COMPACTFLAG_UPPER;
+      if( boundchgs[i].applied )
+         bytes[flagpos] |= COMPACTFLAG_APPLIED;
+      if( boundchgs[i].redundant )
+         bytes[flagpos] |= COMPACTFLAG_REDUNDANT;
+
+      nbytes += compactWriteSigned(&bytes[nbytes], (int64_t) ((uint64_t) (uintptr_t) boundchgs[i].var - (uint64_t) (uintptr_t) prevvar));
+      prevvar = boundchgs[i].var;
+
+      if( REALABS(newbound) <= COMPACTMAXINTBOUND && newbound == (SCIP_Real) (int64_t) newbound ) /*lint !e777*/
+      {
+         bytes[flagpos] |= COMPACTFLAG_INTBOUND;
+         nbytes += compactWriteSigned(&bytes[nbytes], (int64_t) newbound);
+      }
+      else
+      {
+         BMScopyMemorySize(&bytes[nbytes], &newbound, sizeof(SCIP_Real));
+         nbytes += (int) sizeof(SCIP_Real);
+      }
+
+      if( boundchgs[i].data.branchingdata.lpsolval != SCIP_INVALID ) /*lint !e777*/
+      {
+         bytes[flagpos] |= COMPACTFLAG_LPSOLVAL;
+         BMScopyMemorySize(&bytes[nbytes], &boundchgs[i].data.branchingdata.lpsolval, sizeof(SCIP_Real));
+         nbytes += (int) sizeof(SCIP_Real);
+      }
+      assert(nbytes <= (i+1) * COMPACTMAXBYTES);
+   }
+
+   BMSfreeBlockMemoryArray(blkmem, &(*domchg)->domchgbound.boundchgs, nboundchgs);
+   SCIP_ALLOC( BMSreallocBlockMemorySize(blkmem, domchg, sizeof(SCIP_DOMCHGBOUND), sizeof(SCIP_DOMCHGCOMPACT)) );
+   (*domchg)->domchgcompact.domchgtype = SCIP_DOMCHGTYPE_COMPACT; /*lint !e641*/
+   (*domchg)->domchgcompact.nbytes = nbytes;
+   SCIP_ALLOC( BMSduplicateBlockMemoryArray(blkmem, &(*domchg)->domchgcompact.bytes, bytes, nbytes) );
+
+   SCIPsetFreeBufferArray(set, &bytes);
+
+   return SCIP_OKAY;
+}
+
 /** frees domain change data */
 SCIP_RETCODE SCIPdomchgFree(
    SCIP_DOMCHG**         domchg,             /**< pointer to domain change */
@@ -1059,7 +1364,28 @@ SCIP_RETCODE SCIPdomchgFree(
    assert(domchg != NULL);
    assert(blkmem != NULL);
 
-   if( *domchg != NULL )
+   if( *domchg != NULL && (*domchg)->domchgcompact.domchgtype == SCIP_DOMCHGTYPE_COMPACT ) /*lint !e641*/
+   {
+      SCIP_BOUNDCHG boundchg;
+      int bytepos;
+      int i;
+
+      /* release the variables of the branching decisions */
+      boundchg.var = NULL;
+      bytepos = 0;
+      for( i = 0; i < (int)(*domchg)->domchgcompact.nboundchgs; ++i )
+      {
+         SCIP_VAR* var;
+
+         SCIPdomchgGetCompactBoundchg(*domchg, &bytepos, &boundchg);
+         var = boundchg.var;
+         SCIP_CALL( SCIPvarRelease(&var, blkmem, set, eventqueue, lp) );
+      }
+
+      BMSfreeBlockMemoryArray(blkmem, &(*domchg)->domchgcompact.bytes, (*domchg)->domchgcompact.nbytes);
+      BMSfreeBlockMemorySize(blkmem, domchg, sizeof(SCIP_DOMCHGCOMPACT));
+   }
+   else if( *domchg != NULL )
    {
       int i;
 
@@ -1113,6 +1439,12 @@ SCIP_RETCODE domchgMakeDynamic(
    }
    else
    {
+      /* restore the bound changes of compact domain change data */
+      if( (*domchg)->domchgcompact.domchgtype == SCIP_DOMCHGTYPE_COMPACT ) /*lint !e641*/
+      {
+         SCIP_CALL( SCIPdomchgExpandCompact(domchg, blkmem) );
+      }
+
       switch( (*domchg)->domchgdyn.domchgtype )
       {
       case SCIP_DOMCHGTYPE_BOUND:
@@ -1166,6 +1498,9 @@ SCIP_RETCODE SCIPdomchgMakeStatic(
    {
       switch( (*domchg)->domchgdyn.domchgtype )
       {
+      case SCIP_DOMCHGTYPE_COMPACT:
+         SCIP_CALL( SCIPdomchgExpandCompact(domchg, blkmem) );
+         break;
       case SCIP_DOMCHGTYPE_BOUND:
          if( (*domchg)->domchgbound.nboundchgs == 0 )
          {
@@ -1310,6 +1645,8 @@ SCIP_RETCODE SCIPdomchgApply(
    if( domchg == NULL )
       return SCIP_OKAY;
 
+   assert(domchg->domchgdyn.domchgtype != SCIP_DOMCHGTYPE_COMPACT); /*lint !e641*/
+
    /* apply bound changes */
    for( i = 0; i < (int)domchg->domchgbound.nboundchgs; ++i )
    {
@@ -1352,6 +1689,8 @@ SCIP_RETCODE SCIPdomchgUndo(
    if( domchg == NULL )
       return SCIP_OKAY;
 
+   assert(domchg->domchgdyn.domchgtype != SCIP_DOMCHGTYPE_COMPACT); /*lint !e641*/
+
    /* undo holelist changes */
    if( domchg->domchgdyn.domchgtype != SCIP_DOMCHGTYPE_BOUND ) /*lint !e641*/
    {
@@ -2040,6 +2379,7 @@ SCIP_RETCODE varCreate(
    (*var)->vartype = vartype; /*lint !e641*/
    (*var)->pseudocostflag = FALSE;
    (*var)->eventqueueimpl = FALSE;
+   (*var)->bdchgdeferred = FALSE;
    (*var)->deletable = FALSE;
    (*var)->delglobalstructs = FALSE;
    (*var)->relaxationonly = FALSE;
@@ -3543,6 +3883,7 @@ SCIP_RETCODE SCIPvarGetTransformed(
    BMS_BLKMEM*           blkmem,             /**< block memory of transformed problem */
    SCIP_SET*             set,                /**< global SCIP settings */
    SCIP_STAT*            stat,               /**< problem statistics */
+   SCIP_PROB*            transprob,          /**< transformed problem data, or NULL if the bounds are not mirrored */
    SCIP_VAR**            transvar            /**< pointer to store the transformed variable, or NULL if not existing yet */
    )
 {
@@ -3559,7 +3900,7 @@ SCIP_RETCODE SCIPvarGetTransformed(
          *transvar = NULL;
       else
       {
-         SCIP_CALL( SCIPvarNegate(origvar->negatedvar->data.original.transvar, blkmem, set, stat, transvar) );
+         SCIP_CALL( SCIPvarNegate(origvar->negatedvar->data.original.transvar, blkmem, set, stat, transprob, transvar) );
       }
    }
    else 
@@ -3826,6 +4167,7 @@ SCIP_RETCODE SCIPvarFix(
       var->glbdom.ub = fixedval;
       var->locdom.lb = fixedval;
       var->locdom.ub = fixedval;
+      varUpdateBoundMirror(var, eventqueue);
 
       /* delete implications and variable bounds information */
       SCIP_CALL( SCIPvarRemoveCliquesImplicsVbs(var, blkmem, cliquetable, set, FALSE, FALSE, TRUE) );
@@ -4860,6 +5202,9 @@ SCIP_RETCODE SCIPvarAggregate(
       var->negatedvar = aggvar;
       aggvar->negatedvar = var;
 
+      /* the bounds of the variable are mirrored through its negation variable from now on */
+      varUpdateBoundMirror(aggvar, eventqueue);
+
       /* copy donot(mult)aggr status */
       aggvar->donotaggr |= var->donotaggr;
       aggvar->donotmultaggr |= var->donotmultaggr;
@@ -4875,6 +5220,7 @@ SCIP_RETCODE SCIPvarAggregate(
       var->data.aggregate.var = aggvar;
       var->data.aggregate.scalar = scalar;
       var->data.aggregate.constant = constant;
+      varInvalidateBoundMirror(var, eventqueue);
 
       /* copy donot(mult)aggr status */
       aggvar->donotaggr |= var->donotaggr;
@@ -5671,6 +6017,7 @@ SCIP_RETCODE SCIPvarMultiaggregate(
       var->data.multaggr.constant = tmpconstant;
       var->data.multaggr.nvars = ntmpvars;
       var->data.multaggr.varssize = ntmpvars;
+      varInvalidateBoundMirror(var, eventqueue);
 
       /* mark variable to be non-deletable */
       SCIPvarMarkNotDeletable(var);
@@ -5913,6 +6260,7 @@ SCIP_RETCODE SCIPvarNegate(
    BMS_BLKMEM*           blkmem,             /**< block memory of transformed problem */
    SCIP_SET*             set,                /**< global SCIP settings */
    SCIP_STAT*            stat,               /**< problem statistics */
+   SCIP_PROB*            transprob,          /**< transformed problem data, or NULL if the bounds are not mirrored */
    SCIP_VAR**            negvar              /**< pointer to store the negated variable */
    )
 {
@@ -5964,6 +6312,13 @@ SCIP_RETCODE SCIPvarNegate(
       var->negatedvar = *negvar;
       (*negvar)->negatedvar = var;
 
+      /* mirror the bounds of the negated variable along with the bounds of its negation variable */
+      if( transprob != NULL && transprob->mirrorbounds && SCIPvarIsTransformed(var) )
+      {
+         SCIP_CALL( SCIPprobExtendBoundMirror(transprob, set, (*negvar)->index + 1) );
+         SCIPprobUpdateMirror(transprob, var);
+      }
+
       /* mark both variables to be non-deletable */
       SCIPvarMarkNotDeletable(var);
       SCIPvarMarkNotDeletable(*negvar);
@@ -6886,6 +7241,7 @@ SCIP_RETCODE varProcessChgLbGlobal(
       /* merges overlapping holes into single holes, moves bounds respectively */
       domMerge(&var->glbdom, blkmem, set, &newbound, NULL);
    }
+   varUpdateBoundMirror(var, eventqueue);
 
    /* update the root bound changes counters */
    varIncRootboundchgs(var, set, stat);
@@ -7062,6 +7418,7 @@ SCIP_RETCODE varProcessChgUbGlobal(
       /* merges overlapping holes into single holes, moves bounds respectively */
       domMerge(&var->glbdom, blkmem, set, NULL, &newbound);
    }
+   varUpdateBoundMirror(var, eventqueue);
 
    /* update the root bound changes counters */
    varIncRootboundchgs(var, set, stat);
@@ -7675,6 +8032,24 @@ SCIP_RETCODE varProcessChgLbLocal(
    else if( SCIPsetIsEQ(set, newbound, var->locdom.lb) && !(newbound != var->locdom.lb && newbound * var->locdom.lb <= 0.0) )  /*lint !e777*/
       return SCIP_OKAY;
 
+   /* while local bound changes are deferred in the event queue, only change the bound itself; the event and the
+    * update of the parent variables are issued for the net change in SCIPvarFlushDeferredBdchgs()
+    */
+   if( stat != NULL && eventqueue != NULL && SCIPeventqueueIsDeferringBdchgs(eventqueue)
+      && (SCIPvarGetStatus(var) == SCIP_VARSTATUS_COLUMN || SCIPvarGetStatus(var) == SCIP_VARSTATUS_LOOSE)
+      && (var->bdchgdeferred || var->locdom.holelist == NULL) )
+   {
+      if( !var->bdchgdeferred )
+      {
+         SCIP_CALL( SCIPeventqueueAddDeferredVar(eventqueue, set, var) );
+      }
+      var->locdom.lb = newbound;
+      varUpdateBoundMirror(var, eventqueue);
+      SCIPstatIncrement(stat, set, domchgcount);
+
+      return SCIP_OKAY;
+   }
+
    /* change the bound */
    oldbound = var->locdom.lb;
    assert(SCIPsetGetStage(set) == SCIP_STAGE_PROBLEM || SCIPsetIsFeasLE(set, newbound, var->locdom.ub));
@@ -7691,6 +8066,7 @@ SCIP_RETCODE varProcessChgLbLocal(
       /* merges overlapping holes into single holes, moves bounds respectively */
       domMerge(&var->locdom, blkmem, set, &newbound, NULL);
    }
+   varUpdateBoundMirror(var, eventqueue);
 
    /* issue bound change event */
    assert(SCIPvarIsTransformed(var) == (var->eventfilter != NULL));
@@ -7842,6 +8218,24 @@ SCIP_RETCODE varProcessChgUbLocal(
    else if( SCIPsetIsEQ(set, newbound, var->locdom.ub) && !(newbound != var->locdom.ub && newbound * var->locdom.ub <= 0.0) )  /*lint !e777*/
       return SCIP_OKAY;
 
+   /* while local bound changes are deferred in the event queue, only change the bound itself; the event and the
+    * update of the parent variables are issued for the net change in SCIPvarFlushDeferredBdchgs()
+    */
+   if( stat != NULL && eventqueue != NULL && SCIPeventqueueIsDeferringBdchgs(eventqueue)
+      && (SCIPvarGetStatus(var) == SCIP_VARSTATUS_COLUMN || SCIPvarGetStatus(var) == SCIP_VARSTATUS_LOOSE)
+      && (var->bdchgdeferred || var->locdom.holelist == NULL) )
+   {
+      if( !var->bdchgdeferred )
+      {
+         SCIP_CALL( SCIPeventqueueAddDeferredVar(eventqueue, set, var) );
+      }
+      var->locdom.ub = newbound;
+      varUpdateBoundMirror(var, eventqueue);
+      SCIPstatIncrement(stat, set, domchgcount);
+
+      return SCIP_OKAY;
+   }
+
    /* change the bound */
    oldbound = var->locdom.ub;
    assert(SCIPsetGetStage(set) == SCIP_STAGE_PROBLEM || SCIPsetIsFeasGE(set, newbound, var->locdom.lb));
@@ -7858,6 +8252,7 @@ SCIP_RETCODE varProcessChgUbLocal(
       /* merges overlapping holes into single holes, moves bounds respectively */
       domMerge(&var->locdom, blkmem, set, NULL, &newbound);
    }
+   varUpdateBoundMirror(var, eventqueue);
 
    /* issue bound change event */
    assert(SCIPvarIsTransformed(var) == (var->eventfilter != NULL));
@@ -7959,6 +8354,59 @@ SCIP_RETCODE varProcessChgUbLocal(
    return SCIP_OKAY;
 }
 
+/** issues the bound change events and the updates of the parent variables for the net change of the local bounds of
+ *  a variable whose local bound changes were deferred in the event queue
+ */
+SCIP_RETCODE SCIPvarFlushDeferredBdchgs(
+   SCIP_VAR*             var,                /**< loose or column variable with deferred local bound changes */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_LP*              lp,                 /**< current LP data */
+   SCIP_BRANCHCAND*      branchcand,         /**< branching candidate storage */
+   SCIP_EVENTQUEUE*      eventqueue,         /**< event queue */
+   SCIP_Real             oldlb,              /**< local lower bound before the first deferred change */
+   SCIP_Real             oldub               /**< local upper bound before the first deferred change */
+   )
+{
+   SCIP_Real newlb;
+   SCIP_Real newub;
+
+   assert(var != NULL);
+   assert(var->bdchgdeferred);
+   assert(SCIPvarGetStatus(var) == SCIP_VARSTATUS_COLUMN || SCIPvarGetStatus(var) == SCIP_VARSTATUS_LOOSE);
+   assert(!SCIPeventqueueIsDeferringBdchgs(eventqueue));
+
+   var->bdchgdeferred = FALSE;
+
+   newlb = var->locdom.lb;
+   newub = var->locdom.ub;
+
+   if( newlb == oldlb && newub == oldub ) /*lint !e777*/
+      return SCIP_OKAY;
+
+   SCIPsetDebugMsg(set, "flush deferred bound changes of <%s>: [%g,%g] -> [%g,%g]\n", var->name, oldlb, oldub, newlb, newub);
+
+   /* reinstall the old bounds and pass the net changes through the usual processing; the domain counter was already
+    * increased for every deferred change; if the new lower bound exceeds the old upper bound, the upper bound is
+    * relaxed first, such that the domains of the parent variables stay consistent in between
+    */
+   var->locdom.lb = oldlb;
+   var->locdom.ub = oldub;
+
+   if( newlb > oldub )
+   {
+      SCIP_CALL( varProcessChgUbLocal(var, blkmem, set, NULL, lp, branchcand, eventqueue, newub) );
+      SCIP_CALL( varProcessChgLbLocal(var, blkmem, set, NULL, lp, branchcand, eventqueue, newlb) );
+   }
+   else
+   {
+      SCIP_CALL( varProcessChgLbLocal(var, blkmem, set, NULL, lp, branchcand, eventqueue, newlb) );
+      SCIP_CALL( varProcessChgUbLocal(var, blkmem, set, NULL, lp, branchcand, eventqueue, newub) );
+   }
+
+   return SCIP_OKAY;
+}
+
 /** changes current local lower bound of variable; if possible, adjusts bound to integral value; stores inference
  *  information in variable
  */
@@ -8783,6 +9231,7 @@ SCIP_RETCODE varProcessAddHoleGlobal(
 
    /* merge domain holes */
    domMerge(&var->glbdom, blkmem, set, &newlb, &newub);
+   varUpdateBoundMirror(var, eventqueue);
 
    /* the bound should not be changed */
    assert(SCIPsetIsEQ(set, newlb, var->glbdom.lb));
@@ -9029,6 +9478,7 @@ SCIP_RETCODE varProcessAddHoleLocal(
 
    /* merge domain holes */
    domMerge(&var->locdom, blkmem, set, &newlb, &newub);
+   varUpdateBoundMirror(var, eventqueue);
 
    /* the bound should not be changed */
    assert(SCIPsetIsEQ(set, newlb, var->locdom.lb));
@@ -17208,6 +17658,7 @@ SCIP_BOUNDCHG* SCIPdomchgGetBoundchg(
    )
 {
    assert(domchg != NULL);
+   assert(domchg->domchgdyn.domchgtype != SCIP_DOMCHGTYPE_COMPACT); /*lint !e641*/
    assert(0 <= pos && pos < (int)domchg->domchgbound.nboundchgs);
 
    return &domchg->domchgbound.boundchgs[pos];
@@ -120,6 +120,35 @@ SCIP_RETCODE SCIPdomchgMakeStatic(
    SCIP_LP*              lp                  /**< current LP data */
    );
 
+/** converts static domain change data that only consists of branching decisions into compact domain change data;
+ *  the bound changes can be accessed again after converting the data back with SCIPdomchgMakeStatic() or
+ *  SCIPdomchgExpandCompact()
+ *
+ *  Domain change data with hole changes or inferred bound changes is left unchanged.
+ */
+SCIP_RETCODE SCIPdomchgMakeCompact(
+   SCIP_DOMCHG**         domchg,             /**< pointer to domain change data */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_SET*             set                 /**< global SCIP settings */
+   );
+
+/** converts compact domain change data back into static domain change data with bound changes only */
+SCIP_RETCODE SCIPdomchgExpandCompact(
+   SCIP_DOMCHG**         domchg,             /**< pointer to compact domain change data */
+   BMS_BLKMEM*           blkmem              /**< block memory */
+   );
+
+/** decodes the next bound change of a compact domain change and advances the position in the byte encoding
+ *
+ *  @note boundchg->var has to be the variable of the previously decoded bound change of the domain change, or NULL
+ *        when decoding the first bound change
+ */
+void SCIPdomchgGetCompactBoundchg(
+   SCIP_DOMCHG*          domchg,             /**< compact domain change data */
+   int*                  bytepos,            /**< pointer to position in byte encoding, 0 for the first bound change */
+   SCIP_BOUNDCHG*        boundchg            /**< bound change to store decoded data in */
+   );
+
 /** applies domain change */
 SCIP_RETCODE SCIPdomchgApply(
    SCIP_DOMCHG*          domchg,             /**< domain change to apply */
@@ -348,6 +377,7 @@ SCIP_RETCODE SCIPvarGetTransformed(
    BMS_BLKMEM*           blkmem,             /**< block memory of transformed problem */
    SCIP_SET*             set,                /**< global SCIP settings */
    SCIP_STAT*            stat,               /**< problem statistics */
+   SCIP_PROB*            transprob,          /**< transformed problem data, or NULL if the bounds are not mirrored */
    SCIP_VAR**            transvar            /**< pointer to store the transformed variable, or NULL if not existing yet */
    );
 
@@ -549,6 +579,7 @@ SCIP_RETCODE SCIPvarNegate(
    BMS_BLKMEM*           blkmem,             /**< block memory of transformed problem */
    SCIP_SET*             set,                /**< global SCIP settings */
    SCIP_STAT*            stat,               /**< problem statistics */
+   SCIP_PROB*            transprob,          /**< transformed problem data, or NULL if the bounds are not mirrored */
    SCIP_VAR**            negvar              /**< pointer to store the negated variable */
    );
 
@@ -738,6 +769,20 @@ SCIP_RETCODE SCIPvarChgBdGlobal(
    SCIP_BOUNDTYPE        boundtype           /**< type of bound: lower or upper bound */
    );
 
+/** issues the bound change events and the updates of the parent variables for the net change of the local bounds of
+ *  a variable whose local bound changes were deferred in the event queue
+ */
+SCIP_RETCODE SCIPvarFlushDeferredBdchgs(
+   SCIP_VAR*             var,                /**< loose or column variable with deferred local bound changes */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_LP*              lp,                 /**< current LP data */
+   SCIP_BRANCHCAND*      branchcand,         /**< branching candidate storage */
+   SCIP_EVENTQUEUE*      eventqueue,         /**< event queue */
+   SCIP_Real             oldlb,              /**< local lower bound before the first deferred change */
+   SCIP_Real             oldub               /**< local upper bound before the first deferred change */
+   );
+
 /** changes current local lower bound of variable; if possible, adjusts bound to integral value; stores inference
  *  information in variable
  */
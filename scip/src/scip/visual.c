@@ -67,6 +67,21 @@ void getBranchInfo(
    if( domchgbound->nboundchgs == 0 )
       return;
 
+   /* the branching decisions of leaves may be stored compactly: decode the first bound change */
+   if( node->domchg->domchgcompact.domchgtype == SCIP_DOMCHGTYPE_COMPACT ) /*lint !e641*/
+   {
+      SCIP_BOUNDCHG boundchg;
+      int bytepos = 0;
+
+      boundchg.var = NULL;
+      SCIPdomchgGetCompactBoundchg(node->domchg, &bytepos, &boundchg);
+
+      (*var) = boundchg.var;
+      (*bound) = boundchg.newbound;
+      (*boundtype) = (SCIP_BOUNDTYPE) boundchg.boundtype;
+      return;
+   }
+
    (*var) = domchgbound->boundchgs[0].var;
    (*bound) = domchgbound->boundchgs[0].newbound;
    (*boundtype) = (SCIP_BOUNDTYPE) domchgbound->boundchgs[0].boundtype;
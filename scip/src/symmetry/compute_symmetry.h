@@ -53,7 +53,9 @@ SCIP_RETCODE SYMcomputeSymmetryGenerators(
    int*                  nperms,             /**< pointer to store number of permutations */
    int*                  nmaxperms,          /**< pointer to store maximal number of permutations (needed for freeing storage) */
    int***                perms,              /**< pointer to store permutation generators as (nperms x npermvars) matrix */
-   SCIP_Real*            log10groupsize      /**< pointer to store log10 of size of group */
+   SCIP_Real*            log10groupsize,     /**< pointer to store log10 of size of group */
+   SCIP_Real             timelimit,          /**< wall clock time limit for the search in seconds (infinity if unlimited) */
+   SCIP_Bool*            interrupted         /**< pointer to store whether the search has been interrupted by the time limit */
    );
 
 #ifdef __cplusplus
@@ -29,8 +29,10 @@
 #include <bliss/graph.hh>
 
 #include <string.h>
+#include <limits.h>
 #include <vector>
 #include <list>
+#include <algorithm>
 #include <math.h>
 
 #include "scip/expr_var.h"
@@ -39,9 +41,50 @@
 #include "scip/expr.h"
 #include "scip/cons_nonlinear.h"
 #include "scip/cons_linear.h"
+#include "scip/symmetry.h"
 
 using std::vector;
 
+#define MAXREFINEMENTROUNDS       100        /**< maximal number of rounds of color refinement */
+#define MAXREFINEMENTWORK   100000000        /**< maximal number of vertices and adjacency entries processed in all rounds of color refinement */
+#define INITNODELIMIT            1000        /**< node limit of the first search if older versions of bliss are interrupted by node limits */
+
+/** colored graph that is collected before it is handed to bliss, such that it can be reduced by color refinement
+ *
+ *  The interface for adding vertices and edges is the same as for bliss graphs.
+ */
+struct SYM_ColoredGraph
+{
+   vector<unsigned int>  colors;             /**< colors of the vertices */
+   vector<unsigned int>  tails;              /**< first endpoints of the edges */
+   vector<unsigned int>  heads;              /**< second endpoints of the edges */
+
+   /** adds a vertex with the given color and returns its index */
+   unsigned int add_vertex(
+      unsigned int       color               /**< color of the vertex */
+      )
+   {
+      colors.push_back(color);
+      return (unsigned int) colors.size() - 1;
+   }
+
+   /** adds an undirected edge between two vertices */
+   void add_edge(
+      unsigned int       v,                  /**< first endpoint */
+      unsigned int       w                   /**< second endpoint */
+      )
+   {
+      tails.push_back(v);
+      heads.push_back(w);
+   }
+
+   /** returns the number of vertices */
+   unsigned int get_nof_vertices() const
+   {
+      return (unsigned int) colors.size();
+   }
+};
+
 /** struct for bliss callback */
 struct BLISS_Data
 {
@@ -51,6 +94,12 @@ struct BLISS_Data
    int**                 perms;              /**< permutation generators as (nperms x npermvars) matrix */
    int                   nmaxperms;          /**< maximal number of permutations */
    int                   maxgenerators;      /**< maximal number of generators constructed (= 0 if unlimited) */
+   bliss::Graph*         G;                  /**< graph that is searched */
+   int                   nblissvars;         /**< number of variable vertices of the graph that is searched */
+   const int*            blissvartoperm;     /**< index in permutations of the variable of each variable vertex */
+   SCIP_CLOCK*           clock;              /**< wall clock measuring the time of the search */
+   SCIP_Real             timelimit;          /**< time limit for the search in seconds */
+   bool                  interrupted;        /**< whether the search has been interrupted by the time limit */
 };
 
 /* ------------------- map for operator types ------------------- */
@@ -184,6 +233,34 @@ SCIP_DECL_HASHKEYVAL(SYMhashKeyValRhstype)
    return SCIPhashTwo(SCIPrealHashCode(k->lhs), SCIPrealHashCode(k->rhs));
 }
 
+/** checks whether the time limit of the search has been reached
+ *
+ *  If bliss provides a termination callback, this function is called by bliss during the search. Otherwise, it is
+ *  called whenever a new generator has been found and between the node limited searches of findAutomorphisms(); if the
+ *  patch for search limits is present, the limits are tightened such that bliss stops the search; the generators found
+ *  so far are kept.
+ */
+static
+bool blissterminate(
+   BLISS_Data*           data                /**< data of the search */
+   )
+{
+   assert( data != NULL );
+
+   if ( data->interrupted )
+      return true;
+
+   if ( SCIPisInfinity(data->scip, data->timelimit) || SCIPgetClockTime(data->scip, data->clock) <= data->timelimit )
+      return false;
+
+   data->interrupted = true;
+#if !defined(BLISS_VERSION_MAJOR) && defined(BLISS_PATCH_PRESENT)
+   data->G->set_search_limits(1, 1);
+#endif
+
+   return true;
+}
+
 /** callback function for bliss */
 static
 void blisshook(
@@ -197,7 +274,8 @@ void blisshook(
 
    BLISS_Data* data = static_cast<BLISS_Data*>(user_param);
    assert( data->scip != NULL );
-   assert( data->npermvars < (int) n );
+   assert( data->nblissvars <= (int) n );
+   assert( data->nblissvars <= data->npermvars );
    assert( data->maxgenerators >= 0);
 
    /* make sure we do not generate more that maxgenerators many permutations, if the limit in bliss is not available */
@@ -210,11 +288,17 @@ void blisshook(
    if ( SCIPallocBlockMemoryArray(data->scip, &p, data->npermvars) != SCIP_OKAY )
       return;
 
+   /* variables whose vertices have been removed from the graph are fixed by all automorphisms */
    for (int j = 0; j < data->npermvars; ++j)
+      p[j] = j;
+
+   for (int j = 0; j < data->nblissvars; ++j)
    {
       /* convert index of variable-level 0-nodes to variable indices */
-      p[j] = (int) aut[j];
-      if ( p[j] != j )
+      assert( (int) aut[j] < data->nblissvars );
+      const int var = data->blissvartoperm[j];
+      p[var] = data->blissvartoperm[aut[j]];
+      if ( p[var] != var )
          isIdentity = false;
    }
 
@@ -249,8 +333,73 @@ void blisshook(
    }
 
    data->perms[data->nperms++] = p;
+
+#ifndef BLISS_VERSION_MAJOR
+   /* older versions of bliss do not provide a termination callback */
+   (void) blissterminate(data);
+#endif
 }
 
+#if !defined(BLISS_VERSION_MAJOR) && defined(BLISS_PATCH_PRESENT)
+/** searches for automorphisms with older versions of bliss, which do not provide a termination callback
+ *
+ *  Since the time limit could otherwise only be checked when a generator is found, the search is run with a node limit.
+ *  If the node limit is reached and time remains, the generators are discarded and the search is restarted with a node
+ *  limit that is doubled or, if the remaining time is expected to be too short for this, fits the remaining time. The
+ *  generators of the last search are kept if the time limit is reached.
+ */
+static
+void findAutomorphisms(
+   BLISS_Data*           data,               /**< data of the search */
+   bliss::Stats&         stats               /**< statistics of the search */
+   )
+{
+   unsigned long nodelimit = INITNODELIMIT;
+
+   assert( data != NULL );
+   assert( data->G != NULL );
+
+   /* without a time limit, a single search without node limit suffices */
+   if ( SCIPisInfinity(data->scip, data->timelimit) )
+   {
+      data->G->find_automorphisms(stats, blisshook, (void*) data);
+      return;
+   }
+
+   while ( ! blissterminate(data) )
+   {
+      SCIP_Real starttime;
+      SCIP_Real nodespersecond;
+      SCIP_Real remainingnodes;
+
+      starttime = SCIPgetClockTime(data->scip, data->clock);
+      data->G->set_search_limits((unsigned) nodelimit, (unsigned) data->maxgenerators);
+      data->G->find_automorphisms(stats, blisshook, (void*) data);
+
+      /* stop if the search has been completed (or stopped by the generator limit) */
+      if ( data->interrupted || stats.get_nof_nodes() < nodelimit )
+         return;
+
+      /* estimate the number of nodes that can be searched in the remaining time */
+      nodespersecond = (SCIP_Real) stats.get_nof_nodes() / MAX(SCIPgetClockTime(data->scip, data->clock) - starttime, 1e-6);
+      remainingnodes = nodespersecond * (data->timelimit - SCIPgetClockTime(data->scip, data->clock));
+
+      /* a restarted search only makes progress if it may explore more nodes; otherwise keep the current generators */
+      if ( remainingnodes <= (SCIP_Real) nodelimit )
+      {
+         data->interrupted = true;
+         return;
+      }
+
+      for (int p = 0; p < data->nperms; ++p)
+         SCIPfreeBlockMemoryArray(data->scip, &data->perms[p], data->npermvars);
+      data->nperms = 0;
+
+      nodelimit = (unsigned long) MIN(2.0 * nodelimit, MIN(remainingnodes, (SCIP_Real) UINT_MAX));
+   }
+}
+#endif
+
 /** Creates the nodes in the graph that correspond to variables. Each variable type gets a unique color
  *
  *  @pre graph should be empty when this is called
@@ -258,7 +407,7 @@ void blisshook(
 static
 SCIP_RETCODE createVariableNodes(
    SCIP*                 scip,               /**< SCIP instance */
-   bliss::Graph*         G,                  /**< Graph to be constructed */
+   SYM_ColoredGraph*     G,                  /**< Graph to be constructed */
    SYM_MATRIXDATA*       matrixdata,         /**< data for MIP matrix (also contains the relevant variables) */
    int&                  nnodes,             /**< buffer to store number of nodes in graph */
    const int&            nedges,             /**< buffer to store number of edges in graph */
@@ -310,7 +459,7 @@ SCIP_RETCODE createVariableNodes(
 static
 SCIP_RETCODE fillGraphByLinearConss(
    SCIP*                 scip,               /**< SCIP instance */
-   bliss::Graph*         G,                  /**< Graph to be constructed */
+   SYM_ColoredGraph*     G,                  /**< Graph to be constructed */
    SYM_MATRIXDATA*       matrixdata,         /**< data for MIP matrix */
    int&                  nnodes,             /**< buffer to store number of nodes in graph */
    int&                  nedges,             /**< buffer to store number of edges in graph */
@@ -472,7 +621,7 @@ SCIP_RETCODE fillGraphByLinearConss(
 static
 SCIP_RETCODE fillGraphByNonlinearConss(
    SCIP*                 scip,               /**< SCIP instance */
-   bliss::Graph*         G,                  /**< Graph to be constructed */
+   SYM_ColoredGraph*     G,                  /**< Graph to be constructed */
    SYM_EXPRDATA*         exprdata,           /**< data for nonlinear constraints */
    int&                  nnodes,             /**< buffer to store number of nodes in graph */
    int&                  nedges,             /**< buffer to store number of edges in graph */
@@ -945,6 +1094,138 @@ SCIP_RETCODE fillGraphByNonlinearConss(
    return SCIP_OKAY;
 }
 
+/** refines the colors of the graph and creates the bliss graph without the vertices that have a unique color
+ *
+ *  Color refinement iteratively splits the vertices of each color by the colors of their neighbors. Since the refined
+ *  coloring only depends on the structure of the graph, it is respected by every automorphism. If the refinement is
+ *  stable, all vertices of a color have the same number of neighbors of each color. Hence, a vertex with a unique color
+ *  is fixed by every automorphism and every other color class is either completely adjacent to it or not at all, such
+ *  that removing it does not change the automorphisms of the remaining graph. Most constraint and coefficient vertices
+ *  are removed this way.
+ *
+ *  The first vertices of the bliss graph correspond to the remaining variable vertices, whose original indices are
+ *  stored in @p blissvartoperm.
+ */
+static
+SCIP_RETCODE createReducedBlissGraph(
+   SCIP*                 scip,               /**< SCIP instance */
+   SYM_ColoredGraph&     graph,              /**< colored graph whose first vertices correspond to the variables */
+   int                   npermvars,          /**< number of variables */
+   bliss::Graph*         G,                  /**< bliss graph to be constructed */
+   vector<int>&          blissvartoperm      /**< vector to store the original indices of the remaining variable vertices */
+   )
+{
+   assert( scip != NULL );
+   assert( G != NULL );
+   assert( (int) graph.get_nof_vertices() >= npermvars );
+   assert( graph.tails.size() == graph.heads.size() );
+
+   const int nvertices = (int) graph.get_nof_vertices();
+   const int nedges = (int) graph.tails.size();
+
+   /* store adjacency lists without duplicate edges */
+   vector<int> adjbegins(nvertices + 1, 0);
+   vector<int> adj(2 * nedges);
+   for (int e = 0; e < nedges; ++e)
+   {
+      ++adjbegins[graph.tails[e] + 1];
+      ++adjbegins[graph.heads[e] + 1];
+   }
+   for (int v = 0; v < nvertices; ++v)
+      adjbegins[v + 1] += adjbegins[v];
+
+   vector<int> pos(adjbegins.begin(), adjbegins.end() - 1);
+   for (int e = 0; e < nedges; ++e)
+   {
+      adj[pos[graph.tails[e]]++] = (int) graph.heads[e];
+      adj[pos[graph.heads[e]]++] = (int) graph.tails[e];
+   }
+
+   int nadj = 0;
+   int begin = 0;
+   for (int v = 0; v < nvertices; ++v)
+   {
+      const int end = adjbegins[v + 1];
+      std::sort(adj.begin() + begin, adj.begin() + end);
+      adjbegins[v] = nadj;
+      for (int i = begin; i < end; ++i)
+      {
+         if ( i == begin || adj[i] != adj[i - 1] )
+            adj[nadj++] = adj[i];
+      }
+      begin = end;
+   }
+   adjbegins[nvertices] = nadj;
+
+   /* refine colors; the number of rounds is limited such that the total work stays bounded on large graphs */
+   vector<int> colors(graph.colors.begin(), graph.colors.end());
+   int maxrounds = MIN(MAXREFINEMENTROUNDS, MAXREFINEMENTWORK / MAX(nvertices + nadj, 1));
+   int ncolors;
+   SCIP_Bool stable;
+
+   maxrounds = MAX(maxrounds, 1);
+   SCIP_CALL( SCIPrefineColorsSym(scip, nvertices, adjbegins.data(), adj.data(), maxrounds, colors.data(), &ncolors,
+         &stable) );
+
+   /* if the refinement is not stable, vertices with unique colors might not be removed */
+   vector<int> colorsize(ncolors, 0);
+   for (int v = 0; v < nvertices; ++v)
+      ++colorsize[colors[v]];
+
+   vector<int> blissnode(nvertices, -1);
+   int nblissnodes = 0;
+   blissvartoperm.clear();
+   for (int v = 0; v < npermvars; ++v)
+   {
+      if ( stable && colorsize[colors[v]] == 1 )
+         continue;
+      blissnode[v] = nblissnodes++;
+      blissvartoperm.push_back(v);
+   }
+
+   /* if all variables are fixed, there is no symmetry */
+   if ( blissvartoperm.empty() )
+      return SCIP_OKAY;
+
+   for (int v = npermvars; v < nvertices; ++v)
+   {
+      if ( stable && colorsize[colors[v]] == 1 )
+         continue;
+      blissnode[v] = nblissnodes++;
+   }
+
+   /* create bliss graph */
+   for (int v = 0; v < nvertices; ++v)
+   {
+      if ( blissnode[v] >= 0 )
+      {
+#ifndef NDEBUG
+         int node = (int) G->add_vertex((unsigned) colors[v]);
+         assert( node == blissnode[v] );
+#else
+         (void) G->add_vertex((unsigned) colors[v]);
+#endif
+      }
+   }
+
+   for (int v = 0; v < nvertices; ++v)
+   {
+      if ( blissnode[v] < 0 )
+         continue;
+
+      for (int i = adjbegins[v]; i < adjbegins[v + 1]; ++i)
+      {
+         if ( adj[i] > v && blissnode[adj[i]] >= 0 )
+            G->add_edge((unsigned) blissnode[v], (unsigned) blissnode[adj[i]]);
+      }
+   }
+
+   SCIPdebugMsg(scip, "Color refinement (%s) reduced symmetry detection graph from %d to %d nodes.\n",
+      stable ? "stable" : "not stable", nvertices, nblissnodes);
+
+   return SCIP_OKAY;
+}
+
 /** return whether symmetry can be computed */
 SCIP_Bool SYMcanComputeSymmetry(void)
 {
@@ -980,7 +1261,9 @@ SCIP_RETCODE SYMcomputeSymmetryGenerators(
    int*                  nperms,             /**< pointer to store number of permutations */
    int*                  nmaxperms,          /**< pointer to store maximal number of permutations (needed for freeing storage) */
    int***                perms,              /**< pointer to store permutation generators as (nperms x npermvars) matrix */
-   SCIP_Real*            log10groupsize      /**< pointer to store size of group */
+   SCIP_Real*            log10groupsize,     /**< pointer to store size of group */
+   SCIP_Real             timelimit,          /**< wall clock time limit for the search in seconds (infinity if unlimited) */
+   SCIP_Bool*            interrupted         /**< pointer to store whether the search has been interrupted by the time limit */
    )
 {
    assert( scip != NULL );
@@ -990,6 +1273,7 @@ SCIP_RETCODE SYMcomputeSymmetryGenerators(
    assert( nmaxperms != NULL );
    assert( perms != NULL );
    assert( log10groupsize != NULL );
+   assert( interrupted != NULL );
    assert( maxgenerators >= 0 );
 
    /* init */
@@ -997,23 +1281,24 @@ SCIP_RETCODE SYMcomputeSymmetryGenerators(
    *nmaxperms = 0;
    *perms = NULL;
    *log10groupsize = 0;
+   *interrupted = FALSE;
 
    int nnodes = 0;
    int nedges = 0;
    int nusedcolors = 0;
    SCIP_Bool success = FALSE;
 
-   /* create bliss graph */
-   bliss::Graph G(0);
+   /* collect colored graph */
+   SYM_ColoredGraph graph;
 
    /* create nodes corresponding to variables */
-   SCIP_CALL( createVariableNodes(scip, &G, matrixdata, nnodes, nedges, nusedcolors) );
+   SCIP_CALL( createVariableNodes(scip, &graph, matrixdata, nnodes, nedges, nusedcolors) );
 
    assert( nnodes == matrixdata->npermvars );
    assert( nusedcolors == matrixdata->nuniquevars );
 
    /* fill graph with nodes for variables and linear constraints */
-   SCIP_CALL( fillGraphByLinearConss(scip, &G, matrixdata, nnodes, nedges, nusedcolors, success) );
+   SCIP_CALL( fillGraphByLinearConss(scip, &graph, matrixdata, nnodes, nedges, nusedcolors, success) );
 
    if ( !success )
    {
@@ -1022,7 +1307,7 @@ SCIP_RETCODE SYMcomputeSymmetryGenerators(
    }
 
    /* add the nodes for nonlinear constraints to the graph */
-   SCIP_CALL( fillGraphByNonlinearConss(scip, &G, exprdata, nnodes, nedges, nusedcolors, success) );
+   SCIP_CALL( fillGraphByNonlinearConss(scip, &graph, exprdata, nnodes, nedges, nusedcolors, success) );
 
    if ( !success )
    {
@@ -1030,11 +1315,27 @@ SCIP_RETCODE SYMcomputeSymmetryGenerators(
       return SCIP_OKAY;
    }
 
+   SCIPdebugMsg(scip, "Symmetry detection graph has %u nodes.\n", graph.get_nof_vertices());
+
+   /* create bliss graph, which does not contain the vertices that are fixed by color refinement */
+   bliss::Graph G(0);
+   vector<int> blissvartoperm;
+   SCIP_CALL( createReducedBlissGraph(scip, graph, matrixdata->npermvars, &G, blissvartoperm) );
+
+   /* free memory of colored graph */
+   vector<unsigned int>().swap(graph.colors);
+   vector<unsigned int>().swap(graph.tails);
+   vector<unsigned int>().swap(graph.heads);
+
+   /* return if all variables are fixed by color refinement */
+   if ( blissvartoperm.empty() )
+      return SCIP_OKAY;
+
 #ifdef SCIP_OUTPUT
    G.write_dot("debug.dot");
 #endif
 
-   SCIPdebugMsg(scip, "Symmetry detection graph has %u nodes.\n", G.get_nof_vertices());
+   SCIPdebugMsg(scip, "Reduced symmetry detection graph has %u nodes.\n", G.get_nof_vertices());
 
    /* compute automorphisms */
    bliss::Stats stats;
@@ -1045,6 +1346,12 @@ SCIP_RETCODE SYMcomputeSymmetryGenerators(
    data.nmaxperms = 0;
    data.maxgenerators = maxgenerators;
    data.perms = NULL;
+   data.G = &G;
+   data.nblissvars = (int) blissvartoperm.size();
+   data.blissvartoperm = blissvartoperm.data();
+   data.timelimit = timelimit;
+   data.interrupted = false;
+   SCIP_CALL( SCIPcreateWallClock(scip, &data.clock) );
 
    /* Prefer splitting partition cells corresponding to variables over those corresponding
     * to inequalities. This is because we are only interested in the action
@@ -1059,7 +1366,21 @@ SCIP_RETCODE SYMcomputeSymmetryGenerators(
 #endif
 
    /* start search */
-   G.find_automorphisms(stats, blisshook, (void*) &data);
+   SCIP_CALL( SCIPstartClock(scip, data.clock) );
+#ifdef BLISS_VERSION_MAJOR
+   /* since version 0.76, bliss can be interrupted by a termination callback, which also enforces the generator limit */
+   auto report = [&](unsigned int n, const unsigned int* aut) { blisshook((void*) &data, n, aut); };
+   auto term = [&]() { return (maxgenerators != 0 && data.nperms >= maxgenerators) || blissterminate(&data); };
+   G.find_automorphisms(stats, report, term);
+#elif defined(BLISS_PATCH_PRESENT)
+   findAutomorphisms(&data, stats);
+#else
+   /* without the patch for search limits, bliss cannot be interrupted, so the time limit is only checked before the
+    * search */
+   if ( ! blissterminate(&data) )
+      G.find_automorphisms(stats, blisshook, (void*) &data);
+#endif
+   SCIP_CALL( SCIPstopClock(scip, data.clock) );
 #ifdef SCIP_OUTPUT
    (void) stats.print(stdout);
 #endif
@@ -1077,8 +1398,19 @@ SCIP_RETCODE SYMcomputeSymmetryGenerators(
       assert( data.nmaxperms == 0 );
    }
 
-   /* determine log10 of symmetry group size */
+   /* determine log10 of symmetry group size; if the search has been interrupted, this is only the estimate of bliss
+    * for the part of the search tree explored so far, which is neither the size of the symmetry group nor, in general,
+    * the size of the subgroup generated by the permutations found so far */
    *log10groupsize = (SCIP_Real) log10l(stats.get_group_size_approx());
 
+   if ( data.interrupted )
+   {
+      SCIPverbMessage(scip, SCIP_VERBLEVEL_HIGH, NULL,
+         "symmetry detection interrupted after %.1f seconds, using %d generators found so far\n",
+         SCIPgetClockTime(scip, data.clock), data.nperms);
+      *interrupted = TRUE;
+   }
+   SCIP_CALL( SCIPfreeClock(scip, &data.clock) );
+
    return SCIP_OKAY;
 }
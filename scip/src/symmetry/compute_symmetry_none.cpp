@@ -49,7 +49,9 @@ SCIP_RETCODE SYMcomputeSymmetryGenerators(
    int*                  nperms,             /**< pointer to store number of permutations */
    int*                  nmaxperms,          /**< pointer to store maximal number of permutations (needed for freeing storage) */
    int***                perms,              /**< pointer to store permutation generators as (nperms x npermvars) matrix */
-   SCIP_Real*            log10groupsize      /**< pointer to store size of group */
+   SCIP_Real*            log10groupsize,     /**< pointer to store size of group */
+   SCIP_Real             timelimit,          /**< wall clock time limit for the search in seconds (infinity if unlimited) */
+   SCIP_Bool*            interrupted         /**< pointer to store whether the search has been interrupted by the time limit */
    )
 {  /*lint --e{715}*/
    assert( scip != NULL );
@@ -59,12 +61,14 @@ SCIP_RETCODE SYMcomputeSymmetryGenerators(
    assert( nmaxperms != NULL );
    assert( perms != NULL );
    assert( log10groupsize != NULL );
+   assert( interrupted != NULL );
 
    /* init */
    *nperms = 0;
    *nmaxperms = 0;
    *perms = NULL;
    *log10groupsize = 0;
+   *interrupted = FALSE;
 
    return SCIP_OKAY;
 }
@@ -0,0 +1,533 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2021 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   activation.c
+ * @brief  benchmark of the activation handlers of orbitope constraints
+ * @author Sten Wessel
+ *
+ * For every activation handler and a range of matrix sizes, an orbitope constraint with the activation handler is
+ * created and SCIP is brought to the solving stage. Then, in a probing node, a randomized partial fixing of the matrix
+ * with a given density is applied, and both the search for activated submatrices (find-data callback) and the
+ * propagation of the orbitope constraint (which includes the propagation of the found submatrices) are timed.
+ *
+ * The fixings are generated such that they resemble fixings that occur in the tree: they are taken from a random
+ * assignment of the matrix that is feasible for the orbitope, and a prefix of the rows is fixed completely, since the
+ * activation handlers only detect sub-symmetries below completely fixed rows.
+ *
+ * Usage: benchmark-activation [<nreps> [<seed>]]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "scip/scip.h"
+#include "scip/cons_orbitope.h"
+#include "scip/scip_activation.h"
+#include "scip/struct_activation.h"
+#include "scip/struct_scip.h"
+#include "scip/struct_stat.h"
+#include "scip/activation_suborbitope.h"
+#include "scip/activation_makespan.h"
+#include "scip/activation_colorcomp.h"
+
+#include "include/scip_test.c"
+
+#define DEFAULT_NREPS           1000         /**< default number of fixings per benchmark instance */
+#define DEFAULT_SEED              42         /**< default random seed */
+
+#define BENCH_MAXJOBTIME          10         /**< maximal processing time of a job (makespan); small processing times
+                                              *   make machines with equal makespans, and hence sub-symmetries, common */
+#define BENCH_UNASSIGNEDPROB     0.1         /**< probability that a row of a packing orbitope is assigned to no column */
+
+/** activation handler that is benchmarked */
+enum BenchHandler
+{
+   BENCH_SUBORBITOPE = 0,                    /**< sub-orbitope activation handler on a full orbitope */
+   BENCH_MAKESPAN    = 1,                    /**< makespan activation handler on a packing orbitope */
+   BENCH_COLORCOMP   = 2                     /**< color components activation handler on a packing orbitope */
+};
+typedef enum BenchHandler BENCHHANDLER;
+
+/** benchmark instance */
+struct BenchInstance
+{
+   BENCHHANDLER          handler;            /**< activation handler */
+   int                   m;                  /**< number of rows of the orbitope matrix */
+   int                   n;                  /**< number of columns of the orbitope matrix */
+   int                   k;                  /**< activation height (suborbitope), or component-finding strategy (colorcomp) */
+   SCIP_Real             graphdensity;       /**< edge density of the random graph (colorcomp) */
+};
+typedef struct BenchInstance BENCHINSTANCE;
+
+/** benchmark instances, ordered by handler and size */
+static const BENCHINSTANCE instances[] =
+{
+   { BENCH_SUBORBITOPE,  24,  4, 2, 0.0 },
+   { BENCH_SUBORBITOPE,  48,  8, 3, 0.0 },
+   { BENCH_SUBORBITOPE,  96, 16, 4, 0.0 },
+   { BENCH_SUBORBITOPE, 168, 32, 6, 0.0 },
+   { BENCH_MAKESPAN,     20,  4, 0, 0.0 },
+   { BENCH_MAKESPAN,     50,  8, 0, 0.0 },
+   { BENCH_MAKESPAN,    100, 16, 0, 0.0 },
+   { BENCH_MAKESPAN,    200, 32, 0, 0.0 },
+   { BENCH_COLORCOMP,    30,  5, 0, 0.1 },
+   { BENCH_COLORCOMP,    30,  5, 0, 0.5 },
+   { BENCH_COLORCOMP,   100, 10, 0, 0.1 },
+   { BENCH_COLORCOMP,   100, 10, 1, 0.1 },
+   { BENCH_COLORCOMP,   100, 10, 2, 0.1 },
+   { BENCH_COLORCOMP,   100, 10, 0, 0.5 },
+};
+
+/** densities of the partial fixings, i.e., the probability that a matrix entry is fixed */
+static const SCIP_Real fixingdensities[] = { 0.1, 0.3, 0.6 };
+
+/** names of the activation handlers */
+static const char* handlernames[] = { "suborbitope", "makespan", "colorcomp" };
+
+
+/** returns the current time in nanoseconds */
+static
+double getTimeNs(void)
+{
+   struct timespec ts;
+
+   (void) clock_gettime(CLOCK_MONOTONIC, &ts);
+
+   return 1e9 * (double) ts.tv_sec + (double) ts.tv_nsec;
+}
+
+/** creates the variables, the orbitope constraint and registers the constraint at the activation handler */
+static
+SCIP_RETCODE createInstance(
+   SCIP*                 scip,               /**< SCIP data structure */
+   const BENCHINSTANCE*  instance,           /**< benchmark instance */
+   SCIP_RANDNUMGEN*      randnumgen,         /**< random number generator */
+   int*                  jobtimes,           /**< array to store the processing times of the jobs (makespan) */
+   SCIP_VAR***           matrix,             /**< matrix to store the (original) variables, rows already allocated */
+   SCIP_CONS**           cons                /**< pointer to store the orbitope constraint */
+   )
+{
+   char name[SCIP_MAXSTRLEN];
+   int m;
+   int n;
+   int i;
+   int j;
+
+   m = instance->m;
+   n = instance->n;
+
+   for( i = 0; i < m; ++i )
+   {
+      for( j = 0; j < n; ++j )
+      {
+         (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x_%d_%d", i, j);
+         SCIP_CALL( SCIPcreateVarBasic(scip, &matrix[i][j], name, 0.0, 1.0, 0.0, SCIP_VARTYPE_BINARY) );
+         SCIP_CALL( SCIPaddVar(scip, matrix[i][j]) );
+      }
+   }
+
+   SCIP_CALL( SCIPcreateConsOrbitope(scip, cons, "orbitope", matrix,
+         instance->handler == BENCH_SUBORBITOPE ? SCIP_ORBITOPETYPE_FULL : SCIP_ORBITOPETYPE_PACKING, m, n,
+         FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, TRUE, FALSE, FALSE, FALSE, FALSE, FALSE) );
+   SCIP_CALL( SCIPaddCons(scip, *cons) );
+
+   switch( instance->handler )
+   {
+   case BENCH_SUBORBITOPE:
+      SCIP_CALL( SCIPincludeActivationSuborbitope(scip) );
+      SCIP_CALL( SCIPregisterConsActivationSuborbitope(scip, *cons, matrix, m, n, instance->k, instance->k) );
+      break;
+
+   case BENCH_MAKESPAN:
+      for( i = 0; i < m; ++i )
+         jobtimes[i] = SCIPrandomGetInt(randnumgen, 1, BENCH_MAXJOBTIME);
+
+      SCIP_CALL( SCIPincludeActivationMakespan(scip) );
+      SCIP_CALL( SCIPregisterConsActivationMakespan(scip, *cons, matrix, jobtimes, n, m) );
+      break;
+
+   case BENCH_COLORCOMP:
+   {
+      int** adjacencies;
+      int* nadjacencies;
+
+      /* random graph with independent edges */
+      SCIP_CALL( SCIPallocBufferArray(scip, &adjacencies, m) );
+      SCIP_CALL( SCIPallocClearBufferArray(scip, &nadjacencies, m) );
+      for( i = 0; i < m; ++i )
+      {
+         SCIP_CALL( SCIPallocBufferArray(scip, &adjacencies[i], m) ); /*lint !e866*/
+      }
+
+      for( i = 0; i < m; ++i )
+      {
+         for( j = i + 1; j < m; ++j )
+         {
+            if( SCIPrandomGetReal(randnumgen, 0.0, 1.0) < instance->graphdensity )
+            {
+               adjacencies[i][nadjacencies[i]++] = j;
+               adjacencies[j][nadjacencies[j]++] = i;
+            }
+         }
+      }
+
+      SCIP_CALL( SCIPincludeActivationColorComp(scip) );
+      SCIP_CALL( SCIPregisterConsActivationColorComp(scip, *cons, matrix, m, n, adjacencies, nadjacencies, TRUE,
+            instance->k) );
+
+      for( i = m - 1; i >= 0; --i )
+      {
+         SCIPfreeBufferArray(scip, &adjacencies[i]);
+      }
+      SCIPfreeBufferArray(scip, &nadjacencies);
+      SCIPfreeBufferArray(scip, &adjacencies);
+      break;
+   }
+
+   default:
+      SCIPerrorMessage("unknown activation handler <%d>\n", instance->handler);
+      return SCIP_INVALIDDATA;
+   }
+
+   return SCIP_OKAY;
+}
+
+/** generates a randomized partial fixing of the matrix that is feasible for the orbitope and its sub-symmetries
+ *
+ *  First, a complete assignment of the matrix is drawn that satisfies the orbitope constraint and the sub-orbitopes that
+ *  the activation handler may find for it. For sub-orbitope instances, every row is a block of ones followed by zeros,
+ *  whose length changes with probability 1/k from one row to the next; the columns consist of runs of equal values and
+ *  dominate each other, so that they are sorted lexicographically decreasing below every row. For packing orbitopes,
+ *  every row is assigned to at most one column, and a column is only used after all columns left of it. For makespan
+ *  instances, a job is moreover assigned to the leftmost machine among those with the same current makespan, which
+ *  keeps the machines of every sub-symmetry sorted as well. Then, as in the tree, where the orbitope is branched on row by
+ *  row, the first density * m rows are fixed completely and every entry of the remaining rows is fixed with probability
+ *  density.
+ *
+ *  Entries are set to -1 if they are not fixed, and to the fixed value otherwise.
+ */
+static
+void generateFixing(
+   const BENCHINSTANCE*  instance,           /**< benchmark instance */
+   SCIP_RANDNUMGEN*      randnumgen,         /**< random number generator */
+   const int*            jobtimes,           /**< processing times of the jobs (makespan) */
+   SCIP_Real             density,            /**< probability that an entry is fixed */
+   int*                  makespans,          /**< buffer for the makespans of the machines (makespan) */
+   int**                 fixing              /**< matrix to store the fixing */
+   )
+{
+   int nfixedrows;
+   int i;
+   int j;
+
+   if( instance->handler == BENCH_SUBORBITOPE )
+   {
+      int nones = SCIPrandomGetInt(randnumgen, 0, instance->n);
+
+      for( i = 0; i < instance->m; ++i )
+      {
+         if( SCIPrandomGetReal(randnumgen, 0.0, 1.0) < 1.0 / instance->k )
+            nones = SCIPrandomGetInt(randnumgen, 0, instance->n);
+
+         for( j = 0; j < instance->n; ++j )
+            fixing[i][j] = (int) (j < nones);
+      }
+   }
+   else
+   {
+      int nusedcols = 0;
+
+      for( j = 0; j < instance->n; ++j )
+         makespans[j] = 0;
+
+      for( i = 0; i < instance->m; ++i )
+      {
+         int col = -1;
+
+         if( SCIPrandomGetReal(randnumgen, 0.0, 1.0) >= BENCH_UNASSIGNEDPROB )
+         {
+            col = SCIPrandomGetInt(randnumgen, 0, MIN(nusedcols, instance->n - 1));
+            if( col == nusedcols )
+               ++nusedcols;
+
+            if( instance->handler == BENCH_MAKESPAN )
+            {
+               for( j = 0; makespans[j] != makespans[col]; ++j )
+                  ;
+               col = j;
+               makespans[col] += jobtimes[i];
+            }
+         }
+
+         for( j = 0; j < instance->n; ++j )
+            fixing[i][j] = (int) (j == col);
+      }
+   }
+
+   nfixedrows = (int) (density * instance->m);
+
+   for( i = nfixedrows; i < instance->m; ++i )
+   {
+      for( j = 0; j < instance->n; ++j )
+      {
+         if( SCIPrandomGetReal(randnumgen, 0.0, 1.0) >= density )
+            fixing[i][j] = -1;
+      }
+   }
+}
+
+/** runs the benchmark for a single instance and fixing density, and prints one line of results */
+static
+SCIP_RETCODE runBenchmark(
+   const BENCHINSTANCE*  instance,           /**< benchmark instance */
+   SCIP_Real             density,            /**< probability that an entry is fixed */
+   int                   nreps,              /**< number of random fixings */
+   unsigned int          seed                /**< random seed */
+   )
+{
+   SCIP* scip;
+   SCIP_RANDNUMGEN* randnumgen;
+   SCIP_ACTIVATIONHDLR* activationhdlr;
+   SCIP_CONS* cons;
+   SCIP_CONS* transcons;
+   SCIP_VAR*** matrix;
+   SCIP_VAR*** transmatrix;
+   int** fixing;
+   int* jobtimes;
+   int* makespans;
+   double findtime = 0.0;
+   double proptime = 0.0;
+   SCIP_Longint nsubmatrices = 0;
+   SCIP_Longint nblocks = 0;
+   SCIP_Longint nbytes = 0;
+   int ncutoffs = 0;
+   int nentries;
+   int m;
+   int n;
+   int r;
+   int i;
+   int j;
+
+   m = instance->m;
+   n = instance->n;
+   nentries = m * n;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeConshdlrOrbitope(scip) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "activation") );
+   SCIP_CALL( SCIPcreateRandom(scip, &randnumgen, seed, TRUE) );
+
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &matrix, m) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &transmatrix, m) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &fixing, m) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &jobtimes, m) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &makespans, n) );
+   for( i = 0; i < m; ++i )
+   {
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &matrix[i], n) ); /*lint !e866*/
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &transmatrix[i], n) ); /*lint !e866*/
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &fixing[i], n) ); /*lint !e866*/
+   }
+
+   SCIP_CALL( createInstance(scip, instance, randnumgen, jobtimes, matrix, &cons) );
+
+   /* stop at the root node; the activation handler and orbitope are initialized for the transformed problem */
+   SCIP_CALL( TESTscipSetStage(scip, SCIP_STAGE_SOLVING, FALSE) );
+
+   /* the solving process was interrupted to stop at the root, which would also stop the propagation in probing */
+   scip->stat->userinterrupt = FALSE;
+   scip->stat->status = SCIP_STATUS_UNKNOWN;
+
+   SCIP_CALL( SCIPgetTransformedCons(scip, cons, &transcons) );
+   assert(transcons != NULL);
+
+   for( i = 0; i < m; ++i )
+   {
+      for( j = 0; j < n; ++j )
+      {
+         SCIP_CALL( SCIPgetTransformedVar(scip, matrix[i][j], &transmatrix[i][j]) );
+      }
+   }
+
+   activationhdlr = SCIPconsGetActivationhdlr(transcons);
+   assert(activationhdlr != NULL);
+   assert(activationhdlr->activationfindactivationdata != NULL);
+
+   SCIP_CALL( SCIPstartProbing(scip) );
+
+   for( r = 0; r < nreps; ++r )
+   {
+      SCIP_ACTIVATIONSUBMATRIX* submatrix = NULL;
+      SCIP_Bool cutoff;
+      SCIP_Longint ndomreds;
+      double start;
+
+      generateFixing(instance, randnumgen, jobtimes, density, makespans, fixing);
+
+      SCIP_CALL( SCIPnewProbingNode(scip) );
+      for( i = 0; i < m; ++i )
+      {
+         for( j = 0; j < n; ++j )
+         {
+            if( fixing[i][j] >= 0 )
+            {
+               SCIP_CALL( SCIPfixVarProbing(scip, transmatrix[i][j], (SCIP_Real) fixing[i][j]) );
+            }
+         }
+      }
+
+      /* time the search for activated submatrices on its own */
+      start = getTimeNs();
+      SCIP_CALL( activationhdlr->activationfindactivationdata(scip, activationhdlr, transcons, FALSE,
+            (void**) &submatrix) );
+      findtime += getTimeNs() - start;
+
+      /* count the memory blocks held by the returned submatrices before the orbitope constraint would free them; these
+       * are derived from the returned list and do not include temporary allocations of the callback */
+      while( submatrix != NULL )
+      {
+         SCIP_ACTIVATIONSUBMATRIX* prev;
+
+         ++nsubmatrices;
+         ++nblocks;
+         nbytes += (SCIP_Longint) sizeof(SCIP_ACTIVATIONSUBMATRIX);
+
+         prev = submatrix;
+         submatrix = submatrix->next;
+
+         if( prev->rows != NULL )
+         {
+            ++nblocks;
+            nbytes += (SCIP_Longint) prev->nrows * (SCIP_Longint) sizeof(int);
+            SCIPfreeBlockMemoryArray(scip, &prev->rows, prev->nrows);
+         }
+         if( prev->cols != NULL )
+         {
+            ++nblocks;
+            nbytes += (SCIP_Longint) prev->ncols * (SCIP_Longint) sizeof(int);
+            SCIPfreeBlockMemoryArray(scip, &prev->cols, prev->ncols);
+         }
+         SCIPfreeBlockMemory(scip, &prev);
+      }
+
+      /* time one propagation round of the orbitope constraint, including the found submatrices */
+      start = getTimeNs();
+      SCIP_CALL( SCIPpropagateProbing(scip, 1, &cutoff, &ndomreds) );
+      proptime += getTimeNs() - start;
+
+      if( cutoff )
+         ++ncutoffs;
+
+      SCIP_CALL( SCIPbacktrackProbing(scip, 0) );
+   }
+
+   SCIP_CALL( SCIPendProbing(scip) );
+
+   if( instance->handler == BENCH_COLORCOMP )
+   {
+      printf("%-12s %5d %4d %2d %4.2f %5.2f %12.2f %12.2f %10.2f %11.2f %11.1f %8d\n", handlernames[instance->handler], m,
+         n, instance->k, instance->graphdensity, density, findtime / nreps / nentries, proptime / nreps / nentries,
+         (double) nsubmatrices / nreps, (double) nblocks / nreps, (double) nbytes / nreps, ncutoffs);
+   }
+   else
+   {
+      printf("%-12s %5d %4d %2d %4s %5.2f %12.2f %12.2f %10.2f %11.2f %11.1f %8d\n", handlernames[instance->handler], m,
+         n, instance->k, "-", density, findtime / nreps / nentries, proptime / nreps / nentries,
+         (double) nsubmatrices / nreps, (double) nblocks / nreps, (double) nbytes / nreps, ncutoffs);
+   }
+
+   SCIP_CALL( SCIPfreeTransform(scip) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+
+   for( i = m - 1; i >= 0; --i )
+   {
+      for( j = n - 1; j >= 0; --j )
+      {
+         SCIP_CALL( SCIPreleaseVar(scip, &matrix[i][j]) );
+      }
+      SCIPfreeBlockMemoryArray(scip, &fixing[i], n);
+      SCIPfreeBlockMemoryArray(scip, &transmatrix[i], n);
+      SCIPfreeBlockMemoryArray(scip, &matrix[i], n);
+   }
+   SCIPfreeBlockMemoryArray(scip, &makespans, n);
+   SCIPfreeBlockMemoryArray(scip, &jobtimes, m);
+   SCIPfreeBlockMemoryArray(scip, &fixing, m);
+   SCIPfreeBlockMemoryArray(scip, &transmatrix, m);
+   SCIPfreeBlockMemoryArray(scip, &matrix, m);
+
+   SCIPfreeRandom(scip, &randnumgen);
+   SCIP_CALL( SCIPfree(&scip) );
+
+   BMScheckEmptyMemory();
+
+   return SCIP_OKAY;
+}
+
+/** runs all benchmark instances */
+static
+SCIP_RETCODE runBenchmarks(
+   int                   nreps,              /**< number of random fixings per instance and density */
+   unsigned int          seed                /**< random seed */
+   )
+{
+   int i;
+   int d;
+
+   printf("%-12s %5s %4s %2s %4s %5s %12s %12s %10s %11s %11s %8s\n", "handler", "m", "n", "k", "p", "dens",
+      "find ns/ent", "prop ns/ent", "subm/call", "blocks/call", "bytes/call", "cutoffs");
+
+   for( i = 0; i < (int) (sizeof(instances) / sizeof(instances[0])); ++i )
+   {
+      for( d = 0; d < (int) (sizeof(fixingdensities) / sizeof(fixingdensities[0])); ++d )
+      {
+         SCIP_CALL( runBenchmark(&instances[i], fixingdensities[d], nreps, seed) );
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+/** main method */
+int main(
+   int                   argc,               /**< number of arguments from the shell */
+   char**                argv                /**< array of shell arguments */
+   )
+{
+   SCIP_RETCODE retcode;
+   int nreps = DEFAULT_NREPS;
+   unsigned int seed = DEFAULT_SEED;
+
+   if( argc > 1 )
+      nreps = atoi(argv[1]);
+   if( argc > 2 )
+      seed = (unsigned int) atoi(argv[2]);
+
+   if( nreps <= 0 )
+   {
+      fprintf(stderr, "usage: %s [<nreps> [<seed>]]\n", argv[0]);
+      return -1;
+   }
+
+   retcode = runBenchmarks(nreps, seed);
+
+   if( retcode != SCIP_OKAY )
+   {
+      SCIPprintError(retcode);
+      return -1;
+   }
+
+   return 0;
+}
@@ -0,0 +1,194 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2021 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   sbthreads.c
+ * @brief  unit tests for strong branching on copies of the LP solver interface in parallel
+ *
+ * A branching rule strong branches on all candidates of the root LP once with lp/sbthreads = 1 and once with more
+ * threads. The dual bounds of both calls have to agree.
+ */
+
+#include <string.h>
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+#include "scip/struct_scip.h"
+#include "scip/struct_lp.h"
+#include "lpi/lpi.h"
+
+#include "include/scip_test.h"
+
+#define NITEMS        12
+#define NROWS         3
+#define NTHREADS      4
+
+/* global SCIP instance */
+static SCIP* scip;
+
+/* strong branching results of the sequential and the parallel call */
+static SCIP_Real seqdown[NITEMS];
+static SCIP_Real sequp[NITEMS];
+static SCIP_Bool seqdownvalid[NITEMS];
+static SCIP_Bool sequpvalid[NITEMS];
+static SCIP_Real pardown[NITEMS];
+static SCIP_Real parup[NITEMS];
+static SCIP_Bool pardownvalid[NITEMS];
+static SCIP_Bool parupvalid[NITEMS];
+static int nsbvars = -1;
+static int nworkers = 0;
+
+/** branching execution method for fractional LP solutions: strong branches on all candidates of the first LP twice */
+static
+SCIP_DECL_BRANCHEXECLP(branchExeclpSbthreads)
+{
+   SCIP_VAR** lpcands;
+   SCIP_Bool lperror;
+   int nlpcands;
+
+   *result = SCIP_DIDNOTRUN;
+
+   if( nsbvars >= 0 )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPgetLPBranchCands(scip, &lpcands, NULL, NULL, &nlpcands, NULL, NULL) );
+   nsbvars = MIN(nlpcands, NITEMS);
+
+   SCIP_CALL( SCIPstartStrongbranch(scip, FALSE) );
+
+   SCIP_CALL( SCIPsetIntParam(scip, "lp/sbthreads", 1) );
+   SCIP_CALL( SCIPgetVarsStrongbranchesFrac(scip, lpcands, nsbvars, INT_MAX, seqdown, sequp, seqdownvalid, sequpvalid,
+         NULL, NULL, NULL, NULL, &lperror) );
+   cr_assert(!lperror, "sequential strong branching failed");
+
+   SCIP_CALL( SCIPsetIntParam(scip, "lp/sbthreads", NTHREADS) );
+   SCIP_CALL( SCIPgetVarsStrongbranchesFrac(scip, lpcands, nsbvars, INT_MAX, pardown, parup, pardownvalid, parupvalid,
+         NULL, NULL, NULL, NULL, &lperror) );
+   cr_assert(!lperror, "parallel strong branching failed");
+   nworkers = scip->lp->nvalidsbworkers;
+
+   SCIP_CALL( SCIPendStrongbranch(scip) );
+
+   return SCIP_OKAY;
+}
+
+/** creates a knapsack problem with three capacity constraints, whose LP solution has several fractional values */
+static
+void createProb(void)
+{
+   SCIP_VAR* vars[NITEMS];
+   SCIP_Real weights[NROWS][NITEMS];
+   SCIP_Real capacities[NROWS];
+   SCIP_CONS* cons;
+   int i;
+   int r;
+
+   SCIP_CALL_ABORT( SCIPcreateProbBasic(scip, "sbthreads") );
+   SCIP_CALL_ABORT( SCIPsetObjsense(scip, SCIP_OBJSENSE_MAXIMIZE) );
+
+   for( r = 0; r < NROWS; ++r )
+      capacities[r] = 0.0;
+
+   for( i = 0; i < NITEMS; ++i )
+   {
+      char name[SCIP_MAXSTRLEN];
+
+      for( r = 0; r < NROWS; ++r )
+      {
+         weights[r][i] = (SCIP_Real) (10 + ((7 + 4 * r) * i + 5 * r) % 23);
+         capacities[r] += weights[r][i];
+      }
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", i);
+      SCIP_CALL_ABORT( SCIPcreateVarBasic(scip, &vars[i], name, 0.0, 1.0, weights[0][i] + (SCIP_Real) ((3 * i) % 5),
+            SCIP_VARTYPE_BINARY) );
+      SCIP_CALL_ABORT( SCIPaddVar(scip, vars[i]) );
+   }
+
+   for( r = 0; r < NROWS; ++r )
+   {
+      char name[SCIP_MAXSTRLEN];
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "capacity%d", r);
+      SCIP_CALL_ABORT( SCIPcreateConsBasicLinear(scip, &cons, name, NITEMS, vars, weights[r], -SCIPinfinity(scip),
+            SCIPfloor(scip, capacities[r] / 2.0) + 0.5) );
+      SCIP_CALL_ABORT( SCIPaddCons(scip, cons) );
+      SCIP_CALL_ABORT( SCIPreleaseCons(scip, &cons) );
+   }
+
+   for( i = 0; i < NITEMS; ++i )
+   {
+      SCIP_CALL_ABORT( SCIPreleaseVar(scip, &vars[i]) );
+   }
+}
+
+/** setup: create SCIP with the problem and the branching rule */
+static
+void setup(void)
+{
+   SCIP_BRANCHRULE* branchrule;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPincludeBranchruleBasic(scip, &branchrule, "sbthreads", "strong branches sequentially and in parallel",
+         1000000, -1, 1.0, NULL) );
+   SCIP_CALL( SCIPsetBranchruleExecLp(scip, branchrule, branchExeclpSbthreads) );
+   createProb();
+
+   /* branch on the first LP solution */
+   SCIP_CALL( SCIPsetPresolving(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetHeuristics(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetSeparating(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetIntParam(scip, "parallel/maxnthreads", NTHREADS) );
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+}
+
+/** teardown: free SCIP */
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+/* TEST SUITE */
+TestSuite(sbthreads, .init = setup, .fini = teardown);
+
+Test(sbthreads, compare, .description = "strong branching in parallel yields the same dual bounds as sequentially")
+{
+   int i;
+
+   /* skip test if no LP solver is available */
+   if( strcmp(SCIPlpiGetSolverName(), "NONE") == 0 )
+      return;
+
+   SCIP_CALL( SCIPsolve(scip) );
+
+   cr_assert_eq(SCIPgetStatus(scip), SCIP_STATUS_OPTIMAL);
+   cr_assert_gt(nsbvars, 1, "the root LP has too few fractional variables");
+#ifdef _OPENMP
+   cr_expect_gt(nworkers, 1, "strong branching has not been performed in parallel");
+#endif
+
+   for( i = 0; i < nsbvars; ++i )
+   {
+      cr_expect_eq(seqdownvalid[i], pardownvalid[i], "validity of down branch of candidate %d differs", i);
+      cr_expect_eq(sequpvalid[i], parupvalid[i], "validity of up branch of candidate %d differs", i);
+      cr_expect(SCIPisFeasEQ(scip, seqdown[i], pardown[i]), "down value %g of candidate %d differs from sequential %g",
+         pardown[i], i, seqdown[i]);
+      cr_expect(SCIPisFeasEQ(scip, sequp[i], parup[i]), "up value %g of candidate %d differs from sequential %g",
+         parup[i], i, sequp[i]);
+   }
+}
@@ -0,0 +1,181 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2021 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   subtrees.c
+ * @brief  unit tests for splitting the search tree among the concurrent solvers
+ *
+ * A maximization problem with an objective offset is solved concurrently on subtrees of the split search tree. The
+ * final primal and dual bound have to agree with a sequential solve, and if a limit stops the subtree solvers, the
+ * dual bound has to remain an upper bound on the optimal value.
+ */
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+
+#include "include/scip_test.h"
+
+#define NITEMS        16
+#define OBJOFFSET     7.5
+
+/* global SCIP instance */
+static SCIP* scip;
+
+/** creates a two-dimensional knapsack problem, in which every item occurs twice */
+static
+void createProb(
+   SCIP*                 targetscip          /**< SCIP instance */
+   )
+{
+   SCIP_VAR* vars[NITEMS];
+   SCIP_Real weights1[NITEMS];
+   SCIP_Real weights2[NITEMS];
+   SCIP_CONS* cons;
+   SCIP_Real capacity1 = 0.0;
+   SCIP_Real capacity2 = 0.0;
+   int i;
+
+   SCIP_CALL_ABORT( SCIPcreateProbBasic(targetscip, "subtrees") );
+   SCIP_CALL_ABORT( SCIPsetObjsense(targetscip, SCIP_OBJSENSE_MAXIMIZE) );
+   SCIP_CALL_ABORT( SCIPaddOrigObjoffset(targetscip, OBJOFFSET) );
+
+   for( i = 0; i < NITEMS; ++i )
+   {
+      char name[SCIP_MAXSTRLEN];
+      int item;
+
+      item = i % (NITEMS / 2);
+      weights1[i] = (SCIP_Real) (10 + (7 * item) % 23);
+      weights2[i] = (SCIP_Real) (12 + (11 * item) % 19);
+      capacity1 += weights1[i];
+      capacity2 += weights2[i];
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", i);
+      SCIP_CALL_ABORT( SCIPcreateVarBasic(targetscip, &vars[i], name, 0.0, 1.0, weights1[i] + (SCIP_Real) (item % 5),
+            SCIP_VARTYPE_BINARY) );
+      SCIP_CALL_ABORT( SCIPaddVar(targetscip, vars[i]) );
+   }
+
+   SCIP_CALL_ABORT( SCIPcreateConsBasicLinear(targetscip, &cons, "capacity1", NITEMS, vars, weights1, -SCIPinfinity(targetscip),
+         SCIPfloor(targetscip, capacity1 / 3.0)) );
+   SCIP_CALL_ABORT( SCIPaddCons(targetscip, cons) );
+   SCIP_CALL_ABORT( SCIPreleaseCons(targetscip, &cons) );
+
+   SCIP_CALL_ABORT( SCIPcreateConsBasicLinear(targetscip, &cons, "capacity2", NITEMS, vars, weights2, -SCIPinfinity(targetscip),
+         SCIPfloor(targetscip, capacity2 / 3.0)) );
+   SCIP_CALL_ABORT( SCIPaddCons(targetscip, cons) );
+   SCIP_CALL_ABORT( SCIPreleaseCons(targetscip, &cons) );
+
+   for( i = 0; i < NITEMS; ++i )
+   {
+      SCIP_CALL_ABORT( SCIPreleaseVar(targetscip, &vars[i]) );
+   }
+}
+
+/** solves the problem sequentially and returns its optimal value */
+static
+SCIP_Real solveSequential(void)
+{
+   SCIP* refscip;
+   SCIP_Real optimum;
+
+   SCIP_CALL_ABORT( SCIPcreate(&refscip) );
+   SCIP_CALL_ABORT( SCIPincludeDefaultPlugins(refscip) );
+   SCIP_CALL_ABORT( SCIPsetIntParam(refscip, "display/verblevel", 0) );
+   createProb(refscip);
+
+   SCIP_CALL_ABORT( SCIPsolve(refscip) );
+   cr_assert_eq(SCIPgetStatus(refscip), SCIP_STATUS_OPTIMAL);
+   optimum = SCIPgetPrimalbound(refscip);
+
+   SCIP_CALL_ABORT( SCIPfree(&refscip) );
+
+   return optimum;
+}
+
+/** setup: create SCIP with the problem that is solved on subtrees of two concurrent solvers */
+static
+void setup(void)
+{
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+   createProb(scip);
+
+   SCIP_CALL( SCIPsetIntParam(scip, "concurrent/nsubtrees", 2) );
+   SCIP_CALL( SCIPsetIntParam(scip, "parallel/minnthreads", 2) );
+   SCIP_CALL( SCIPsetIntParam(scip, "parallel/maxnthreads", 2) );
+}
+
+/** teardown: free SCIP */
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+/* TEST SUITE */
+TestSuite(subtrees, .init = setup, .fini = teardown);
+
+Test(subtrees, optimal, .description = "solving a maximization problem on subtrees yields the optimal primal and dual bound")
+{
+   SCIP_Real optimum;
+
+#ifdef TPI_NONE
+   /* skip test if SCIP cannot solve concurrently */
+   return;
+#endif
+
+   optimum = solveSequential();
+
+   SCIP_CALL( SCIPsolveConcurrent(scip) );
+
+   cr_assert_gt(SCIPsyncstoreGetNSubtrees(SCIPgetSyncstore(scip)), 1, "search tree has not been split");
+   cr_assert_eq(SCIPgetStatus(scip), SCIP_STATUS_OPTIMAL);
+   cr_expect(SCIPisEQ(scip, SCIPgetPrimalbound(scip), optimum), "primal bound %g differs from optimum %g",
+      SCIPgetPrimalbound(scip), optimum);
+   cr_expect(SCIPisEQ(scip, SCIPgetDualbound(scip), optimum), "dual bound %g differs from optimum %g",
+      SCIPgetDualbound(scip), optimum);
+}
+
+Test(subtrees, limit, .description = "if a limit stops the subtrees, the dual bound of a maximization problem is an upper bound")
+{
+   SCIP_Real optimum;
+
+#ifdef TPI_NONE
+   /* skip test if SCIP cannot solve concurrently */
+   return;
+#endif
+
+   optimum = solveSequential();
+
+   /* every subtree solve stops after a few nodes without LP */
+   SCIP_CALL( SCIPsetLongintParam(scip, "limits/nodes", 3LL) );
+   SCIP_CALL( SCIPsetIntParam(scip, "lp/solvefreq", -1) );
+   SCIP_CALL( SCIPsolveConcurrent(scip) );
+
+   cr_assert_gt(SCIPsyncstoreGetNSubtrees(SCIPgetSyncstore(scip)), 1, "search tree has not been split");
+   cr_assert_neq(SCIPgetStatus(scip), SCIP_STATUS_OPTIMAL);
+   cr_expect(SCIPisFeasGE(scip, SCIPgetDualbound(scip), optimum), "dual bound %g is below optimum %g",
+      SCIPgetDualbound(scip), optimum);
+   cr_expect(SCIPisFeasLT(scip, SCIPgetDualbound(scip), SCIPinfinity(scip)), "dual bound is infinite");
+
+   if( SCIPgetNSols(scip) > 0 )
+   {
+      cr_expect(SCIPisFeasLE(scip, SCIPgetPrimalbound(scip), optimum), "primal bound %g is above optimum %g",
+         SCIPgetPrimalbound(scip), optimum);
+   }
+}
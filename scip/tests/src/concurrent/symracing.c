@@ -0,0 +1,181 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2021 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   symracing.c
+ * @brief  unit tests for the racing ramp-up phase of the symmetry handling methods
+ *
+ * The racers solve copies of the transformed problem, which is minimized. On a maximization problem, the race must not
+ * stop before the racers solved the problem or closed the gap, and the solutions of the racers have to be passed to the
+ * main SCIP.
+ */
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+#include "scip/concurrent.h"
+
+#include "include/scip_test.h"
+
+#define NITEMS        16
+
+/* global SCIP instance */
+static SCIP* scip;
+
+/** creates a two-dimensional knapsack problem, in which every item occurs twice */
+static
+void createProb(
+   SCIP*                 targetscip          /**< SCIP instance */
+   )
+{
+   SCIP_VAR* vars[NITEMS];
+   SCIP_Real weights1[NITEMS];
+   SCIP_Real weights2[NITEMS];
+   SCIP_CONS* cons;
+   SCIP_Real capacity1 = 0.0;
+   SCIP_Real capacity2 = 0.0;
+   int i;
+
+   SCIP_CALL_ABORT( SCIPcreateProbBasic(targetscip, "symracing") );
+   SCIP_CALL_ABORT( SCIPsetObjsense(targetscip, SCIP_OBJSENSE_MAXIMIZE) );
+
+   for( i = 0; i < NITEMS; ++i )
+   {
+      char name[SCIP_MAXSTRLEN];
+      int item;
+
+      item = i % (NITEMS / 2);
+      weights1[i] = (SCIP_Real) (10 + (7 * item) % 23);
+      weights2[i] = (SCIP_Real) (12 + (11 * item) % 19);
+      capacity1 += weights1[i];
+      capacity2 += weights2[i];
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", i);
+      SCIP_CALL_ABORT( SCIPcreateVarBasic(targetscip, &vars[i], name, 0.0, 1.0, weights1[i] + (SCIP_Real) (item % 5),
+            SCIP_VARTYPE_BINARY) );
+      SCIP_CALL_ABORT( SCIPaddVar(targetscip, vars[i]) );
+   }
+
+   SCIP_CALL_ABORT( SCIPcreateConsBasicLinear(targetscip, &cons, "capacity1", NITEMS, vars, weights1, -SCIPinfinity(targetscip),
+         SCIPfloor(targetscip, capacity1 / 3.0)) );
+   SCIP_CALL_ABORT( SCIPaddCons(targetscip, cons) );
+   SCIP_CALL_ABORT( SCIPreleaseCons(targetscip, &cons) );
+
+   SCIP_CALL_ABORT( SCIPcreateConsBasicLinear(targetscip, &cons, "capacity2", NITEMS, vars, weights2, -SCIPinfinity(targetscip),
+         SCIPfloor(targetscip, capacity2 / 3.0)) );
+   SCIP_CALL_ABORT( SCIPaddCons(targetscip, cons) );
+   SCIP_CALL_ABORT( SCIPreleaseCons(targetscip, &cons) );
+
+   for( i = 0; i < NITEMS; ++i )
+   {
+      SCIP_CALL_ABORT( SCIPreleaseVar(targetscip, &vars[i]) );
+   }
+}
+
+/** setup: create SCIP with the problem */
+static
+void setup(void)
+{
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+   createProb(scip);
+}
+
+/** teardown: free SCIP */
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+/* TEST SUITE */
+TestSuite(symracing, .init = setup, .fini = teardown);
+
+Test(symracing, maximize, .description = "the race on a maximization problem runs until a racer solved the problem")
+{
+   SCIP* refscip;
+   SCIP_STATUS status;
+   SCIP_Longint refnodes;
+   SCIP_Real optimum;
+
+#ifdef TPI_NONE
+   /* skip test if SCIP cannot solve concurrently */
+   return;
+#endif
+
+   /* solve the problem sequentially to get the optimum and the size of the tree */
+   SCIP_CALL( SCIPcreate(&refscip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(refscip) );
+   SCIP_CALL( SCIPsetIntParam(refscip, "display/verblevel", 0) );
+   createProb(refscip);
+   SCIP_CALL( SCIPsolve(refscip) );
+
+   cr_assert_eq(SCIPgetStatus(refscip), SCIP_STATUS_OPTIMAL);
+   optimum = SCIPgetPrimalbound(refscip);
+   refnodes = SCIPgetNNodes(refscip);
+   SCIP_CALL( SCIPfree(&refscip) );
+
+   /* the racers cannot solve the problem in the first round, but well within the whole race */
+   cr_assert_gt(refnodes, 20, "the problem is too easy to race on");
+   SCIP_CALL( SCIPsetLongintParam(scip, "concurrent/symracingnodes", 5 * refnodes) );
+
+   SCIP_CALL( SCIPpresolve(scip) );
+   cr_assert_eq(SCIPgetStage(scip), SCIP_STAGE_PRESOLVED);
+
+   SCIP_CALL( SCIPconcurrentRaceSymmetry(scip, 2, &status) );
+
+   cr_expect_eq(status, SCIP_STATUS_OPTIMAL, "race stopped with status %d before the problem was solved", status);
+   cr_expect_geq(SCIPsyncstoreGetSymmetryVariant(SCIPgetSyncstore(scip)), 0, "no winner has been stored");
+   cr_assert_gt(SCIPgetNSols(scip), 0);
+   cr_expect(SCIPisEQ(scip, SCIPgetPrimalbound(scip), optimum), "primal bound %g after the race differs from optimum %g",
+      SCIPgetPrimalbound(scip), optimum);
+}
+
+Test(symracing, solve, .description = "solving a maximization problem concurrently after the race yields the optimum")
+{
+   SCIP* refscip;
+   SCIP_Real optimum;
+
+#ifdef TPI_NONE
+   /* skip test if SCIP cannot solve concurrently */
+   return;
+#endif
+
+   SCIP_CALL( SCIPcreate(&refscip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(refscip) );
+   SCIP_CALL( SCIPsetIntParam(refscip, "display/verblevel", 0) );
+   createProb(refscip);
+   SCIP_CALL( SCIPsolve(refscip) );
+
+   cr_assert_eq(SCIPgetStatus(refscip), SCIP_STATUS_OPTIMAL);
+   optimum = SCIPgetPrimalbound(refscip);
+   SCIP_CALL( SCIPfree(&refscip) );
+
+   /* the race is too short to solve the problem, so that the concurrent solvers use the winner */
+   SCIP_CALL( SCIPsetBoolParam(scip, "concurrent/symracing", TRUE) );
+   SCIP_CALL( SCIPsetLongintParam(scip, "concurrent/symracingnodes", 10LL) );
+   SCIP_CALL( SCIPsetIntParam(scip, "parallel/minnthreads", 2) );
+   SCIP_CALL( SCIPsetIntParam(scip, "parallel/maxnthreads", 2) );
+
+   SCIP_CALL( SCIPsolveConcurrent(scip) );
+
+   cr_assert_eq(SCIPgetStatus(scip), SCIP_STATUS_OPTIMAL);
+   cr_expect_geq(SCIPsyncstoreGetSymmetryVariant(SCIPgetSyncstore(scip)), 0, "no winner has been stored");
+   cr_expect(SCIPisEQ(scip, SCIPgetPrimalbound(scip), optimum), "primal bound %g differs from optimum %g",
+      SCIPgetPrimalbound(scip), optimum);
+   cr_expect(SCIPisEQ(scip, SCIPgetDualbound(scip), optimum), "dual bound %g differs from optimum %g",
+      SCIPgetDualbound(scip), optimum);
+}
@@ -0,0 +1,286 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2021 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   state.c
+ * @brief  unit tests for storing and restoring the basis of the lpi with SCIPlpiGetState() and SCIPlpiSetState()
+ *
+ * Some LPIs pack the basis status of the LPi state; the SoPlex interface additionally stores the packed arrays
+ * run-length encoded if that is shorter. The bases below cover empty arrays, arrays that consist of a single run, arrays
+ * with a few long runs, and arrays without repeated packets, which are stored plainly.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include <scip/scip.h>
+#include <lpi/lpi.h>
+#include "include/scip_test.h"
+
+#define MAXNCOLS 100
+#define MAXNROWS 40
+
+/* global variables for the LPI and the block memory of the LPi states */
+static SCIP_LPI* lpi;
+static BMS_BLKMEM* blkmem;
+
+/** creates an LP with the given number of columns with bounds [0,1] and ranged rows -1 <= x_{i mod ncols} <= 1 */
+static
+void createLP(
+   int                   ncols,              /**< number of columns */
+   int                   nrows               /**< number of rows */
+   )
+{
+   SCIP_Real obj[MAXNCOLS];
+   SCIP_Real lb[MAXNCOLS];
+   SCIP_Real ub[MAXNCOLS];
+   SCIP_Real lhs[MAXNROWS];
+   SCIP_Real rhs[MAXNROWS];
+   SCIP_Real val[MAXNROWS];
+   int beg[MAXNROWS];
+   int ind[MAXNROWS];
+   int nlpcols;
+   int nlprows;
+   int i;
+
+   assert(ncols <= MAXNCOLS);
+   assert(nrows <= MAXNROWS);
+   assert(ncols > 0 || nrows == 0);
+
+   for (i = 0; i < ncols; ++i)
+   {
+      obj[i] = 1.0;
+      lb[i] = 0.0;
+      ub[i] = 1.0;
+   }
+
+   for (i = 0; i < nrows; ++i)
+   {
+      lhs[i] = -1.0;
+      rhs[i] = 1.0;
+      val[i] = 1.0;
+      beg[i] = i;
+      ind[i] = i % ncols;
+   }
+
+   if ( ncols > 0 )
+   {
+      SCIP_CALL( SCIPlpiAddCols(lpi, ncols, obj, lb, ub, NULL, 0, NULL, NULL, NULL) );
+   }
+   if ( nrows > 0 )
+   {
+      SCIP_CALL( SCIPlpiAddRows(lpi, nrows, lhs, rhs, NULL, nrows, beg, ind, val) );
+   }
+
+   SCIP_CALL( SCIPlpiGetNCols(lpi, &nlpcols) );
+   SCIP_CALL( SCIPlpiGetNRows(lpi, &nlprows) );
+   cr_assert_eq(nlpcols, ncols);
+   cr_assert_eq(nlprows, nrows);
+}
+
+/** stores the given basis in an LPi state, loads another basis, restores the state, and checks that the given basis is
+ *  restored
+ */
+static
+void checkRoundTrip(
+   const int*            cstat,              /**< basis status of the columns to store */
+   const int*            rstat,              /**< basis status of the rows to store */
+   const int*            othercstat,         /**< basis status of the columns to load before restoring the state */
+   const int*            otherrstat          /**< basis status of the rows to load before restoring the state */
+   )
+{
+   SCIP_LPISTATE* lpistate = NULL;
+   int cstatout[MAXNCOLS];
+   int rstatout[MAXNROWS];
+   int ncols;
+   int nrows;
+   int i;
+
+   SCIP_CALL( SCIPlpiGetNCols(lpi, &ncols) );
+   SCIP_CALL( SCIPlpiGetNRows(lpi, &nrows) );
+
+   SCIP_CALL( SCIPlpiSetBase(lpi, cstat, rstat) );
+   SCIP_CALL( SCIPlpiGetState(lpi, blkmem, &lpistate) );
+   cr_assert_not_null(lpistate);
+
+   SCIP_CALL( SCIPlpiSetBase(lpi, othercstat, otherrstat) );
+   SCIP_CALL( SCIPlpiSetState(lpi, blkmem, lpistate) );
+   SCIP_CALL( SCIPlpiFreeState(lpi, blkmem, &lpistate) );
+   cr_assert_null(lpistate);
+
+   SCIP_CALL( SCIPlpiGetBase(lpi, cstatout, rstatout) );
+
+   for (i = 0; i < ncols; ++i)
+      cr_expect_eq(cstatout[i], cstat[i], "status of column %d is %d instead of %d", i, cstatout[i], cstat[i]);
+
+   for (i = 0; i < nrows; ++i)
+      cr_expect_eq(rstatout[i], rstat[i], "status of row %d is %d instead of %d", i, rstatout[i], rstat[i]);
+}
+
+/** returns the basis status with lower and upper bound exchanged */
+static
+int mirrorStatus(
+   int                   stat                /**< basis status */
+   )
+{
+   if ( stat == (int) SCIP_BASESTAT_LOWER )
+      return (int) SCIP_BASESTAT_UPPER;
+   if ( stat == (int) SCIP_BASESTAT_UPPER )
+      return (int) SCIP_BASESTAT_LOWER;
+   return stat;
+}
+
+/** mirrors the bounds of a basis, which gives another valid basis of the LP created by createLP() */
+static
+void mirrorBasis(
+   const int*            cstat,              /**< basis status of the columns */
+   const int*            rstat,              /**< basis status of the rows */
+   int*                  mirrorcstat,        /**< array to store the mirrored basis status of the columns */
+   int*                  mirrorrstat,        /**< array to store the mirrored basis status of the rows */
+   int                   ncols,              /**< number of columns */
+   int                   nrows               /**< number of rows */
+   )
+{
+   int i;
+
+   for (i = 0; i < ncols; ++i)
+      mirrorcstat[i] = mirrorStatus(cstat[i]);
+
+   for (i = 0; i < nrows; ++i)
+      mirrorrstat[i] = mirrorStatus(rstat[i]);
+}
+
+/** setup: create LPI and block memory */
+static
+void setup(void)
+{
+   lpi = NULL;
+
+   SCIP_CALL( SCIPlpiCreate(&lpi, NULL, "state", SCIP_OBJSEN_MINIMIZE) );
+
+   blkmem = BMScreateBlockMemory(1, 10);
+   cr_assert_not_null(blkmem);
+}
+
+/** teardown: free LPI and block memory */
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPlpiFree(&lpi) );
+   BMSdestroyBlockMemory(&blkmem);
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+TestSuite(state, .init = setup, .fini = teardown);
+
+/*** TESTS ***/
+Test(state, empty, .description = "the basis of an LP without rows and of an empty LP is restored")
+{
+   int cstat[20];
+   int othercstat[20];
+   int nostat[1] = { 0 };
+   int i;
+
+   /* no columns and no rows */
+   checkRoundTrip(nostat, nostat, nostat, nostat);
+
+   /* columns, but no rows */
+   createLP(20, 0);
+
+   for (i = 0; i < 20; ++i)
+      cstat[i] = (int) SCIP_BASESTAT_LOWER;
+   mirrorBasis(cstat, nostat, othercstat, nostat, 20, 0);
+
+   checkRoundTrip(cstat, nostat, othercstat, nostat);
+}
+
+Test(state, allsame, .description = "a basis whose columns and rows have the same status each is restored")
+{
+   int cstat[MAXNCOLS];
+   int rstat[MAXNROWS];
+   int othercstat[MAXNCOLS];
+   int otherrstat[MAXNROWS];
+   int i;
+
+   createLP(MAXNCOLS, MAXNROWS);
+
+   /* slack basis with all columns at their lower bound */
+   for (i = 0; i < MAXNCOLS; ++i)
+      cstat[i] = (int) SCIP_BASESTAT_LOWER;
+   for (i = 0; i < MAXNROWS; ++i)
+      rstat[i] = (int) SCIP_BASESTAT_BASIC;
+   mirrorBasis(cstat, rstat, othercstat, otherrstat, MAXNCOLS, MAXNROWS);
+
+   checkRoundTrip(cstat, rstat, othercstat, otherrstat);
+}
+
+Test(state, runs, .description = "a basis with a few long runs of equal status is restored")
+{
+   int cstat[MAXNCOLS];
+   int rstat[MAXNROWS];
+   int othercstat[MAXNCOLS];
+   int otherrstat[MAXNROWS];
+   int i;
+
+   createLP(MAXNCOLS, MAXNROWS);
+
+   /* 7 basic columns and 33 basic rows; the runs do not end at packet boundaries */
+   for (i = 0; i < MAXNCOLS; ++i)
+   {
+      if ( i < 60 )
+         cstat[i] = (int) SCIP_BASESTAT_LOWER;
+      else if ( i < 93 )
+         cstat[i] = (int) SCIP_BASESTAT_UPPER;
+      else
+         cstat[i] = (int) SCIP_BASESTAT_BASIC;
+   }
+   for (i = 0; i < MAXNROWS; ++i)
+      rstat[i] = i < 33 ? (int) SCIP_BASESTAT_BASIC : (int) SCIP_BASESTAT_LOWER;
+   mirrorBasis(cstat, rstat, othercstat, otherrstat, MAXNCOLS, MAXNROWS);
+
+   checkRoundTrip(cstat, rstat, othercstat, otherrstat);
+}
+
+Test(state, noruns, .description = "a basis without repeated packets is restored")
+{
+   int cstat[MAXNCOLS];
+   int rstat[MAXNROWS];
+   int othercstat[MAXNCOLS];
+   int otherrstat[MAXNROWS];
+   int i;
+
+   createLP(MAXNCOLS, MAXNROWS);
+
+   /* the period 3 of the column status does not divide the number of entries per packet, so consecutive packets differ;
+    * there are 33 basic columns and 7 basic rows
+    */
+   for (i = 0; i < MAXNCOLS; ++i)
+   {
+      if ( i % 3 == 0 )
+         cstat[i] = (int) SCIP_BASESTAT_LOWER;
+      else if ( i % 3 == 1 )
+         cstat[i] = (int) SCIP_BASESTAT_UPPER;
+      else
+         cstat[i] = (int) SCIP_BASESTAT_BASIC;
+   }
+   for (i = 0; i < MAXNROWS; ++i)
+   {
+      if ( i < 7 )
+         rstat[i] = (int) SCIP_BASESTAT_BASIC;
+      else
+         rstat[i] = i % 2 == 0 ? (int) SCIP_BASESTAT_LOWER : (int) SCIP_BASESTAT_UPPER;
+   }
+   mirrorBasis(cstat, rstat, othercstat, otherrstat, MAXNCOLS, MAXNROWS);
+
+   checkRoundTrip(cstat, rstat, othercstat, otherrstat);
+}
@@ -0,0 +1,225 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2021 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   linprop.c
+ * @brief  unit tests for the bound tightenings of prop_linprop
+ *
+ * All other propagators, presolving, and the propagation of the linear constraint handler are switched off, such that
+ * all bound changes in the root node are deduced by linprop.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+
+#include "include/scip_test.h"
+
+static SCIP* scip;
+
+/** setup: create SCIP, in which linprop is the only propagator */
+static
+void setup(void)
+{
+   int i;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+
+   SCIP_CALL( SCIPcreateProbBasic(scip, "linprop") );
+
+   for (i = 0; i < SCIPgetNProps(scip); ++i)
+   {
+      char paramname[SCIP_MAXSTRLEN];
+
+      (void) SCIPsnprintf(paramname, SCIP_MAXSTRLEN, "propagating/%s/freq", SCIPpropGetName(SCIPgetProps(scip)[i]));
+      SCIP_CALL( SCIPsetIntParam(scip, paramname, -1) );
+   }
+   SCIP_CALL( SCIPsetIntParam(scip, "propagating/linprop/freq", 1) );
+   SCIP_CALL( SCIPsetIntParam(scip, "constraints/linear/propfreq", -1) );
+   SCIP_CALL( SCIPsetPresolving(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetHeuristics(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetSeparating(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetLongintParam(scip, "limits/nodes", 1LL) );
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+}
+
+/** teardown: free SCIP */
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+/** creates a continuous variable without objective and adds it to the problem, which keeps it captured */
+static
+SCIP_VAR* addVar(
+   const char*           name,               /**< name of the variable */
+   SCIP_Real             lb,                 /**< lower bound of the variable */
+   SCIP_Real             ub                  /**< upper bound of the variable */
+   )
+{
+   SCIP_VAR* var;
+   SCIP_VAR* probvar;
+
+   SCIP_CALL_ABORT( SCIPcreateVarBasic(scip, &var, name, lb, ub, 0.0, SCIP_VARTYPE_CONTINUOUS) );
+   SCIP_CALL_ABORT( SCIPaddVar(scip, var) );
+
+   probvar = var;
+   SCIP_CALL_ABORT( SCIPreleaseVar(scip, &var) );
+
+   return probvar;
+}
+
+/** adds the linear constraint lhs <= vals * vars <= rhs to the problem */
+static
+void addRow(
+   SCIP_VAR**            vars,               /**< variables of the constraint */
+   SCIP_Real*            vals,               /**< coefficients of the constraint */
+   int                   nvars,              /**< number of variables */
+   SCIP_Real             lhs,                /**< left hand side */
+   SCIP_Real             rhs                 /**< right hand side */
+   )
+{
+   SCIP_CONS* cons;
+
+   SCIP_CALL_ABORT( SCIPcreateConsBasicLinear(scip, &cons, "row", nvars, vars, vals, lhs, rhs) );
+   SCIP_CALL_ABORT( SCIPaddCons(scip, cons) );
+   SCIP_CALL_ABORT( SCIPreleaseCons(scip, &cons) );
+}
+
+/** solves the root node, in which linprop tightens the global bounds */
+static
+void solveRoot(void)
+{
+   SCIP_CALL_ABORT( SCIPsolve(scip) );
+   cr_assert( SCIPgetStage(scip) == SCIP_STAGE_SOLVING || SCIPgetStage(scip) == SCIP_STAGE_SOLVED );
+}
+
+/** checks the global bounds of the transformed variable of an original variable */
+static
+void checkBounds(
+   SCIP_VAR*             var,                /**< original variable */
+   SCIP_Real             lb,                 /**< expected lower bound */
+   SCIP_Real             ub                  /**< expected upper bound */
+   )
+{
+   SCIP_VAR* transvar;
+
+   transvar = SCIPvarGetTransVar(var);
+   cr_assert_not_null(transvar);
+
+   cr_expect(SCIPisFeasEQ(scip, SCIPvarGetLbGlobal(transvar), lb), "lower bound of <%s> is %.15g instead of %.15g",
+      SCIPvarGetName(var), SCIPvarGetLbGlobal(transvar), lb);
+   cr_expect(SCIPisFeasEQ(scip, SCIPvarGetUbGlobal(transvar), ub), "upper bound of <%s> is %.15g instead of %.15g",
+      SCIPvarGetName(var), SCIPvarGetUbGlobal(transvar), ub);
+}
+
+/* TEST SUITE */
+TestSuite(linprop, .init = setup, .fini = teardown);
+
+Test(linprop, finite, .description = "rows with finite activities tighten the bounds of all their variables")
+{
+   SCIP_VAR* vars[3];
+   SCIP_Real vals[3];
+   SCIP_VAR* x;
+   SCIP_VAR* y;
+   SCIP_VAR* z;
+
+   x = addVar("x", 0.0, 10.0);
+   y = addVar("y", 0.0, 10.0);
+   z = addVar("z", 0.0, 10.0);
+
+   /* x + 2y + 3z <= 6 */
+   vars[0] = x; vars[1] = y; vars[2] = z;
+   vals[0] = 1.0; vals[1] = 2.0; vals[2] = 3.0;
+   addRow(vars, vals, 3, -SCIPinfinity(scip), 6.0);
+
+   /* x - y >= 2, which increases the minimal activity of the first row */
+   vars[0] = x; vars[1] = y;
+   vals[0] = 1.0; vals[1] = -1.0;
+   addRow(vars, vals, 2, 2.0, SCIPinfinity(scip));
+
+   solveRoot();
+
+   checkBounds(x, 2.0, 6.0);
+   checkBounds(y, 0.0, 2.0);
+   checkBounds(z, 0.0, 4.0 / 3.0);
+}
+
+Test(linprop, infinite, .description = "only the variable with the single infinite contribution is tightened")
+{
+   SCIP_VAR* vars[2];
+   SCIP_Real vals[2];
+   SCIP_VAR* u;
+   SCIP_VAR* v;
+   SCIP_VAR* w1;
+   SCIP_VAR* w2;
+   SCIP_VAR* p;
+   SCIP_VAR* q;
+
+   u = addVar("u", -SCIPinfinity(scip), 10.0);
+   v = addVar("v", 1.0, 10.0);
+   w1 = addVar("w1", -SCIPinfinity(scip), 5.0);
+   w2 = addVar("w2", -SCIPinfinity(scip), 5.0);
+   p = addVar("p", 0.0, SCIPinfinity(scip));
+   q = addVar("q", 0.0, 4.0);
+
+   /* u + v <= 3: the minimal activity has one infinite contribution, so only u <= 2 can be deduced */
+   vars[0] = u; vars[1] = v;
+   vals[0] = 1.0; vals[1] = 1.0;
+   addRow(vars, vals, 2, -SCIPinfinity(scip), 3.0);
+
+   /* w1 + w2 <= 0: two infinite contributions do not allow any deduction */
+   vars[0] = w1; vars[1] = w2;
+   addRow(vars, vals, 2, -SCIPinfinity(scip), 0.0);
+
+   /* p - q >= 1: the maximal activity has one infinite contribution, so only p >= 1 can be deduced */
+   vars[0] = p; vars[1] = q;
+   vals[0] = 1.0; vals[1] = -1.0;
+   addRow(vars, vals, 2, 1.0, SCIPinfinity(scip));
+
+   solveRoot();
+
+   checkBounds(u, -SCIPinfinity(scip), 2.0);
+   checkBounds(v, 1.0, 10.0);
+   checkBounds(w1, -SCIPinfinity(scip), 5.0);
+   checkBounds(w2, -SCIPinfinity(scip), 5.0);
+   checkBounds(p, 1.0, SCIPinfinity(scip));
+   checkBounds(q, 0.0, 4.0);
+}
+
+Test(linprop, huge, .description = "huge contributions are counted like infinite ones instead of spoiling the activity")
+{
+   SCIP_VAR* vars[2];
+   SCIP_Real vals[2];
+   SCIP_VAR* h;
+   SCIP_VAR* s;
+
+   h = addVar("h", -1e+06, 1e+06);
+   s = addVar("s", 0.0, 10.0);
+
+   /* -1e10 h + s <= 5: the contribution -1e16 of h to the minimal activity is huge, so only h >= -5e-10 is deduced */
+   vars[0] = h; vars[1] = s;
+   vals[0] = -1e+10; vals[1] = 1.0;
+   addRow(vars, vals, 2, -SCIPinfinity(scip), 5.0);
+
+   solveRoot();
+
+   checkBounds(h, -5e-10, 1e+06);
+   checkBounds(s, 0.0, 10.0);
+}
@@ -0,0 +1,326 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2021 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   boundmirror.c
+ * @brief  unit tests for the bound mirror of the transformed variables
+ *
+ * The mirrored local and global bounds of the transformed variables and of their negated variables have to coincide
+ * with the bounds of the variables whenever a node is focused or branched on, with and without net bound changes when
+ * switching between nodes, and during probing. Aggregated variables and their negations are not mirrored.
+ */
+
+#include <scip/scip.h>
+#include <scip/scipdefplugins.h>
+#include <include/scip_test.h>
+
+#define NVARS     10
+
+/* global SCIP instance, original variables, and negations of the transformed variables */
+static SCIP* scip;
+static SCIP_VAR* vars[NVARS];
+static SCIP_VAR* negvars[NVARS];
+
+/* number of checks and of mismatches in the event handler */
+static int nchecks;
+static int nmismatches;
+
+/** compares the mirrored bounds of the given variables with their local and global bounds and returns the number of
+ *  mismatches
+ */
+static
+int compareMirror(
+   SCIP_VAR**            checkvars,          /**< transformed variables */
+   int                   ncheckvars          /**< number of variables */
+   )
+{
+   SCIP_Real lbs[2 * NVARS];
+   SCIP_Real ubs[2 * NVARS];
+   SCIP_Real glblbs[2 * NVARS];
+   SCIP_Real glbubs[2 * NVARS];
+   int varindices[2 * NVARS];
+   int nmismatch = 0;
+   int i;
+
+   assert(ncheckvars <= 2 * NVARS);
+
+   for (i = 0; i < ncheckvars; ++i)
+      varindices[i] = SCIPvarGetIndex(checkvars[i]);
+
+   SCIPgetMirroredVarBoundsLocal(scip, varindices, ncheckvars, lbs, ubs);
+   SCIPgetMirroredVarBoundsGlobal(scip, varindices, ncheckvars, glblbs, glbubs);
+
+   for (i = 0; i < ncheckvars; ++i)
+   {
+      if ( lbs[i] != SCIPvarGetLbLocal(checkvars[i]) ) /*lint !e777*/
+         ++nmismatch;
+      if ( ubs[i] != SCIPvarGetUbLocal(checkvars[i]) ) /*lint !e777*/
+         ++nmismatch;
+      if ( glblbs[i] != SCIPvarGetLbGlobal(checkvars[i]) ) /*lint !e777*/
+         ++nmismatch;
+      if ( glbubs[i] != SCIPvarGetUbGlobal(checkvars[i]) ) /*lint !e777*/
+         ++nmismatch;
+   }
+
+   return nmismatch;
+}
+
+/** compares the mirrored bounds of all active variables and of the mirrored negated variables with their bounds */
+static
+int checkMirror(void)
+{
+   SCIP_VAR* checkvars[2 * NVARS];
+   int ncheckvars = 0;
+   int i;
+
+   assert(SCIPgetNVars(scip) <= NVARS);
+
+   for (i = 0; i < SCIPgetNVars(scip); ++i)
+      checkvars[ncheckvars++] = SCIPgetVars(scip)[i];
+
+   for (i = 0; i < NVARS; ++i)
+   {
+      if ( negvars[i] != NULL && SCIPisVarBoundMirrored(scip, negvars[i]) )
+         checkvars[ncheckvars++] = negvars[i];
+   }
+
+   return compareMirror(checkvars, ncheckvars);
+}
+
+/** execution method of event handler */
+static
+SCIP_DECL_EVENTEXEC(eventExecCheckmirror)
+{
+   ++nchecks;
+   nmismatches += checkMirror();
+
+   return SCIP_OKAY;
+}
+
+/** initialization method of event handler (called after problem was transformed) */
+static
+SCIP_DECL_EVENTINITSOL(eventInitsolCheckmirror)
+{
+   SCIP_CALL( SCIPcatchEvent(scip, SCIP_EVENTTYPE_NODEFOCUSED | SCIP_EVENTTYPE_NODEBRANCHED, eventhdlr, NULL, NULL) );
+
+   return SCIP_OKAY;
+}
+
+/** setup: create SCIP and a small integer program that needs branching */
+static
+void setup(void)
+{
+   SCIP_Real weights[NVARS];
+   SCIP_Real ones[NVARS];
+   SCIP_CONS* cons;
+   int i;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPincludeEventhdlrBasic(scip, NULL, "checkmirror", "compares the bound mirror with the local bounds",
+         eventExecCheckmirror, NULL) );
+   SCIP_CALL( SCIPsetEventhdlrInitsol(scip, SCIPfindEventhdlr(scip, "checkmirror"), eventInitsolCheckmirror) );
+
+   SCIP_CALL( SCIPcreateProbBasic(scip, "boundmirror") );
+   SCIP_CALL( SCIPsetObjsense(scip, SCIP_OBJSENSE_MAXIMIZE) );
+
+   for (i = 0; i < NVARS; ++i)
+   {
+      char name[SCIP_MAXSTRLEN];
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", i);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &vars[i], name, 0.0, 3.0, (SCIP_Real) (2 * i + 7), SCIP_VARTYPE_INTEGER) );
+      SCIP_CALL( SCIPaddVar(scip, vars[i]) );
+      weights[i] = (SCIP_Real) (3 * i + 11);
+      ones[i] = 1.0;
+      negvars[i] = NULL;
+   }
+
+   SCIP_CALL( SCIPcreateConsBasicLinear(scip, &cons, "capacity", NVARS, vars, weights, -SCIPinfinity(scip), 143.0) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+   SCIP_CALL( SCIPcreateConsBasicLinear(scip, &cons, "cardinality", NVARS, vars, ones, -SCIPinfinity(scip), 7.0) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+
+   SCIP_CALL( SCIPsetPresolving(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetHeuristics(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetSeparating(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetIntParam(scip, "nodeselection/breadthfirst/stdpriority", 1000000) );
+   SCIP_CALL( SCIPsetLongintParam(scip, "limits/nodes", 200LL) );
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+
+   nchecks = 0;
+   nmismatches = 0;
+}
+
+/** teardown: free SCIP */
+static
+void teardown(void)
+{
+   int i;
+
+   for (i = 0; i < NVARS; ++i)
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &vars[i]) );
+   }
+
+   SCIP_CALL( SCIPfree(&scip) );
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "Memory leak!");
+}
+
+/** transforms the problem, negates the even transformed variables, and enables the bound mirror */
+static
+void enableMirror(void)
+{
+   int i;
+
+   SCIP_CALL( SCIPtransformProb(scip) );
+
+   for (i = 0; i < NVARS; i += 2)
+   {
+      SCIP_CALL( SCIPgetNegatedVar(scip, SCIPvarGetTransVar(vars[i]), &negvars[i]) );
+   }
+
+   SCIP_CALL( SCIPenableVarBoundMirror(scip) );
+   cr_assert( SCIPisVarBoundMirrorEnabled(scip) );
+
+   for (i = 0; i < NVARS; ++i)
+   {
+      cr_expect( SCIPisVarBoundMirrored(scip, SCIPvarGetTransVar(vars[i])) );
+      cr_expect( negvars[i] == NULL || SCIPisVarBoundMirrored(scip, negvars[i]) );
+   }
+   cr_expect_eq(checkMirror(), 0);
+}
+
+/* TEST SUITE */
+TestSuite(test_boundmirror, .init = setup, .fini = teardown);
+
+Test(test_boundmirror, nodes, .description = "the bound mirror coincides with the bounds in each node")
+{
+   enableMirror();
+
+   SCIP_CALL( SCIPsolve(scip) );
+
+   /* the tree has to be large enough to switch between siblings and cousins */
+   cr_assert_gt(nchecks, 10);
+   cr_expect_eq(nmismatches, 0, "%d mirrored bounds differ from the bounds of the variables", nmismatches);
+   cr_expect_eq(checkMirror(), 0);
+}
+
+Test(test_boundmirror, netswitch, .description = "the bound mirror coincides with the bounds in each node if only net bound changes are issued")
+{
+   SCIP_CALL( SCIPsetBoolParam(scip, "nodeselection/netswitch", TRUE) );
+   enableMirror();
+
+   SCIP_CALL( SCIPsolve(scip) );
+
+   cr_assert_gt(nchecks, 10);
+   cr_expect_eq(nmismatches, 0, "%d mirrored bounds differ from the bounds of the variables", nmismatches);
+}
+
+Test(test_boundmirror, probing, .description = "the bound mirror follows the bound changes in probing and their undoing")
+{
+   SCIP_VAR* transvar;
+   SCIP_Bool cutoff;
+   int i;
+
+   enableMirror();
+
+   SCIP_CALL( SCIPsetLongintParam(scip, "limits/nodes", 1LL) );
+   SCIP_CALL( SCIPsolve(scip) );
+   cr_assert( SCIPgetStage(scip) == SCIP_STAGE_SOLVING );
+
+   /* negated variables that are created after the mirror has been enabled are mirrored as well */
+   for (i = 1; i < NVARS; i += 2)
+   {
+      SCIP_CALL( SCIPgetNegatedVar(scip, SCIPvarGetTransVar(vars[i]), &negvars[i]) );
+   }
+   cr_expect_eq(checkMirror(), 0);
+
+   SCIP_CALL( SCIPstartProbing(scip) );
+
+   SCIP_CALL( SCIPnewProbingNode(scip) );
+   transvar = SCIPvarGetTransVar(vars[NVARS - 1]);
+   SCIP_CALL( SCIPchgVarLbProbing(scip, transvar, 2.0) );
+   cr_expect_eq(checkMirror(), 0);
+
+   /* propagating the capacity constraint tightens the upper bounds of the other variables */
+   SCIP_CALL( SCIPpropagateProbing(scip, -1, &cutoff, NULL) );
+   cr_assert( !cutoff );
+   cr_expect_eq(checkMirror(), 0);
+
+   SCIP_CALL( SCIPnewProbingNode(scip) );
+   SCIP_CALL( SCIPfixVarProbing(scip, SCIPvarGetTransVar(vars[0]), 1.0) );
+   cr_expect_eq(checkMirror(), 0);
+
+   SCIP_CALL( SCIPbacktrackProbing(scip, 1) );
+   cr_expect_eq(checkMirror(), 0);
+   cr_expect_eq(SCIPvarGetLbLocal(transvar), 2.0);
+
+   SCIP_CALL( SCIPendProbing(scip) );
+   cr_expect_eq(checkMirror(), 0);
+   cr_expect_eq(SCIPvarGetLbLocal(transvar), 0.0);
+
+   /* global bound changes are mirrored as well */
+   SCIP_CALL( SCIPchgVarUbGlobal(scip, transvar, 1.0) );
+   cr_expect_eq(checkMirror(), 0);
+}
+
+Test(test_boundmirror, aggregated, .description = "aggregated variables and their negations are not mirrored")
+{
+   SCIP_VAR* aggvars[2];
+   SCIP_VAR* aggvar;
+   SCIP_VAR* activevar;
+   SCIP_Real vals[2] = {1.0, -1.0};
+   SCIP_CONS* cons;
+
+   /* the equation x0 = x1 lets presolving aggregate one of the variables after the mirror has been enabled */
+   aggvars[0] = vars[0];
+   aggvars[1] = vars[1];
+   SCIP_CALL( SCIPcreateConsBasicLinear(scip, &cons, "equal", 2, aggvars, vals, 0.0, 0.0) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+   SCIP_CALL( SCIPsetPresolving(scip, SCIP_PARAMSETTING_DEFAULT, TRUE) );
+
+   enableMirror();
+
+   SCIP_CALL( SCIPpresolve(scip) );
+
+   if ( SCIPvarGetStatus(SCIPvarGetTransVar(vars[0])) == SCIP_VARSTATUS_AGGREGATED )
+   {
+      aggvar = SCIPvarGetTransVar(vars[0]);
+      activevar = SCIPvarGetTransVar(vars[1]);
+   }
+   else
+   {
+      aggvar = SCIPvarGetTransVar(vars[1]);
+      activevar = SCIPvarGetTransVar(vars[0]);
+   }
+   cr_assert_eq(SCIPvarGetStatus(aggvar), SCIP_VARSTATUS_AGGREGATED, "presolving did not aggregate x0 or x1");
+   cr_assert( SCIPvarIsActive(activevar) );
+
+   cr_expect( !SCIPisVarBoundMirrored(scip, aggvar) );
+   cr_expect( SCIPisVarBoundMirrored(scip, activevar) );
+
+   /* the negation of x0 is only mirrored if x0 is active */
+   cr_expect_eq(SCIPisVarBoundMirrored(scip, negvars[0]), aggvar != SCIPvarGetTransVar(vars[0]));
+   cr_expect_eq(checkMirror(), 0);
+
+   SCIP_CALL( SCIPsolve(scip) );
+
+   cr_assert_gt(nchecks, 10);
+   cr_expect_eq(nmismatches, 0, "%d mirrored bounds differ from the bounds of the variables", nmismatches);
+   cr_expect( !SCIPisVarBoundMirrored(scip, aggvar) );
+}
@@ -0,0 +1,165 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2021 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   compactleaves.c
+ * @brief  unit tests for accessing the bound changes of leaves whose branching decisions are stored compactly
+ */
+
+#include <scip/scip.h>
+#include <scip/scipdefplugins.h>
+#include "scip/struct_tree.h"
+#include "scip/struct_var.h"
+#include <include/scip_test.h>
+
+#define NVARS 12
+
+/* global SCIP instance and the variables of a knapsack problem */
+static SCIP* scip;
+static SCIP_VAR* vars[NVARS];
+
+/** setup: create a knapsack problem and solve it until some leaves are open */
+static
+void setup(void)
+{
+   SCIP_CONS* cons;
+   SCIP_Real vals[NVARS];
+   int i;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "compactleaves") );
+   SCIP_CALL( SCIPsetObjsense(scip, SCIP_OBJSENSE_MAXIMIZE) );
+
+   for (i = 0; i < NVARS; ++i)
+   {
+      char name[SCIP_MAXSTRLEN];
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", i);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &vars[i], name, 0.0, 1.0, (SCIP_Real) (i + 3), SCIP_VARTYPE_BINARY) );
+      SCIP_CALL( SCIPaddVar(scip, vars[i]) );
+      vals[i] = (SCIP_Real) (2 * i + 5);
+   }
+
+   SCIP_CALL( SCIPcreateConsBasicLinear(scip, &cons, "capacity", NVARS, vars, vals, -SCIPinfinity(scip), 57.0) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+
+   /* store the branching decisions of all leaves compactly */
+   SCIP_CALL( SCIPsetRealParam(scip, "memory/compactfac", 0.0) );
+   SCIP_CALL( SCIPsetPresolving(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetHeuristics(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetSeparating(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetLongintParam(scip, "limits/nodes", 5LL) );
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+
+   SCIP_CALL( SCIPsolve(scip) );
+}
+
+/** teardown: free SCIP */
+static
+void teardown(void)
+{
+   int i;
+
+   for (i = 0; i < NVARS; ++i)
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &vars[i]) );
+   }
+
+   SCIP_CALL( SCIPfree(&scip) );
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "Memory leak!");
+}
+
+/* TEST SUITE */
+TestSuite(test_compactleaves, .init = setup, .fini = teardown);
+
+Test(test_compactleaves, domchg, .description = "the bound changes of compact leaves can be read from their domain change data")
+{
+   SCIP_NODE** leaves;
+   int nleaves;
+   int ncompact = 0;
+   int l;
+
+   cr_assert_eq(SCIPgetStatus(scip), SCIP_STATUS_NODELIMIT);
+   SCIP_CALL( SCIPgetLeaves(scip, &leaves, &nleaves) );
+   cr_assert_gt(nleaves, 0);
+
+   for (l = 0; l < nleaves; ++l)
+   {
+      SCIP_VAR* branchvars[NVARS];
+      SCIP_Real branchbounds[NVARS];
+      SCIP_BOUNDTYPE boundtypes[NVARS];
+      SCIP_DOMCHG* domchg;
+      SCIP_Bool compact;
+      int nbranchvars;
+      int nboundchgs;
+      int i;
+
+      if ( leaves[l]->domchg == NULL )
+         continue;
+
+      compact = (leaves[l]->domchg->domchgcompact.domchgtype == SCIP_DOMCHGTYPE_COMPACT);
+      if ( compact )
+         ++ncompact;
+
+      /* the branching decisions are decoded without expanding the compact data */
+      SCIPnodeGetParentBranchings(leaves[l], branchvars, branchbounds, boundtypes, &nbranchvars, NVARS);
+      cr_assert_leq(nbranchvars, NVARS);
+
+      /* getting the domain change data does not change it */
+      domchg = SCIPnodeGetDomchg(leaves[l]);
+      cr_expect_eq(domchg->domchgbound.domchgtype == SCIP_DOMCHGTYPE_COMPACT, compact);
+
+      /* the domain change data has to be expanded before its bound changes are accessed */
+      SCIP_CALL( SCIPexpandNodeDomchg(scip, leaves[l]) );
+      domchg = SCIPnodeGetDomchg(leaves[l]);
+      cr_assert_neq(domchg->domchgbound.domchgtype, SCIP_DOMCHGTYPE_COMPACT);
+
+      nboundchgs = SCIPdomchgGetNBoundchgs(domchg);
+      cr_expect_eq(nboundchgs, nbranchvars);
+
+      for (i = 0; i < nboundchgs && i < nbranchvars; ++i)
+      {
+         SCIP_BOUNDCHG* boundchg;
+
+         boundchg = SCIPdomchgGetBoundchg(domchg, i);
+         cr_expect_eq(SCIPboundchgGetBoundchgtype(boundchg), SCIP_BOUNDCHGTYPE_BRANCHING);
+         cr_expect_eq(SCIPboundchgGetVar(boundchg), branchvars[i]);
+         cr_expect_eq(SCIPboundchgGetBoundtype(boundchg), boundtypes[i]);
+         cr_expect(SCIPisEQ(scip, SCIPboundchgGetNewbound(boundchg), branchbounds[i]));
+      }
+   }
+
+   /* otherwise, the test does not cover compact leaves */
+   cr_expect_gt(ncompact, 0);
+}
+
+Test(test_compactleaves, resolve, .description = "leaves whose compact data has been expanded can be solved")
+{
+   SCIP_NODE** leaves;
+   int nleaves;
+   int l;
+
+   SCIP_CALL( SCIPgetLeaves(scip, &leaves, &nleaves) );
+   for (l = 0; l < nleaves; ++l)
+   {
+      SCIP_CALL( SCIPexpandNodeDomchg(scip, leaves[l]) );
+   }
+
+   SCIP_CALL( SCIPsetLongintParam(scip, "limits/nodes", -1LL) );
+   SCIP_CALL( SCIPsolve(scip) );
+
+   cr_expect_eq(SCIPgetStatus(scip), SCIP_STATUS_OPTIMAL);
+}
@@ -0,0 +1,293 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2021 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   eventbatch.c
+ * @brief  unit tests for the batched delivery of local bound change events during propagation
+ *
+ * A propagator fixes several variables in one call. An event handler with batched execution method has to receive
+ * the bound changes of this call in one delivery at its end, while an event handler without batched execution method
+ * has to receive them one by one. Both have to see the same events in the same order.
+ */
+
+#include <scip/scip.h>
+#include <scip/scipdefplugins.h>
+#include <include/scip_test.h>
+
+#define NVARS          8
+#define NFIXED         5
+#define MAXEVENTS      1000
+
+/** data of an event handler that records the local upper bound changes it receives */
+struct SCIP_EventhdlrData
+{
+   int                   varindices[MAXEVENTS]; /**< indices of the variables of the received events */
+   SCIP_Real             newbounds[MAXEVENTS];  /**< new bounds of the received events */
+   int                   nevents;               /**< number of received events */
+   int                   deliverysizes[MAXEVENTS]; /**< number of events of each call of an execution method */
+   SCIP_Bool             deliverybatched[MAXEVENTS]; /**< was the call a call of the batched execution method? */
+   int                   ndeliveries;           /**< number of calls of the execution methods */
+};
+
+/* global SCIP instance and data of the event handlers */
+static SCIP* scip;
+static SCIP_EVENTHDLRDATA batchdata;
+static SCIP_EVENTHDLRDATA singledata;
+
+/* variables fixed to 0 by the propagator, in this order, and the number of calls of the propagator */
+static const int fixorder[NFIXED] = {4, 2, 0, 6, 1};
+static int npropcalls;
+
+/** records a local upper bound change event */
+static
+void recordEvent(
+   SCIP_EVENTHDLRDATA*   eventhdlrdata,      /**< event handler data */
+   SCIP_EVENT*           event               /**< event */
+   )
+{
+   if ( eventhdlrdata->nevents >= MAXEVENTS )
+      return;
+
+   eventhdlrdata->varindices[eventhdlrdata->nevents] = SCIPvarGetProbindex(SCIPeventGetVar(event));
+   eventhdlrdata->newbounds[eventhdlrdata->nevents] = SCIPeventGetNewbound(event);
+   ++eventhdlrdata->nevents;
+}
+
+/** records a call of an execution method */
+static
+void recordDelivery(
+   SCIP_EVENTHDLRDATA*   eventhdlrdata,      /**< event handler data */
+   int                   nevents,            /**< number of events of the call */
+   SCIP_Bool             batched             /**< is it a call of the batched execution method? */
+   )
+{
+   if ( eventhdlrdata->ndeliveries >= MAXEVENTS )
+      return;
+
+   eventhdlrdata->deliverysizes[eventhdlrdata->ndeliveries] = nevents;
+   eventhdlrdata->deliverybatched[eventhdlrdata->ndeliveries] = batched;
+   ++eventhdlrdata->ndeliveries;
+}
+
+/** execution method of both event handlers */
+static
+SCIP_DECL_EVENTEXEC(eventExecRecord)
+{
+   SCIP_EVENTHDLRDATA* eventhdlrdata;
+
+   eventhdlrdata = SCIPeventhdlrGetData(eventhdlr);
+
+   recordDelivery(eventhdlrdata, 1, FALSE);
+   recordEvent(eventhdlrdata, event);
+
+   return SCIP_OKAY;
+}
+
+/** batched execution method of the batching event handler */
+static
+SCIP_DECL_EVENTEXECBATCH(eventExecBatchRecord)
+{
+   SCIP_EVENTHDLRDATA* eventhdlrdata;
+   int i;
+
+   eventhdlrdata = SCIPeventhdlrGetData(eventhdlr);
+
+   recordDelivery(eventhdlrdata, nevents, TRUE);
+   for (i = 0; i < nevents; ++i)
+      recordEvent(eventhdlrdata, events[i]);
+
+   return SCIP_OKAY;
+}
+
+/** solving process initialization method of both event handlers: catches upper bound changes of all variables */
+static
+SCIP_DECL_EVENTINITSOL(eventInitsolRecord)
+{
+   int i;
+
+   for (i = 0; i < SCIPgetNVars(scip); ++i)
+   {
+      SCIP_CALL( SCIPcatchVarEvent(scip, SCIPgetVars(scip)[i], SCIP_EVENTTYPE_UBTIGHTENED, eventhdlr, NULL, NULL) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** solving process deinitialization method of both event handlers: drops the events */
+static
+SCIP_DECL_EVENTEXITSOL(eventExitsolRecord)
+{
+   int i;
+
+   for (i = 0; i < SCIPgetNVars(scip); ++i)
+   {
+      SCIP_CALL( SCIPdropVarEvent(scip, SCIPgetVars(scip)[i], SCIP_EVENTTYPE_UBTIGHTENED, eventhdlr, NULL, -1) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** execution method of propagator: fixes several variables to 0 in its first call */
+static
+SCIP_DECL_PROPEXEC(propExecFix)
+{
+   SCIP_Bool infeasible;
+   SCIP_Bool tightened;
+   int i;
+
+   *result = SCIP_DIDNOTFIND;
+
+   if ( npropcalls++ > 0 )
+      return SCIP_OKAY;
+
+   for (i = 0; i < NFIXED; ++i)
+   {
+      SCIP_CALL( SCIPtightenVarUb(scip, SCIPgetVars(scip)[fixorder[i]], 0.0, FALSE, &infeasible, &tightened) );
+      cr_assert(tightened && !infeasible);
+   }
+
+   *result = SCIP_REDUCEDDOM;
+
+   return SCIP_OKAY;
+}
+
+/** includes an event handler that records the events it receives */
+static
+void includeRecordEventhdlr(
+   const char*           name,               /**< name of event handler */
+   SCIP_EVENTHDLRDATA*   eventhdlrdata,      /**< event handler data */
+   SCIP_Bool             batched             /**< should the event handler have a batched execution method? */
+   )
+{
+   SCIP_EVENTHDLR* eventhdlr;
+
+   SCIP_CALL_ABORT( SCIPincludeEventhdlrBasic(scip, &eventhdlr, name, "records local upper bound changes",
+         eventExecRecord, eventhdlrdata) );
+   SCIP_CALL_ABORT( SCIPsetEventhdlrInitsol(scip, eventhdlr, eventInitsolRecord) );
+   SCIP_CALL_ABORT( SCIPsetEventhdlrExitsol(scip, eventhdlr, eventExitsolRecord) );
+
+   if ( batched )
+   {
+      SCIP_CALL_ABORT( SCIPsetEventhdlrExecBatch(scip, eventhdlr, eventExecBatchRecord) );
+   }
+}
+
+/** setup: create SCIP with the recording event handlers, the fixing propagator, and a problem without constraints,
+ *  whose optimal solution is zero, such that the fixings of the propagator are valid
+ */
+static
+void setup(void)
+{
+   SCIP_PROP* prop;
+   int i;
+
+   BMSclearMemory(&batchdata);
+   BMSclearMemory(&singledata);
+   npropcalls = 0;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   includeRecordEventhdlr("batch", &batchdata, TRUE);
+   includeRecordEventhdlr("single", &singledata, FALSE);
+   SCIP_CALL( SCIPincludePropBasic(scip, &prop, "fix", "fixes several variables in one call", 1000000, 1, FALSE,
+         SCIP_PROPTIMING_BEFORELP, propExecFix, NULL) );
+
+   SCIP_CALL( SCIPcreateProbBasic(scip, "eventbatch") );
+
+   for (i = 0; i < NVARS; ++i)
+   {
+      SCIP_VAR* var;
+      char name[SCIP_MAXSTRLEN];
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", i);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &var, name, 0.0, 1.0, 1.0 + i, SCIP_VARTYPE_BINARY) );
+      SCIP_CALL( SCIPaddVar(scip, var) );
+      SCIP_CALL( SCIPreleaseVar(scip, &var) );
+   }
+
+   /* keep the variables for the propagator and do not solve LPs */
+   SCIP_CALL( SCIPsetPresolving(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetIntParam(scip, "propagating/dualfix/freq", -1) );
+   SCIP_CALL( SCIPsetHeuristics(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetIntParam(scip, "lp/solvefreq", -1) );
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+}
+
+/** teardown: free SCIP */
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+/* TEST SUITE */
+TestSuite(eventbatch, .init = setup, .fini = teardown);
+
+Test(eventbatch, coalesced, .description = "a batching event handler receives the bound changes of a propagator call in one delivery")
+{
+   int i;
+
+   SCIP_CALL( SCIPsolve(scip) );
+
+   cr_assert_eq(SCIPgetStatus(scip), SCIP_STATUS_OPTIMAL);
+   cr_assert_gt(npropcalls, 0);
+
+   /* the first delivery contains all fixings of the propagator in the order in which they occurred */
+   cr_assert_geq(batchdata.ndeliveries, 1);
+   cr_expect(batchdata.deliverybatched[0], "bound changes of the propagator were not delivered as a batch");
+   cr_assert_eq(batchdata.deliverysizes[0], NFIXED, "%d events delivered at once instead of %d",
+      batchdata.deliverysizes[0], NFIXED);
+
+   for (i = 0; i < NFIXED; ++i)
+   {
+      cr_expect_eq(batchdata.varindices[i], fixorder[i], "event %d belongs to variable %d instead of %d", i,
+         batchdata.varindices[i], fixorder[i]);
+      cr_expect_eq(batchdata.newbounds[i], 0.0);
+   }
+}
+
+Test(eventbatch, individual, .description = "an event handler without batched execution method receives the bound changes one by one in the same order")
+{
+   int i;
+
+   SCIP_CALL( SCIPsolve(scip) );
+
+   cr_assert_eq(SCIPgetStatus(scip), SCIP_STATUS_OPTIMAL);
+
+   /* the fixings of the propagator are delivered one by one */
+   cr_assert_geq(singledata.ndeliveries, NFIXED);
+   for (i = 0; i < singledata.ndeliveries; ++i)
+   {
+      cr_expect(!singledata.deliverybatched[i]);
+      cr_expect_eq(singledata.deliverysizes[i], 1);
+   }
+
+   for (i = 0; i < NFIXED; ++i)
+   {
+      cr_expect_eq(singledata.varindices[i], fixorder[i], "event %d belongs to variable %d instead of %d", i,
+         singledata.varindices[i], fixorder[i]);
+      cr_expect_eq(singledata.newbounds[i], 0.0);
+   }
+
+   /* both event handlers have seen the same events in the same order during the whole solve */
+   cr_assert_lt(batchdata.nevents, MAXEVENTS);
+   cr_assert_eq(batchdata.nevents, singledata.nevents);
+   for (i = 0; i < singledata.nevents; ++i)
+   {
+      cr_expect_eq(batchdata.varindices[i], singledata.varindices[i], "event %d differs", i);
+      cr_expect_eq(batchdata.newbounds[i], singledata.newbounds[i], "event %d differs", i);
+   }
+}
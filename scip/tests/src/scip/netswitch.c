@@ -0,0 +1,222 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2021 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   netswitch.c
+ * @brief  unit tests for the bound change events that are issued when switching between nodes
+ *
+ * An event handler tracks the local bounds of all variables from bound change events only. Whenever a node is focused,
+ * these bounds have to coincide with the local bounds of the variables, with and without nodeselection/netswitch. The
+ * breadth first node selection switches between siblings and cousins.
+ */
+
+#include <scip/scip.h>
+#include <scip/scipdefplugins.h>
+#include <include/scip_test.h>
+
+#define NVARS     10
+#define MAXNODES  1000
+
+/** bounds of all variables seen by the event handler when the nodes were focused */
+struct FocusData
+{
+   SCIP_Real             lbs[MAXNODES][NVARS];  /**< lower bounds seen by the event handler in each node */
+   SCIP_Real             ubs[MAXNODES][NVARS];  /**< upper bounds seen by the event handler in each node */
+   SCIP_Bool             focused[MAXNODES];     /**< was the node focused? */
+   int                   nfocused;              /**< number of focused nodes */
+   int                   nmismatches;           /**< number of bounds that differed from the local bounds in a focused node */
+};
+typedef struct FocusData FOCUSDATA;
+
+/* bounds seen by the event handler */
+static SCIP_Real eventlbs[NVARS];
+static SCIP_Real eventubs[NVARS];
+
+/* focus data of the current solve */
+static FOCUSDATA* focusdata;
+
+/* focus data of the solves with and without net bound changes */
+static FOCUSDATA netdata;
+static FOCUSDATA fulldata;
+
+/** initialization method of event handler (called after problem was transformed) */
+static
+SCIP_DECL_EVENTINITSOL(eventInitsolTrackbounds)
+{
+   SCIP_VAR** vars;
+   int i;
+
+   assert(SCIPgetNVars(scip) == NVARS);
+
+   vars = SCIPgetVars(scip);
+   for (i = 0; i < NVARS; ++i)
+   {
+      eventlbs[i] = SCIPvarGetLbLocal(vars[i]);
+      eventubs[i] = SCIPvarGetUbLocal(vars[i]);
+      SCIP_CALL( SCIPcatchVarEvent(scip, vars[i], SCIP_EVENTTYPE_BOUNDCHANGED, eventhdlr, NULL, NULL) );
+   }
+   SCIP_CALL( SCIPcatchEvent(scip, SCIP_EVENTTYPE_NODEFOCUSED, eventhdlr, NULL, NULL) );
+
+   return SCIP_OKAY;
+}
+
+/** execution method of event handler */
+static
+SCIP_DECL_EVENTEXEC(eventExecTrackbounds)
+{
+   SCIP_VAR** vars;
+   SCIP_Longint number;
+   int i;
+
+   if( SCIPeventGetType(event) != SCIP_EVENTTYPE_NODEFOCUSED )
+   {
+      i = SCIPvarGetProbindex(SCIPeventGetVar(event));
+      assert(0 <= i && i < NVARS);
+
+      if( (SCIPeventGetType(event) & SCIP_EVENTTYPE_LBCHANGED) != 0 )
+         eventlbs[i] = SCIPeventGetNewbound(event);
+      else
+         eventubs[i] = SCIPeventGetNewbound(event);
+
+      return SCIP_OKAY;
+   }
+
+   number = SCIPnodeGetNumber(SCIPgetFocusNode(scip));
+   ++focusdata->nfocused;
+
+   vars = SCIPgetVars(scip);
+   for (i = 0; i < NVARS; ++i)
+   {
+      if( !SCIPisEQ(scip, eventlbs[i], SCIPvarGetLbLocal(vars[i])) )
+         ++focusdata->nmismatches;
+      if( !SCIPisEQ(scip, eventubs[i], SCIPvarGetUbLocal(vars[i])) )
+         ++focusdata->nmismatches;
+   }
+
+   if( number < MAXNODES )
+   {
+      focusdata->focused[number] = TRUE;
+      BMScopyMemoryArray(focusdata->lbs[number], eventlbs, NVARS);
+      BMScopyMemoryArray(focusdata->ubs[number], eventubs, NVARS);
+   }
+
+   return SCIP_OKAY;
+}
+
+/** solves a small integer program with breadth first search and records the bounds in the focused nodes */
+static
+void solveAndRecord(
+   SCIP_Bool             netswitch,          /**< should only net bound changes be issued when switching paths? */
+   FOCUSDATA*            data                /**< focus data to fill */
+   )
+{
+   SCIP* scip;
+   SCIP_VAR* vars[NVARS];
+   SCIP_Real weights[NVARS];
+   SCIP_Real ones[NVARS];
+   SCIP_CONS* cons;
+   int i;
+
+   BMSclearMemory(data);
+   focusdata = data;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPincludeEventhdlrBasic(scip, NULL, "trackbounds", "tracks the local bounds from bound change events",
+         eventExecTrackbounds, NULL) );
+   SCIP_CALL( SCIPsetEventhdlrInitsol(scip, SCIPfindEventhdlr(scip, "trackbounds"), eventInitsolTrackbounds) );
+
+   SCIP_CALL( SCIPcreateProbBasic(scip, "netswitch") );
+   SCIP_CALL( SCIPsetObjsense(scip, SCIP_OBJSENSE_MAXIMIZE) );
+
+   for (i = 0; i < NVARS; ++i)
+   {
+      char name[SCIP_MAXSTRLEN];
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", i);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &vars[i], name, 0.0, 3.0, (SCIP_Real) (2 * i + 7), SCIP_VARTYPE_INTEGER) );
+      SCIP_CALL( SCIPaddVar(scip, vars[i]) );
+      weights[i] = (SCIP_Real) (3 * i + 11);
+      ones[i] = 1.0;
+   }
+
+   SCIP_CALL( SCIPcreateConsBasicLinear(scip, &cons, "capacity", NVARS, vars, weights, -SCIPinfinity(scip), 143.0) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+   SCIP_CALL( SCIPcreateConsBasicLinear(scip, &cons, "cardinality", NVARS, vars, ones, -SCIPinfinity(scip), 7.0) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+
+   SCIP_CALL( SCIPsetBoolParam(scip, "nodeselection/netswitch", netswitch) );
+   SCIP_CALL( SCIPsetIntParam(scip, "nodeselection/breadthfirst/stdpriority", 1000000) );
+   SCIP_CALL( SCIPsetPresolving(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetHeuristics(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetSeparating(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetLongintParam(scip, "limits/nodes", 200LL) );
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+
+   SCIP_CALL( SCIPsolve(scip) );
+
+   for (i = 0; i < NVARS; ++i)
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &vars[i]) );
+   }
+   SCIP_CALL( SCIPfree(&scip) );
+
+   focusdata = NULL;
+}
+
+/** teardown: check for memory leaks */
+static
+void teardown(void)
+{
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "Memory leak!");
+}
+
+/* TEST SUITE */
+TestSuite(test_netswitch, .fini = teardown);
+
+Test(test_netswitch, bounds, .description = "event handlers see the same bounds in each node with and without net bound changes")
+{
+   int ncommon = 0;
+   int n;
+
+   solveAndRecord(TRUE, &netdata);
+   solveAndRecord(FALSE, &fulldata);
+
+   /* the tree has to be large enough to switch between siblings and cousins */
+   cr_assert_gt(netdata.nfocused, 10);
+   cr_assert_gt(fulldata.nfocused, 10);
+
+   cr_expect_eq(netdata.nmismatches, 0, "%d bounds differ from the local bounds with netswitch", netdata.nmismatches);
+   cr_expect_eq(fulldata.nmismatches, 0, "%d bounds differ from the local bounds without netswitch", fulldata.nmismatches);
+
+   for (n = 0; n < MAXNODES; ++n)
+   {
+      int i;
+
+      if( !netdata.focused[n] || !fulldata.focused[n] )
+         continue;
+
+      ++ncommon;
+      for (i = 0; i < NVARS; ++i)
+      {
+         cr_expect_eq(netdata.lbs[n][i], fulldata.lbs[n][i], "node %d: lb of x%d differs: %g vs. %g", n, i,
+            netdata.lbs[n][i], fulldata.lbs[n][i]);
+         cr_expect_eq(netdata.ubs[n][i], fulldata.ubs[n][i], "node %d: ub of x%d differs: %g vs. %g", n, i,
+            netdata.ubs[n][i], fulldata.ubs[n][i]);
+      }
+   }
+   cr_expect_gt(ncommon, 10);
+}
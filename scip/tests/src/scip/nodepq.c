@@ -0,0 +1,326 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2021 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   nodepq.c
+ * @brief  unit tests for the node priority queue, whose node selector order and lower bound order are 4-ary heaps
+ *
+ * The queue is checked against reference orders of the nodes after insertions, deletions of arbitrary nodes, and
+ * bounding. The estimate node selector is used, so that the two orders of the queue differ.
+ */
+
+#include <scip/scip.h>
+#include <scip/scipdefplugins.h>
+#include "scip/nodesel.c"
+#include "scip/struct_mem.h"
+#include "scip/struct_tree.h"
+#include <include/scip_test.h>
+
+#define NNODES  200
+#define NVARS   12
+
+/* global SCIP instance, node priority queue, and nodes that are not part of a tree */
+static SCIP* scip;
+static SCIP_NODEPQ* nodepq;
+static SCIP_NODE nodes[NNODES];
+static int byestimate[NNODES];
+static int bylowerbound[NNODES];
+
+/** checks both heaps of the queue and the links between them */
+static
+void checkHeaps(
+   SCIP_NODEPQ*          pq                  /**< node priority queue */
+   )
+{
+   int pos;
+
+   for (pos = 0; pos < pq->len; ++pos)
+   {
+      int bfspos;
+
+      if ( pos > 0 )
+      {
+         cr_assert_leq(SCIPnodepqCompare(pq, scip->set, pq->slots[PQ_PARENT(pos)], pq->slots[pos]), 0,
+            "node selector order is violated at slot %d", pos);
+      }
+
+      bfspos = pq->bfsposs[pos];
+      cr_assert(0 <= bfspos && bfspos < pq->len);
+      cr_assert_eq(pq->bfsqueue[bfspos], pos, "bfs position of slot %d is not linked back", pos);
+      cr_assert_eq(pq->bfslowerbounds[bfspos], SCIPnodeGetLowerbound(pq->slots[pos]));
+
+      if ( pos > 0 )
+      {
+         cr_assert_leq(pq->bfslowerbounds[PQ_PARENT(pos)], pq->bfslowerbounds[pos],
+            "lower bound order is violated at bfs position %d", pos);
+      }
+   }
+}
+
+/** checks the best nodes of both orders and the lower bound sum against the nodes that have not been removed */
+static
+void checkFirst(
+   SCIP_Bool*            removed             /**< array to mark the removed nodes */
+   )
+{
+   SCIP_Real lowerboundsum = 0.0;
+   int len = 0;
+   int k;
+   int i;
+
+   for (i = 0; i < NNODES; ++i)
+   {
+      if ( !removed[i] )
+      {
+         lowerboundsum += SCIPnodeGetLowerbound(&nodes[i]);
+         ++len;
+      }
+   }
+
+   cr_assert_eq(SCIPnodepqLen(nodepq), len);
+   cr_assert_float_eq(SCIPnodepqGetLowerboundSum(nodepq), lowerboundsum, 1e-6);
+
+   if ( len == 0 )
+   {
+      cr_assert_null(SCIPnodepqFirst(nodepq));
+      cr_assert_null(SCIPnodepqGetLowerboundNode(nodepq, scip->set));
+      return;
+   }
+
+   for (k = 0; removed[byestimate[k]]; ++k)
+   {}
+   cr_assert_eq(SCIPnodepqFirst(nodepq), &nodes[byestimate[k]]);
+
+   for (k = 0; removed[bylowerbound[k]]; ++k)
+   {}
+   cr_assert_eq(SCIPnodepqGetLowerboundNode(nodepq, scip->set), &nodes[bylowerbound[k]]);
+   cr_assert_eq(SCIPnodepqGetLowerbound(nodepq, scip->set), SCIPnodeGetLowerbound(&nodes[bylowerbound[k]]));
+}
+
+/** setup: create SCIP, an empty node priority queue, and leaves with distinct estimates and lower bounds */
+static
+void setup(void)
+{
+   int i;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPnodepqCreate(&nodepq, scip->set, SCIPfindNodesel(scip, "estimate")) );
+
+   /* the estimates and lower bounds are two different permutations of 0, ..., NNODES-1 */
+   BMSclearMemoryArray(nodes, NNODES);
+   for (i = 0; i < NNODES; ++i)
+   {
+      nodes[i].number = i;
+      nodes[i].depth = 1;
+      nodes[i].nodetype = SCIP_NODETYPE_LEAF; /*lint !e641*/
+      nodes[i].estimate = (SCIP_Real) ((37 * i) % NNODES);
+      nodes[i].lowerbound = (SCIP_Real) ((61 * i) % NNODES);
+
+      byestimate[(37 * i) % NNODES] = i;
+      bylowerbound[(61 * i) % NNODES] = i;
+   }
+}
+
+/** teardown: free the queue, but not the nodes, and SCIP */
+static
+void teardown(void)
+{
+   if ( nodepq != NULL )
+      SCIPnodepqDestroy(&nodepq);
+
+   SCIP_CALL( SCIPfree(&scip) );
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "Memory leak!");
+}
+
+/* TEST SUITE */
+TestSuite(test_nodepq, .init = setup, .fini = teardown);
+
+Test(test_nodepq, insert, .description = "the best nodes of both orders are found after every insertion")
+{
+   SCIP_Bool removed[NNODES];
+   int i;
+
+   for (i = 0; i < NNODES; ++i)
+      removed[i] = TRUE;
+
+   checkFirst(removed);
+
+   for (i = 0; i < NNODES; ++i)
+   {
+      SCIP_CALL( SCIPnodepqInsert(nodepq, scip->set, &nodes[i]) );
+      removed[i] = FALSE;
+
+      checkHeaps(nodepq);
+      checkFirst(removed);
+   }
+}
+
+Test(test_nodepq, remove, .description = "the best nodes of both orders are found after removing arbitrary nodes")
+{
+   SCIP_Bool removed[NNODES];
+   int i;
+
+   for (i = 0; i < NNODES; ++i)
+   {
+      SCIP_CALL( SCIPnodepqInsert(nodepq, scip->set, &nodes[i]) );
+      removed[i] = FALSE;
+   }
+
+   /* remove the nodes in an order that is unrelated to both orders of the queue */
+   for (i = 0; i < NNODES; ++i)
+   {
+      int n = (53 * i + 7) % NNODES;
+
+      SCIP_CALL( SCIPnodepqRemove(nodepq, scip->set, &nodes[n]) );
+      removed[n] = TRUE;
+
+      checkHeaps(nodepq);
+      checkFirst(removed);
+   }
+
+   /* a node that is not in the queue cannot be removed */
+   SCIPmessageSetErrorPrinting(NULL, NULL);
+   cr_expect_eq(SCIPnodepqRemove(nodepq, scip->set, &nodes[0]), SCIP_INVALIDDATA);
+   SCIPmessageSetErrorPrintingDefault();
+}
+
+Test(test_nodepq, sorted, .description = "taking the best node repeatedly returns the nodes in the node selector order")
+{
+   int k;
+   int i;
+
+   for (i = 0; i < NNODES; ++i)
+   {
+      SCIP_CALL( SCIPnodepqInsert(nodepq, scip->set, &nodes[i]) );
+   }
+
+   for (k = 0; k < NNODES; ++k)
+   {
+      SCIP_NODE* node;
+
+      node = SCIPnodepqFirst(nodepq);
+      cr_assert_eq(node, &nodes[byestimate[k]], "node %d is taken at position %d", (int) node->number, k);
+
+      SCIP_CALL( SCIPnodepqRemove(nodepq, scip->set, node) );
+      checkHeaps(nodepq);
+   }
+
+   cr_expect_eq(SCIPnodepqLen(nodepq), 0);
+}
+
+Test(test_nodepq, bound, .description = "bounding keeps exactly the leaves below the cutoff bound in a valid queue")
+{
+   SCIP_CONS* cons;
+   SCIP_VAR* vars[NVARS];
+   SCIP_NODE** leaves;
+   SCIP_NODE** kept;
+   SCIP_NODEPQ* leafpq;
+   SCIP_Real vals[NVARS];
+   SCIP_Real lowerboundsum;
+   int nleaves;
+   int nkept;
+   int l;
+   int i;
+
+   /* this test uses the leaves of a tree instead of the nodes above, since bounding frees the cut off nodes */
+   SCIPnodepqDestroy(&nodepq);
+
+   SCIP_CALL( SCIPcreateProbBasic(scip, "nodepq") );
+   SCIP_CALL( SCIPsetObjsense(scip, SCIP_OBJSENSE_MAXIMIZE) );
+
+   for (i = 0; i < NVARS; ++i)
+   {
+      char name[SCIP_MAXSTRLEN];
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", i);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &vars[i], name, 0.0, 1.0, (SCIP_Real) (i + 3), SCIP_VARTYPE_BINARY) );
+      SCIP_CALL( SCIPaddVar(scip, vars[i]) );
+      vals[i] = (SCIP_Real) (2 * i + 5);
+   }
+
+   SCIP_CALL( SCIPcreateConsBasicLinear(scip, &cons, "capacity", NVARS, vars, vals, -SCIPinfinity(scip), 57.0) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+
+   for (i = 0; i < NVARS; ++i)
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &vars[i]) );
+   }
+
+   SCIP_CALL( SCIPsetPresolving(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetHeuristics(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetSeparating(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetCharParam(scip, "nodeselection/childsel", 'd') );
+   SCIP_CALL( SCIPsetLongintParam(scip, "limits/nodes", 10LL) );
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+
+   SCIP_CALL( SCIPsolve(scip) );
+   cr_assert_eq(SCIPgetStatus(scip), SCIP_STATUS_NODELIMIT);
+
+   leafpq = scip->tree->leaves;
+   nleaves = SCIPnodepqLen(leafpq);
+   cr_assert_geq(nleaves, 4, "the test needs more open leaves");
+
+   /* give the leaves distinct lower bounds in the opposite order of their estimates; they are reinserted, since the queue stores the lower bounds */
+   SCIP_CALL( SCIPallocBufferArray(scip, &leaves, nleaves) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &kept, nleaves) );
+   BMScopyMemoryArray(leaves, SCIPnodepqNodes(leafpq), nleaves);
+
+   for (l = 0; l < nleaves; ++l)
+   {
+      SCIP_CALL( SCIPnodepqRemove(leafpq, scip->set, leaves[l]) );
+   }
+
+   for (l = 0; l < nleaves; ++l)
+   {
+      leaves[l]->lowerbound = (SCIP_Real) (10 * (nleaves - 1 - l));
+      leaves[l]->estimate = (SCIP_Real) (10 * l);
+      SCIP_CALL( SCIPnodepqInsert(leafpq, scip->set, leaves[l]) );
+   }
+
+   /* remember the leaves below the cutoff bound, which cuts off the upper half of the lower bounds */
+   nkept = 0;
+   lowerboundsum = 0.0;
+   for (l = 0; l < nleaves; ++l)
+   {
+      if ( nleaves - 1 - l < nleaves / 2 )
+      {
+         kept[nkept++] = leaves[l];
+         lowerboundsum += leaves[l]->lowerbound;
+      }
+   }
+
+   SCIP_CALL( SCIPnodepqBound(leafpq, scip->mem->probmem, scip->set, scip->stat, scip->eventfilter, scip->eventqueue,
+         scip->tree, scip->reopt, scip->lp, 10.0 * (nleaves / 2) - 5.0) );
+
+   cr_assert_eq(SCIPnodepqLen(leafpq), nkept);
+   cr_assert_float_eq(SCIPnodepqGetLowerboundSum(leafpq), lowerboundsum, 1e-6);
+   cr_assert_eq(SCIPnodepqGetLowerbound(leafpq, scip->set), 0.0);
+
+   for (l = 0; l < nkept; ++l)
+   {
+      SCIP_Bool found = FALSE;
+
+      for (i = 0; i < nkept && !found; ++i)
+         found = (SCIPnodepqNodes(leafpq)[i] == kept[l]);
+
+      cr_assert(found, "leaf %d below the cutoff bound was removed", l);
+   }
+
+   checkHeaps(leafpq);
+
+   SCIPfreeBufferArray(scip, &kept);
+   SCIPfreeBufferArray(scip, &leaves);
+}
@@ -0,0 +1,229 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2021 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   activationcopy.c
+ * @brief  unit tests for copying orbitopes together with their activation handlers
+ */
+
+#include <scip/scip.h>
+#include <scip/scipdefplugins.h>
+#include <scip/cons_orbitope.h>
+#include <scip/pub_activation.h>
+#include <include/scip_test.h>
+
+#define NROWS 3
+#define NCOLS 2
+
+/* global SCIP instances, the variable matrix, and the orbitope on it */
+static SCIP* scip;
+static SCIP* targetscip;
+static SCIP_VAR* vars[NROWS][NCOLS];
+static SCIP_CONS* orbitope;
+
+/** setup: create SCIP and an orbitope on a matrix of binary variables */
+static
+void setup(void)
+{
+   SCIP_VAR** matrix[NROWS];
+   int i;
+   int j;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPsetIntParam(scip, "misc/usesymmetry", 0) );
+
+   SCIP_CALL( SCIPcreateProbBasic(scip, "activationcopy") );
+
+   for (i = 0; i < NROWS; ++i)
+   {
+      for (j = 0; j < NCOLS; ++j)
+      {
+         char name[SCIP_MAXSTRLEN];
+
+         (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x_%d_%d", i, j);
+         SCIP_CALL( SCIPcreateVarBasic(scip, &vars[i][j], name, 0.0, 1.0, 0.0, SCIP_VARTYPE_BINARY) );
+         SCIP_CALL( SCIPaddVar(scip, vars[i][j]) );
+      }
+      matrix[i] = vars[i];
+   }
+
+   SCIP_CALL( SCIPcreateConsOrbitope(scip, &orbitope, "orbitope", matrix, SCIP_ORBITOPETYPE_FULL, NROWS, NCOLS,
+         FALSE, FALSE, FALSE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, FALSE, FALSE, FALSE, FALSE, FALSE) );
+   SCIP_CALL( SCIPaddCons(scip, orbitope) );
+
+   targetscip = NULL;
+}
+
+/** teardown: free the SCIP instances */
+static
+void teardown(void)
+{
+   int i;
+   int j;
+
+   if( targetscip != NULL )
+   {
+      SCIP_CALL( SCIPfree(&targetscip) );
+   }
+
+   SCIP_CALL( SCIPreleaseCons(scip, &orbitope) );
+
+   for (i = 0; i < NROWS; ++i)
+   {
+      for (j = 0; j < NCOLS; ++j)
+      {
+         SCIP_CALL( SCIPreleaseVar(scip, &vars[i][j]) );
+      }
+   }
+
+   SCIP_CALL( SCIPfree(&scip) );
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "Memory leak!");
+}
+
+/** returns the orbitope of the target SCIP, or NULL if there is none */
+static
+SCIP_CONS* getTargetOrbitope(void)
+{
+   SCIP_CONS** conss;
+   SCIP_CONS* cons = NULL;
+   int c;
+
+   conss = SCIPgetConss(targetscip);
+
+   for (c = 0; c < SCIPgetNConss(targetscip); ++c)
+   {
+      if ( strcmp(SCIPconshdlrGetName(SCIPconsGetHdlr(conss[c])), "orbitope") == 0 )
+      {
+         cr_assert_null(cons, "more than one orbitope was copied");
+         cons = conss[c];
+      }
+   }
+
+   return cons;
+}
+
+/** copies the transformed problem and returns the copied orbitope, or NULL if it was not copied */
+static
+SCIP_CONS* copyProblem(
+   SCIP_Bool*            valid               /**< pointer to store whether the copy is valid */
+   )
+{
+   SCIP_CALL( SCIPtransformProb(scip) );
+
+   SCIP_CALL( SCIPcreate(&targetscip) );
+   SCIP_CALL( SCIPcopy(scip, targetscip, NULL, NULL, "copy", TRUE, FALSE, FALSE, FALSE, valid) );
+
+   return getTargetOrbitope();
+}
+
+/* TEST SUITE */
+TestSuite(test_activationcopy, .init = setup, .fini = teardown);
+
+Test(test_activationcopy, suborbitope, .description = "an orbitope is copied together with its sub-orbitope patterns")
+{
+   SCIP_VAR** matrix[NROWS];
+   SCIP_CONS* targetcons;
+   SCIP_Bool valid;
+   int i;
+
+   for (i = 0; i < NROWS; ++i)
+      matrix[i] = vars[i];
+
+   SCIP_CALL( SCIPregisterConsActivationSuborbitope(scip, orbitope, matrix, NROWS, NCOLS, 1, 1) );
+
+   targetcons = copyProblem(&valid);
+
+   cr_expect(valid);
+   cr_assert_not_null(targetcons);
+   cr_assert_not_null(SCIPconsGetActivationhdlr(targetcons));
+   cr_expect_str_eq(SCIPactivationhdlrGetName(SCIPconsGetActivationhdlr(targetcons)), "suborbitope");
+}
+
+Test(test_activationcopy, varfix, .description = "an orbitope is copied together with its variable fixing triggers")
+{
+   SCIP_Real vals[2] = {1.0, 0.0};
+   SCIP_VAR* triggervars[2];
+   SCIP_CONS* targetcons;
+   SCIP_Bool valid;
+   int rows[2] = {1, 2};
+   int cols[2] = {0, 1};
+
+   triggervars[0] = vars[0][0];
+   triggervars[1] = vars[0][1];
+
+   SCIP_CALL( SCIPregisterConsActivationVarFix(scip, orbitope, triggervars, vals, 2, rows, 2, cols, 2,
+         SCIP_ORBITOPETYPE_FULL) );
+   SCIP_CALL( SCIPregisterConsActivationVarFix(scip, orbitope, &triggervars[1], &vals[0], 1, NULL, 0, NULL, 0,
+         SCIP_ORBITOPETYPE_FULL) );
+
+   targetcons = copyProblem(&valid);
+
+   cr_expect(valid);
+   cr_assert_not_null(targetcons);
+   cr_assert_not_null(SCIPconsGetActivationhdlr(targetcons));
+   cr_expect_str_eq(SCIPactivationhdlrGetName(SCIPconsGetActivationhdlr(targetcons)), "varfix");
+}
+
+Test(test_activationcopy, dropped, .description = "an orbitope whose activation cannot be copied is dropped, but the copy stays valid")
+{
+   SCIP_HASHMAP* varmap;
+   SCIP_VAR* triggervar;
+   SCIP_Real val = 1.0;
+   SCIP_Bool valid;
+
+   triggervar = vars[0][0];
+   SCIP_CALL( SCIPregisterConsActivationVarFix(scip, orbitope, &triggervar, &val, 1, NULL, 0, NULL, 0,
+         SCIP_ORBITOPETYPE_FULL) );
+
+   SCIP_CALL( SCIPtransformProb(scip) );
+
+   /* the target SCIP knows orbitopes, but not the activation handler */
+   SCIP_CALL( SCIPcreate(&targetscip) );
+   SCIP_CALL( SCIPincludeConshdlrOrbitope(targetscip) );
+   SCIP_CALL( SCIPcreateProbBasic(targetscip, "copy") );
+
+   SCIP_CALL( SCIPhashmapCreate(&varmap, SCIPblkmem(targetscip), SCIPgetNVars(scip)) );
+   SCIP_CALL( SCIPcopyVars(scip, targetscip, varmap, NULL, NULL, NULL, 0, TRUE) );
+   SCIP_CALL( SCIPcopyConss(scip, targetscip, varmap, NULL, TRUE, FALSE, &valid) );
+   SCIPhashmapFree(&varmap);
+
+   cr_expect(valid);
+   cr_expect_null(getTargetOrbitope());
+}
+
+Test(test_activationcopy, nonmodel, .description = "a checked non-model orbitope with activation is dropped, but the copy stays valid")
+{
+   SCIP_VAR** matrix[NROWS];
+   SCIP_CONS* cons;
+   SCIP_CONS* targetcons;
+   SCIP_Bool valid;
+   int i;
+
+   for (i = 0; i < NROWS; ++i)
+      matrix[i] = vars[i];
+
+   /* the orbitope constraint handler does not copy non-model orbitopes */
+   SCIP_CALL( SCIPcreateConsOrbitope(scip, &cons, "nonmodel", matrix, SCIP_ORBITOPETYPE_FULL, NROWS, NCOLS,
+         FALSE, FALSE, FALSE, FALSE, TRUE, TRUE, FALSE, TRUE, TRUE, FALSE, FALSE, FALSE, FALSE, FALSE) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPregisterConsActivationSuborbitope(scip, cons, matrix, NROWS, NCOLS, 1, 1) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+
+   targetcons = copyProblem(&valid);
+
+   cr_expect(valid);
+   cr_assert_not_null(targetcons);
+   cr_expect_null(SCIPconsGetActivationhdlr(targetcons));
+}
@@ -0,0 +1,116 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2021 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   checksym.c
+ * @brief  unit tests for the check whether permutations are symmetries, e.g., of cached generators
+ */
+
+#include <scip/scip.h>
+#include <scip/scipdefplugins.h>
+#include "scip/prop_symmetry.c"
+#include <include/scip_test.h>
+
+#define NVARS 3
+
+/* global SCIP instance and binary variables */
+static SCIP* scip;
+static SCIP_VAR* vars[NVARS];
+
+/** setup: create SCIP and binary variables x0, x1 with objective 1 and x2 with objective 2 */
+static
+void setup(void)
+{
+   int i;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "checksym") );
+
+   for (i = 0; i < NVARS; ++i)
+   {
+      char name[SCIP_MAXSTRLEN];
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", i);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &vars[i], name, 0.0, 1.0, i < 2 ? 1.0 : 2.0, SCIP_VARTYPE_BINARY) );
+      SCIP_CALL( SCIPaddVar(scip, vars[i]) );
+   }
+}
+
+/** teardown: free SCIP */
+static
+void teardown(void)
+{
+   int i;
+
+   for (i = 0; i < NVARS; ++i)
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &vars[i]) );
+   }
+
+   SCIP_CALL( SCIPfree(&scip) );
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "Memory leak!");
+}
+
+/** checks a permutation against the matrix data of the row x0 + x1 + x2 <= 2 */
+static
+SCIP_Bool isSymmetry(
+   int*                  perm                /**< permutation of the variables */
+   )
+{
+   SYM_MATRIXDATA matrixdata;
+   SCIP_Real matcoef[NVARS] = {1.0, 1.0, 1.0};
+   SCIP_Real rhscoef[1] = {2.0};
+   SYM_RHSSENSE rhssense[1] = {SYM_SENSE_INEQUALITY};
+   int matrhsidx[NVARS] = {0, 0, 0};
+   int matvaridx[NVARS] = {0, 1, 2};
+   int permvarcolors[NVARS] = {0, 0, 1};
+   int* perms[1];
+   SCIP_Bool issymmetry;
+
+   BMSclearMemory(&matrixdata);
+   matrixdata.matcoef = matcoef;
+   matrixdata.rhscoef = rhscoef;
+   matrixdata.rhssense = rhssense;
+   matrixdata.matrhsidx = matrhsidx;
+   matrixdata.matvaridx = matvaridx;
+   matrixdata.permvarcolors = permvarcolors;
+   matrixdata.permvars = vars;
+   matrixdata.npermvars = NVARS;
+   matrixdata.nmatcoef = NVARS;
+   matrixdata.nrhscoef = 1;
+
+   perms[0] = perm;
+   SCIP_CALL( checkSymmetriesAreSymmetries(scip, (SYM_SPEC) 0, &matrixdata, 1, perms, &issymmetry) );
+
+   return issymmetry;
+}
+
+/* TEST SUITE */
+TestSuite(test_checksym_symmetry, .init = setup, .fini = teardown);
+
+Test(test_checksym_symmetry, samecolor, .description = "exchanging variables of the same color is a symmetry")
+{
+   int perm[NVARS] = {1, 0, 2};
+
+   cr_expect( isSymmetry(perm) );
+}
+
+Test(test_checksym_symmetry, differentcolor, .description = "exchanging variables of different colors is no symmetry")
+{
+   /* the row is invariant under every permutation, but x2 has a different objective than x0 */
+   int perm[NVARS] = {2, 1, 0};
+
+   cr_expect( ! isSymmetry(perm) );
+}
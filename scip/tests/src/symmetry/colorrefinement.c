@@ -0,0 +1,138 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2021 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   colorrefinement.c
+ * @brief  unit tests for the color refinement of symmetry detection graphs
+ */
+
+#include <scip/scip.h>
+#include <scip/symmetry.h>
+#include <include/scip_test.h>
+
+#define NPATHVERTICES 5
+
+/* global SCIP instance */
+static SCIP* scip;
+
+/* path 0 - 1 - 2 - 3 - 4 as adjacency lists */
+static int pathadjbegins[NPATHVERTICES + 1] = {0, 1, 3, 5, 7, 8};
+static int pathadj[8] = {1, 0, 2, 1, 3, 2, 4, 3};
+
+/** checks that the coloring induces the expected partition of the vertices, independent of the numbering */
+static
+void checkPartition(
+   int*                  colors,             /**< colors of the vertices */
+   int*                  expclasses,         /**< expected class of each vertex */
+   int                   nvertices           /**< number of vertices */
+   )
+{
+   int v;
+   int w;
+
+   for (v = 0; v < nvertices; ++v)
+   {
+      for (w = v + 1; w < nvertices; ++w)
+      {
+         cr_expect_eq(colors[v] == colors[w], expclasses[v] == expclasses[w],
+            "vertices %d and %d: colors %d and %d, expected classes %d and %d\n", v, w, colors[v], colors[w],
+            expclasses[v], expclasses[w]);
+      }
+   }
+}
+
+/** setup: create SCIP */
+static
+void setup(void)
+{
+   SCIP_CALL( SCIPcreate(&scip) );
+}
+
+/** teardown: free SCIP */
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPfree(&scip) );
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "Memory leak!");
+}
+
+/* TEST SUITE */
+TestSuite(test_colorrefinement_symmetry, .init = setup, .fini = teardown);
+
+Test(test_colorrefinement_symmetry, path, .description = "a uniformly colored path is refined by the distance to its ends")
+{
+   int colors[NPATHVERTICES] = {7, 7, 7, 7, 7};
+   int expclasses[NPATHVERTICES] = {0, 1, 2, 1, 0};
+   SCIP_Bool stable;
+   int ncolors;
+   int v;
+
+   SCIP_CALL( SCIPrefineColorsSym(scip, NPATHVERTICES, pathadjbegins, pathadj, -1, colors, &ncolors, &stable) );
+
+   cr_assert( stable );
+   cr_assert_eq(ncolors, 3);
+   checkPartition(colors, expclasses, NPATHVERTICES);
+   for (v = 0; v < NPATHVERTICES; ++v)
+      cr_expect(colors[v] >= 0 && colors[v] < ncolors, "color %d of vertex %d is out of range\n", colors[v], v);
+}
+
+Test(test_colorrefinement_symmetry, discrete, .description = "a path with a distinguished end is refined to a discrete coloring")
+{
+   int colors[NPATHVERTICES] = {3, 1, 1, 1, 1};
+   int expclasses[NPATHVERTICES] = {0, 1, 2, 3, 4};
+   SCIP_Bool stable;
+   int ncolors;
+
+   SCIP_CALL( SCIPrefineColorsSym(scip, NPATHVERTICES, pathadjbegins, pathadj, -1, colors, &ncolors, &stable) );
+
+   cr_assert( stable );
+   cr_assert_eq(ncolors, NPATHVERTICES);
+   checkPartition(colors, expclasses, NPATHVERTICES);
+}
+
+Test(test_colorrefinement_symmetry, maxrounds, .description = "the refinement stops with a coarser coloring after the maximal number of rounds")
+{
+   int colors[NPATHVERTICES] = {7, 7, 7, 7, 7};
+   int expclasses[NPATHVERTICES] = {0, 1, 1, 1, 0};
+   SCIP_Bool stable;
+   int ncolors;
+
+   /* one round only distinguishes the ends of the path by their degree */
+   SCIP_CALL( SCIPrefineColorsSym(scip, NPATHVERTICES, pathadjbegins, pathadj, 1, colors, &ncolors, &stable) );
+
+   cr_assert( ! stable );
+   cr_assert_eq(ncolors, 2);
+   checkPartition(colors, expclasses, NPATHVERTICES);
+}
+
+Test(test_colorrefinement_symmetry, regular, .description = "initial colors are kept if the coloring is already stable")
+{
+   /* two disjoint triangles 0 - 1 - 2 and 3 - 4 - 5 with one color each */
+   int adjbegins[7] = {0, 2, 4, 6, 8, 10, 12};
+   int adj[12] = {1, 2, 0, 2, 0, 1, 4, 5, 3, 5, 3, 4};
+   int colors[6] = {5, 5, 5, 2, 2, 2};
+   int expclasses[6] = {0, 0, 0, 1, 1, 1};
+   SCIP_Bool stable;
+   int ncolors;
+
+   SCIP_CALL( SCIPrefineColorsSym(scip, 6, adjbegins, adj, -1, colors, &ncolors, &stable) );
+
+   cr_assert( stable );
+   cr_assert_eq(ncolors, 2);
+   checkPartition(colors, expclasses, 6);
+
+   /* colors are numbered consecutively in the order of the initial colors */
+   cr_expect_eq(colors[3], 0);
+   cr_expect_eq(colors[0], 1);
+}
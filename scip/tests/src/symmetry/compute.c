@@ -1736,3 +1736,69 @@ Test(test_compute_symmetry, expr4, .description = "compute symmetry for a simple
 
    SCIPfreeBufferArray(scip, &summands);
 }
+
+/* TEST 9 (time limit) */
+Test(test_compute_symmetry, timelimit, .description = "stop the symmetry computation at the time limit before the first generator is found")
+{
+   SCIP_VAR* vars[20];
+   SCIP_CONS* cons;
+   SCIP_Real vals[2] = {1.0, 1.0};
+   SCIP_VAR** permvars;
+   int** perms;
+   int npermvars;
+   int nperms;
+   int i;
+
+   /* skip test if no symmetry can be computed */
+   if ( ! SYMcanComputeSymmetry() )
+      return;
+
+   /* setup problem with a large symmetry group:
+    * min sum_i x_i
+    *     x_{2i} + x_{2i+1} = 1   for i = 0, ..., 9
+    *     x_i binary
+    */
+   SCIP_CALL( SCIPcreateProbBasic(scip, "timelimit"));
+
+   for (i = 0; i < 20; ++i)
+   {
+      char name[SCIP_MAXSTRLEN];
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", i);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &vars[i], name, 0.0, 1.0, 1.0, SCIP_VARTYPE_BINARY) );
+      SCIP_CALL( SCIPaddVar(scip, vars[i]) );
+   }
+
+   for (i = 0; i < 10; ++i)
+   {
+      char name[SCIP_MAXSTRLEN];
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "e%d", i);
+      SCIP_CALL( SCIPcreateConsBasicLinear(scip, &cons, name, 2, &vars[2 * i], vals, 1.0, 1.0) );
+      SCIP_CALL( SCIPaddCons(scip, cons) );
+      SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+   }
+
+   /* the search is interrupted as soon as the time limit is checked */
+   SCIP_CALL( SCIPsetRealParam(scip, "propagating/symmetry/timelimit", 0.0) );
+
+   /* turn off presolving in order to avoid having trivial problem afterwards */
+   SCIP_CALL( SCIPsetIntParam(scip, "presolving/maxrounds", 0) );
+
+   /* turn off subgroup detection */
+   SCIP_CALL( SCIPsetBoolParam(scip, "propagating/symmetry/detectsubgroups", FALSE) );
+
+   /* presolve problem (symmetry will be available afterwards) */
+   SCIP_CALL( SCIPpresolve(scip) );
+
+   /* get symmetry */
+   SCIP_CALL( SCIPgetSymmetry(scip,
+         &npermvars, &permvars, NULL, &nperms, &perms, NULL, NULL, NULL,
+         NULL, NULL, NULL, NULL) );
+   cr_assert( nperms == 0 );
+
+   for (i = 0; i < 20; ++i)
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &vars[i]) );
+   }
+}
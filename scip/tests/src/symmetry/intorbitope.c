@@ -0,0 +1,153 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2021 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   intorbitope.c
+ * @brief  unit tests for orbitopal reduction of orbitopes on general integer variables
+ */
+
+#include <scip/scip.h>
+#include <scip/scipdefplugins.h>
+#include "scip/prop_symmetry.c"
+#include <include/scip_test.h>
+
+#define NROWS 2
+#define NCOLS 3
+
+/* global SCIP instance and the variable matrix of the orbitope (row by row) */
+static SCIP* scip;
+static SCIP_VAR* vars[NROWS * NCOLS];
+
+/** setup: create SCIP and integer variables with domain {0, ..., 3} */
+static
+void setup(void)
+{
+   int i;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "intorbitope") );
+
+   for (i = 0; i < NROWS * NCOLS; ++i)
+   {
+      char name[SCIP_MAXSTRLEN];
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x_%d_%d", i / NCOLS, i % NCOLS);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &vars[i], name, 0.0, 3.0, 0.0, SCIP_VARTYPE_INTEGER) );
+      SCIP_CALL( SCIPaddVar(scip, vars[i]) );
+   }
+}
+
+/** teardown: free SCIP */
+static
+void teardown(void)
+{
+   int i;
+
+   for (i = 0; i < NROWS * NCOLS; ++i)
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &vars[i]) );
+   }
+
+   SCIP_CALL( SCIPfree(&scip) );
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "Memory leak!");
+}
+
+/** checks the local bounds of the entry in row i and column j */
+static
+void checkBounds(
+   int                   i,                  /**< row of the entry */
+   int                   j,                  /**< column of the entry */
+   SCIP_Real             lb,                 /**< expected lower bound */
+   SCIP_Real             ub                  /**< expected upper bound */
+   )
+{
+   SCIP_VAR* var = vars[i * NCOLS + j];
+
+   cr_expect(SCIPisEQ(scip, SCIPvarGetLbLocal(var), lb), "lb of <%s>: expected %g, but got %g\n",
+      SCIPvarGetName(var), lb, SCIPvarGetLbLocal(var));
+   cr_expect(SCIPisEQ(scip, SCIPvarGetUbLocal(var), ub), "ub of <%s>: expected %g, but got %g\n",
+      SCIPvarGetName(var), ub, SCIPvarGetUbLocal(var));
+}
+
+/* TEST SUITE */
+TestSuite(test_intorbitope_symmetry, .init = setup, .fini = teardown);
+
+Test(test_intorbitope_symmetry, upperbound, .description = "the first entries of later columns are bounded by the first column")
+{
+   SCIP_Bool infeasible;
+   int nprop;
+
+   /* x_0_0 <= 1 implies x_0_1 <= 1 and x_0_2 <= 1, since the columns are lexicographically non-increasing */
+   SCIP_CALL( SCIPchgVarUb(scip, vars[0], 1.0) );
+
+   SCIP_CALL( propagateIntOrbitope(scip, vars, NROWS, NCOLS, &infeasible, &nprop) );
+
+   cr_assert( ! infeasible );
+   cr_expect_eq(nprop, 2);
+   checkBounds(0, 1, 0.0, 1.0);
+   checkBounds(0, 2, 0.0, 1.0);
+   checkBounds(1, 1, 0.0, 3.0);
+   checkBounds(1, 2, 0.0, 3.0);
+}
+
+Test(test_intorbitope_symmetry, lowerbound, .description = "the first entries of earlier columns are bounded by the last column")
+{
+   SCIP_Bool infeasible;
+   int nprop;
+
+   /* x_0_2 >= 2 implies x_0_0 >= 2 and x_0_1 >= 2 */
+   SCIP_CALL( SCIPchgVarLb(scip, vars[2], 2.0) );
+
+   SCIP_CALL( propagateIntOrbitope(scip, vars, NROWS, NCOLS, &infeasible, &nprop) );
+
+   cr_assert( ! infeasible );
+   cr_expect_eq(nprop, 2);
+   checkBounds(0, 0, 2.0, 3.0);
+   checkBounds(0, 1, 2.0, 3.0);
+   checkBounds(1, 0, 0.0, 3.0);
+}
+
+Test(test_intorbitope_symmetry, fixrow, .description = "equal first entries bound the second row")
+{
+   SCIP_Bool infeasible;
+   int nprop;
+
+   /* x_0_0 = 2, x_1_0 <= 1, x_0_1 >= 2: the first entries of the first two columns are equal, so x_1_1 <= 1 */
+   SCIP_CALL( SCIPchgVarLb(scip, vars[0], 2.0) );
+   SCIP_CALL( SCIPchgVarUb(scip, vars[0], 2.0) );
+   SCIP_CALL( SCIPchgVarUb(scip, vars[NCOLS], 1.0) );
+   SCIP_CALL( SCIPchgVarLb(scip, vars[1], 2.0) );
+
+   SCIP_CALL( propagateIntOrbitope(scip, vars, NROWS, NCOLS, &infeasible, &nprop) );
+
+   cr_assert( ! infeasible );
+   checkBounds(0, 1, 2.0, 2.0);
+   checkBounds(1, 1, 0.0, 1.0);
+   checkBounds(0, 2, 0.0, 2.0);
+   checkBounds(1, 2, 0.0, 3.0);
+}
+
+Test(test_intorbitope_symmetry, infeasible, .description = "a column that is lexicographically larger than an earlier one is infeasible")
+{
+   SCIP_Bool infeasible;
+   int nprop;
+
+   SCIP_CALL( SCIPchgVarUb(scip, vars[0], 0.0) );
+   SCIP_CALL( SCIPchgVarLb(scip, vars[1], 1.0) );
+
+   SCIP_CALL( propagateIntOrbitope(scip, vars, NROWS, NCOLS, &infeasible, &nprop) );
+
+   cr_expect( infeasible );
+}
@@ -0,0 +1,181 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2021 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   lexreduction.c
+ * @brief  unit tests for the propagation of symresacks by lexicographic reduction
+ */
+
+#include <scip/scip.h>
+#include <scip/scipdefplugins.h>
+#include "scip/prop_symmetry.c"
+#include <include/scip_test.h>
+
+#define NVARS 3
+
+/* global SCIP instance, binary variables, and the data of the symmetry propagator */
+static SCIP* scip;
+static SCIP_VAR* vars[NVARS];
+static SCIP_PROPDATA* propdata;
+
+/** setup: create SCIP and binary variables */
+static
+void setup(void)
+{
+   int i;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "lexreduction") );
+
+   for (i = 0; i < NVARS; ++i)
+   {
+      char name[SCIP_MAXSTRLEN];
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", i);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &vars[i], name, 0.0, 1.0, 0.0, SCIP_VARTYPE_BINARY) );
+      SCIP_CALL( SCIPaddVar(scip, vars[i]) );
+   }
+
+   propdata = SCIPpropGetData(SCIPfindProp(scip, "symmetry"));
+   cr_assert( propdata != NULL );
+}
+
+/** teardown: free SCIP */
+static
+void teardown(void)
+{
+   int i;
+
+   for (i = 0; i < NVARS; ++i)
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &vars[i]) );
+   }
+
+   SCIP_CALL( SCIPfree(&scip) );
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "Memory leak!");
+}
+
+/** propagates the symresack of a single permutation by lexicographic reduction */
+static
+void propagate(
+   int*                  perm,               /**< permutation of the variables */
+   SCIP_Bool*            infeasible,         /**< pointer to store whether the node is infeasible */
+   int*                  nprop               /**< pointer to store the number of tightened bounds */
+   )
+{
+   int* perms[1];
+   int lexperms[1] = {0};
+
+   perms[0] = perm;
+   propdata->permvars = vars;
+   propdata->npermvars = NVARS;
+   propdata->perms = perms;
+   propdata->nperms = 1;
+
+   SCIP_CALL( setupLexReduction(scip, propdata, lexperms, 1) );
+   SCIP_CALL( propagateLexReduction(scip, propdata, infeasible, nprop) );
+
+   /* free data of lexicographic reduction, the remaining data belongs to the test */
+   SCIPfreeBlockMemoryArray(scip, &propdata->lexpermpreimages, MAX(propdata->nlexpairs, 1));
+   SCIPfreeBlockMemoryArray(scip, &propdata->lexpermvars, MAX(propdata->nlexpairs, 1));
+   SCIPfreeBlockMemoryArray(scip, &propdata->lexpermbegins, propdata->nlexperms + 1);
+   SCIPfreeBlockMemoryArray(scip, &propdata->lexsupportimages, MAX(propdata->nlexpairs, 1));
+   SCIPfreeBlockMemoryArray(scip, &propdata->lexsupportperms, MAX(propdata->nlexpairs, 1));
+   SCIPfreeBlockMemoryArray(scip, &propdata->lexsupportbegins, propdata->npermvars + 1);
+   propdata->nlexpairs = 0;
+   propdata->nlexperms = 0;
+
+   propdata->permvars = NULL;
+   propdata->npermvars = 0;
+   propdata->perms = NULL;
+   propdata->nperms = 0;
+}
+
+/* TEST SUITE */
+TestSuite(test_lexreduction_symmetry, .init = setup, .fini = teardown);
+
+Test(test_lexreduction_symmetry, fixsecond, .description = "(0, _) fixes the second entry of a pair to 0")
+{
+   int perm[NVARS] = {1, 0, 2};
+   SCIP_Bool infeasible;
+   int nprop;
+
+   SCIP_CALL( SCIPchgVarUb(scip, vars[0], 0.0) );
+
+   propagate(perm, &infeasible, &nprop);
+
+   cr_assert( ! infeasible );
+   cr_expect_eq(nprop, 1);
+   cr_expect( SCIPvarGetUbLocal(vars[1]) < 0.5 );
+}
+
+Test(test_lexreduction_symmetry, fixfirst, .description = "(_, 1) fixes the first entry of a pair to 1")
+{
+   int perm[NVARS] = {1, 0, 2};
+   SCIP_Bool infeasible;
+   int nprop;
+
+   SCIP_CALL( SCIPchgVarLb(scip, vars[1], 1.0) );
+
+   propagate(perm, &infeasible, &nprop);
+
+   cr_assert( ! infeasible );
+   cr_expect_eq(nprop, 1);
+   cr_expect( SCIPvarGetLbLocal(vars[0]) > 0.5 );
+}
+
+Test(test_lexreduction_symmetry, infeasible, .description = "(0, 1) violates the lexicographic order")
+{
+   int perm[NVARS] = {1, 0, 2};
+   SCIP_Bool infeasible;
+   int nprop;
+
+   SCIP_CALL( SCIPchgVarUb(scip, vars[0], 0.0) );
+   SCIP_CALL( SCIPchgVarLb(scip, vars[1], 1.0) );
+
+   propagate(perm, &infeasible, &nprop);
+
+   cr_expect( infeasible );
+}
+
+Test(test_lexreduction_symmetry, peek, .description = "peeking at (0, _) fixes both entries of the pair virtually")
+{
+   /* the symresack is (x0, x1, x2) >= (x1, x2, x0): if x2 = 1, then x0 = 0 would imply x1 = 0 and thus
+    * (0, 0, 1) >= (0, 1, 0), which is violated; so x0 has to be fixed to 1 */
+   int perm[NVARS] = {2, 0, 1};
+   SCIP_Bool infeasible;
+   int nprop;
+
+   SCIP_CALL( SCIPchgVarLb(scip, vars[2], 1.0) );
+
+   propagate(perm, &infeasible, &nprop);
+
+   cr_assert( ! infeasible );
+   cr_expect_eq(nprop, 1);
+   cr_expect( SCIPvarGetLbLocal(vars[0]) > 0.5 );
+   cr_expect( SCIPvarGetLbLocal(vars[1]) < 0.5 && SCIPvarGetUbLocal(vars[1]) > 0.5 );
+}
+
+Test(test_lexreduction_symmetry, nofixing, .description = "no fixings if the symresack can be satisfied in all ways")
+{
+   int perm[NVARS] = {2, 0, 1};
+   SCIP_Bool infeasible;
+   int nprop;
+
+   propagate(perm, &infeasible, &nprop);
+
+   cr_assert( ! infeasible );
+   cr_expect_eq(nprop, 0);
+}
@@ -0,0 +1,164 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2021 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   nodepruning.c
+ * @brief  unit tests for pruning nodes that are symmetric to finished leaves
+ *
+ * Pruning symmetric nodes must not change the optimal value, and it is only enabled if no other symmetry handling
+ * method is active and strong dual reductions are allowed.
+ */
+
+#include <scip/scip.h>
+#include <scip/scipdefplugins.h>
+#include "scip/prop_symmetry.c"
+#include <include/scip_test.h>
+
+#define NVARS 8
+
+/* global SCIP instance and the data of the symmetry propagator */
+static SCIP* scip;
+static SCIP_PROPDATA* propdata;
+
+/** setup: create SCIP and the problem min sum x_i + 10 w s.t. sum 2 x_i + w = 9, which is symmetric in the binary
+ *  variables x_i
+ *
+ *  The optimal value is 14. Since the right hand side is odd, the LP relaxation is weak and many symmetric subproblems
+ *  are created by branching.
+ */
+static
+void setup(void)
+{
+   SCIP_VAR* vars[NVARS + 1];
+   SCIP_Real vals[NVARS + 1];
+   SCIP_CONS* cons;
+   int i;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "nodepruning") );
+
+   for (i = 0; i < NVARS; ++i)
+   {
+      char name[SCIP_MAXSTRLEN];
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", i);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &vars[i], name, 0.0, 1.0, 1.0, SCIP_VARTYPE_BINARY) );
+      SCIP_CALL( SCIPaddVar(scip, vars[i]) );
+      vals[i] = 2.0;
+   }
+
+   SCIP_CALL( SCIPcreateVarBasic(scip, &vars[NVARS], "w", 0.0, 1.0, 10.0, SCIP_VARTYPE_CONTINUOUS) );
+   SCIP_CALL( SCIPaddVar(scip, vars[NVARS]) );
+   vals[NVARS] = 1.0;
+
+   SCIP_CALL( SCIPcreateConsBasicLinear(scip, &cons, "odd", NVARS + 1, vars, vals, 9.0, 9.0) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+
+   for (i = 0; i <= NVARS; ++i)
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &vars[i]) );
+   }
+
+   /* only prune symmetric nodes and keep the problem as it is */
+   SCIP_CALL( SCIPsetIntParam(scip, "misc/usesymmetry", 0) );
+   SCIP_CALL( SCIPsetBoolParam(scip, "propagating/symmetry/nodepruning", TRUE) );
+   SCIP_CALL( SCIPsetPresolving(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetHeuristics(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetSeparating(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+
+   propdata = SCIPpropGetData(SCIPfindProp(scip, "symmetry"));
+   cr_assert( propdata != NULL );
+}
+
+/** teardown: free SCIP */
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPfree(&scip) );
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "Memory leak!");
+}
+
+/* TEST SUITE */
+TestSuite(test_nodepruning_symmetry, .init = setup, .fini = teardown);
+
+Test(test_nodepruning_symmetry, optimum, .description = "pruning symmetric nodes keeps the optimal value")
+{
+   SCIP_Real optimum;
+   SCIP_Longint nnodes;
+
+   /* skip test if no symmetry can be computed */
+   if ( ! SYMcanComputeSymmetry() )
+      return;
+
+   /* solve without pruning */
+   SCIP_CALL( SCIPsetBoolParam(scip, "propagating/symmetry/nodepruning", FALSE) );
+   SCIP_CALL( SCIPsolve(scip) );
+
+   cr_assert( SCIPgetStatus(scip) == SCIP_STATUS_OPTIMAL );
+   cr_assert( ! propdata->nodepruningenabled );
+   cr_expect_eq(propdata->nprunednodes, 0);
+   optimum = SCIPgetPrimalbound(scip);
+   nnodes = SCIPgetNNodes(scip);
+   cr_expect( SCIPisEQ(scip, optimum, 14.0) );
+   cr_assert_gt(nnodes, 1, "the problem has to be solved by branching");
+
+   /* solve again with pruning */
+   SCIP_CALL( SCIPfreeTransform(scip) );
+   SCIP_CALL( SCIPsetBoolParam(scip, "propagating/symmetry/nodepruning", TRUE) );
+   SCIP_CALL( SCIPsolve(scip) );
+
+   cr_assert( SCIPgetStatus(scip) == SCIP_STATUS_OPTIMAL );
+   cr_assert( propdata->nodepruningenabled );
+   cr_expect_gt(propdata->nprunednodes, 0, "no symmetric node has been pruned");
+   cr_expect( SCIPisEQ(scip, SCIPgetPrimalbound(scip), optimum), "optimal value %g with pruning differs from %g",
+      SCIPgetPrimalbound(scip), optimum);
+   cr_expect_leq(SCIPgetNNodes(scip), nnodes);
+}
+
+Test(test_nodepruning_symmetry, orbitalfixing, .description = "symmetric nodes are not pruned if orbital fixing is active")
+{
+   /* skip test if no symmetry can be computed */
+   if ( ! SYMcanComputeSymmetry() )
+      return;
+
+   SCIP_CALL( SCIPsetIntParam(scip, "misc/usesymmetry", 2) );
+   SCIP_CALL( SCIPsetIntParam(scip, "propagating/symmetry/ofsymcomptiming", 0) );
+   SCIP_CALL( SCIPsolve(scip) );
+
+   cr_assert( SCIPgetStatus(scip) == SCIP_STATUS_OPTIMAL );
+   cr_assert( propdata->ofenabled );
+   cr_expect( ! propdata->nodepruningenabled );
+   cr_expect( propdata->leafforms == NULL );
+   cr_expect_eq(propdata->nprunednodes, 0);
+   cr_expect( SCIPisEQ(scip, SCIPgetPrimalbound(scip), 14.0) );
+}
+
+Test(test_nodepruning_symmetry, strongdualreds, .description = "symmetric nodes are not pruned if strong dual reductions are forbidden")
+{
+   /* skip test if no symmetry can be computed */
+   if ( ! SYMcanComputeSymmetry() )
+      return;
+
+   SCIP_CALL( SCIPsetBoolParam(scip, "misc/allowstrongdualreds", FALSE) );
+   SCIP_CALL( SCIPsolve(scip) );
+
+   cr_assert( SCIPgetStatus(scip) == SCIP_STATUS_OPTIMAL );
+   cr_expect( ! propdata->nodepruningenabled );
+   cr_expect( propdata->leafforms == NULL );
+   cr_expect_eq(propdata->nprunednodes, 0);
+   cr_expect( SCIPisEQ(scip, SCIPgetPrimalbound(scip), 14.0) );
+}
@@ -0,0 +1,273 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2021 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   orbitcache.c
+ * @brief  unit tests for the orbit cache of orbital fixing
+ *
+ * The cached orbits of a component have to be recomputed if a global bound change deactivates permutations of the
+ * component, and the cache has to be rebuilt if the generators are recomputed after a restart.
+ */
+
+#include <scip/scip.h>
+#include <scip/scipdefplugins.h>
+#include "scip/prop_symmetry.c"
+#include <include/scip_test.h>
+
+#define NVARS 4
+
+/* global SCIP instance, binary variables, and the data of the symmetry propagator */
+static SCIP* scip;
+static SCIP_VAR* vars[NVARS];
+static SCIP_PROPDATA* propdata;
+
+/** setup: create SCIP and the problem min sum x_i s.t. sum x_i >= 1, which is symmetric in all variables */
+static
+void setup(void)
+{
+   SCIP_CONS* cons;
+   SCIP_Real vals[NVARS];
+   int i;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "orbitcache") );
+
+   for (i = 0; i < NVARS; ++i)
+   {
+      char name[SCIP_MAXSTRLEN];
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", i);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &vars[i], name, 0.0, 1.0, 1.0, SCIP_VARTYPE_BINARY) );
+      SCIP_CALL( SCIPaddVar(scip, vars[i]) );
+      vals[i] = 1.0;
+   }
+
+   SCIP_CALL( SCIPcreateConsBasicLinear(scip, &cons, "cover", NVARS, vars, vals, 1.0, SCIPinfinity(scip)) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+
+   /* only use orbital fixing, compute symmetry before presolving, and keep the problem as it is */
+   SCIP_CALL( SCIPsetIntParam(scip, "misc/usesymmetry", 2) );
+   SCIP_CALL( SCIPsetIntParam(scip, "propagating/symmetry/ofsymcomptiming", 0) );
+   SCIP_CALL( SCIPsetIntParam(scip, "propagating/symmetry/recomputerestart", 1) );
+   SCIP_CALL( SCIPsetIntParam(scip, "presolving/maxrounds", 0) );
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+
+   propdata = SCIPpropGetData(SCIPfindProp(scip, "symmetry"));
+   cr_assert( propdata != NULL );
+}
+
+/** teardown: free SCIP */
+static
+void teardown(void)
+{
+   int i;
+
+   for (i = 0; i < NVARS; ++i)
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &vars[i]) );
+   }
+
+   SCIP_CALL( SCIPfree(&scip) );
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "Memory leak!");
+}
+
+/** checks that the cached orbits of each component are the orbits of the active permutations, which are recomputed from
+ *  scratch
+ */
+static
+void checkOrbitCache(void)
+{
+   int** activeperms;
+   int* orbits;
+   int* orbitbegins;
+   int* cacheorbit;
+   int* reforbit;
+   int nactiveperms = 0;
+   int norbits;
+   int npermvars;
+   int c;
+   int p;
+   int v;
+   int w;
+   int i;
+
+   cr_assert( propdata->ofcompvars != NULL );
+   cr_assert( propdata->nperms > 0 );
+
+   npermvars = propdata->npermvars;
+
+   /* the cache has been computed w.r.t. the current inactive permutations */
+   for (p = 0; p < propdata->nperms; ++p)
+      cr_expect_eq(propdata->ofinactiveperms[p], propdata->inactiveperms[p], "cache of permutation %d is outdated", p);
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &activeperms, propdata->nperms) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &orbits, npermvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &orbitbegins, npermvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &cacheorbit, npermvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &reforbit, npermvars) );
+
+   for (p = 0; p < propdata->nperms; ++p)
+   {
+      if ( ! propdata->inactiveperms[p] )
+         activeperms[nactiveperms++] = propdata->perms[p];
+   }
+
+   /* reference orbits of the active permutations */
+   for (v = 0; v < npermvars; ++v)
+      reforbit[v] = -1;
+
+   if ( nactiveperms > 0 )
+   {
+      SCIP_CALL( SCIPcomputeOrbitsSym(scip, propdata->permvars, npermvars, activeperms, nactiveperms, orbits,
+            orbitbegins, &norbits) );
+
+      for (i = 0; i < norbits; ++i)
+      {
+         for (v = orbitbegins[i]; v < orbitbegins[i + 1]; ++v)
+            reforbit[orbits[v]] = i;
+      }
+   }
+
+   /* cached orbits of the components */
+   for (v = 0; v < npermvars; ++v)
+      cacheorbit[v] = -1;
+
+   for (c = 0; c < propdata->ncomponents; ++c)
+   {
+      int* compoforbits;
+      int* compoforbitbegins;
+
+      cr_assert( propdata->ofnorbits[c] >= 0, "orbits of component %d have not been recomputed", c );
+
+      compoforbits = &propdata->oforbits[propdata->ofcompvarbegins[c]];
+      compoforbitbegins = &propdata->oforbitbegins[propdata->ofcompvarbegins[c] + c];
+
+      for (i = 0; i < propdata->ofnorbits[c]; ++i)
+      {
+         for (v = compoforbitbegins[i]; v < compoforbitbegins[i + 1]; ++v)
+         {
+            cr_assert( 0 <= compoforbits[v] && compoforbits[v] < propdata->nbinpermvars );
+            cr_expect_eq(propdata->vartocomponent[compoforbits[v]], c);
+            cacheorbit[compoforbits[v]] = npermvars * c + i;
+         }
+      }
+   }
+
+   /* both partitions have to agree, trivial orbits are not stored */
+   for (v = 0; v < npermvars; ++v)
+   {
+      cr_expect_eq(cacheorbit[v] == -1, reforbit[v] == -1, "variable %d is only in one partition in a trivial orbit", v);
+
+      for (w = v + 1; w < npermvars; ++w)
+      {
+         if ( cacheorbit[v] == -1 || reforbit[v] == -1 )
+            continue;
+
+         cr_expect_eq(cacheorbit[v] == cacheorbit[w], reforbit[v] == reforbit[w],
+            "cached and recomputed orbits of variables %d and %d differ", v, w);
+      }
+   }
+
+   SCIPfreeBufferArray(scip, &reforbit);
+   SCIPfreeBufferArray(scip, &cacheorbit);
+   SCIPfreeBufferArray(scip, &orbitbegins);
+   SCIPfreeBufferArray(scip, &orbits);
+   SCIPfreeBufferArray(scip, &activeperms);
+}
+
+/** returns the index of the given variable in the permutation variables, or -1 if it is not a permutation variable */
+static
+int getPermvarIndex(
+   SCIP_VAR*             var                 /**< original variable */
+   )
+{
+   SCIP_VAR* transvar;
+
+   SCIP_CALL_ABORT( SCIPgetTransformedVar(scip, var, &transvar) );
+
+   if ( transvar == NULL || ! SCIPhashmapExists(propdata->permvarmap, (void*) transvar) )
+      return -1;
+
+   return SCIPhashmapGetImageInt(propdata->permvarmap, (void*) transvar);
+}
+
+/* TEST SUITE */
+TestSuite(test_orbitcache_symmetry, .init = setup, .fini = teardown);
+
+Test(test_orbitcache_symmetry, bounds, .description = "the cached orbits are recomputed if a global bound change deactivates permutations")
+{
+   SCIP_Bool infeasible;
+   int nprop;
+   int idx;
+   int i;
+
+   /* skip test if no symmetry can be computed */
+   if ( ! SYMcanComputeSymmetry() )
+      return;
+
+   /* process the root node, which fills the cache */
+   SCIP_CALL( SCIPsetLongintParam(scip, "limits/nodes", 1LL) );
+   SCIP_CALL( SCIPsolve(scip) );
+
+   cr_assert( SCIPgetStage(scip) == SCIP_STAGE_SOLVING );
+   cr_assert( propdata->ofenabled );
+   cr_assert( propdata->ncomponents == 1 );
+   checkOrbitCache();
+
+   /* all variables form a single orbit */
+   cr_expect_eq(propdata->ofnorbits[0], 1);
+   cr_expect_eq(propdata->oforbitbegins[1] - propdata->oforbitbegins[0], NVARS);
+
+   /* fixing a variable to 0 deactivates the permutations moving it */
+   idx = getPermvarIndex(vars[0]);
+   cr_assert( idx >= 0 );
+   SCIP_CALL( SCIPchgVarUbGlobal(scip, propdata->permvars[idx], 0.0) );
+
+   SCIP_CALL( propagateOrbitalFixing(scip, propdata, &infeasible, &nprop) );
+   cr_assert( ! infeasible );
+   cr_expect_eq(nprop, 0);
+
+   checkOrbitCache();
+   for (i = propdata->oforbitbegins[0]; i < propdata->oforbitbegins[propdata->ofnorbits[0]]; ++i)
+      cr_expect_neq(propdata->oforbits[i], idx, "fixed variable is still in an orbit");
+}
+
+Test(test_orbitcache_symmetry, generators, .description = "the cache is rebuilt if the generators are recomputed after a restart")
+{
+   /* skip test if no symmetry can be computed */
+   if ( ! SYMcanComputeSymmetry() )
+      return;
+
+   SCIP_CALL( SCIPsetLongintParam(scip, "limits/nodes", 1LL) );
+   SCIP_CALL( SCIPsolve(scip) );
+
+   cr_assert( SCIPgetStage(scip) == SCIP_STAGE_SOLVING );
+   checkOrbitCache();
+   cr_expect_eq(propdata->npermvars, NVARS);
+
+   /* a restart removes the fixed variable, so that the generators act on fewer variables */
+   SCIP_CALL( SCIPchgVarUbGlobal(scip, SCIPvarGetTransVar(vars[0]), 0.0) );
+   SCIP_CALL( SCIPrestartSolve(scip) );
+
+   SCIP_CALL( SCIPsetLongintParam(scip, "limits/nodes", 2LL) );
+   SCIP_CALL( SCIPsolve(scip) );
+
+   cr_assert( SCIPgetNRuns(scip) == 2 );
+   cr_expect_eq(propdata->npermvars, NVARS - 1);
+   cr_expect_eq(getPermvarIndex(vars[0]), -1);
+   checkOrbitCache();
+   cr_expect_eq(propdata->ofnorbits[0], 1);
+}
@@ -0,0 +1,206 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2021 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   subsym.c
+ * @brief  unit tests for the detection of sub-symmetry structures of orbitopes
+ */
+
+#include <scip/scip.h>
+#include <scip/scipdefplugins.h>
+#include "scip/prop_symmetry.c"
+#include <include/scip_test.h>
+
+#define NJOBS     3
+#define NMACHINES 2
+
+/* global SCIP instance and the variable matrix of a scheduling problem */
+static SCIP* scip;
+static SCIP_VAR* vars[NJOBS][NMACHINES];
+
+/** setup: create SCIP and the variables and machine capacities of a scheduling problem */
+static
+void setup(void)
+{
+   SCIP_Longint weights[NJOBS] = {2, 3, 4};
+   int i;
+   int j;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPsetBoolParam(scip, "propagating/symmetry/detectsubsym", TRUE) );
+
+   SCIP_CALL( SCIPcreateProbBasic(scip, "scheduling") );
+
+   for (i = 0; i < NJOBS; ++i)
+   {
+      for (j = 0; j < NMACHINES; ++j)
+      {
+         char name[SCIP_MAXSTRLEN];
+
+         (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x_%d_%d", i, j);
+         SCIP_CALL( SCIPcreateVarBasic(scip, &vars[i][j], name, 0.0, 1.0, 0.0, SCIP_VARTYPE_BINARY) );
+         SCIP_CALL( SCIPaddVar(scip, vars[i][j]) );
+      }
+   }
+
+   /* every machine has the same capacity */
+   for (j = 0; j < NMACHINES; ++j)
+   {
+      SCIP_VAR* machinevars[NJOBS];
+      SCIP_CONS* cons;
+      char name[SCIP_MAXSTRLEN];
+
+      for (i = 0; i < NJOBS; ++i)
+         machinevars[i] = vars[i][j];
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "capacity_%d", j);
+      SCIP_CALL( SCIPcreateConsBasicKnapsack(scip, &cons, name, NJOBS, machinevars, weights, 6) );
+      SCIP_CALL( SCIPaddCons(scip, cons) );
+      SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+   }
+}
+
+/** teardown: free SCIP */
+static
+void teardown(void)
+{
+   int i;
+   int j;
+
+   for (i = 0; i < NJOBS; ++i)
+   {
+      for (j = 0; j < NMACHINES; ++j)
+      {
+         SCIP_CALL( SCIPreleaseVar(scip, &vars[i][j]) );
+      }
+   }
+
+   SCIP_CALL( SCIPfree(&scip) );
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "Memory leak!");
+}
+
+/** adds the constraint lhs <= sum_j coef * x_ij <= rhs for a job i */
+static
+void addJobCons(
+   int                   job,                /**< index of the job */
+   SCIP_Real             coef,               /**< coefficient of the variables of the job */
+   SCIP_Real             lhs,                /**< left-hand side */
+   SCIP_Real             rhs                 /**< right-hand side */
+   )
+{
+   SCIP_Real vals[NMACHINES];
+   SCIP_CONS* cons;
+   char name[SCIP_MAXSTRLEN];
+   int j;
+
+   for (j = 0; j < NMACHINES; ++j)
+      vals[j] = coef;
+
+   (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "job_%d", job);
+   SCIP_CALL( SCIPcreateConsBasicLinear(scip, &cons, name, NMACHINES, vars[job], vals, lhs, rhs) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+}
+
+/** detects the sub-symmetry structure of the orbitope on the transformed variable matrix */
+static
+SUBSYMTYPE detectStructure(void)
+{
+   SCIP_VAR* transvars[NJOBS][NMACHINES];
+   SCIP_VAR** matrix[NJOBS];
+   SUBSYMDATA subsymdata;
+   SUBSYMTYPE type;
+   int i;
+   int j;
+
+   SCIP_CALL( SCIPtransformProb(scip) );
+
+   for (i = 0; i < NJOBS; ++i)
+   {
+      for (j = 0; j < NMACHINES; ++j)
+      {
+         SCIP_CALL( SCIPgetTransformedVar(scip, vars[i][j], &transvars[i][j]) );
+      }
+      matrix[i] = transvars[i];
+   }
+
+   SCIP_CALL( detectSubsymmetryStructure(scip, SCIPpropGetData(SCIPfindProp(scip, "symmetry")), matrix, NJOBS,
+         NMACHINES, &subsymdata) );
+
+   type = subsymdata.type;
+   if ( type == SUBSYMTYPE_MAKESPAN )
+   {
+      cr_expect_eq(subsymdata.weights[0], 2);
+      cr_expect_eq(subsymdata.weights[1], 3);
+      cr_expect_eq(subsymdata.weights[2], 4);
+   }
+   freeSubsymData(scip, &subsymdata);
+
+   return type;
+}
+
+/* TEST SUITE */
+TestSuite(test_subsym_symmetry, .init = setup, .fini = teardown);
+
+Test(test_subsym_symmetry, partitioning, .description = "a makespan structure is detected if every job is assigned to one machine")
+{
+   int i;
+
+   for (i = 0; i < NJOBS; ++i)
+      addJobCons(i, 1.0, 1.0, 1.0);
+
+   cr_expect_eq(detectStructure(), SUBSYMTYPE_MAKESPAN);
+}
+
+Test(test_subsym_symmetry, packing, .description = "scaled and negated set packing rows are recognized")
+{
+   addJobCons(0, 2.0, -SCIPinfinity(scip), 2.0);
+   addJobCons(1, -1.0, -1.0, SCIPinfinity(scip));
+   addJobCons(2, 1.0, 0.0, 1.0);
+
+   cr_expect_eq(detectStructure(), SUBSYMTYPE_MAKESPAN);
+}
+
+Test(test_subsym_symmetry, nopacking, .description = "no structure is detected if a job can be assigned to several machines")
+{
+   addJobCons(0, 1.0, 1.0, 1.0);
+   addJobCons(1, 1.0, 1.0, 1.0);
+   addJobCons(2, 1.0, 1.0, 2.0);
+
+   cr_expect_eq(detectStructure(), SUBSYMTYPE_NONE);
+}
+
+Test(test_subsym_symmetry, norowcons, .description = "no structure is detected if a job has no row constraint")
+{
+   addJobCons(0, 1.0, 1.0, 1.0);
+   addJobCons(1, 1.0, 1.0, 1.0);
+
+   cr_expect_eq(detectStructure(), SUBSYMTYPE_NONE);
+}
+
+Test(test_subsym_symmetry, includetwice, .description = "the activation handlers can be included again after the default plugins")
+{
+   SCIP_ACTIVATIONHDLR* activationhdlr;
+
+   activationhdlr = SCIPfindActivationhdlr(scip, "suborbitope");
+   cr_assert_not_null(activationhdlr);
+
+   cr_assert_eq(SCIPincludeActivationSuborbitope(scip), SCIP_OKAY);
+   cr_assert_eq(SCIPincludeActivationMakespan(scip), SCIP_OKAY);
+   cr_assert_eq(SCIPincludeActivationColorComp(scip), SCIP_OKAY);
+   cr_assert_eq(SCIPincludeActivationVarFix(scip), SCIP_OKAY);
+
+   cr_expect_eq(SCIPfindActivationhdlr(scip, "suborbitope"), activationhdlr);
+}
@@ -0,0 +1,204 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2021 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   support.c
+ * @brief  unit tests for the sparse support of permutations
+ */
+
+#include <scip/scip.h>
+#include <scip/symmetry.h>
+#include <include/scip_test.h>
+
+/* global SCIP instance */
+static SCIP* scip;
+
+/** setup: create SCIP */
+static
+void setup(void)
+{
+   SCIP_CALL( SCIPcreate(&scip) );
+}
+
+/** teardown: free SCIP */
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPfree(&scip) );
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "Memory leak!");
+}
+
+/* TEST SUITE */
+TestSuite(test_support_symmetry, .init = setup, .fini = teardown);
+
+Test(test_support_symmetry, support, .description = "sparse transposed permutations contain exactly the moved variables")
+{
+   int perm0[5] = {1, 0, 2, 3, 4};
+   int perm1[5] = {0, 1, 3, 4, 2};
+   int* perms[2] = {perm0, perm1};
+   int expbegins[6] = {0, 1, 2, 3, 4, 5};
+   int expperms[5] = {0, 0, 1, 1, 1};
+   int expimages[5] = {1, 0, 3, 4, 2};
+   int* supportbegins;
+   int* supportperms;
+   int* supportimages;
+   int nsupport;
+   int i;
+
+   SCIP_CALL( SCIPcomputeSupportSym(scip, perms, 2, 5, NULL, &supportbegins, &supportperms, &supportimages, &nsupport) );
+
+   cr_assert_eq(nsupport, 5);
+   for (i = 0; i <= 5; ++i)
+      cr_expect_eq(supportbegins[i], expbegins[i], "supportbegins[%d]: expected %d, but got %d\n", i, expbegins[i], supportbegins[i]);
+   for (i = 0; i < nsupport; ++i)
+   {
+      cr_expect_eq(supportperms[i], expperms[i], "supportperms[%d]: expected %d, but got %d\n", i, expperms[i], supportperms[i]);
+      cr_expect_eq(supportimages[i], expimages[i], "supportimages[%d]: expected %d, but got %d\n", i, expimages[i], supportimages[i]);
+   }
+
+   SCIPfreeBlockMemoryArray(scip, &supportimages, MAX(nsupport, 1));
+   SCIPfreeBlockMemoryArray(scip, &supportperms, MAX(nsupport, 1));
+   SCIPfreeBlockMemoryArray(scip, &supportbegins, 6);
+}
+
+Test(test_support_symmetry, ignorevars, .description = "images of ignored variables are not stored")
+{
+   int perm0[4] = {1, 0, 3, 2};
+   int* perms[1] = {perm0};
+   SCIP_Shortbool ignorevars[4] = {FALSE, FALSE, TRUE, TRUE};
+   int* supportbegins;
+   int* supportperms;
+   int* supportimages;
+   int nsupport;
+
+   SCIP_CALL( SCIPcomputeSupportSym(scip, perms, 1, 4, ignorevars, &supportbegins, &supportperms, &supportimages, &nsupport) );
+
+   cr_assert_eq(nsupport, 2);
+   cr_expect_eq(supportbegins[2], 2);
+   cr_expect_eq(supportbegins[4], 2);
+   cr_expect_eq(supportimages[0], 1);
+   cr_expect_eq(supportimages[1], 0);
+
+   SCIPfreeBlockMemoryArray(scip, &supportimages, MAX(nsupport, 1));
+   SCIPfreeBlockMemoryArray(scip, &supportperms, MAX(nsupport, 1));
+   SCIPfreeBlockMemoryArray(scip, &supportbegins, 5);
+}
+
+Test(test_support_symmetry, orbits, .description = "orbits computed from the support agree with orbits of the dense permutations")
+{
+   int perm0[6] = {1, 0, 2, 3, 4, 5};
+   int perm1[6] = {0, 2, 1, 3, 4, 5};
+   int perm2[6] = {0, 1, 2, 3, 5, 4};
+   int* perms[3] = {perm0, perm1, perm2};
+   SCIP_VAR* permvars[6] = {NULL, NULL, NULL, NULL, NULL, NULL};
+   SCIP_Shortbool inactiveperms[3] = {FALSE, TRUE, FALSE};
+   int* supportbegins;
+   int* supportperms;
+   int* supportimages;
+   int nsupport;
+   int orbits[6];
+   int orbitbegins[6];
+   int norbits;
+   int denseorbits[6];
+   int denseorbitbegins[6];
+   int ndenseorbits;
+   int i;
+
+   SCIP_CALL( SCIPcomputeSupportSym(scip, perms, 3, 6, NULL, &supportbegins, &supportperms, &supportimages, &nsupport) );
+   cr_assert_eq(nsupport, 6);
+
+   /* all permutations: orbits {0, 1, 2} and {4, 5} */
+   SCIP_CALL( SCIPcomputeOrbitsSym(scip, permvars, 6, perms, 3, denseorbits, denseorbitbegins, &ndenseorbits) );
+   SCIP_CALL( SCIPcomputeOrbitsSupportSym(scip, 6, supportbegins, supportperms, supportimages, NULL, orbits,
+         orbitbegins, &norbits) );
+
+   cr_assert_eq(ndenseorbits, 2);
+   cr_assert_eq(norbits, ndenseorbits);
+   for (i = 0; i <= norbits; ++i)
+      cr_expect_eq(orbitbegins[i], denseorbitbegins[i], "orbitbegins[%d]: expected %d, but got %d\n", i, denseorbitbegins[i], orbitbegins[i]);
+   for (i = 0; i < orbitbegins[norbits]; ++i)
+      cr_expect_eq(orbits[i], denseorbits[i], "orbits[%d]: expected %d, but got %d\n", i, denseorbits[i], orbits[i]);
+
+   /* without the second permutation: orbits {0, 1} and {4, 5} */
+   SCIP_CALL( SCIPcomputeOrbitsSupportSym(scip, 6, supportbegins, supportperms, supportimages, inactiveperms, orbits,
+         orbitbegins, &norbits) );
+
+   cr_assert_eq(norbits, 2);
+   cr_expect_eq(orbitbegins[1], 2);
+   cr_expect_eq(orbitbegins[2], 4);
+   cr_expect_eq(orbits[0], 0);
+   cr_expect_eq(orbits[1], 1);
+   cr_expect_eq(orbits[2], 4);
+   cr_expect_eq(orbits[3], 5);
+
+   SCIPfreeBlockMemoryArray(scip, &supportimages, MAX(nsupport, 1));
+   SCIPfreeBlockMemoryArray(scip, &supportperms, MAX(nsupport, 1));
+   SCIPfreeBlockMemoryArray(scip, &supportbegins, 7);
+}
+
+Test(test_support_symmetry, components, .description = "components computed from the support agree with components of the dense permutations")
+{
+   int perm0[6] = {0, 1, 2, 3, 5, 4};
+   int perm1[6] = {1, 0, 2, 3, 4, 5};
+   int perm2[6] = {0, 2, 1, 3, 4, 5};
+   int* perms[3] = {perm0, perm1, perm2};
+   SCIP_VAR* permvars[6] = {NULL, NULL, NULL, NULL, NULL, NULL};
+   int* supportbegins;
+   int* supportperms;
+   int* supportimages;
+   int nsupport;
+   int* components;
+   int* componentbegins;
+   int* vartocomponent;
+   unsigned* componentblocked;
+   int ncomponents;
+   int* densecomponents;
+   int* densecomponentbegins;
+   int* densevartocomponent;
+   unsigned* densecomponentblocked;
+   int ndensecomponents;
+   int i;
+
+   SCIP_CALL( SCIPcomputeSupportSym(scip, perms, 3, 6, NULL, &supportbegins, &supportperms, &supportimages, &nsupport) );
+
+   SCIP_CALL( SCIPcomputeComponentsSym(scip, perms, 3, permvars, 6, FALSE, &densecomponents, &densecomponentbegins,
+         &densevartocomponent, &densecomponentblocked, &ndensecomponents) );
+   SCIP_CALL( SCIPcomputeComponentsSupportSym(scip, supportbegins, supportperms, supportimages, 3, 6, &components,
+         &componentbegins, &vartocomponent, &componentblocked, &ncomponents) );
+
+   /* the first permutation forms a component of its own, the other two share variable 1 */
+   cr_assert_eq(ndensecomponents, 2);
+   cr_assert_eq(ncomponents, ndensecomponents);
+   for (i = 0; i <= ncomponents; ++i)
+      cr_expect_eq(componentbegins[i], densecomponentbegins[i], "componentbegins[%d]: expected %d, but got %d\n", i, densecomponentbegins[i], componentbegins[i]);
+   for (i = 0; i < 3; ++i)
+      cr_expect_eq(components[i], densecomponents[i], "components[%d]: expected %d, but got %d\n", i, densecomponents[i], components[i]);
+   for (i = 0; i < 6; ++i)
+      cr_expect_eq(vartocomponent[i], densevartocomponent[i], "vartocomponent[%d]: expected %d, but got %d\n", i, densevartocomponent[i], vartocomponent[i]);
+   cr_expect_eq(vartocomponent[3], -1);
+   cr_expect_eq(vartocomponent[0], vartocomponent[2]);
+   cr_expect_neq(vartocomponent[0], vartocomponent[4]);
+
+   SCIPfreeBlockMemoryArray(scip, &densecomponentblocked, ndensecomponents);
+   SCIPfreeBlockMemoryArray(scip, &densevartocomponent, 6);
+   SCIPfreeBlockMemoryArray(scip, &densecomponentbegins, ndensecomponents + 1);
+   SCIPfreeBlockMemoryArray(scip, &densecomponents, 3);
+   SCIPfreeBlockMemoryArray(scip, &componentblocked, ncomponents);
+   SCIPfreeBlockMemoryArray(scip, &vartocomponent, 6);
+   SCIPfreeBlockMemoryArray(scip, &componentbegins, ncomponents + 1);
+   SCIPfreeBlockMemoryArray(scip, &components, 3);
+   SCIPfreeBlockMemoryArray(scip, &supportimages, MAX(nsupport, 1));
+   SCIPfreeBlockMemoryArray(scip, &supportperms, MAX(nsupport, 1));
+   SCIPfreeBlockMemoryArray(scip, &supportbegins, 7);
+}